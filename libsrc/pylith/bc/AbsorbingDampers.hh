@@ -112,6 +112,13 @@ public :
 			       const PylithScalar t,
 			       topology::SolutionFields* const fields);
 
+  /** Check whether integrator can apply its contribution to the
+   * Jacobian without assembling a sparse matrix.
+   *
+   * @returns False; damping terms are only applied to assembled Jacobian.
+   */
+  bool hasJacobianAction(void) const;
+
   /** Integrate contributions to Jacobian matrix (A) associated with
    * operator.
    *
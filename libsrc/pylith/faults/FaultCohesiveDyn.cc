@@ -66,10 +66,15 @@ pylith::faults::FaultCohesiveDyn::FaultCohesiveDyn(void) :
     _zeroToleranceNormal(1.0e-10),
     _tractPerturbation(0),
     _friction(0),
-    _jacobian(0),
-    _ksp(0),
+    _complianceState(-1),
+    _sensitivityLocal(false),
     _openFreeSurf(true)
 { // constructor
+    for (int iSide=0; iSide < 2; ++iSide) {
+        _jacobian[iSide] = 0;
+        _ksp[iSide] = 0;
+        _jacobianState[iSide] = -1;
+    } // for
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -90,8 +95,13 @@ void pylith::faults::FaultCohesiveDyn::deallocate(void)
     _tractPerturbation = 0; // :TODO: Use shared pointer
     _friction = 0; // :TODO: Use shared pointer
 
-    delete _jacobian; _jacobian = 0;
-    PetscErrorCode err = KSPDestroy(&_ksp); PYLITH_CHECK_ERROR(err);
+    for (int iSide=0; iSide < 2; ++iSide) {
+        delete _jacobian[iSide]; _jacobian[iSide] = 0;
+        PetscErrorCode err = KSPDestroy(&_ksp[iSide]); PYLITH_CHECK_ERROR(err);
+        _jacobianState[iSide] = -1;
+    } // for
+    _compliance.resize(0);
+    _complianceState = -1;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -151,6 +161,33 @@ pylith::faults::FaultCohesiveDyn::openFreeSurf(const bool value)
     _openFreeSurf = value;
 } // openFreeSurf
 
+// ----------------------------------------------------------------------
+// Set method used to compute the change in slip associated with a
+// change in the Lagrange multipliers.
+void
+pylith::faults::FaultCohesiveDyn::sensitivityMode(const char* value)
+{ // sensitivityMode
+    assert(value);
+    const std::string name(value);
+    if (name != "global" && name != "local") {
+        std::ostringstream msg;
+        msg << "Unknown sensitivity mode '" << name << "' for fault " << label() << ". "
+            << "Options are 'global' and 'local'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _sensitivityLocal = ("local" == name);
+} // sensitivityMode
+
+// ----------------------------------------------------------------------
+// Get method used to compute the change in slip associated with a
+// change in the Lagrange multipliers.
+const char*
+pylith::faults::FaultCohesiveDyn::sensitivityMode(void) const
+{ // sensitivityMode
+    return (_sensitivityLocal) ? "local" : "global";
+} // sensitivityMode
+
 // ----------------------------------------------------------------------
 // Initialize fault. Determine orientation and setup boundary
 void
@@ -218,7 +255,6 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
     const int computeEvent = _logger->eventId("FaIR compute");
 #if defined(DETAILED_EVENT_LOGGING)
     const int geometryEvent = _logger->eventId("FaIR geometry");
-    const int restrictEvent = _logger->eventId("FaIR restrict");
     const int updateEvent = _logger->eventId("FaIR update");
 #endif
 
@@ -227,9 +263,6 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
     // Get cell geometry information that doesn't depend on cell
     const int spaceDim = _quadrature->spaceDim();
 
-    // Get sections associated with cohesive cells
-    PetscSection residualGlobalSection = residual.globalSection(); assert(residualGlobalSection);
-
     topology::VecVisitorMesh residualVisitor(residual);
     PetscScalar* residualArray = residualVisitor.localArray();
 
@@ -268,29 +301,17 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
 #endif
 
     // Loop over fault vertices
-    PetscErrorCode err = 0;
+    const CohesiveOffsets& offsets = _cohesiveOffsets(residual);
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
 
-        // Skip clamped vertices
-        if (e_lagrange < 0) {
+        // Compute contribution only if Lagrange constraint is local
+        // (clamped vertices are also flagged as not local).
+        if (offsets.lagrangeGlobal[iVertex] < 0) {
             continue;
         } // if
 
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff = 0;
-        err = PetscSectionGetOffset(residualGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0)
-            continue;
-
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
-
         // Get prescribed traction perturbation at fault vertex.
         if (_tractPerturbation) {
             const PetscInt toff = tractionsVisitor->sectionOffset(v_fault);
@@ -302,36 +323,16 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
             tractPerturbVertex = 0.0;
         } // if/else
 
-        // Get orientation associated with fault vertex.
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+        // Offsets are the same for residual, disp(t), and dispIncr(t->t+dt).
+        const PetscInt ooff = offsets.faultOrientation[iVertex];
+        const PetscInt aoff = offsets.faultScalar[iVertex];
+        const PetscInt noff = offsets.negative[iVertex];
+        const PetscInt poff = offsets.positive[iVertex];
+        const PetscInt loff = offsets.lagrange[iVertex];
         assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
-
-        // Get area associated with fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
-
-        // Get disp(t) at conventional vertices and Lagrange vertex.
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get dispIncr(t->t+dt) at conventional vertices and Lagrange vertex.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
+        assert(spaceDim == residualVisitor.sectionDof(_cohesiveVertices[iVertex].lagrange));
 
 #if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
         _logger->eventBegin(computeEvent);
 #endif
 
@@ -340,8 +341,8 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
         PylithScalar tractionNormal = 0.0;
         const PetscInt indexN = spaceDim - 1;
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            slipNormal += orientationArray[ooff+indexN*spaceDim+d] * (dispTArray[dtpoff+d] + dispTIncrArray[dipoff+d] - dispTArray[dtnoff+d] - dispTIncrArray[dinoff+d]);
-            tractionNormal += orientationArray[ooff+indexN*spaceDim+d] * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d]);
+            slipNormal += orientationArray[ooff+indexN*spaceDim+d] * (dispTArray[poff+d] + dispTIncrArray[poff+d] - dispTArray[noff+d] - dispTIncrArray[noff+d]);
+            tractionNormal += orientationArray[ooff+indexN*spaceDim+d] * (dispTArray[loff+d] + dispTIncrArray[loff+d]);
         } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -351,16 +352,10 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
         if (slipNormal < _zeroToleranceNormal || !_openFreeSurf) {
             // if no opening or flag indicates to still impose initial tractions when fault is open.
             // Assemble contributions into field
-            const PetscInt rnoff = residualVisitor.sectionOffset(v_negative);
-            assert(spaceDim == residualVisitor.sectionDof(v_negative));
-
-            const PetscInt rpoff = residualVisitor.sectionOffset(v_positive);
-            assert(spaceDim == residualVisitor.sectionDof(v_positive));
-
             // Initial (external) tractions oppose (internal) tractions associated with Lagrange multiplier.
             for(PetscInt d = 0; d < spaceDim; ++d) {
-                residualArray[rnoff+d] +=  areaArray[aoff] * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d] - tractPerturbVertex[d]);
-                residualArray[rpoff+d] += -areaArray[aoff] * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d] - tractPerturbVertex[d]);
+                residualArray[noff+d] +=  areaArray[aoff] * (dispTArray[loff+d] + dispTIncrArray[loff+d] - tractPerturbVertex[d]);
+                residualArray[poff+d] += -areaArray[aoff] * (dispTArray[loff+d] + dispTIncrArray[loff+d] - tractPerturbVertex[d]);
             } // for
         } else { // opening, normal traction should be zero
             std::ostringstream msg;
@@ -429,7 +424,14 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
     topology::VecVisitorMesh orientationVisitor(orientation);
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
+    // Gather slip, slip rate, and normal traction for all vertices and
+    // then update the friction state variables for all of them at once.
     const int numVertices = _cohesiveVertices.size();
+    scalar_array slipMagVertices(numVertices);
+    scalar_array slipRateMagVertices(numVertices);
+    scalar_array tractionNormalVertices(numVertices);
+    std::vector<int> verticesFault(numVertices);
+    int numVerticesUpdate = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -471,42 +473,40 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
             } // for
         } // for
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
-
-        // Use fault constitutive model to compute traction associated with
-        // friction.
         switch (spaceDim) { // switch
         case 1: { // case 1
-            const PylithScalar slipMag = 0.0;
-            const PylithScalar slipRateMag = 0.0;
-            const PylithScalar tractionNormal = tractionTpdtVertex[0];
-            _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            slipMagVertices[numVerticesUpdate] = 0.0;
+            slipRateMagVertices[numVerticesUpdate] = 0.0;
+            tractionNormalVertices[numVerticesUpdate] = tractionTpdtVertex[0];
             break;
         } // case 1
         case 2: { // case 2
-            const PylithScalar slipMag = fabs(slipVertex[0]);
-            const PylithScalar slipRateMag = fabs(slipRateVertex[0]);
-            const PylithScalar tractionNormal = tractionTpdtVertex[1];
-            _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            slipMagVertices[numVerticesUpdate] = fabs(slipVertex[0]);
+            slipRateMagVertices[numVerticesUpdate] = fabs(slipRateVertex[0]);
+            tractionNormalVertices[numVerticesUpdate] = tractionTpdtVertex[1];
             break;
         } // case 2
         case 3: { // case 3
-            const PylithScalar slipMag =
+            slipMagVertices[numVerticesUpdate] =
                 sqrt(slipVertex[0]*slipVertex[0] + slipVertex[1]*slipVertex[1]);
-            const PylithScalar slipRateMag =
+            slipRateMagVertices[numVerticesUpdate] =
                 sqrt(slipRateVertex[0]*slipRateVertex[0] +
                      slipRateVertex[1]*slipRateVertex[1]);
-            const PylithScalar tractionNormal = tractionTpdtVertex[2];
-            _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            tractionNormalVertices[numVerticesUpdate] = tractionTpdtVertex[2];
             break;
         } // case 3
         default:
             assert(0);
             throw std::logic_error("Unknown spatial dimension in FaultCohesiveDyn::updateStateVars().");
         } // switch
+        verticesFault[numVerticesUpdate++] = v_fault;
     } // for
 
+    // Use fault constitutive model to update state variables.
+    if (numVerticesUpdate > 0) {
+        _friction->updateStateVars(t, &slipMagVertices[0], &slipRateMagVertices[0], &tractionNormalVertices[0], &verticesFault[0], numVerticesUpdate);
+    } // if
+
     PYLITH_METHOD_END;
 } // updateStateVars
 
@@ -527,7 +527,8 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
         const scalar_array&,
         const scalar_array&,
         const PylithScalar,
-        const bool);
+        const bool,
+        const PylithScalar*);
 
     assert(fields);
     assert(_quadrature);
@@ -535,6 +536,9 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     assert(_friction);
 
     _sensitivitySetup(jacobian);
+    if (_sensitivityLocal) {
+        _sensitivityUpdateCompliance(jacobian, *fields);
+    } // if
 
     // Update time step in friction (can vary).
     _friction->timeStep(_dt);
@@ -563,8 +567,6 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     topology::VecVisitorMesh dispTIncrVisitor(fields->get("dispIncr(t->t+dt)"));
     const PetscScalar* dispTIncrArray = dispTIncrVisitor.localArray();
 
-    PetscSection dispTIncrGlobalSection = fields->get("dispIncr(t->t+dt)").globalSection(); assert(dispTIncrGlobalSection);
-
     topology::VecVisitorMesh dispTIncrAdjVisitor(fields->get("dispIncr adjust"));
     PetscScalar* dispTIncrAdjArray = dispTIncrAdjVisitor.localArray();
 
@@ -593,40 +595,35 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
                                "FaultCohesiveDyn::constrainSolnSpace().");
     } // switch
 
+    // Offsets are the same for disp(t), dispIncr(t->t+dt), and dispIncr
+    // adjust over the domain and for the vector fields over the fault.
+    const CohesiveOffsets& offsets = _cohesiveOffsets(fields->get("dispIncr(t->t+dt)"));
     const int numVertices = _cohesiveVertices.size();
+
+    // Slip, slip rate, and traction in the fault coordinate system and
+    // adjustment to normal traction from Step 1 for the vertices that
+    // are not clamped. We gather these first so that friction can be
+    // computed for all of the vertices at once.
+    scalar_array slipVertices(numVertices*spaceDim);
+    scalar_array slipRateVertices(numVertices*spaceDim);
+    scalar_array tractionTpdtVertices(numVertices*spaceDim);
+    scalar_array dTractionTpdtNormalVertices(numVertices);
+    std::vector<int> indicesFriction(numVertices);
+    std::vector<int> verticesFriction(numVertices);
+    int numVerticesFriction = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
 
         // Skip clamped vertices
-        if (e_lagrange < 0) {
+        const PetscInt loff = offsets.lagrange[iVertex];
+        if (loff < 0) {
             continue;
         } // if
 
-        // Get displacement values
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get displacement increment values.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
-        // Get orientation
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+        const PetscInt noff = offsets.negative[iVertex];
+        const PetscInt poff = offsets.positive[iVertex];
+        const PetscInt ooff = offsets.faultOrientation[iVertex];
+        assert(spaceDim == dispTIncrVisitor.sectionDof(_cohesiveVertices[iVertex].lagrange));
         assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
 
         // Step 1: Prevent nonphysical trial solutions. The product of the
@@ -640,9 +637,9 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
         tractionTpdtVertex = 0.0;
         for(PetscInt d = 0; d < spaceDim; ++d) {
             for(PetscInt e = 0; e < spaceDim; ++e) {
-                slipTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[dtpoff+e] + dispTIncrArray[dipoff+e] - dispTArray[dtnoff+e] - dispTIncrArray[dinoff+e]);
-                slipRateVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTIncrArray[dipoff+e] - dispTIncrArray[dinoff+e]) / dt;
-                tractionTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[dtloff+e] + dispTIncrArray[diloff+e]);
+                slipTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[poff+e] + dispTIncrArray[poff+e] - dispTArray[noff+e] - dispTIncrArray[noff+e]);
+                slipRateVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTIncrArray[poff+e] - dispTIncrArray[noff+e]) / dt;
+                tractionTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[loff+e] + dispTIncrArray[loff+e]);
             } // for
 #if !defined(DISABLE_SLIPRATE_TOLERANCE) // 2017-06-23  Is this really necessary?
             if (fabs(slipRateVertex[d]) < _zeroTolerance / dt) {
@@ -686,19 +683,69 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
             slipTpdtVertex[indexN] = 0.0;
         } // if
 
-        // Step 2: Apply friction criterion to trial solution to get
-        // change in Lagrange multiplier (dTractionTpdtVertex) in fault
-        // coordinate system.
+        const int iFriction = numVerticesFriction++;
+        for (int d=0; d < spaceDim; ++d) {
+            slipVertices[iFriction*spaceDim+d] = slipTpdtVertex[d];
+            slipRateVertices[iFriction*spaceDim+d] = slipRateVertex[d];
+            tractionTpdtVertices[iFriction*spaceDim+d] = tractionTpdtVertex[d];
+        } // for
+        dTractionTpdtNormalVertices[iFriction] = dTractionTpdtVertexNormal;
+        indicesFriction[iFriction] = iVertex;
+        verticesFriction[iFriction] = v_fault;
+    } // for
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
+    // Step 2: Apply friction criterion to trial solution to get
+    // change in Lagrange multiplier (dTractionTpdtVertex) in fault
+    // coordinate system.
+
+    // Use fault constitutive model to compute friction for all of the
+    // vertices.
+    scalar_array frictionVertices(numVerticesFriction);
+    _calcFrictionBatch(&frictionVertices, t, slipVertices, slipRateVertices, tractionTpdtVertices,
+                       verticesFriction, numVerticesFriction);
+
+    for (int iFriction=0; iFriction < numVerticesFriction; ++iFriction) {
+        const int iVertex = indicesFriction[iFriction];
+        const PetscInt ooff = offsets.faultOrientation[iVertex];
+
+        for (int d=0; d < spaceDim; ++d) {
+            slipTpdtVertex[d] = slipVertices[iFriction*spaceDim+d];
+            slipRateVertex[d] = slipRateVertices[iFriction*spaceDim+d];
+            tractionTpdtVertex[d] = tractionTpdtVertices[iFriction*spaceDim+d];
+        } // for
+        const PylithScalar dTractionTpdtVertexNormal = dTractionTpdtNormalVertices[iFriction];
+
+        // With the local sensitivity approximation, the shear stiffness
+        // of the vertex lets the friction criterion iterate on the
+        // change in slip as in adjustSolnLumped().
+        PylithScalar jacobianShearVertex = 0.0;
+        if (_sensitivityLocal) {
+            const PylithScalar* complianceVertex = &_compliance[iVertex*spaceDim*spaceDim];
+            PylithScalar complianceShear = 0.0;
+            for (int iDim=0; iDim < indexN; ++iDim) {
+                for (int jDim=0; jDim < spaceDim; ++jDim) {
+                    for (int kDim=0; kDim < spaceDim; ++kDim) {
+                        complianceShear += orientationArray[ooff+iDim*spaceDim+jDim] * complianceVertex[jDim*spaceDim+kDim] * orientationArray[ooff+iDim*spaceDim+kDim];
+                    } // for
+                } // for
+            } // for
+            if (indexN > 0 && complianceShear > 0.0) {
+                jacobianShearVertex = -indexN / complianceShear;
+            } // if
+        } // if
+
+        // The Newton update uses the friction model for a single
+        // vertex, so it needs the properties and state variables of
+        // this vertex.
+        if (0.0 != jacobianShearVertex) {
+            _friction->retrievePropsStateVars(verticesFriction[iFriction]);
+        } // if
 
         // Use fault constitutive model to compute traction associated with
         // friction.
         dTractionTpdtVertex = 0.0;
-        const PylithScalar jacobianShearVertex = 0.0;
         const bool iterating = true; // Iterating to get friction
-        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, slipTpdtVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex, iterating);
+        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, slipTpdtVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex, iterating, &frictionVertices[iFriction]);
 
         // Rotate increment in traction back to global coordinate system.
         dLagrangeTpdtVertex = 0.0;
@@ -715,7 +762,7 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
         } // for
 
 #if 0 // debugging
-        std::cout << "v_fault: " << v_fault;
+        std::cout << "v_fault: " << verticesFriction[iFriction];
         std::cout << ", slipVertex: ";
         for (int iDim=0; iDim < spaceDim; ++iDim)
             std::cout << "  " << slipTpdtVertex[iDim];
@@ -732,8 +779,8 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
 #endif
 
         // Set change in Lagrange multiplier
-        const PetscInt soff = dLagrangeVisitor.sectionOffset(v_fault);
-        assert(spaceDim == dLagrangeVisitor.sectionDof(v_fault));
+        const PetscInt soff = offsets.faultVector[iVertex];
+        assert(spaceDim == dLagrangeVisitor.sectionDof(verticesFriction[iFriction]));
         for(PetscInt d = 0; d < spaceDim; ++d) {
             dLagrangeArray[soff+d] = dLagrangeTpdtVertex[d];
         } // for
@@ -745,19 +792,24 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     // Step 3: Calculate change in displacement field corresponding to
     // change in Lagrange multipliers imposed by friction criterion.
 
-    // Solve sensitivity problem for negative side of the fault.
-    bool negativeSideFlag = true;
-    _sensitivityUpdateJacobian(negativeSideFlag, jacobian, *fields);
-    _sensitivityReformResidual(negativeSideFlag);
-    _sensitivitySolve();
-    _sensitivityUpdateSoln(negativeSideFlag);
-
-    // Solve sensitivity problem for positive side of the fault.
-    negativeSideFlag = false;
-    _sensitivityUpdateJacobian(negativeSideFlag, jacobian, *fields);
-    _sensitivityReformResidual(negativeSideFlag);
-    _sensitivitySolve();
-    _sensitivityUpdateSoln(negativeSideFlag);
+    if (_sensitivityLocal) {
+        // Use compliance of each vertex.
+        _sensitivityUpdateSolnLocal();
+    } else {
+        // Solve sensitivity problem for negative side of the fault.
+        bool negativeSideFlag = true;
+        _sensitivityUpdateJacobian(negativeSideFlag, jacobian, *fields);
+        _sensitivityReformResidual(negativeSideFlag);
+        _sensitivitySolve(negativeSideFlag);
+        _sensitivityUpdateSoln(negativeSideFlag);
+
+        // Solve sensitivity problem for positive side of the fault.
+        negativeSideFlag = false;
+        _sensitivityUpdateJacobian(negativeSideFlag, jacobian, *fields);
+        _sensitivityReformResidual(negativeSideFlag);
+        _sensitivitySolve(negativeSideFlag);
+        _sensitivityUpdateSoln(negativeSideFlag);
+    } // if/else
 
     // Step 4: Update Lagrange multipliers and displacement fields based
     // on changes imposed by friction criterion in Step 2 (change in
@@ -868,52 +920,26 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     dLagrangeVisitor.initialize(_fields->get("sensitivity dLagrange"));
     dLagrangeArray = dLagrangeVisitor.localArray();
 
-    PetscErrorCode err = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
 
         // Skip clamped vertices
-        if (e_lagrange < 0) {
+        const PetscInt loff = offsets.lagrange[iVertex];
+        if (loff < 0) {
             continue;
         } // if
 
-        // Get change in Lagrange multiplier computed from friction criterion.
-        const PetscInt soff = dLagrangeVisitor.sectionOffset(v_fault);
+        // Change in Lagrange multiplier computed from friction criterion
+        // and change in relative displacement from sensitivity solve.
+        const PetscInt soff = offsets.faultVector[iVertex];
         assert(spaceDim == dLagrangeVisitor.sectionDof(v_fault));
-
-        // Get change in relative displacement from sensitivity solve.
-        const PetscInt sroff = sensDispRelVisitor.sectionOffset(v_fault);
         assert(spaceDim == sensDispRelVisitor.sectionDof(v_fault));
 
-        // Get current relative displacement for updating.
-        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
-
-        // Get orientation.
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+        const PetscInt ooff = offsets.faultOrientation[iVertex];
         assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
 
-        // Get displacement.
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get displacement increment (trial solution).
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
+        const PetscInt noff = offsets.negative[iVertex];
+        const PetscInt poff = offsets.positive[iVertex];
 
         // Scale perturbation in relative displacements and change in
         // Lagrange multipliers by alpha using only shear components.
@@ -924,10 +950,10 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
         dTractionTpdtVertex = 0.0;
         for (int iDim=0; iDim < spaceDim; ++iDim) {
             for (int jDim=0; jDim < spaceDim; ++jDim) {
-                slipTVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtpoff+jDim] - dispTArray[dtnoff+jDim]);
-                slipTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtpoff+jDim] - dispTArray[dtnoff+jDim] + dispTIncrArray[dipoff+jDim] - dispTIncrArray[dinoff+jDim]);
-                dSlipTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * alpha*sensDispRelArray[sroff+jDim];
-                tractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtloff+jDim] + dispTIncrArray[diloff+jDim]);
+                slipTVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[poff+jDim] - dispTArray[noff+jDim]);
+                slipTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[poff+jDim] - dispTArray[noff+jDim] + dispTIncrArray[poff+jDim] - dispTIncrArray[noff+jDim]);
+                dSlipTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * alpha*sensDispRelArray[soff+jDim];
+                tractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[loff+jDim] + dispTIncrArray[loff+jDim]);
                 dTractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * alpha*dLagrangeArray[soff+jDim];
             } // for
         } // for
@@ -1014,24 +1040,12 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
 
         // Compute contribution to adjusting solution only if Lagrange
         // constraint is local (the adjustment is assembled across processors).
-        PetscInt goff;
-        err = PetscSectionGetOffset(dispTIncrGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff >= 0) {
-            // Get offsets in displacement increment adjustment.
-            const PetscInt dialoff = dispTIncrAdjVisitor.sectionOffset(e_lagrange);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(e_lagrange));
-
-            const PetscInt dianoff = dispTIncrAdjVisitor.sectionOffset(v_negative);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_negative));
-
-            const PetscInt diapoff = dispTIncrAdjVisitor.sectionOffset(v_positive);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_positive));
-
+        if (offsets.lagrangeGlobal[iVertex] >= 0) {
             // Update Lagrange multiplier increment.
             for(PetscInt d = 0; d < spaceDim; ++d) {
-                dispTIncrAdjArray[dialoff+d] += dLagrangeTpdtVertex[d];
-                dispTIncrAdjArray[dianoff+d] += dDispTIncrVertexN[d];
-                dispTIncrAdjArray[diapoff+d] += dDispTIncrVertexP[d];
+                dispTIncrAdjArray[loff+d] += dLagrangeTpdtVertex[d];
+                dispTIncrAdjArray[noff+d] += dDispTIncrVertexN[d];
+                dispTIncrAdjArray[poff+d] += dDispTIncrVertexP[d];
             } // for
         } // if
     } // for
@@ -1057,7 +1071,8 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         const scalar_array&,
         const scalar_array&,
         const PylithScalar,
-        const bool);
+        const bool,
+        const PylithScalar*);
 
     assert(fields);
     assert(_quadrature);
@@ -1080,7 +1095,6 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     const int computeEvent = _logger->eventId("FaAS compute");
 #if defined(DETAILED_EVENT_LOGGING)
     const int geometryEvent = _logger->eventId("FaAS geometry");
-    const int restrictEvent = _logger->eventId("FaAS restrict");
     const int updateEvent = _logger->eventId("FaAS update");
 #endif
 
@@ -1130,8 +1144,6 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     topology::VecVisitorMesh residualVisitor(fields->get("residual"));
     const PetscScalar* residualArray = residualVisitor.localArray();
 
-    PetscSection solnGlobalSection = fields->get("dispIncr(t->t+dt)").globalSection(); assert(solnGlobalSection);
-
     constrainSolnSpace_fn_type constrainSolnSpaceFn;
     switch (spaceDim) { // switch
     case 1:
@@ -1157,77 +1169,43 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     _logger->eventBegin(computeEvent);
 #endif
 
-    PetscErrorCode err = 0;
+    // Offsets are the same for all fields over the domain and for the
+    // vector fields over the fault.
+    const CohesiveOffsets& offsets = _cohesiveOffsets(fields->get("dispIncr(t->t+dt)"));
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
 
         // Skip clamped vertices
-        if (e_lagrange < 0) {
+        const PetscInt loff = offsets.lagrange[iVertex];
+        if (loff < 0) {
             continue;
         } // if
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
-
-        // Get residual at cohesive cell's vertices.
-        const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == residualVisitor.sectionDof(e_lagrange));
-
-        // Get jacobian at cohesive cell's vertices.
-        const PetscInt jnoff = jacobianVisitor.sectionOffset(v_negative);
-        assert(spaceDim == jacobianVisitor.sectionDof(v_negative));
-
-        const PetscInt jpoff = jacobianVisitor.sectionOffset(v_positive);
-        assert(spaceDim == jacobianVisitor.sectionDof(v_positive));
-
-        // Get disp(t) at Lagrange vertex.
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get dispIncr(t) at cohesive cell's vertices.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
-        // Get relative displacement at fault vertex.
-        const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
-        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
+        const PetscInt noff = offsets.negative[iVertex];
+        const PetscInt poff = offsets.positive[iVertex];
+        const PetscInt droff = offsets.faultVector[iVertex];
+        const PetscInt ooff = offsets.faultOrientation[iVertex];
+        assert(spaceDim == jacobianVisitor.sectionDof(_cohesiveVertices[iVertex].negative));
+        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
 
-        // Get area at fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
-        const PetscScalar areaVertex = areaArray[aoff];
+        const PetscScalar areaVertex = areaArray[offsets.faultScalar[iVertex]];
         assert(areaVertex > 0.0);
 
-        // Get fault orientation at fault vertex.
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
-        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
-
 #if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
         _logger->eventBegin(computeEvent);
 #endif
 
         // Adjust solution as in prescribed rupture, updating the Lagrange
         // multipliers and the corresponding displacment increments.
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            assert(jacobianArray[jpoff+iDim] > 0.0);
-            assert(jacobianArray[jnoff+iDim] > 0.0);
-            const PylithScalar S = (1.0/jacobianArray[jpoff+iDim] + 1.0/jacobianArray[jnoff+iDim]) * areaVertex*areaVertex;
+            assert(jacobianArray[poff+iDim] > 0.0);
+            assert(jacobianArray[noff+iDim] > 0.0);
+            const PylithScalar S = (1.0/jacobianArray[poff+iDim] + 1.0/jacobianArray[noff+iDim]) * areaVertex*areaVertex;
             assert(S > 0.0);
-            lagrangeTIncrVertex[iDim] = 1.0/S * (-residualArray[rloff+iDim] + areaVertex * (dispTIncrArray[dipoff+iDim] - dispTIncrArray[dinoff+iDim]));
-            dispIncrVertexN[iDim] =  areaVertex / jacobianArray[jnoff+iDim]*lagrangeTIncrVertex[iDim];
-            dispIncrVertexP[iDim] = -areaVertex / jacobianArray[jpoff+iDim]*lagrangeTIncrVertex[iDim];
+            lagrangeTIncrVertex[iDim] = 1.0/S * (-residualArray[loff+iDim] + areaVertex * (dispTIncrArray[poff+iDim] - dispTIncrArray[noff+iDim]));
+            dispIncrVertexN[iDim] =  areaVertex / jacobianArray[noff+iDim]*lagrangeTIncrVertex[iDim];
+            dispIncrVertexP[iDim] = -areaVertex / jacobianArray[poff+iDim]*lagrangeTIncrVertex[iDim];
         } // for
 
         // Compute slip, slip rate, and Lagrange multiplier at time t+dt
@@ -1238,12 +1216,12 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         for (int iDim=0; iDim < spaceDim; ++iDim) {
             for (int jDim=0; jDim < spaceDim; ++jDim) {
                 slipVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * dispRelArray[droff+jDim];
-                tractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtloff+jDim] + lagrangeTIncrVertex[jDim]);
+                tractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[loff+jDim] + lagrangeTIncrVertex[jDim]);
             } // for
         } // for
           // Jacobian is diagonal and isotropic, so it is invariant with
           // respect to rotation and contains one unique term.
-        const PylithScalar jacobianShearVertex = -1.0 / (areaVertex * (1.0 / jacobianArray[jnoff+0] + 1.0 / jacobianArray[jpoff+0]));
+        const PylithScalar jacobianShearVertex = -1.0 / (areaVertex * (1.0 / jacobianArray[noff+0] + 1.0 / jacobianArray[poff+0]));
 
         // Get friction properties and state variables.
         _friction->retrievePropsStateVars(v_fault);
@@ -1253,7 +1231,7 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         dTractionTpdtVertex = 0.0;
 
         const bool iterating = false; // No iteration for friction in lumped soln
-        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, slipVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex, iterating);
+        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, slipVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex, iterating, 0);
 
         // Rotate traction back to global coordinate system.
         dLagrangeTpdtVertex = 0.0;
@@ -1299,11 +1277,11 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 
         // Compute change in displacement.
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            assert(jacobianArray[jpoff+iDim] > 0.0);
-            assert(jacobianArray[jnoff+iDim] > 0.0);
+            assert(jacobianArray[poff+iDim] > 0.0);
+            assert(jacobianArray[noff+iDim] > 0.0);
 
-            dispIncrVertexN[iDim] += areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[jnoff+iDim];
-            dispIncrVertexP[iDim] -= areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[jpoff+iDim];
+            dispIncrVertexN[iDim] += areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[noff+iDim];
+            dispIncrVertexP[iDim] -= areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[poff+iDim];
 
             // Update increment in Lagrange multiplier.
             lagrangeTIncrVertex[iDim] += dLagrangeTpdtVertex[iDim];
@@ -1316,21 +1294,13 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 
         // Compute contribution to adjusting solution only if Lagrange
         // constraint is local (the adjustment is assembled across processors).
-        PetscInt goff;
-        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff >= 0) {
-            const PetscInt dianoff = dispTIncrAdjVisitor.sectionOffset(v_negative);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_negative));
-
-            const PetscInt diapoff = dispTIncrAdjVisitor.sectionOffset(v_positive);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_positive));
-
+        if (offsets.lagrangeGlobal[iVertex] >= 0) {
             // Adjust displacements to account for Lagrange multiplier values
             // (assumed to be zero in preliminary solve).
             // Update displacement field
             for(PetscInt d = 0; d < spaceDim; ++d) {
-                dispTIncrAdjArray[dianoff+d] += dispIncrVertexN[d];
-                dispTIncrAdjArray[diapoff+d] += dispIncrVertexP[d];
+                dispTIncrAdjArray[noff+d] += dispIncrVertexN[d];
+                dispTIncrAdjArray[poff+d] += dispIncrVertexP[d];
             } // for
         } // if
 
@@ -1341,7 +1311,7 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         // Set Lagrange multiplier value. Value from preliminary solve is
         // bogus due to artificial diagonal entry in Jacobian of 1.0.
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            dispTIncrArray[diloff+d] = lagrangeTIncrVertex[d];
+            dispTIncrArray[loff+d] = lagrangeTIncrVertex[d];
         } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -1656,36 +1626,47 @@ pylith::faults::FaultCohesiveDyn::_sensitivitySetup(const topology::Jacobian& ja
     topology::Field& dLagrange = _fields->get("sensitivity dLagrange");
     dLagrange.zeroAll();
 
-    // Setup Jacobian sparse matrix for sensitivity solve.
-    if (!_jacobian) {
-        _jacobian = new topology::Jacobian(solution, jacobian.matrixType());
-    } // if
-    assert(_jacobian);
-    _jacobian->zero();
-
-    // Setup PETSc KSP linear solver.
-    if (!_ksp) {
-        PetscErrorCode err = 0;
-        err = KSPCreate(_faultMesh->comm(), &_ksp); PYLITH_CHECK_ERROR(err);
-        err = KSPSetInitialGuessNonzero(_ksp, PETSC_FALSE); PYLITH_CHECK_ERROR(err);
-        PylithScalar rtol = 0.0;
-        PylithScalar atol = 0.0;
-        PylithScalar dtol = 0.0;
-        int maxIters = 0;
-        err = KSPGetTolerances(_ksp, &rtol, &atol, &dtol, &maxIters); PYLITH_CHECK_ERROR(err);
-        rtol = 1.0e-3*_zeroTolerance;
-        atol = 1.0e-5*_zeroTolerance;
-        err = KSPSetTolerances(_ksp, rtol, atol, dtol, maxIters); PYLITH_CHECK_ERROR(err);
-
-        PC pc;
-        err = KSPGetPC(_ksp, &pc); PYLITH_CHECK_ERROR(err);
-        err = PCSetType(pc, PCJACOBI); PYLITH_CHECK_ERROR(err);
-        err = KSPSetType(_ksp, KSPGMRES); PYLITH_CHECK_ERROR(err);
-
-        err = KSPAppendOptionsPrefix(_ksp, "friction_"); PYLITH_CHECK_ERROR(err);
-        err = KSPSetFromOptions(_ksp); PYLITH_CHECK_ERROR(err);
+    // The local sensitivity approximation does not use any linear
+    // solves.
+    if (_sensitivityLocal) {
+        PYLITH_METHOD_END;
     } // if
 
+    // Setup Jacobian sparse matrices and PETSc KSP linear solvers for
+    // the sensitivity solves on each side of the fault. They are kept
+    // across calls so that the preconditioner (e.g., a direct
+    // factorization selected with -friction_pc_type lu) is reused
+    // until the domain Jacobian changes.
+    for (int iSide=0; iSide < 2; ++iSide) {
+        if (!_jacobian[iSide]) {
+            _jacobian[iSide] = new topology::Jacobian(solution, jacobian.matrixType());
+            _jacobianState[iSide] = -1;
+        } // if
+        assert(_jacobian[iSide]);
+
+        if (!_ksp[iSide]) {
+            PetscErrorCode err = 0;
+            err = KSPCreate(_faultMesh->comm(), &_ksp[iSide]); PYLITH_CHECK_ERROR(err);
+            err = KSPSetInitialGuessNonzero(_ksp[iSide], PETSC_FALSE); PYLITH_CHECK_ERROR(err);
+            PylithScalar rtol = 0.0;
+            PylithScalar atol = 0.0;
+            PylithScalar dtol = 0.0;
+            int maxIters = 0;
+            err = KSPGetTolerances(_ksp[iSide], &rtol, &atol, &dtol, &maxIters); PYLITH_CHECK_ERROR(err);
+            rtol = 1.0e-3*_zeroTolerance;
+            atol = 1.0e-5*_zeroTolerance;
+            err = KSPSetTolerances(_ksp[iSide], rtol, atol, dtol, maxIters); PYLITH_CHECK_ERROR(err);
+
+            PC pc;
+            err = KSPGetPC(_ksp[iSide], &pc); PYLITH_CHECK_ERROR(err);
+            err = PCSetType(pc, PCJACOBI); PYLITH_CHECK_ERROR(err);
+            err = KSPSetType(_ksp[iSide], KSPGMRES); PYLITH_CHECK_ERROR(err);
+
+            err = KSPAppendOptionsPrefix(_ksp[iSide], "friction_"); PYLITH_CHECK_ERROR(err);
+            err = KSPSetFromOptions(_ksp[iSide]); PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+
     PYLITH_METHOD_END;
 } // _sensitivitySetup
 
@@ -1701,6 +1682,13 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
     assert(_quadrature);
     assert(_fields);
 
+    // Values are extracted from the domain Jacobian, so nothing
+    // changes if it has not been updated since the last time.
+    const int iSide = (negativeSide) ? 0 : 1;
+    if (_jacobianState[iSide] == jacobian.valuesState()) {
+        PYLITH_METHOD_END;
+    } // if
+
     const int numBasis = _quadrature->numBasis();
     const int spaceDim = _quadrature->spaceDim();
     const int subnrows = numBasis*spaceDim;
@@ -1735,10 +1723,11 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
     PetscSection solutionFaultSection = _fields->get("sensitivity solution").localSection(); assert(solutionFaultSection);
     PetscVec solutionFaultVec = _fields->get("sensitivity solution").localVector(); assert(solutionFaultVec);
     PetscSection solutionFaultGlobalSection = _fields->get("sensitivity solution").globalSection(); assert(solutionFaultGlobalSection);
-    assert(_jacobian);
-    const PetscMat jacobianFaultMatrix = _jacobian->matrix(); assert(jacobianFaultMatrix);
+    assert(_jacobian[iSide]);
+    _jacobian[iSide]->zero();
+    const PetscMat jacobianFaultMatrix = _jacobian[iSide]->matrix(); assert(jacobianFaultMatrix);
 
-    const int iCone = (negativeSide) ? 0 : 1;
+    const int iCone = iSide;
 
     PetscIS* cellsIS = (numCohesiveCells > 0) ? new PetscIS[numCohesiveCells] : 0;
     int_array indicesGlobal(subnrows);
@@ -1828,13 +1817,19 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
     err = MatDestroySubMatrices(numCohesiveCells, &submatrices); PYLITH_CHECK_ERROR(err);
     delete[] cellsIS; cellsIS = 0;
 
-    _jacobian->assemble("final_assembly");
+    _jacobian[iSide]->assemble("final_assembly");
+
+    // Setting the operators forces setup of the preconditioner on the
+    // next solve.
+    assert(_ksp[iSide]);
+    err = KSPSetOperators(_ksp[iSide], jacobianFaultMatrix, jacobianFaultMatrix); PYLITH_CHECK_ERROR(err);
+    _jacobianState[iSide] = jacobian.valuesState();
 
 #if 0 // DEBUGGING
       //std::cout << "DOMAIN JACOBIAN" << std::endl;
       //jacobian.view();
     std::cout << "SENSITIVITY JACOBIAN" << std::endl;
-    _jacobian->view();
+    _jacobian[iSide]->view();
 #endif
 
     PYLITH_METHOD_END;
@@ -1932,13 +1927,14 @@ pylith::faults::FaultCohesiveDyn::_sensitivityReformResidual(const bool negative
 // ----------------------------------------------------------------------
 // Solve sensitivity problem.
 void
-pylith::faults::FaultCohesiveDyn::_sensitivitySolve(void)
+pylith::faults::FaultCohesiveDyn::_sensitivitySolve(const bool negativeSide)
 { // _sensitivitySolve
     PYLITH_METHOD_BEGIN;
 
+    const int iSide = (negativeSide) ? 0 : 1;
     assert(_fields);
-    assert(_jacobian);
-    assert(_ksp);
+    assert(_jacobian[iSide]);
+    assert(_ksp[iSide]);
 
     topology::Field& residual = _fields->get("sensitivity residual");
     topology::Field& solution = _fields->get("sensitivity solution");
@@ -1949,13 +1945,12 @@ pylith::faults::FaultCohesiveDyn::_sensitivitySolve(void)
     // Update PetscVector view of field.
     residual.scatterLocalToGlobal();
 
+    // Operators were set when the sensitivity Jacobian was last
+    // updated, so the preconditioner is reused if it has not changed.
     PetscErrorCode err = 0;
-    const PetscMat jacobianMat = _jacobian->matrix();
-    err = KSPSetOperators(_ksp, jacobianMat, jacobianMat); PYLITH_CHECK_ERROR(err);
-
     const PetscVec residualVec = residual.globalVector();
     const PetscVec solutionVec = solution.globalVector();
-    err = KSPSolve(_ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
+    err = KSPSolve(_ksp[iSide], residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
 
     // Update section view of field.
     solution.scatterGlobalToLocal();
@@ -2027,6 +2022,207 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateSoln(const bool negativeSide
     PYLITH_METHOD_END;
 } // _sensitivityUpdateSoln
 
+// ----------------------------------------------------------------------
+// Update the compliance of each vertex used in place of the
+// sensitivity solves.
+void
+pylith::faults::FaultCohesiveDyn::_sensitivityUpdateCompliance(const topology::Jacobian& jacobian,
+                                                               const topology::SolutionFields& fields)
+{ // _sensitivityUpdateCompliance
+    PYLITH_METHOD_BEGIN;
+
+    assert(_quadrature);
+    assert(_fields);
+
+    // Values are extracted from the domain Jacobian, so nothing
+    // changes if it has not been updated since the last time.
+    if (_complianceState == jacobian.valuesState()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    const int spaceDim = _quadrature->spaceDim();
+    const int blockSize = spaceDim*spaceDim;
+    const int numVertices = _cohesiveVertices.size();
+
+    PetscErrorCode err = 0;
+
+    const CohesiveOffsets& offsets = _cohesiveOffsets(fields.get("dispIncr(t->t+dt)"));
+    PetscSection solutionDomainGlobalSection = fields.solution().globalSection(); assert(solutionDomainGlobalSection);
+
+    topology::VecVisitorMesh areaVisitor(_fields->get("area"));
+    const PetscScalar* areaArray = areaVisitor.localArray();
+
+    // Get global indices of the DOF for the vertices on the negative
+    // and positive sides of the fault for each vertex that is not
+    // clamped. The blocks are extracted from a single submatrix, so
+    // the only communication is when the domain Jacobian changes.
+    const int subnrowsVertex = 2*spaceDim;
+    int_array indicesGlobal(numVertices*subnrowsVertex);
+    int_array indicesPerm(numVertices*subnrowsVertex);
+    int_array indicesLocal(numVertices*subnrowsVertex);
+    std::vector<int> verticesCompliance(numVertices);
+    int numVerticesCompliance = 0;
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        // Skip clamped vertices
+        if (offsets.lagrange[iVertex] < 0) {
+            continue;
+        } // if
+
+        const int iCompliance = numVerticesCompliance++;
+        verticesCompliance[iCompliance] = iVertex;
+
+        const int v_negative = _cohesiveVertices[iVertex].negative;
+        const int v_positive = _cohesiveVertices[iVertex].positive;
+        PetscInt goffN = 0, goffP = 0;
+        err = PetscSectionGetOffset(solutionDomainGlobalSection, v_negative, &goffN); PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(solutionDomainGlobalSection, v_positive, &goffP); PYLITH_CHECK_ERROR(err);
+        const PetscInt gindN = goffN < 0 ? -(goffN+1) : goffN;
+        const PetscInt gindP = goffP < 0 ? -(goffP+1) : goffP;
+        for (int iDim=0, iB=iCompliance*subnrowsVertex; iDim < spaceDim; ++iDim) {
+            indicesGlobal[iB+iDim] = gindN + iDim;
+            indicesGlobal[iB+spaceDim+iDim] = gindP + iDim;
+        } // for
+    } // for
+    const int subnrows = numVerticesCompliance*subnrowsVertex;
+
+    for (int i=0; i < subnrows; ++i) {
+        indicesPerm[i]  = i;
+    } // for
+    if (subnrows > 0) {
+        err = PetscSortIntWithArray(subnrows, &indicesGlobal[0], &indicesPerm[0]); PYLITH_CHECK_ERROR(err);
+    } // if
+    for (int i=0; i < subnrows; ++i) {
+        indicesLocal[indicesPerm[i]] = i;
+    } // for
+
+    PetscIS verticesIS = NULL;
+    err = ISCreateGeneral(PETSC_COMM_SELF, subnrows, (subnrows > 0) ? &indicesGlobal[0] : NULL, PETSC_COPY_VALUES, &verticesIS); PYLITH_CHECK_ERROR(err);
+
+    const PetscMat jacobianDomainMatrix = jacobian.matrix(); assert(jacobianDomainMatrix);
+    PetscMat* submatrices = NULL;
+    err = MatCreateSubMatrices(jacobianDomainMatrix, 1, &verticesIS, &verticesIS, MAT_INITIAL_MATRIX, &submatrices); PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&verticesIS); PYLITH_CHECK_ERROR(err);
+
+    _compliance.resize(numVertices*blockSize);
+    _compliance = 0.0;
+    scalar_array jacobianBlock(blockSize);
+    scalar_array complianceBlock(blockSize);
+    for (int iCompliance=0; iCompliance < numVerticesCompliance; ++iCompliance) {
+        const int iVertex = verticesCompliance[iCompliance];
+        const PylithScalar areaVertex = areaArray[offsets.faultScalar[iVertex]];
+        assert(areaVertex > 0.0);
+
+        // Sum inverses of the diagonal blocks for the vertices on the
+        // negative (iSide=0) and positive (iSide=1) sides of the fault.
+        for (int iSide=0; iSide < 2; ++iSide) {
+            const PetscInt* indicesBlock = &indicesLocal[iCompliance*subnrowsVertex+iSide*spaceDim];
+            err = MatGetValues(submatrices[0], spaceDim, indicesBlock, spaceDim, indicesBlock,
+                               &jacobianBlock[0]); PYLITH_CHECK_ERROR_MSG(err, "Restrict from PETSc Mat failed.");
+
+            const PylithScalar* j = &jacobianBlock[0];
+            PylithScalar det = 0.0;
+            switch (spaceDim) {
+            case 1:
+                det = j[0];
+                complianceBlock[0] = 1.0;
+                break;
+            case 2:
+                det = j[0]*j[3] - j[1]*j[2];
+                complianceBlock[0] =  j[3];
+                complianceBlock[1] = -j[1];
+                complianceBlock[2] = -j[2];
+                complianceBlock[3] =  j[0];
+                break;
+            case 3:
+                det = j[0]*(j[4]*j[8] - j[5]*j[7]) - j[1]*(j[3]*j[8] - j[5]*j[6]) + j[2]*(j[3]*j[7] - j[4]*j[6]);
+                complianceBlock[0] = j[4]*j[8] - j[5]*j[7];
+                complianceBlock[1] = j[2]*j[7] - j[1]*j[8];
+                complianceBlock[2] = j[1]*j[5] - j[2]*j[4];
+                complianceBlock[3] = j[5]*j[6] - j[3]*j[8];
+                complianceBlock[4] = j[0]*j[8] - j[2]*j[6];
+                complianceBlock[5] = j[2]*j[3] - j[0]*j[5];
+                complianceBlock[6] = j[3]*j[7] - j[4]*j[6];
+                complianceBlock[7] = j[1]*j[6] - j[0]*j[7];
+                complianceBlock[8] = j[0]*j[4] - j[1]*j[3];
+                break;
+            default:
+                assert(0);
+                throw std::logic_error("Unknown spatial dimension in "
+                                       "FaultCohesiveDyn::_sensitivityUpdateCompliance().");
+            } // switch
+            if (0.0 == det) {
+                std::ostringstream msg;
+                msg << "Singular block in Jacobian for vertex " << (iSide ? _cohesiveVertices[iVertex].positive : _cohesiveVertices[iVertex].negative)
+                    << " on fault " << label() << " when computing compliance for local sensitivity mode.";
+                throw std::runtime_error(msg.str());
+            } // if
+
+            for (int i=0; i < blockSize; ++i) {
+                _compliance[iVertex*blockSize+i] += areaVertex * complianceBlock[i] / det;
+            } // for
+        } // for
+    } // for
+    PetscLogFlops(numVerticesCompliance*2*(3*blockSize + 14));
+
+    err = MatDestroySubMatrices(1, &submatrices); PYLITH_CHECK_ERROR(err);
+
+    _complianceState = jacobian.valuesState();
+
+    PYLITH_METHOD_END;
+} // _sensitivityUpdateCompliance
+
+// ----------------------------------------------------------------------
+// Update the relative displacement field values using the compliance
+// of each vertex.
+void
+pylith::faults::FaultCohesiveDyn::_sensitivityUpdateSolnLocal(void)
+{ // _sensitivityUpdateSolnLocal
+    PYLITH_METHOD_BEGIN;
+
+    assert(_fields);
+    assert(_quadrature);
+
+    const int spaceDim = _quadrature->spaceDim();
+    const int blockSize = spaceDim*spaceDim;
+
+    topology::VecVisitorMesh dispRelVisitor(_fields->get("sensitivity relative disp"));
+    PetscScalar* dispRelArray = dispRelVisitor.localArray();
+
+    topology::VecVisitorMesh dLagrangeVisitor(_fields->get("sensitivity dLagrange"));
+    const PetscScalar* dLagrangeArray = dLagrangeVisitor.localArray();
+
+    // Change in relative displacement is the negative of the change in
+    // the Lagrange multipliers times the compliance, consistent with
+    // the sign convention in _sensitivityReformResidual() and
+    // _sensitivityUpdateSoln().
+    const int numVertices = _cohesiveVertices.size();
+    assert(_compliance.size() == size_t(numVertices*blockSize));
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+
+        // Skip clamped vertices
+        if (v_fault < 0) {
+            continue;
+        } // if
+
+        const PetscInt dloff = dLagrangeVisitor.sectionOffset(v_fault);
+        assert(spaceDim == dLagrangeVisitor.sectionDof(v_fault));
+
+        const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
+        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
+
+        const PylithScalar* complianceVertex = &_compliance[iVertex*blockSize];
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            for (int jDim=0; jDim < spaceDim; ++jDim) {
+                dispRelArray[droff+iDim] -= complianceVertex[iDim*spaceDim+jDim] * dLagrangeArray[dloff+jDim];
+            } // for
+        } // for
+    } // for
+    PetscLogFlops(numVertices*blockSize*2);
+
+    PYLITH_METHOD_END;
+} // _sensitivityUpdateSolnLocal
+
 
 // ----------------------------------------------------------------------
 // Compute norm of residual associated with matching fault
@@ -2049,7 +2245,8 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
         const scalar_array&,
         const scalar_array&,
         const PylithScalar,
-        const bool);
+        const bool,
+        const PylithScalar*);
 
     // Update time step in friction (can vary).
     _friction->timeStep(_dt);
@@ -2100,58 +2297,38 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
     topology::Field& dispTIncr = fields->get("dispIncr(t->t+dt)");
     topology::VecVisitorMesh dispTIncrVisitor(dispTIncr);
     const PetscScalar* dispTIncrArray = dispTIncrVisitor.localArray();
-    PetscSection dispTIncrGlobalSection = dispTIncr.globalSection(); assert(dispTIncrGlobalSection);
 
     bool isOpening = false;
     PylithScalar norm2 = 0.0;
+    // Offsets are the same for disp(t) and dispIncr(t->t+dt) and for
+    // the vector fields over the fault.
+    const CohesiveOffsets& offsets = _cohesiveOffsets(dispTIncr);
     int numVertices = _cohesiveVertices.size();
+
+    // Slip, slip rate, and traction in the fault coordinate system for
+    // local vertices, gathered so that friction can be computed for all
+    // of the vertices at once.
+    scalar_array slipVertices(numVertices*spaceDim);
+    scalar_array slipRateVertices(numVertices*spaceDim);
+    scalar_array tractionTpdtVertices(numVertices*spaceDim);
+    std::vector<int> verticesFriction(numVertices);
+    int numVerticesFriction = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        // Skip clamped vertices
-        if (e_lagrange < 0) {
-            continue;
-        } // if
 
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff;
-        err = PetscSectionGetOffset(dispTIncrGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0) {
+        // Compute contribution only if Lagrange constraint is local
+        // (clamped vertices are also flagged as not local).
+        if (offsets.lagrangeGlobal[iVertex] < 0) {
             continue;
         } // if
 
-        // Get displacement values
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get displacement increment values.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
-        // Get orientation
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+        const PetscInt noff = offsets.negative[iVertex];
+        const PetscInt poff = offsets.positive[iVertex];
+        const PetscInt loff = offsets.lagrange[iVertex];
+        const PetscInt ooff = offsets.faultOrientation[iVertex];
+        const PetscInt soff = offsets.faultVector[iVertex];
         assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
-
-        // Get change in relative displacement from sensitivity solve.
-        const PetscInt sdroff = sensDispRelVisitor.sectionOffset(v_fault);
         assert(spaceDim == sensDispRelVisitor.sectionDof(v_fault));
-
-        const PetscInt sdloff = dLagrangeVisitor.sectionOffset(v_fault);
         assert(spaceDim == dLagrangeVisitor.sectionDof(v_fault));
 
         // Compute slip, slip rate, and traction at time t+dt as part of
@@ -2161,9 +2338,9 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
         tractionTpdtVertex = 0.0;
         for(PetscInt d = 0; d < spaceDim; ++d) {
             for(PetscInt e = 0; e < spaceDim; ++e) {
-                slipTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[dtpoff+e] + dispTIncrArray[dipoff+e] - dispTArray[dtnoff+e] - dispTIncrArray[dinoff+e] + alpha*sensDispRelArray[sdroff+e]);
-                slipRateVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTIncrArray[dipoff+e] - dispTIncrArray[dinoff+e] + alpha*sensDispRelArray[sdroff+e]) / dt;
-                tractionTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[dtloff+e] + dispTIncrArray[diloff+e] + alpha*dLagrangeArray[sdloff+e]);
+                slipTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[poff+e] + dispTIncrArray[poff+e] - dispTArray[noff+e] - dispTIncrArray[noff+e] + alpha*sensDispRelArray[soff+e]);
+                slipRateVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTIncrArray[poff+e] - dispTIncrArray[noff+e] + alpha*sensDispRelArray[soff+e]) / dt;
+                tractionTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[loff+e] + dispTIncrArray[loff+e] + alpha*dLagrangeArray[soff+e]);
             } // for
 #if !defined(DISABLE_SLIPRATE_TOLERANCE) // 2017-06-23  Is this really necessary?
             if (fabs(slipRateVertex[d]) < _zeroTolerance / dt) {
@@ -2212,12 +2389,31 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
             isOpening = true;
         } // if
 
-        // Apply friction criterion to trial solution to get change in
-        // Lagrange multiplier (dLagrangeTpdtVertex) in fault coordinate
-        // system.
+        const int iFriction = numVerticesFriction++;
+        for (int d=0; d < spaceDim; ++d) {
+            slipVertices[iFriction*spaceDim+d] = slipTpdtVertex[d];
+            slipRateVertices[iFriction*spaceDim+d] = slipRateVertex[d];
+            tractionTpdtVertices[iFriction*spaceDim+d] = tractionTpdtVertex[d];
+        } // for
+        verticesFriction[iFriction] = v_fault;
+    } // for
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
+    // Apply friction criterion to trial solution to get change in
+    // Lagrange multiplier (dLagrangeTpdtVertex) in fault coordinate
+    // system.
+
+    // Use fault constitutive model to compute friction for all of the
+    // vertices.
+    scalar_array frictionVertices(numVerticesFriction);
+    _calcFrictionBatch(&frictionVertices, t, slipVertices, slipRateVertices, tractionTpdtVertices,
+                       verticesFriction, numVerticesFriction);
+
+    for (int iFriction=0; iFriction < numVerticesFriction; ++iFriction) {
+        for (int d=0; d < spaceDim; ++d) {
+            slipTpdtVertex[d] = slipVertices[iFriction*spaceDim+d];
+            slipRateVertex[d] = slipRateVertices[iFriction*spaceDim+d];
+            tractionTpdtVertex[d] = tractionTpdtVertices[iFriction*spaceDim+d];
+        } // for
 
         // Use fault constitutive model to compute traction associated with
         // friction.
@@ -2226,11 +2422,11 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
         const bool iterating = true; // Iterating to get friction
         CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&tractionMisfitVertex, t,
                                                      slipTpdtVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex,
-                                                     iterating);
+                                                     iterating, &frictionVertices[iFriction]);
 
 #if 0 // DEBUGGING
         std::cout << "alpha: " << alpha
-                  << ", v_fault: " << v_fault;
+                  << ", v_fault: " << verticesFriction[iFriction];
         std::cout << ", misfit:";
         for (int iDim=0; iDim < spaceDim; ++iDim) {
             std::cout << " " << tractionMisfitVertex[iDim];
@@ -2243,10 +2439,6 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
         for (int iDim=0; iDim < spaceDim; ++iDim) {
             std::cout << " " << tractionTpdtVertex[iDim];
         } // for
-        std::cout << ", dDispRel:";
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-            std::cout << " " << sensDispRelArray[sdroff+iDim];
-        } // for
         std::cout << std::endl;
 #endif
 
@@ -2261,14 +2453,63 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
 
     PetscScalar norm2Total = 0.0;
     PetscInt numVerticesTotal = 0;
-    err = MPI_Allreduce(&norm2, &norm2Total, 1, MPIU_SCALAR, MPI_SUM, fields->mesh().comm());
-    err = MPI_Allreduce(&numVertices, &numVerticesTotal, 1, MPIU_INT, MPI_SUM, fields->mesh().comm());
+    err = MPI_Allreduce(&norm2, &norm2Total, 1, MPIU_SCALAR, MPI_SUM, fields->mesh().comm()); PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&numVertices, &numVerticesTotal, 1, MPIU_INT, MPI_SUM, fields->mesh().comm()); PYLITH_CHECK_ERROR(err);
 
     assert(numVerticesTotal > 0);
     PYLITH_METHOD_RETURN(sqrt(norm2Total) / numVerticesTotal);
 } // _constrainSolnSpaceNorm
 
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of fault vertices.
+void
+pylith::faults::FaultCohesiveDyn::_calcFrictionBatch(scalar_array* friction,
+                                                     const PylithScalar t,
+                                                     const scalar_array& slip,
+                                                     const scalar_array& slipRate,
+                                                     const scalar_array& tractionTpdt,
+                                                     const std::vector<int>& verticesFault,
+                                                     const int numVertices)
+{ // _calcFrictionBatch
+    PYLITH_METHOD_BEGIN;
+
+    assert(friction);
+    assert(_friction);
+    assert(friction->size() == size_t(numVertices));
+
+    const int spaceDim = _quadrature->spaceDim();
+    const int indexN = spaceDim - 1;
+    if (1 == spaceDim || 0 == numVertices) {
+        // No shear tractions, so friction is not used.
+        *friction = 0.0;
+        PYLITH_METHOD_END;
+    } // if
+
+    // Magnitudes of shear slip and slip rate as computed in
+    // _constrainSolnSpace2D() and _constrainSolnSpace3D().
+    scalar_array slipMag(numVertices);
+    scalar_array slipRateMag(numVertices);
+    scalar_array tractionNormal(numVertices);
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const PylithScalar* slipVertex = &slip[iVertex*spaceDim];
+        const PylithScalar* slipRateVertex = &slipRate[iVertex*spaceDim];
+        if (2 == spaceDim) {
+            slipMag[iVertex] = fabs(slipVertex[0]);
+            slipRateMag[iVertex] = fabs(slipRateVertex[0]);
+        } else {
+            slipMag[iVertex] = sqrt(slipVertex[0] * slipVertex[0] + slipVertex[1] * slipVertex[1]);
+            slipRateMag[iVertex] = sqrt(slipRateVertex[0]*slipRateVertex[0] + slipRateVertex[1]*slipRateVertex[1]);
+        } // if/else
+        tractionNormal[iVertex] = tractionTpdt[iVertex*spaceDim+indexN];
+    } // for
+
+    _friction->calcFriction(&(*friction)[0], t, &slipMag[0], &slipRateMag[0], &tractionNormal[0],
+                            &verticesFault[0], numVertices);
+
+    PYLITH_METHOD_END;
+} // _calcFrictionBatch
+
 // ----------------------------------------------------------------------
 // Constrain solution space in 1-D.
 void
@@ -2278,7 +2519,8 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D(scalar_array* dTractionT
                                                         const scalar_array& sliprate,
                                                         const scalar_array& tractionTpdt,
                                                         const PylithScalar jacobianShear,
-                                                        const bool iterating)
+                                                        const bool iterating,
+                                                        const PylithScalar* frictionStressTrial)
 { // _constrainSolnSpace1D
     assert(dTractionTpdt);
 
@@ -2303,7 +2545,8 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
                                                         const scalar_array& slipRate,
                                                         const scalar_array& tractionTpdt,
                                                         const PylithScalar jacobianShear,
-                                                        const bool iterating)
+                                                        const bool iterating,
+                                                        const PylithScalar* frictionStressTrial)
 { // _constrainSolnSpace2D
     assert(dTractionTpdt);
 
@@ -2315,7 +2558,8 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
 
     if (fabs(slip[1]) < _zeroToleranceNormal && tractionNormal < -_zeroTolerance) {
         // if in compression and no opening
-        PylithScalar frictionStress = _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal);
+        PylithScalar frictionStress = (frictionStressTrial) ?
+            *frictionStressTrial : _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal);
 
         if (tractionShearMag > frictionStress || (iterating && slipRateMag > 0.0)) {
             // traction is limited by friction, so have sliding OR
@@ -2385,7 +2629,8 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
                                                         const scalar_array& slipRate,
                                                         const scalar_array& tractionTpdt,
                                                         const PylithScalar jacobianShear,
-                                                        const bool iterating)
+                                                        const bool iterating,
+                                                        const PylithScalar* frictionStressTrial)
 { // _constrainSolnSpace3D
     assert(dTractionTpdt);
 
@@ -2397,7 +2642,8 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
 
     if (fabs(slip[2]) < _zeroToleranceNormal && tractionNormal < -_zeroTolerance) {
         // if in compression and no opening
-        PylithScalar frictionStress = _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal);
+        PylithScalar frictionStress = (frictionStressTrial) ?
+            *frictionStressTrial : _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal);
 
         if (tractionShearMag > frictionStress || (iterating && slipRateMag > 0.0)) {
             // traction is limited by friction, so have sliding OR
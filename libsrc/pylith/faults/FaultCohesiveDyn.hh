@@ -89,6 +89,26 @@ public :
    */
   void openFreeSurf(const bool value);
 
+  /** Set method used to compute the change in slip associated with a
+   * change in the Lagrange multipliers when constraining the solution
+   * space.
+   *
+   * "global" solves the sensitivity problem for each side of the
+   * fault with a PETSc linear solver. "local" uses a compliance for
+   * each vertex computed from the diagonal blocks of the Jacobian, so
+   * no linear solves or communication are needed.
+   *
+   * @param value Name of method ("global" or "local").
+   */
+  void sensitivityMode(const char* value);
+
+  /** Get method used to compute the change in slip associated with a
+   * change in the Lagrange multipliers.
+   *
+   * @returns Name of method.
+   */
+  const char* sensitivityMode(void) const;
+
   /** Initialize fault. Determine orientation and setup boundary
    * condition parameters.
    *
@@ -181,6 +201,10 @@ private :
   void _sensitivitySetup(const topology::Jacobian& jacobian);
 
   /** Update the Jacobian values for the sensitivity solve.
+   *
+   * The values depend only on the Jacobian for the entire domain, so
+   * the sparse matrix and the preconditioner for each side of the
+   * fault are reused until the domain Jacobian changes.
    *
    * @param negativeSide True if solving sensitivity problem for
    * negative side of the fault, false if solving sensitivity problem
@@ -200,8 +224,13 @@ private :
    */
   void _sensitivityReformResidual(const bool negativeSide);
 
-  /// Solve sensitivity problem.
-  void _sensitivitySolve(void);
+  /** Solve sensitivity problem.
+   *
+   * @param negativeSide True if solving sensitivity problem for
+   * negative side of the fault, false if solving sensitivity problem
+   * for positive side of the fault.
+   */
+  void _sensitivitySolve(const bool negativeSide);
 
   /** Update the solution (displacement increment) values based on
    * the sensitivity solve.
@@ -212,6 +241,25 @@ private :
    */
   void _sensitivityUpdateSoln(const bool negativeSide);
 
+  /** Update the compliance of each vertex used in place of the
+   * sensitivity solves.
+   *
+   * The compliance is the area associated with the vertex times the
+   * sum of the inverses of the diagonal blocks of the domain Jacobian
+   * for the vertices on the negative and positive sides of the
+   * fault. It is recomputed only when the domain Jacobian changes.
+   *
+   * @param jacobian Jacobian matrix for entire domain.
+   * @param fields Solution fields.
+   */
+  void _sensitivityUpdateCompliance(const topology::Jacobian& jacobian,
+                                    const topology::SolutionFields& fields);
+
+  /** Update the relative displacement field values using the
+   * compliance of each vertex instead of the sensitivity solves.
+   */
+  void _sensitivityUpdateSolnLocal(void);
+
   /** Compute norm of residual associated with matching fault
    *  constitutive model using update from sensitivity solve. We use
    *  this in a line search to find a good update (required because
@@ -228,6 +276,25 @@ private :
 				       const PylithScalar t,
 				       topology::SolutionFields* const fields);
 
+  /** Compute friction for a batch of fault vertices from the slip,
+   * slip rate, and traction in the fault coordinate system.
+   *
+   * @param friction Array for friction at vertices [numVertices].
+   * @param t Current time.
+   * @param slip Slip at vertices [numVertices*spaceDim].
+   * @param slipRate Slip rate at vertices [numVertices*spaceDim].
+   * @param tractionTpdt Fault traction at vertices [numVertices*spaceDim].
+   * @param verticesFault Vertices in fault mesh.
+   * @param numVertices Number of vertices in batch.
+   */
+  void _calcFrictionBatch(scalar_array* friction,
+			  const PylithScalar t,
+			  const scalar_array& slip,
+			  const scalar_array& slipRate,
+			  const scalar_array& tractionTpdt,
+			  const std::vector<int>& verticesFault,
+			  const int numVertices);
+
   /** Constrain solution space in 1-D.
    *
    * @param dLagrangeTpdt Adjustment to Lagrange multiplier.
@@ -237,6 +304,8 @@ private :
    * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
    * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
    * @param iterating True if iterating on solution.
+   * @param frictionStressTrial Friction for trial solution (NULL to
+   *   compute using current properties and state variables of vertex).
    */
   void _constrainSolnSpace1D(scalar_array* dLagrangeTpdt,
 			     const PylithScalar t,
@@ -244,7 +313,8 @@ private :
 			     const scalar_array& slipRate,
 			     const scalar_array& tractionTpdt,
 			     const PylithScalar jacobianShear,
-			     const bool iterating =true);
+			     const bool iterating =true,
+			     const PylithScalar* frictionStressTrial =0);
 
   /** Constrain solution space in 2-D.
    *
@@ -255,6 +325,8 @@ private :
    * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
    * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
    * @param iterating True if iterating on solution.
+   * @param frictionStressTrial Friction for trial solution (NULL to
+   *   compute using current properties and state variables of vertex).
    */
   void _constrainSolnSpace2D(scalar_array* dLagrangeTpdt,
 			     const PylithScalar t,
@@ -262,7 +334,8 @@ private :
 			     const scalar_array& slipRate,
 			     const scalar_array& tractionTpdt,
 			     const PylithScalar jacobianShear,
-			     const bool iterating =true);
+			     const bool iterating =true,
+			     const PylithScalar* frictionStressTrial =0);
 
   /** Constrain solution space in 3-D.
    *
@@ -273,6 +346,8 @@ private :
    * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
    * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
    * @param iterating True if iterating on solution.
+   * @param frictionStressTrial Friction for trial solution (NULL to
+   *   compute using current properties and state variables of vertex).
    */
   void _constrainSolnSpace3D(scalar_array* dLagrangeTpdt,
 			     const PylithScalar t,
@@ -280,7 +355,8 @@ private :
 			     const scalar_array& slipRate,
 			     const scalar_array& tractionTpdt,
 			     const PylithScalar jacobianShear,
-			     const bool iterating =true);
+			     const bool iterating =true,
+			     const PylithScalar* frictionStressTrial =0);
 
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
@@ -297,10 +373,30 @@ private :
   /// To identify constitutive model
   friction::FrictionModel* _friction;
 
-  /// Sparse matrix for sensitivity solve.
-  topology::Jacobian* _jacobian;
+  /// Sparse matrices for sensitivity solve for the negative and
+  /// positive sides of the fault.
+  topology::Jacobian* _jacobian[2];
+
+  /// PETSc KSP linear solvers for sensitivity problem for the negative
+  /// and positive sides of the fault.
+  PetscKSP _ksp[2];
+
+  /// Value of valuesState() of the domain Jacobian when the
+  /// sensitivity matrices were last formed (-1 if not formed).
+  long _jacobianState[2];
+
+  /// Compliance relating the change in relative displacement to the
+  /// change in Lagrange multipliers in the global coordinate system
+  /// for each cohesive vertex [numVertices][spaceDim*spaceDim]
+  /// (local sensitivity mode).
+  scalar_array _compliance;
+
+  /// Value of valuesState() of the domain Jacobian when the compliance
+  /// was last computed (-1 if not computed).
+  long _complianceState;
 
-  PetscKSP _ksp; ///< PETSc KSP linear solver for sensitivity problem.
+  /// Use compliance of each vertex instead of sensitivity solves.
+  bool _sensitivityLocal;
 
   /// Flag to control whether to continue to impose initial tractions
   /// on the fault surface when it opens. If it is a frictional
@@ -60,6 +60,8 @@ pylith::faults::FaultCohesiveLagrange::FaultCohesiveLagrange(void) :
     _cohesiveIS(0)
 { // constructor
     _useLagrangeConstraints = true;
+    _offsets.storageSize = -1;
+    _offsets.globalStorageSize = -1;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -78,6 +80,8 @@ pylith::faults::FaultCohesiveLagrange::deallocate(void)
 
     FaultCohesive::deallocate();
     delete _cohesiveIS; _cohesiveIS = 0;
+    _offsets.storageSize = -1;
+    _offsets.globalStorageSize = -1;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -227,7 +231,6 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
     const int computeEvent = _logger->eventId("FaIR compute");
 #if defined(DETAILED_EVENT_LOGGING)
     const int geometryEvent = _logger->eventId("FaIR geometry");
-    const int restrictEvent = _logger->eventId("FaIR restrict");
     const int updateEvent = _logger->eventId("FaIR update");
 #endif
 
@@ -236,10 +239,6 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
     // Get cell geometry information that doesn't depend on cell
     const int spaceDim = _quadrature->spaceDim();
 
-    // Get sections associated with cohesive cells
-    PetscSection residualSection = residual.localSection(); assert(residualSection);
-    PetscSection residualGlobalSection = residual.globalSection(); assert(residualGlobalSection);
-
     topology::VecVisitorMesh residualVisitor(residual);
     PetscScalar* residualArray = residualVisitor.localArray();
 
@@ -268,76 +267,34 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
 #endif
 
     // Loop over fault vertices
+    const CohesiveOffsets& offsets = _cohesiveOffsets(residual);
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        if (e_lagrange < 0) { // Skip clamped edges.
+        // Compute contribution only if Lagrange constraint is local
+        // (clamped edges are also flagged as not local).
+        if (offsets.lagrangeGlobal[iVertex] < 0) {
             continue;
         } // if
 
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff  = 0;
-        PetscErrorCode err = PetscSectionGetOffset(residualGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0)
-            continue;
-
 #if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
+        _logger->eventBegin(updateEvent);
 #endif
 
-        // Get relative dislplacement at fault vertex.
-        const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
-        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
-
-        // Get area associated with fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
-        const PylithScalar areaValue = areaArray[aoff];
-
-        // Get disp(t) at conventional vertices and Lagrange vertex.
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get dispIncr(t->t+dt) at conventional vertices and Lagrange vertex.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
+        // Offsets are the same for residual, disp(t), and dispIncr(t->t+dt).
+        const PetscInt noff = offsets.negative[iVertex];
+        const PetscInt poff = offsets.positive[iVertex];
+        const PetscInt loff = offsets.lagrange[iVertex];
+        const PetscInt droff = offsets.faultVector[iVertex];
+        assert(spaceDim == dispRelVisitor.sectionDof(_cohesiveVertices[iVertex].fault));
+        assert(spaceDim == residualVisitor.sectionDof(_cohesiveVertices[iVertex].lagrange));
 
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
-        // Assemble contributions into field
-        const PetscInt rnoff = residualVisitor.sectionOffset(v_negative);
-        assert(spaceDim == residualVisitor.sectionDof(v_negative));
-
-        const PetscInt rpoff = residualVisitor.sectionOffset(v_positive);
-        assert(spaceDim == residualVisitor.sectionDof(v_positive));
-
-        const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == residualVisitor.sectionDof(e_lagrange));
-
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
-        _logger->eventBegin(updateEvent);
-#endif
+        const PylithScalar areaValue = areaArray[offsets.faultScalar[iVertex]];
 
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            const PylithScalar residualN = areaValue * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d]);
-            residualArray[rnoff+d] += +residualN;
-            residualArray[rpoff+d] += -residualN;
-            residualArray[rloff+d] += -areaValue * (dispTArray[dtpoff+d] + dispTIncrArray[dipoff+d] - dispTArray[dtnoff+d] - dispTIncrArray[dinoff+d] - dispRelArray[droff+d]);
+            const PylithScalar residualN = areaValue * (dispTArray[loff+d] + dispTIncrArray[loff+d]);
+            residualArray[noff+d] += +residualN;
+            residualArray[poff+d] += -residualN;
+            residualArray[loff+d] += -areaValue * (dispTArray[poff+d] + dispTIncrArray[poff+d] - dispTArray[noff+d] - dispTIncrArray[noff+d] - dispRelArray[droff+d]);
         } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -353,6 +310,14 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
     PYLITH_METHOD_END;
 } // integrateResidual
 
+// ----------------------------------------------------------------------
+// Check whether integrator supports matrix-free Jacobian.
+bool
+pylith::faults::FaultCohesiveLagrange::hasJacobianAction(void) const
+{ // hasJacobianAction
+    return false;
+} // hasJacobianAction
+
 // ----------------------------------------------------------------------
 // Compute Jacobian matrix (A) associated with operator.
 void
@@ -803,7 +768,6 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
     const int computeEvent = _logger->eventId("FaAS compute");
 #if defined(DETAILED_EVENT_LOGGING)
     const int geometryEvent = _logger->eventId("FaAS geometry");
-    const int restrictEvent = _logger->eventId("FaAS restrict");
 #endif
 
     _logger->eventBegin(setupEvent);
@@ -831,94 +795,52 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
     topology::VecVisitorMesh dispTIncrAdjVisitor(dispTIncrAdj);
     PetscScalar* dispTIncrAdjArray = dispTIncrAdjVisitor.localArray();
 
-    PetscSection jacobianGlobalSection = jacobian.globalSection(); assert(jacobianGlobalSection);
-
     _logger->eventEnd(setupEvent);
 
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
 #endif
 
-    PetscErrorCode err = 0;
+    const CohesiveOffsets& offsets = _cohesiveOffsets(dispTIncr);
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        if (e_lagrange < 0) { // Skip clamped edges
+        // Offsets are the same for all fields over the domain.
+        const PetscInt loff = offsets.lagrange[iVertex];
+        if (loff < 0) { // Skip clamped edges
             continue;
         } // if
 
         // Set Lagrange multiplier value. Value from preliminary solve is
         // bogus due to artificial diagonal entry.
-        const PetscInt dtloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
+        assert(spaceDim == dispTIncrVisitor.sectionDof(_cohesiveVertices[iVertex].lagrange));
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            dispTIncrArray[dtloff+d] = 0.0;
+            dispTIncrArray[loff+d] = 0.0;
         } // for
 
         // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff;
-        err = PetscSectionGetOffset(jacobianGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0) {
+        if (offsets.lagrangeGlobal[iVertex] < 0) {
             continue;
         } // if
 
 #if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
-
-        // Residual at Lagrange vertex.
-        const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == residualVisitor.sectionDof(e_lagrange));
-
-        // Get jacobian at cohesive cell's vertices.
-        const PetscInt jnoff = jacobianVisitor.sectionOffset(v_negative);
-        assert(spaceDim == jacobianVisitor.sectionDof(v_negative));
-
-        const PetscInt jpoff = jacobianVisitor.sectionOffset(v_positive);
-        assert(spaceDim == jacobianVisitor.sectionDof(v_positive));
-
-        // Area at fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault)); assert(areaArray[aoff] > 0.0);
-
-        // Get dispIncr(t) at cohesive cell vertices.
-        const PetscInt dtnoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        // Get dispIncrAdj at cohesive cell vertices.
-        const PetscInt danoff = dispTIncrAdjVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_negative));
-
-        const PetscInt dapoff = dispTIncrAdjVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_positive));
-
-        const PetscInt daloff = dispTIncrAdjVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrAdjVisitor.sectionDof(e_lagrange));
-
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
         _logger->eventBegin(computeEvent);
 #endif
 
-        const PetscScalar areaVertex = areaArray[aoff];
+        const PetscInt noff = offsets.negative[iVertex];
+        const PetscInt poff = offsets.positive[iVertex];
+        const PetscScalar areaVertex = areaArray[offsets.faultScalar[iVertex]];
+        assert(areaVertex > 0.0);
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            const PylithScalar S = (1.0/jacobianArray[jpoff+d] + 1.0/jacobianArray[jnoff+d]) * areaVertex * areaVertex;
+            const PylithScalar S = (1.0/jacobianArray[poff+d] + 1.0/jacobianArray[noff+d]) * areaVertex * areaVertex;
             // Set Lagrange multiplier value (value from preliminary solve is bogus due to artificial diagonal entry)
-            dispTIncrAdjArray[daloff+d] = 1.0/S * (-residualArray[rloff+d] + areaArray[aoff] * (dispTIncrArray[dtpoff+d] - dispTIncrArray[dtnoff+d]));
+            dispTIncrAdjArray[loff+d] = 1.0/S * (-residualArray[loff+d] + areaVertex * (dispTIncrArray[poff+d] - dispTIncrArray[noff+d]));
 
             // Adjust displacements to account for Lagrange multiplier values (assumed to be zero in preliminary solve).
-            assert(jacobianArray[jnoff+d] > 0.0);
-            dispTIncrAdjArray[danoff+d] +=  +areaVertex / jacobianArray[jnoff+d] * dispTIncrAdjArray[dtloff+d];
+            assert(jacobianArray[noff+d] > 0.0);
+            dispTIncrAdjArray[noff+d] +=  +areaVertex / jacobianArray[noff+d] * dispTIncrAdjArray[loff+d];
 
-            assert(jacobianArray[jpoff+d] > 0.0);
-            dispTIncrAdjArray[dapoff+d] += -areaVertex / jacobianArray[jpoff+d] * dispTIncrAdjArray[dtloff+d];
+            assert(jacobianArray[poff+d] > 0.0);
+            dispTIncrAdjArray[poff+d] += -areaVertex / jacobianArray[poff+d] * dispTIncrAdjArray[loff+d];
         } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -1130,6 +1052,8 @@ void pylith::faults::FaultCohesiveLagrange::_initializeCohesiveInfo(const topolo
     const PetscInt* points = faultMeshIS.points();
 
     _cohesiveToFault.clear();
+    _offsets.storageSize = -1; // Invalidate table of offsets.
+    _offsets.globalStorageSize = -1;
     typedef std::map<int, int> indexmap_type;
     indexmap_type indexMap;
     _cohesiveVertices.resize(fvEnd-fvStart);
@@ -1205,6 +1129,90 @@ void pylith::faults::FaultCohesiveLagrange::_initializeCohesiveInfo(const topolo
     PYLITH_METHOD_END;
 } // _initializeCohesiveInfo
 
+// ----------------------------------------------------------------------
+// Get offsets of cohesive vertex DOF.
+const pylith::faults::FaultCohesiveLagrange::CohesiveOffsets&
+pylith::faults::FaultCohesiveLagrange::_cohesiveOffsets(const topology::Field& solution)
+{ // _cohesiveOffsets
+    PYLITH_METHOD_BEGIN;
+
+    assert(_fields);
+
+    PetscSection solnSection = solution.localSection(); assert(solnSection);
+    PetscSection solnGlobalSection = solution.globalSection(); assert(solnGlobalSection);
+    PetscErrorCode err = 0;
+
+    // Fields cloned from the solution have their own sections but share
+    // its layout, so we detect changes in layout using the storage sizes.
+    PetscInt storageSize = 0, globalStorageSize = 0;
+    err = PetscSectionGetStorageSize(solnSection, &storageSize); PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetStorageSize(solnGlobalSection, &globalStorageSize); PYLITH_CHECK_ERROR(err);
+
+    const size_t numVertices = _cohesiveVertices.size();
+    if (storageSize == _offsets.storageSize && globalStorageSize == _offsets.globalStorageSize &&
+        numVertices == _offsets.lagrange.size()) {
+        PYLITH_METHOD_RETURN(_offsets);
+    } // if
+
+    _offsets.negative.resize(numVertices);
+    _offsets.positive.resize(numVertices);
+    _offsets.lagrange.resize(numVertices);
+    _offsets.lagrangeGlobal.resize(numVertices);
+    _offsets.faultVector.resize(numVertices);
+    _offsets.faultScalar.resize(numVertices);
+    _offsets.faultOrientation.resize(numVertices);
+
+    PetscSection dispRelSection = _fields->get("relative disp").localSection(); assert(dispRelSection);
+    PetscSection areaSection = _fields->hasField("area") ? _fields->get("area").localSection() : NULL;
+    PetscSection orientationSection = _fields->hasField("orientation") ? _fields->get("orientation").localSection() : NULL;
+
+    for (size_t iVertex=0; iVertex < numVertices; ++iVertex) {
+        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+        const int v_negative = _cohesiveVertices[iVertex].negative;
+        const int v_positive = _cohesiveVertices[iVertex].positive;
+
+        if (e_lagrange < 0) { // Clamped vertex.
+            _offsets.negative[iVertex] = -1;
+            _offsets.positive[iVertex] = -1;
+            _offsets.lagrange[iVertex] = -1;
+            _offsets.lagrangeGlobal[iVertex] = -1;
+            _offsets.faultVector[iVertex] = -1;
+            _offsets.faultScalar[iVertex] = -1;
+            _offsets.faultOrientation[iVertex] = -1;
+            continue;
+        } // if
+
+        PetscInt off = 0;
+        err = PetscSectionGetOffset(solnSection, v_negative, &off); PYLITH_CHECK_ERROR(err);
+        _offsets.negative[iVertex] = off;
+        err = PetscSectionGetOffset(solnSection, v_positive, &off); PYLITH_CHECK_ERROR(err);
+        _offsets.positive[iVertex] = off;
+        err = PetscSectionGetOffset(solnSection, e_lagrange, &off); PYLITH_CHECK_ERROR(err);
+        _offsets.lagrange[iVertex] = off;
+        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &off); PYLITH_CHECK_ERROR(err);
+        _offsets.lagrangeGlobal[iVertex] = (off >= 0) ? off : -1;
+
+        err = PetscSectionGetOffset(dispRelSection, v_fault, &off); PYLITH_CHECK_ERROR(err);
+        _offsets.faultVector[iVertex] = off;
+        off = -1;
+        if (areaSection) {
+            err = PetscSectionGetOffset(areaSection, v_fault, &off); PYLITH_CHECK_ERROR(err);
+        } // if
+        _offsets.faultScalar[iVertex] = off;
+        off = -1;
+        if (orientationSection) {
+            err = PetscSectionGetOffset(orientationSection, v_fault, &off); PYLITH_CHECK_ERROR(err);
+        } // if
+        _offsets.faultOrientation[iVertex] = off;
+    } // for
+
+    _offsets.storageSize = storageSize;
+    _offsets.globalStorageSize = globalStorageSize;
+
+    PYLITH_METHOD_RETURN(_offsets);
+} // _cohesiveOffsets
+
 // ----------------------------------------------------------------------
 // Initialize logger.
 void
@@ -28,6 +28,8 @@
 // Include directives ---------------------------------------------------
 #include "FaultCohesive.hh" // ISA FaultCohesive
 
+#include "pylith/utils/array.hh" // HASA int_array
+
 // FaultCohesiveLagrange -----------------------------------------------------
 /**
  * @brief C++ abstract base class for implementing falt slip using
@@ -131,6 +133,13 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Check whether integrator can apply its contribution to the
+   * Jacobian without assembling a sparse matrix.
+   *
+   * @returns False; constraints are only applied to assembled Jacobian.
+   */
+  bool hasJacobianAction(void) const;
+
   /** Integrate contributions to Jacobian matrix (A) associated with
    * operator that require assembly across processors.
    *
@@ -250,6 +259,23 @@ protected :
     int fault; ///< Point (vertex) in fault mesh.
   };
 
+  /** Offsets of cohesive vertex DOF in the local arrays of the
+   *  solution (and fields sharing its layout) and of the fault fields,
+   *  stored as one array per kind of point with the same ordering as
+   *  _cohesiveVertices. Offsets of clamped vertices are -1.
+   */
+  struct CohesiveOffsets {
+    int_array negative; ///< Offset of vertex on negative side.
+    int_array positive; ///< Offset of vertex on positive side.
+    int_array lagrange; ///< Offset of Lagrange multiplier.
+    int_array lagrangeGlobal; ///< Global offset of Lagrange multiplier (-1 if not local).
+    int_array faultVector; ///< Offset of fault vertex in vector fault fields.
+    int_array faultScalar; ///< Offset of fault vertex in scalar fault fields.
+    int_array faultOrientation; ///< Offset of fault vertex in orientation field.
+    PetscInt storageSize; ///< Local storage size of solution layout (-1 if table is invalid).
+    PetscInt globalStorageSize; ///< Global storage size of solution layout.
+  };
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -259,6 +285,14 @@ protected :
    */
   void _initializeCohesiveInfo(const topology::Mesh& mesh);
 
+  /** Get offsets of cohesive vertex DOF. The table is built on first
+   *  use and rebuilt only when the layout of the solution changes.
+   *
+   * @param solution Field with layout of solution over domain.
+   * @returns Table of offsets.
+   */
+  const CohesiveOffsets& _cohesiveOffsets(const topology::Field& solution);
+
   /** Compute change in tractions on fault surface using solution.
    *
    * @param tractions Field for tractions.
@@ -312,6 +346,9 @@ protected :
   /// Array of cohesive vertex information.
   std::vector<CohesiveInfo> _cohesiveVertices;
 
+  /// Offsets of DOF for cohesive vertices.
+  CohesiveOffsets _offsets;
+
   /// Map label of cohesive cell to label of cells in fault mesh.
   std::map<PetscInt, PetscInt> _cohesiveToFault;
 
@@ -90,6 +90,14 @@ pylith::faults::FaultCohesiveTract::integrateResidual(const topology::Field& res
   throw std::logic_error("FaultCohesiveTract::integrateResidual() not implemented.");
 } // integrateResidual
 
+// ----------------------------------------------------------------------
+// Check whether integrator supports matrix-free Jacobian.
+bool
+pylith::faults::FaultCohesiveTract::hasJacobianAction(void) const
+{ // hasJacobianAction
+  return false;
+} // hasJacobianAction
+
 // ----------------------------------------------------------------------
 // Compute Jacobian matrix (A) associated with operator.
 void
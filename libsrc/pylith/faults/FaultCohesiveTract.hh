@@ -72,6 +72,13 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Check whether integrator can apply its contribution to the
+   * Jacobian without assembling a sparse matrix.
+   *
+   * @returns False; Jacobian is not implemented.
+   */
+  bool hasJacobianAction(void) const;
+
   /** Integrate contributions to Jacobian matrix (A) associated with
    * operator.
    *
@@ -20,7 +20,7 @@
 
 #include "CellGeometry.hh" // implementation of class methods
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include "pylith/utils/error.h" // USES std::logic_error
 #include <cstring> // USES memcpy()
@@ -177,7 +177,7 @@ pylith::feassemble::CellGeometry::_orient1D(scalar_array* orientation,
   (*orientation)[1] =  j2;
   (*orientation)[2] =  j2;
   (*orientation)[3] = -j1;
-  PetscLogFlops(1);
+  pylith::utils::EventLogger::logFlops(1);
 } // _orient1D
 		
 // ----------------------------------------------------------------------
@@ -253,7 +253,7 @@ pylith::feassemble::CellGeometry::_orient2D(scalar_array* orientation,
   (*orientation)[6] =  r0*wt;
   (*orientation)[7] =  r1*wt;
   (*orientation)[8] =  r2*wt;
-  PetscLogFlops(63);
+  pylith::utils::EventLogger::logFlops(63);
 } // _orient2D
 
 
@@ -37,8 +37,6 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
-#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
-#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimendional
 
@@ -198,8 +196,6 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
   // Allocate vectors for cell values.
   scalar_array strainCell(numQuadPts*tensorSize);
   strainCell = 0.0;
-  scalar_array gravVec(spaceDim);
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
 
   // Get cell information
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
@@ -229,10 +225,6 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
 
   _material->createPropsAndVarsVisitors();
 
-  assert(_normalizer);
-  const PylithScalar lengthScale = _normalizer->lengthScale();
-  const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
-
   const PylithScalar dt = _dt;assert(dt > 0);
   const PylithScalar viscosity = dt*_normViscosity;assert(_normViscosity >= 0.0);
 
@@ -284,31 +276,20 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
     const scalar_array& basis = _quadrature->basis();
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
     const scalar_array& jacobianDet = _quadrature->jacobianDet();
-    const scalar_array& quadPtsNondim = _quadrature->quadPts();
 
     // Compute body force vector if gravity is being used.
     if (_gravityField) {
-      const spatialdata::geocoords::CoordSys* cs = fields->mesh().coordsys();assert(cs);
-
       // Get density at quadrature points for this cell
       const scalar_array& density = _material->calcDensity();
 
-      quadPtsGlobal = quadPtsNondim;
-      _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-
       // Compute action for element body forces
-      spatialdata::spatialdb::SpatialDB* db = _gravityField;
+      const PylithScalar* gravCell = _gravityCell(c);
       for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
-        const int err = db->query(&gravVec[0], gravVec.size(), &quadPtsGlobal[0], spaceDim, cs);
-        if (err) {
-          throw std::runtime_error("Unable to get gravity vector for point.");
-        } // if
-        _normalizer->nondimensionalize(&gravVec[0], gravVec.size(), gravityScale);
         const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad] * density[iQuad];
         for (int iBasis = 0, iQ = iQuad * numBasis; iBasis < numBasis; ++iBasis) {
           const PylithScalar valI = wt * basis[iQ + iBasis];
           for (int iDim = 0; iDim < spaceDim; ++iDim) {
-            _cellVector[iBasis*spaceDim+iDim] += valI * gravVec[iDim];
+            _cellVector[iBasis*spaceDim+iDim] += valI * gravCell[iQuad*spaceDim+iDim];
           } // for
         } // for
       } // for
@@ -0,0 +1,591 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "ElasticityExplicitHex8.hh" // implementation of class methods
+
+#include "Quadrature.hh" // USES Quadrature
+
+#include "pylith/materials/ElasticMaterial.hh" // USES ElasticMaterial
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/Stratum.hh" // USES StratumIS
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimendional
+
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <algorithm> // USES std::min()
+
+// ----------------------------------------------------------------------
+const int pylith::feassemble::ElasticityExplicitHex8::_spaceDim = 3;
+const int pylith::feassemble::ElasticityExplicitHex8::_cellDim = 3;
+const int pylith::feassemble::ElasticityExplicitHex8::_tensorSize = 6;
+const int pylith::feassemble::ElasticityExplicitHex8::_numBasis = 8;
+const int pylith::feassemble::ElasticityExplicitHex8::_numCorners = 8;
+const int pylith::feassemble::ElasticityExplicitHex8::_numQuadPts = 8;
+const int pylith::feassemble::ElasticityExplicitHex8::_batchSize = 64;
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::feassemble::ElasticityExplicitHex8::ElasticityExplicitHex8(void) :
+  _dtm1(-1.0),
+  _normViscosity(0.1)
+{ // constructor
+  // Geometry is stored in a compact layout by _setupCellData().
+  _allowGeometryCache = false;
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::feassemble::ElasticityExplicitHex8::~ElasticityExplicitHex8(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::feassemble::ElasticityExplicitHex8::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  IntegratorElasticity::deallocate();
+
+  _basisDerivCells.resize(0);
+  _wtsCells.resize(0);
+  _massCells.resize(0);
+  _bodyForceCells.resize(0);
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Set time step for advancing from time t to time t+dt.
+void
+pylith::feassemble::ElasticityExplicitHex8::timeStep(const PylithScalar dt)
+{ // timeStep
+  PYLITH_METHOD_BEGIN;
+
+  if (_dt != -1.0)
+    _dtm1 = _dt;
+  else
+    _dtm1 = dt;
+  _dt = dt;
+  assert(_dt == _dtm1); // For now, don't allow variable time step
+  if (_material)
+    _material->timeStep(_dt);
+
+  PYLITH_METHOD_END;
+} // timeStep
+
+// ----------------------------------------------------------------------
+// Get stable time step for advancing from time t to time t+dt.
+PylithScalar
+pylith::feassemble::ElasticityExplicitHex8::stableTimeStep(const topology::Mesh& mesh) const
+{ // stableTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_material);
+  PYLITH_METHOD_RETURN(_material->stableTimeStepExplicit(mesh, _quadrature));
+} // stableTimeStep
+
+// ----------------------------------------------------------------------
+// Set normalized viscosity for numerical damping.
+void
+pylith::feassemble::ElasticityExplicitHex8::normViscosity(const PylithScalar viscosity)
+{ // normViscosity
+  PYLITH_METHOD_BEGIN;
+
+  if (viscosity < 0.0) {
+    std::ostringstream msg;
+    msg << "Normalized viscosity (" << viscosity << ") must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _normViscosity = viscosity;
+
+  PYLITH_METHOD_END;
+} // normViscosity
+
+// ----------------------------------------------------------------------
+// Initialize integrator.
+void
+pylith::feassemble::ElasticityExplicitHex8::initialize(const topology::Mesh& mesh)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  IntegratorElasticity::initialize(mesh);
+  _setupCellData(mesh);
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Integrate constributions to residual term (r) for operator.
+void
+pylith::feassemble::ElasticityExplicitHex8::integrateResidual(const topology::Field& residual,
+							      const PylithScalar t,
+							      topology::SolutionFields* const fields)
+{ // integrateResidual
+  PYLITH_METHOD_BEGIN;
+
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(fields);
+
+  const int setupEvent = _logger->eventId("ElIR setup");
+  const int computeEvent = _logger->eventId("ElIR compute");
+
+  _logger->eventBegin(setupEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  assert(_quadrature->numQuadPts() == _numQuadPts);
+  assert(_quadrature->numBasis() == _numBasis);
+  assert(_quadrature->spaceDim() == _spaceDim);
+  assert(_quadrature->cellDim() == _cellDim);
+  assert(_material->tensorSize() == _tensorSize);
+  const int spaceDim = _spaceDim;
+  const int tensorSize = _tensorSize;
+  const int numBasis = _numBasis;
+  const int numQuadPts = _numQuadPts;
+  const int cellVectorSize = numBasis*spaceDim;
+  const int basisDerivSize = numBasis*spaceDim*numQuadPts;
+
+  // Get cell information
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+  assert(_wtsCells.size() == size_t(numCells*numQuadPts));
+  assert(_basisDerivCells.size() == size_t(numCells*basisDerivSize));
+  assert(_massCells.size() == size_t(numCells*numBasis));
+
+  // Setup field visitors.
+  scalar_array accCell(cellVectorSize);
+  topology::VecVisitorMesh accVisitor(fields->get("acceleration(t)"), "displacement");
+  accVisitor.optimizeClosure();
+
+  scalar_array velCell(cellVectorSize);
+  topology::VecVisitorMesh velVisitor(fields->get("velocity(t)"), "displacement");
+  velVisitor.optimizeClosure();
+
+  scalar_array dispCell(cellVectorSize);
+  topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
+  dispVisitor.optimizeClosure();
+
+  topology::VecVisitorMesh residualVisitor(residual, "displacement");
+  residualVisitor.optimizeClosure();
+
+  _material->createPropsAndVarsVisitors();
+
+  const PylithScalar dt = _dt;assert(dt > 0);
+  const PylithScalar viscosity = dt*_normViscosity;assert(_normViscosity >= 0.0);
+
+  // Values for block of cells. Strains and stresses use the
+  // structure-of-arrays layout of ElasticMaterial::calcStressBatch(),
+  // so the values at the quadrature points of a cell are contiguous.
+  const int batchSize = _batchSize;
+  scalar_array accBatch(batchSize*cellVectorSize);
+  scalar_array dispAdjBatch(batchSize*cellVectorSize);
+  scalar_array strainBatch;
+  scalar_array stressBatchCells;
+  scalar_array strainCell(numQuadPts*tensorSize);
+  scalar_array stressWtCell(tensorSize*numQuadPts);
+  const bool useBatchKernels = _material->hasBatchKernels();
+
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(computeEvent);
+
+  // Loop over blocks of cells
+  for (PetscInt cBatch = 0; cBatch < numCells; cBatch += batchSize) {
+    const PetscInt numCellsBatch = std::min(PetscInt(batchSize), numCells-cBatch);
+    const int numPoints = numCellsBatch*numQuadPts;
+    if (strainBatch.size() != size_t(numPoints*tensorSize)) {
+      strainBatch.resize(numPoints*tensorSize);
+    } // if
+
+    // Restrict input fields to cells and compute strains.
+    for (PetscInt iCell = 0; iCell < numCellsBatch; ++iCell) {
+      const PetscInt cell = cells[cBatch+iCell];
+
+      accVisitor.getClosure(&accCell, cell);
+      velVisitor.getClosure(&velCell, cell);
+      dispVisitor.getClosure(&dispCell, cell);
+
+      // Numerical damping. Compute displacements adjusted by velocity
+      // times normalized viscosity.
+      PylithScalar* accB = &accBatch[iCell*cellVectorSize];
+      PylithScalar* dispAdj = &dispAdjBatch[iCell*cellVectorSize];
+      for (int i = 0; i < cellVectorSize; ++i) {
+	accB[i] = accCell[i];
+	dispAdj[i] = dispCell[i] + viscosity * velCell[i];
+      } // for
+
+      const PylithScalar* basisDeriv = &_basisDerivCells[(cBatch+iCell)*basisDerivSize];
+      const int iPoint = iCell*numQuadPts;
+      PylithScalar* e11 = &strainBatch[0*numPoints+iPoint];
+      PylithScalar* e22 = &strainBatch[1*numPoints+iPoint];
+      PylithScalar* e33 = &strainBatch[2*numPoints+iPoint];
+      PylithScalar* e12 = &strainBatch[3*numPoints+iPoint];
+      PylithScalar* e23 = &strainBatch[4*numPoints+iPoint];
+      PylithScalar* e13 = &strainBatch[5*numPoints+iPoint];
+      for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+	e11[iQuad] = e22[iQuad] = e33[iQuad] = 0.0;
+	e12[iQuad] = e23[iQuad] = e13[iQuad] = 0.0;
+      } // for
+      for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
+	const PylithScalar u1 = dispAdj[iBasis*spaceDim  ];
+	const PylithScalar u2 = dispAdj[iBasis*spaceDim+1];
+	const PylithScalar u3 = dispAdj[iBasis*spaceDim+2];
+	const PylithScalar* N1 = &basisDeriv[(iBasis*spaceDim  )*numQuadPts];
+	const PylithScalar* N2 = &basisDeriv[(iBasis*spaceDim+1)*numQuadPts];
+	const PylithScalar* N3 = &basisDeriv[(iBasis*spaceDim+2)*numQuadPts];
+	for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+	  e11[iQuad] += N1[iQuad]*u1;
+	  e22[iQuad] += N2[iQuad]*u2;
+	  e33[iQuad] += N3[iQuad]*u3;
+	  e12[iQuad] += 0.5*(N2[iQuad]*u1 + N1[iQuad]*u2);
+	  e23[iQuad] += 0.5*(N3[iQuad]*u2 + N2[iQuad]*u3);
+	  e13[iQuad] += 0.5*(N3[iQuad]*u1 + N1[iQuad]*u3);
+	} // for
+      } // for
+    } // for
+
+    // Compute stresses for all cells in block.
+    const PylithScalar* stressBatch = 0;
+    if (useBatchKernels) {
+      _material->retrievePropsAndVarsBatch(&cells[cBatch], numCellsBatch);
+      stressBatch = &_material->calcStressBatch(strainBatch, false)[0];
+    } else {
+      if (stressBatchCells.size() != size_t(numPoints*tensorSize)) {
+	stressBatchCells.resize(numPoints*tensorSize);
+      } // if
+      for (PetscInt iCell = 0; iCell < numCellsBatch; ++iCell) {
+	_material->retrievePropsAndVars(cells[cBatch+iCell]);
+	for (int iQuad = 0, iPoint = iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	  for (int iComp = 0; iComp < tensorSize; ++iComp) {
+	    strainCell[iQuad*tensorSize+iComp] = strainBatch[iComp*numPoints+iPoint];
+	  } // for
+	} // for
+	const scalar_array& stressCell = _material->calcStress(strainCell, false);
+	for (int iQuad = 0, iPoint = iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	  for (int iComp = 0; iComp < tensorSize; ++iComp) {
+	    stressBatchCells[iComp*numPoints+iPoint] = stressCell[iQuad*tensorSize+iComp];
+	  } // for
+	} // for
+      } // for
+      stressBatch = &stressBatchCells[0];
+    } // if/else
+    assert(stressBatch);
+
+    // Integrate and assemble contributions of cells in block.
+    for (PetscInt iCell = 0; iCell < numCellsBatch; ++iCell) {
+      const PetscInt c = cBatch+iCell;
+      const PetscInt cell = cells[c];
+
+      // Stresses scaled by quadrature weights.
+      const PylithScalar* wts = &_wtsCells[c*numQuadPts];
+      const int iPoint = iCell*numQuadPts;
+      for (int iComp = 0; iComp < tensorSize; ++iComp) {
+	const PylithScalar* stress = &stressBatch[iComp*numPoints+iPoint];
+	PylithScalar* stressWt = &stressWtCell[iComp*numQuadPts];
+	for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+	  stressWt[iQuad] = wts[iQuad] * stress[iQuad];
+	} // for
+      } // for
+      const PylithScalar* s11 = &stressWtCell[0*numQuadPts];
+      const PylithScalar* s22 = &stressWtCell[1*numQuadPts];
+      const PylithScalar* s33 = &stressWtCell[2*numQuadPts];
+      const PylithScalar* s12 = &stressWtCell[3*numQuadPts];
+      const PylithScalar* s23 = &stressWtCell[4*numQuadPts];
+      const PylithScalar* s13 = &stressWtCell[5*numQuadPts];
+
+      // Body forces and inertial terms.
+      const PylithScalar* mass = &_massCells[c*numBasis];
+      const PylithScalar* accB = &accBatch[iCell*cellVectorSize];
+      if (_bodyForceCells.size() > 0) {
+	const PylithScalar* bodyForce = &_bodyForceCells[c*cellVectorSize];
+	for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
+	  for (int iDim = 0; iDim < spaceDim; ++iDim) {
+	    _cellVector[iBasis*spaceDim+iDim] = bodyForce[iBasis*spaceDim+iDim] - mass[iBasis] * accB[iBasis*spaceDim+iDim];
+	  } // for
+	} // for
+      } else {
+	for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
+	  for (int iDim = 0; iDim < spaceDim; ++iDim) {
+	    _cellVector[iBasis*spaceDim+iDim] = -mass[iBasis] * accB[iBasis*spaceDim+iDim];
+	  } // for
+	} // for
+      } // if/else
+
+      // Compute B(transpose) * sigma
+      const PylithScalar* basisDeriv = &_basisDerivCells[c*basisDerivSize];
+      for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
+	const PylithScalar* N1 = &basisDeriv[(iBasis*spaceDim  )*numQuadPts];
+	const PylithScalar* N2 = &basisDeriv[(iBasis*spaceDim+1)*numQuadPts];
+	const PylithScalar* N3 = &basisDeriv[(iBasis*spaceDim+2)*numQuadPts];
+	PylithScalar f1 = 0.0;
+	PylithScalar f2 = 0.0;
+	PylithScalar f3 = 0.0;
+	for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+	  f1 += N1[iQuad]*s11[iQuad] + N2[iQuad]*s12[iQuad] + N3[iQuad]*s13[iQuad];
+	  f2 += N1[iQuad]*s12[iQuad] + N2[iQuad]*s22[iQuad] + N3[iQuad]*s23[iQuad];
+	  f3 += N1[iQuad]*s13[iQuad] + N2[iQuad]*s23[iQuad] + N3[iQuad]*s33[iQuad];
+	} // for
+	_cellVector[iBasis*spaceDim  ] -= f1;
+	_cellVector[iBasis*spaceDim+1] -= f2;
+	_cellVector[iBasis*spaceDim+2] -= f3;
+      } // for
+
+      // Assemble cell contribution into field
+      residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    } // for
+  } // for
+  _material->destroyPropsAndVarsVisitors();
+
+  // damping + strain + weights + inertia/body force + B^T sigma
+  PetscLogFlops(numCells*(cellVectorSize*2 + numBasis*numQuadPts*21 + numQuadPts*tensorSize + cellVectorSize*2 + numBasis*numQuadPts*15));
+  _logger->eventEnd(computeEvent);
+
+  PYLITH_METHOD_END;
+} // integrateResidual
+
+// ----------------------------------------------------------------------
+// Compute matrix associated with operator.
+void
+pylith::feassemble::ElasticityExplicitHex8::integrateJacobian(topology::Jacobian* jacobian,
+							      const PylithScalar t,
+							      topology::SolutionFields* fields)
+{ // integrateJacobian
+  PYLITH_METHOD_BEGIN;
+
+  throw std::logic_error("ElasticityExplicitHex8::integrateJacobian() not implemented. Use integrateJacobian(lumped) instead.");
+
+  PYLITH_METHOD_END;
+} // integrateJacobian
+
+// ----------------------------------------------------------------------
+// Compute matrix associated with operator.
+void
+pylith::feassemble::ElasticityExplicitHex8::integrateJacobian(topology::Field* jacobian,
+							      const PylithScalar t,
+							      topology::SolutionFields* fields)
+{ // integrateJacobian
+  PYLITH_METHOD_BEGIN;
+
+  assert(_quadrature);
+  assert(_material);
+  assert(jacobian);
+  assert(fields);
+
+  const int setupEvent = _logger->eventId("ElIJ setup");
+  const int computeEvent = _logger->eventId("ElIJ compute");
+
+  _logger->eventBegin(setupEvent);
+
+  const int spaceDim = _spaceDim;
+  const int numBasis = _numBasis;
+
+  // Get cell information
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+  assert(_massCells.size() == size_t(numCells*numBasis));
+
+  // Get parameters used in integration.
+  const PylithScalar dt = _dt;
+  const PylithScalar dt2 = dt*dt;
+  assert(dt > 0);
+
+  // Setup visitors.
+  topology::VecVisitorMesh jacobianVisitor(*jacobian, "displacement");
+  // Don't optimize closure since we compute the Jacobian only once.
+
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(computeEvent);
+
+  // Loop over cells
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+
+    // Lumped mass was computed when the integrator was initialized.
+    const PylithScalar* mass = &_massCells[c*numBasis];
+    for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
+      for (int iDim = 0; iDim < spaceDim; ++iDim) {
+	_cellVector[iBasis*spaceDim+iDim] = mass[iBasis] / dt2;
+      } // for
+    } // for
+
+    // Assemble cell contribution into lumped matrix.
+    jacobianVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+  } // for
+
+  PetscLogFlops(numCells*numBasis*spaceDim);
+  _logger->eventEnd(computeEvent);
+
+  _needNewJacobian = false;
+  _material->resetNeedNewJacobian();
+
+  PYLITH_METHOD_END;
+} // integrateJacobian
+
+// ----------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::feassemble::ElasticityExplicitHex8::verifyConfiguration(const topology::Mesh& mesh) const
+{ // verifyConfiguration
+  PYLITH_METHOD_BEGIN;
+
+  IntegratorElasticity::verifyConfiguration(mesh);
+
+  assert(_quadrature);
+  assert(_material);
+  if (_spaceDim != _quadrature->spaceDim() || _cellDim != _quadrature->cellDim() || _numBasis != _quadrature->numBasis() ||  _numQuadPts != _quadrature->numQuadPts()) {
+    std::ostringstream msg;
+    msg << "User specified quadrature settings material '" << _material->label() << "' do not match ElasticityExplicitHex8 hardwired quadrature settings.\n"
+	<< "  Space dim: " << _spaceDim << " (code), " << _quadrature->spaceDim() << " (user)\n"
+	<< "  Cell dim: " << _cellDim << " (code), " << _quadrature->cellDim() << " (user)\n"
+	<< "  # basis fns: " << _numBasis << " (code), " << _quadrature->numBasis() << " (user)\n"
+	<< "  # quad points: " << _numQuadPts << " (code), " << _quadrature->numQuadPts() << " (user)";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // verifyConfiguration
+
+// ----------------------------------------------------------------------
+// Compute and store geometry, lumped mass, and body forces for each cell.
+void
+pylith::feassemble::ElasticityExplicitHex8::_setupCellData(const topology::Mesh& mesh)
+{ // _setupCellData
+  PYLITH_METHOD_BEGIN;
+
+  assert(_quadrature);
+  assert(_material);
+
+  if (_numQuadPts != _quadrature->numQuadPts() || _numBasis != _quadrature->numBasis() ||
+      _spaceDim != _quadrature->spaceDim() || _cellDim != _quadrature->cellDim()) {
+    throw std::logic_error("Quadrature does not match ElasticityExplicitHex8 hardwired quadrature settings.");
+  } // if
+
+  const int spaceDim = _spaceDim;
+  const int numBasis = _numBasis;
+  const int numCorners = _numCorners;
+  const int numQuadPts = _numQuadPts;
+  const int cellVectorSize = numBasis*spaceDim;
+  const int basisDerivSize = numBasis*spaceDim*numQuadPts;
+  const scalar_array& quadWts = _quadrature->quadWts();
+
+  // Get cell information
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  _basisDerivCells.resize(numCells*basisDerivSize);
+  _wtsCells.resize(numCells*numQuadPts);
+  _massCells.resize(numCells*numBasis);
+  _bodyForceCells.resize(_gravityField ? numCells*cellVectorSize : 0);
+
+  scalar_array coordsCell(numCorners*spaceDim);
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  _material->createPropsAndVarsVisitors();
+
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+
+    coordsVisitor.getClosure(&coordsCell, cell);
+    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+
+    const scalar_array& basis = _quadrature->basis();
+    const scalar_array& basisDeriv = _quadrature->basisDeriv();
+    const scalar_array& jacobianDet = _quadrature->jacobianDet();
+
+    // Reorder derivatives of basis functions so quadrature points vary fastest.
+    PylithScalar* basisDerivCell = &_basisDerivCells[c*basisDerivSize];
+    PylithScalar* wtsCell = &_wtsCells[c*numQuadPts];
+    for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+      wtsCell[iQuad] = quadWts[iQuad] * jacobianDet[iQuad];
+      for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
+	for (int iDim = 0; iDim < spaceDim; ++iDim) {
+	  basisDerivCell[(iBasis*spaceDim+iDim)*numQuadPts+iQuad] = basisDeriv[(iQuad*numBasis+iBasis)*spaceDim+iDim];
+	} // for
+      } // for
+    } // for
+
+    // Get density at quadrature points for this cell
+    _material->retrievePropsAndVars(cell);
+    const scalar_array& density = _material->calcDensity();
+
+    // Lumped mass
+    PylithScalar* massCell = &_massCells[c*numBasis];
+    for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
+      massCell[iBasis] = 0.0;
+    } // for
+    for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+      const PylithScalar wt = wtsCell[iQuad] * density[iQuad];
+      const int iQ = iQuad * numBasis;
+      PylithScalar valJ = 0.0;
+      for (int jBasis = 0; jBasis < numBasis; ++jBasis) {
+	valJ += basis[iQ + jBasis];
+      } // for
+      valJ *= wt;
+      for (int iBasis = 0; iBasis < numBasis; ++iBasis) {
+	massCell[iBasis] += basis[iQ + iBasis] * valJ;
+      } // for
+    } // for
+
+    // Body forces if gravity is being used.
+    if (_gravityField) {
+      PylithScalar* bodyForceCell = &_bodyForceCells[c*cellVectorSize];
+      for (int i = 0; i < cellVectorSize; ++i) {
+	bodyForceCell[i] = 0.0;
+      } // for
+      const PylithScalar* gravCell = _gravityCell(c);
+      for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+	const PylithScalar wt = wtsCell[iQuad] * density[iQuad];
+	for (int iBasis = 0, iQ = iQuad * numBasis; iBasis < numBasis; ++iBasis) {
+	  const PylithScalar valI = wt * basis[iQ + iBasis];
+	  for (int iDim = 0; iDim < spaceDim; ++iDim) {
+	    bodyForceCell[iBasis*spaceDim+iDim] += valI * gravCell[iQuad*spaceDim+iDim];
+	  } // for
+	} // for
+      } // for
+    } // if
+  } // for
+  _material->destroyPropsAndVarsVisitors();
+
+  PYLITH_METHOD_END;
+} // _setupCellData
+
+
+// End of file
@@ -0,0 +1,202 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/feassemble/ElasticityExplicitHex8.hh
+ *
+ * @brief Explicit time integration of dynamic elasticity equation
+ * using trilinear hexahedral finite-elements.
+ */
+
+#if !defined(pylith_feassemble_elasticityexplicithex8_hh)
+#define pylith_feassemble_elasticityexplicithex8_hh
+
+// Include directives ---------------------------------------------------
+#include "IntegratorElasticity.hh" // ISA IntegratorElasticity
+
+#include "pylith/utils/arrayfwd.hh" // HASA scalar_array
+
+// ElasticityExplicitHex8 -----------------------------------------------
+/**@brief Explicit time integration of the dynamic elasticity equation
+ * using trilinear hexahedral finite-elements with 2x2x2 quadrature.
+ *
+ * Note: This object operates on a single finite-element family, which
+ * is defined by the quadrature and a database of material property
+ * parameters.
+ *
+ * Computes contributions to terms A and r in
+ *
+ * A(t+dt) du(t) = b(t+dt, u(t), u(t-dt)) - A(t+dt) u(t),
+ *
+ * r(t+dt) = b(t+dt) - A(t+dt) (u(t) + du(t))
+ *
+ * where A(t) is a sparse matrix or vector, u(t+dt) is the field we
+ * want to compute at time t+dt, b is a vector that depends on the
+ * field at time t and t-dt, and u0 is zero at unknown DOF and set to
+ * the known values at the constrained DOF.
+ *
+ * Contributions from elasticity include the intertial and stiffness
+ * terms, so this object computes the following portions of A and r:
+ *
+ * A = 1/(dt*dt) [M]
+ *
+ * r = (1/(dt*dt) [M])(- {u(t+dt)} + 2/(dt*dt){u(t)} - {u(t-dt)}) - [K]{u(t)}
+ *
+ * The mesh does not change during a simulation, so the derivatives
+ * of the basis functions, the quadrature weights scaled by the
+ * determinant of the Jacobian, the lumped mass, and the body forces
+ * are computed once for each cell when the integrator is
+ * initialized. Integrating the residual then only requires the strain,
+ * stress, and B^T sigma operations, which are done for blocks of cells
+ * with loops over the quadrature points that the compiler can
+ * vectorize. Stresses for a block are computed with the material's
+ * batched kernels when available.
+ *
+ * See governing equations section of user manual for more
+ * information.
+*/
+class pylith::feassemble::ElasticityExplicitHex8 : public IntegratorElasticity
+{ // ElasticityExplicitHex8
+  friend class TestElasticityExplicitHex8; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  ElasticityExplicitHex8(void);
+
+  /// Destructor
+  ~ElasticityExplicitHex8(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set time step for advancing from time t to time t+dt.
+   *
+   * @param dt Time step
+   */
+  void timeStep(const PylithScalar dt);
+
+  /** Get stable time step for advancing from time t to time t+dt.
+   *
+   * Default is current time step.
+   *
+   * @param mesh Finite-element mesh.
+   * @returns Time step
+   */
+  PylithScalar stableTimeStep(const topology::Mesh& mesh) const;
+
+  /** Set normalized viscosity for numerical damping.
+   *
+   * @param viscosity Normalized viscosity (viscosity / elastic modulus).
+   */
+  void normViscosity(const PylithScalar viscosity);
+
+  /** Initialize integrator.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void initialize(const topology::Mesh& mesh);
+
+  /** Integrate contributions to residual term (r) for operator.
+   *
+   * @param residual Field containing values for residual
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateResidual(const topology::Field& residual,
+			 const PylithScalar t,
+			 topology::SolutionFields* const fields);
+
+  /** Integrate contributions to Jacobian matrix (A) associated with
+   * operator.
+   *
+   * @param jacobian Diagonal matrix (as field) for Jacobian of system.
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateJacobian(topology::Field* jacobian,
+			 const PylithScalar t,
+			 topology::SolutionFields* const fields);
+
+  /** Verify configuration is acceptable.
+   *
+   * @param mesh Finite-element mesh
+   */
+  void verifyConfiguration(const topology::Mesh& mesh) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Compute and store geometry, lumped mass, and body forces for
+   * each cell.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void _setupCellData(const topology::Mesh& mesh);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  PylithScalar _dtm1; ///< Time step for t-dt1 -> t
+  PylithScalar _normViscosity; ///< Normalized viscosity for numerical damping.
+
+  /// Derivatives of basis functions for each cell with quadrature
+  /// points varying fastest [numCells][numBasis][spaceDim][numQuadPts].
+  scalar_array _basisDerivCells;
+
+  /// Quadrature weights times determinant of Jacobian for each cell
+  /// [numCells][numQuadPts].
+  scalar_array _wtsCells;
+
+  /// Lumped mass (density times integral of basis function) for each
+  /// cell [numCells][numBasis].
+  scalar_array _massCells;
+
+  /// Body forces from gravity for each cell [numCells][numBasis*spaceDim];
+  /// empty if there is no gravity field.
+  scalar_array _bodyForceCells;
+
+  static const int _spaceDim;
+  static const int _cellDim;
+  static const int _tensorSize;
+  static const int _numBasis;
+  static const int _numCorners;
+  static const int _numQuadPts;
+  static const int _batchSize;
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  /// Not implemented.
+  ElasticityExplicitHex8(const ElasticityExplicitHex8&);
+
+  /// Not implemented
+  const ElasticityExplicitHex8& operator=(const ElasticityExplicitHex8&);
+
+  /// Not implemented.
+  void integrateJacobian(topology::Jacobian*,
+			 const PylithScalar,
+			 topology::SolutionFields* const);
+
+}; // ElasticityExplicitHex8
+
+#endif // pylith_feassemble_elasticityexplicithex8_hh
+
+
+// End of file
@@ -36,8 +36,6 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
-#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
-#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimendional
 
@@ -186,8 +184,6 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
   // Allocate vectors for cell values.
   scalar_array strainCell(numQuadPts*tensorSize);
   strainCell = 0.0;
-  scalar_array gravVec(spaceDim);
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
 
   // Get cell information
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
@@ -217,10 +213,6 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
 
   _material->createPropsAndVarsVisitors();
 
-  assert(_normalizer);
-  const PylithScalar lengthScale = _normalizer->lengthScale();
-  const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
-
   const PylithScalar dt = _dt;assert(dt > 0);
   const PylithScalar viscosity = dt*_normViscosity;assert(_normViscosity >= 0.0);
 
@@ -274,23 +266,8 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
 
     // Compute body force vector if gravity is being used.
     if (_gravityField) {
-      const spatialdata::geocoords::CoordSys* cs = fields->mesh().coordsys();assert(cs);
-
-      quadPtsGlobal = 0.0;
-      for (int iBasis=0; iBasis < numBasis; ++iBasis) {
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-          quadPtsGlobal[iDim] += coordsCell[iBasis*spaceDim+iDim] / numBasis;
-	} // for
-      } // for
-      _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-
       // Compute action for element body forces
-      spatialdata::spatialdb::SpatialDB* db = _gravityField;
-      const int err = db->query(&gravVec[0], gravVec.size(), &quadPtsGlobal[0], spaceDim, cs);
-      if (err) {
-        throw std::runtime_error("Unable to get gravity vector for point.");
-      } // if
-      _normalizer->nondimensionalize(&gravVec[0], gravVec.size(), gravityScale);
+      const PylithScalar* gravVec = _gravityCell(c);
       const PylithScalar wtVertex = density[0] * volume / 4.0;
       for (int iBasis=0; iBasis < numBasis; ++iBasis) {
         for (int iDim=0; iDim < spaceDim; ++iDim) {
@@ -434,7 +411,7 @@ pylith::feassemble::ElasticityExplicitTet4::integrateJacobian(topology::Jacobian
 { // integrateJacobian
   PYLITH_METHOD_BEGIN;
   
-  throw std::logic_error("ElasticityExplicit::integrateJacobian() not implemented. Use integrateJacobian(lumped) instead.");
+  throw std::logic_error("ElasticityExplicitTet4::integrateJacobian() not implemented. Use integrateJacobian(lumped) instead.");
 
   PYLITH_METHOD_END;
 } // integrateJacobian
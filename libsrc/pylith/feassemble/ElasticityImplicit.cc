@@ -34,12 +34,9 @@
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
-#include "pylith/utils/lapack.h" // USES LAPACKdgesvd
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
-#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
-#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimendional
 
@@ -47,11 +44,23 @@
 
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <iostream> // USES std::cerr
+#include <algorithm> // USES std::min()
+#include <string> // USES std::string
 
 // ----------------------------------------------------------------------
 // Constructor
 pylith::feassemble::ElasticityImplicit::ElasticityImplicit(void) :
-  _dtm1(-1.0)
+  _dtm1(-1.0),
+  _numThreads(1),
+  _deterministicAssembly(true),
+  _closureSection(NULL),
+  _closureChartStart(0),
+  _closureChartEnd(0),
+  _closureStorageSize(-1),
+  _reuseCellMatrices(false),
+  _cellMatricesValid(false)
 { // constructor
 } // constructor
 
@@ -71,6 +80,18 @@ pylith::feassemble::ElasticityImplicit::deallocate(void)
 
   IntegratorElasticity::deallocate();
 
+  _closureSection = NULL;
+  _closureChartStart = 0;
+  _closureChartEnd = 0;
+  _closureStorageSize = -1;
+  _closureIndices.resize(0);
+  _colorOffsets.clear();
+  _coloredCells.clear();
+  _elasticConstsCells.resize(0);
+  _cellMatrices.resize(0);
+  _elasticConstsHashes.clear();
+  _cellMatricesValid = false;
+
   PYLITH_METHOD_END;
 } // deallocate
   
@@ -103,6 +124,72 @@ pylith::feassemble::ElasticityImplicit::stableTimeStep(const topology::Mesh& mes
   PYLITH_METHOD_RETURN(_material->stableTimeStepImplicit(mesh));
 } // stableTimeStep
 
+// ----------------------------------------------------------------------
+// Set number of threads used in loops over cells.
+void
+pylith::feassemble::ElasticityImplicit::numThreads(const int value)
+{ // numThreads
+  if (value < 1) {
+    std::ostringstream msg;
+    msg << "Number of threads (" << value << ") must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+#if defined(_OPENMP)
+  _numThreads = value;
+#else
+  if (value > 1) {
+    std::cerr << "WARNING: PyLith was built without OpenMP, so the number of threads ("
+	      << value << ") is ignored and loops over cells use a single thread." << std::endl;
+  } // if
+  _numThreads = 1;
+#endif
+} // numThreads
+
+// ----------------------------------------------------------------------
+// Get number of threads used in loops over cells.
+int
+pylith::feassemble::ElasticityImplicit::numThreads(void) const
+{ // numThreads
+  return _numThreads;
+} // numThreads
+
+// ----------------------------------------------------------------------
+// Set flag for bitwise-reproducible threaded assembly of the residual.
+void
+pylith::feassemble::ElasticityImplicit::deterministicAssembly(const bool flag)
+{ // deterministicAssembly
+  _deterministicAssembly = flag;
+} // deterministicAssembly
+
+// ----------------------------------------------------------------------
+// Get flag for bitwise-reproducible threaded assembly of the residual.
+bool
+pylith::feassemble::ElasticityImplicit::deterministicAssembly(void) const
+{ // deterministicAssembly
+  return _deterministicAssembly;
+} // deterministicAssembly
+
+// ----------------------------------------------------------------------
+// Set flag for reusing cell matrices between reformations of the Jacobian.
+void
+pylith::feassemble::ElasticityImplicit::reuseCellMatrices(const bool flag)
+{ // reuseCellMatrices
+  _reuseCellMatrices = flag;
+  if (!flag) {
+    _cellMatrices.resize(0);
+    _elasticConstsHashes.clear();
+  } // if
+  _cellMatricesValid = false;
+} // reuseCellMatrices
+
+// ----------------------------------------------------------------------
+// Get flag for reusing cell matrices between reformations of the Jacobian.
+bool
+pylith::feassemble::ElasticityImplicit::reuseCellMatrices(void) const
+{ // reuseCellMatrices
+  return _reuseCellMatrices;
+} // reuseCellMatrices
+
 // ----------------------------------------------------------------------
 void
 pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field& residual,
@@ -114,6 +201,19 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
   /// Member prototype for _elasticityResidualXD()
   typedef void (pylith::feassemble::ElasticityImplicit::*elasticityResidual_fn_type)
     (const scalar_array&);
+
+#if defined(_OPENMP)
+  if (_numThreads > 1) {
+    _integrateResidualThreaded(residual, t, fields);
+    PYLITH_METHOD_END;
+  } // if
+#endif
+
+  assert(_material);
+  if (_material->hasBatchKernels()) {
+    _integrateResidualBatched(residual, t, fields);
+    PYLITH_METHOD_END;
+  } // if
   
   assert(_quadrature);
   assert(_material);
@@ -159,12 +259,15 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
     throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateResidual().");
   } // if/else		   
 
+  // Use kernels specialized for the cell type if available.
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
+
   // Allocate vectors for cell values.
   scalar_array dispTpdtCell(numBasis*spaceDim);
   scalar_array strainCell(numQuadPts*tensorSize);
   strainCell = 0.0;
-  scalar_array gravVec(spaceDim);
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
 
   // Get cell information
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
@@ -189,10 +292,6 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
 
   _material->createPropsAndVarsVisitors();
 
-  assert(_normalizer);
-  const PylithScalar lengthScale = _normalizer->lengthScale();
-  const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
-
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(computeEvent);
 
@@ -217,7 +316,6 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
     const scalar_array& basis = _quadrature->basis();
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
     const scalar_array& jacobianDet = _quadrature->jacobianDet();
-    const scalar_array& quadPtsNondim = _quadrature->quadPts();
 
     // Compute current estimate of displacement at time t+dt using solution increment.
     for(PetscInt i = 0, dispSize = dispCell.size(); i < dispSize; ++i) {
@@ -226,27 +324,17 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
 
     // Compute body force vector if gravity is being used.
     if (_gravityField) {
-      const spatialdata::geocoords::CoordSys* cs = fields->mesh().coordsys();assert(cs);
-
       // Get density at quadrature points for this cell
       const scalar_array& density = _material->calcDensity();
 
-      quadPtsGlobal = quadPtsNondim;
-      _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-
       // Compute action for element body forces
-      spatialdata::spatialdb::SpatialDB* db = _gravityField;
+      const PylithScalar* gravCell = _gravityCell(c);
       for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
-        const int err = db->query(&gravVec[0], gravVec.size(), &quadPtsGlobal[0], spaceDim, cs);
-        if (err) {
-	  throw std::runtime_error("Unable to get gravity vector for point.");
-	} // if
-        _normalizer->nondimensionalize(&gravVec[0], gravVec.size(), gravityScale);
         const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad] * density[iQuad];
         for (int iBasis = 0, iQ = iQuad * numBasis; iBasis < numBasis; ++iBasis) {
           const PylithScalar valI = wt * basis[iQ + iBasis];
           for (int iDim = 0; iDim < spaceDim; ++iDim) {
-            _cellVector[iBasis * spaceDim + iDim] += valI * gravVec[iDim];
+            _cellVector[iBasis * spaceDim + iDim] += valI * gravCell[iQuad*spaceDim+iDim];
           } // for
         } // for
       } // for
@@ -289,6 +377,21 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
   typedef void (pylith::feassemble::ElasticityImplicit::*elasticityJacobian_fn_type)
     (const scalar_array&);
 
+#if defined(_OPENMP)
+  if (_numThreads > 1) {
+    _integrateJacobianThreaded(jacobian, t, fields);
+    PYLITH_METHOD_END;
+  } // if
+#endif
+
+  // Elasticity constants that depend only on the properties are
+  // cached, which is faster than evaluating them in batches.
+  assert(_material);
+  if (_material->hasBatchKernels() && !_material->hasConstantElasticConsts()) {
+    _integrateJacobianBatched(jacobian, t, fields);
+    PYLITH_METHOD_END;
+  } // if
+
   assert(_quadrature);
   assert(_material);
   assert(_logger);
@@ -331,6 +434,11 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
     throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateJacobian().");
   } // if/else
 
+  // Use kernels specialized for the cell type if available.
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
+
   // Allocate vector for total strain
   scalar_array dispTpdtCell(numBasis*spaceDim);
   scalar_array strainCell(numQuadPts*tensorSize);
@@ -364,9 +472,206 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
   const PylithScalar dt = _dt;
   assert(dt > 0);
 
+  // Elasticity constants that depend only on the properties are
+  // computed once and reused, so we skip retrieving the properties and
+  // computing the strain.
+  const bool constantElasticConsts = _material->hasConstantElasticConsts();
+  scalar_array elasticConstsCell;
+  if (constantElasticConsts) {
+    _material->updateElasticConstsCache();
+    elasticConstsCell.resize(numQuadPts*tensorSize*tensorSize);
+  } // if
+
+  const int cellMatrixSize = _cellMatrix.size();
+  if (_reuseCellMatrices) {
+    _setupCellMatrixReuse(numCells, cellMatrixSize);
+  } // if
+
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(computeEvent);
 
+  // Loop over cells
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+
+    const scalar_array* elasticConsts = 0;
+    bool haveGeometry = false;
+    if (constantElasticConsts) {
+      const PylithScalar* elasticConstsCached = _material->cachedElasticConsts(cell);
+      for (size_t i = 0, size = elasticConstsCell.size(); i < size; ++i) {
+	elasticConstsCell[i] = elasticConstsCached[i];
+      } // for
+      elasticConsts = &elasticConstsCell;
+    } else {
+      // Compute geometry information for current cell
+      coordsVisitor.getClosure(&coordsCell, cell);
+      _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+      haveGeometry = true;
+
+      // Get physical properties and state variables for cell.
+      _material->retrievePropsAndVars(cell);
+
+      // Restrict input fields to cell
+      dispVisitor.getClosure(&dispCell, cell);
+      dispIncrVisitor.getClosure(&dispIncrCell, cell);
+
+      // Get cell geometry information that depends on cell
+      const scalar_array& basisDeriv = _quadrature->basisDeriv();
+
+      // Compute current estimate of displacement at time t+dt using solution increment.
+      for(PetscInt i = 0, dispSize = dispCell.size(); i < dispSize; ++i) {
+	dispTpdtCell[i] = dispCell[i] + dispIncrCell[i];
+      } // for
+      
+      // Compute strains
+      calcTotalStrainFn(&strainCell, basisDeriv, &dispTpdtCell[0], numBasis, spaceDim, numQuadPts);
+      
+      // Get "elasticity" matrix at quadrature points for this cell
+      elasticConsts = &_material->calcDerivElastic(strainCell);
+    } // if/else
+    assert(elasticConsts);
+
+    // Add stored cell matrix if elasticity constants are unchanged.
+    unsigned long long elasticConstsHash = 0;
+    if (_reuseCellMatrices) {
+      elasticConstsHash = _hashElasticConsts(*elasticConsts);
+      if (_cellMatricesValid && elasticConstsHash == _elasticConstsHashes[c]) {
+	jacobianVisitor.setClosure(&_cellMatrices[c*cellMatrixSize], cellMatrixSize, cell, ADD_VALUES);
+	continue;
+      } // if
+    } // if
+
+    if (!haveGeometry) {
+      // Compute geometry information for current cell
+      coordsVisitor.getClosure(&coordsCell, cell);
+      _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+    } // if
+
+    // Reset element matrix to zero
+    _resetCellMatrix();
+
+    CALL_MEMBER_FN(*this, elasticityJacobianFn)(*elasticConsts);
+
+    if (_reuseCellMatrices) {
+      for (int i = 0; i < cellMatrixSize; ++i) {
+	_cellMatrices[c*cellMatrixSize+i] = _cellMatrix[i];
+      } // for
+      _elasticConstsHashes[c] = elasticConstsHash;
+    } // if
+
+    // Assemble cell contribution into PETSc matrix.
+    //   Notice that we are using the default sections
+    jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
+  } // for
+  _material->destroyPropsAndVarsVisitors();
+  _cellMatricesValid = _reuseCellMatrices;
+
+  _needNewJacobian = false;
+  _material->resetNeedNewJacobian();
+
+  _logger->eventEnd(computeEvent);
+
+  PYLITH_METHOD_END;
+} // integrateJacobian
+
+// ----------------------------------------------------------------------
+// Check whether integrator supports matrix-free Jacobian.
+bool
+pylith::feassemble::ElasticityImplicit::hasJacobianAction(void) const
+{ // hasJacobianAction
+  return true;
+} // hasJacobianAction
+
+// ----------------------------------------------------------------------
+// Compute elasticity constants for matrix-free Jacobian.
+void
+pylith::feassemble::ElasticityImplicit::prepareJacobianAction(const PylithScalar t,
+							      topology::SolutionFields* const fields)
+{ // prepareJacobianAction
+  PYLITH_METHOD_BEGIN;
+
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(fields);
+
+  const int computeEvent = _logger->eventId("ElIJ compute");
+  _logger->eventBegin(computeEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  const int numQuadPts = _quadrature->numQuadPts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const int cellDim = _quadrature->cellDim();
+  const int tensorSize = _material->tensorSize();
+  const int numConsts = tensorSize*tensorSize;
+  if (cellDim != spaceDim)
+    throw std::logic_error("Don't know how to integrate elasticity " \
+			   "contribution to Jacobian matrix for cells with " \
+			   "different dimensions than the spatial dimension.");
+
+  // Set variables dependent on dimension of cell
+  totalStrain_fn_type calcTotalStrainFn;
+  if (2 == cellDim) {
+    calcTotalStrainFn = 
+      &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
+  } else if (3 == cellDim) {
+    calcTotalStrainFn = 
+      &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
+  } else {
+    assert(false);
+    throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::prepareJacobianAction().");
+  } // if/else
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
+
+  // Allocate vector for total strain
+  scalar_array dispTpdtCell(numBasis*spaceDim);
+  scalar_array strainCell(numQuadPts*tensorSize);
+  strainCell = 0.0;
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  const size_t cellConstsSize = numQuadPts*numConsts;
+  if (_elasticConstsCells.size() != numCells*cellConstsSize) {
+    _elasticConstsCells.resize(numCells*cellConstsSize);
+  } // if
+
+  // Setup field visitors.
+  scalar_array dispCell(numBasis*spaceDim);
+  topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
+  dispVisitor.optimizeClosure();
+
+  scalar_array dispIncrCell(numBasis*spaceDim);
+  topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
+  dispIncrVisitor.optimizeClosure();
+
+  scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  if (_material->hasConstantElasticConsts()) {
+    _material->updateElasticConstsCache();
+    for(PetscInt c = 0; c < numCells; ++c) {
+      const PylithScalar* elasticConsts = _material->cachedElasticConsts(cells[c]);
+      for(size_t i = 0, iC = c*cellConstsSize; i < cellConstsSize; ++i) {
+	_elasticConstsCells[iC+i] = elasticConsts[i];
+      } // for
+    } // for
+    _needNewJacobian = false;
+    _material->resetNeedNewJacobian();
+
+    _logger->eventEnd(computeEvent);
+
+    PYLITH_METHOD_END;
+  } // if
+
+  _material->createPropsAndVarsVisitors();
+
   // Loop over cells
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
@@ -378,67 +683,23 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
     // Get physical properties and state variables for cell.
     _material->retrievePropsAndVars(cell);
 
-    // Reset element matrix to zero
-    _resetCellMatrix();
-
     // Restrict input fields to cell
     dispVisitor.getClosure(&dispCell, cell);
     dispIncrVisitor.getClosure(&dispIncrCell, cell);
 
-    // Get cell geometry information that depends on cell
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
     // Compute current estimate of displacement at time t+dt using solution increment.
     for(PetscInt i = 0, dispSize = dispCell.size(); i < dispSize; ++i) {
       dispTpdtCell[i] = dispCell[i] + dispIncrCell[i];
     } // for
-      
-    // Compute strains
+
     calcTotalStrainFn(&strainCell, basisDeriv, &dispTpdtCell[0], numBasis, spaceDim, numQuadPts);
-      
-    // Get "elasticity" matrix at quadrature points for this cell
     const scalar_array& elasticConsts = _material->calcDerivElastic(strainCell);
-
-    CALL_MEMBER_FN(*this, elasticityJacobianFn)(elasticConsts);
-
-    if (_quadrature->checkConditioning()) {
-      int n = numBasis*spaceDim;
-      int lwork = 5*n;
-      int idummy = 0;
-      int lierr = 0;
-      PylithScalar *elemMat = new PylithScalar[n*n];
-      PylithScalar *svalues = new PylithScalar[n];
-      PylithScalar *work    = new PylithScalar[lwork];
-#if 0
-      PylithScalar minSV = 0;
-      PylithScalar maxSV = 0;
-#endif
-      PylithScalar sdummy = 0;
-
-      const int n2 = n*n;
-      for (int i = 0; i < n2; ++i)
-        elemMat[i] = _cellMatrix[i];
-      lapack_dgesvd("N", "N", &n, &n, elemMat, &n, svalues, 
-		    &sdummy, &idummy, &sdummy, &idummy, work,
-		    &lwork, &lierr);
-      if (lierr)
-        throw std::runtime_error("Lapack SVD failed");
-#if 0
-      minSV = svalues[n-7];
-      maxSV = svalues[0];
-      std::cout << "Element " << cell << std::endl;
-      for(int i = 0; i < n; ++i)
-        std::cout << "    sV["<<i<<"] = " << svalues[i] << std::endl;
-      std::cout << "  kappa(elemMat) = " << maxSV/minSV << std::endl;
-#endif
-      delete [] elemMat;
-      delete [] svalues;
-      delete [] work;
-    } // if
-
-    // Assemble cell contribution into PETSc matrix.
-    //   Notice that we are using the default sections
-    jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
+    assert(elasticConsts.size() == cellConstsSize);
+    for(size_t i = 0, iC = c*cellConstsSize; i < cellConstsSize; ++i) {
+      _elasticConstsCells[iC+i] = elasticConsts[i];
+    } // for
   } // for
   _material->destroyPropsAndVarsVisitors();
 
@@ -448,7 +709,1180 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
   _logger->eventEnd(computeEvent);
 
   PYLITH_METHOD_END;
-} // integrateJacobian
+} // prepareJacobianAction
+
+// ----------------------------------------------------------------------
+// Integrate contributions to action of Jacobian on a field.
+void
+pylith::feassemble::ElasticityImplicit::integrateJacobianAction(const topology::Field& action,
+								const topology::Field& input,
+								const PylithScalar t,
+								topology::SolutionFields* const fields)
+{ // integrateJacobianAction
+  PYLITH_METHOD_BEGIN;
+
+  /// Member prototype for _elasticityResidualXD()
+  typedef void (pylith::feassemble::ElasticityImplicit::*elasticityResidual_fn_type)
+    (const scalar_array&);
+
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(fields);
+
+  const int computeEvent = _logger->eventId("ElIR compute");
+  _logger->eventBegin(computeEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  const int numQuadPts = _quadrature->numQuadPts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const int cellDim = _quadrature->cellDim();
+  const int tensorSize = _material->tensorSize();
+  const int numConsts = tensorSize*tensorSize;
+
+  // Set variables dependent on dimension of cell
+  totalStrain_fn_type calcTotalStrainFn;
+  elasticityResidual_fn_type elasticityResidualFn;
+  if (2 == cellDim) {
+    elasticityResidualFn = &pylith::feassemble::ElasticityImplicit::_elasticityResidual2D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
+  } else if (3 == cellDim) {
+    elasticityResidualFn = &pylith::feassemble::ElasticityImplicit::_elasticityResidual3D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
+  } else {
+    assert(false);
+    throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateJacobianAction().");
+  } // if/else
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
+
+  scalar_array strainCell(numQuadPts*tensorSize);
+  strainCell = 0.0;
+  scalar_array stressCell(numQuadPts*tensorSize);
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+  const size_t cellConstsSize = numQuadPts*numConsts;
+  if (_elasticConstsCells.size() != numCells*cellConstsSize) {
+    throw std::logic_error("Elasticity constants for matrix-free Jacobian not computed. "
+			   "Call prepareJacobianAction() first.");
+  } // if
+
+  // Setup field visitors.
+  scalar_array inputCell(numBasis*spaceDim);
+  topology::VecVisitorMesh inputVisitor(input, "displacement");
+  inputVisitor.optimizeClosure();
+
+  topology::VecVisitorMesh actionVisitor(action, "displacement");
+  actionVisitor.optimizeClosure();
+
+  scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  // Loop over cells
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+
+    // Compute geometry information for current cell
+    coordsVisitor.getClosure(&coordsCell, cell);
+    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+
+    _resetCellVector();
+
+    inputVisitor.getClosure(&inputCell, cell);
+    const scalar_array& basisDeriv = _quadrature->basisDeriv();
+
+    // Compute stress from linearized constitutive relation. The
+    // residual kernel integrates -B^T sigma, so negate the stress to
+    // get +B^T C B input.
+    calcTotalStrainFn(&strainCell, basisDeriv, &inputCell[0], numBasis, spaceDim, numQuadPts);
+    const PylithScalar* elasticConsts = &_elasticConstsCells[c*cellConstsSize];
+    for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+      const PylithScalar* strainQ = &strainCell[iQuad*tensorSize];
+      for (int iS = 0; iS < tensorSize; ++iS) {
+	const PylithScalar* elasticConstsQS = &elasticConsts[iQuad*numConsts+iS*tensorSize];
+	PylithScalar value = 0.0;
+	for (int jS = 0; jS < tensorSize; ++jS) {
+	  value += elasticConstsQS[jS] * strainQ[jS];
+	} // for
+	stressCell[iQuad*tensorSize+iS] = -value;
+      } // for
+    } // for
+    PetscLogFlops(numQuadPts*tensorSize*(1+2*tensorSize));
+
+    CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell);
+
+    actionVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+  } // for
+
+  _logger->eventEnd(computeEvent);
+
+  PYLITH_METHOD_END;
+} // integrateJacobianAction
+
+// ----------------------------------------------------------------------
+// Integrate contributions to diagonal of Jacobian.
+void
+pylith::feassemble::ElasticityImplicit::integrateJacobianDiagonal(const topology::Field& diagonal,
+								  const PylithScalar t,
+								  topology::SolutionFields* const fields)
+{ // integrateJacobianDiagonal
+  PYLITH_METHOD_BEGIN;
+
+  /// Member prototype for _elasticityJacobianXD()
+  typedef void (pylith::feassemble::ElasticityImplicit::*elasticityJacobian_fn_type)
+    (const scalar_array&);
+
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(fields);
+
+  const int computeEvent = _logger->eventId("ElIJ compute");
+  _logger->eventBegin(computeEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  const int numQuadPts = _quadrature->numQuadPts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const int cellDim = _quadrature->cellDim();
+  const int tensorSize = _material->tensorSize();
+  const int numConsts = tensorSize*tensorSize;
+  const int cellVectorSize = numBasis*spaceDim;
+
+  // Set variables dependent on dimension of cell
+  elasticityJacobian_fn_type elasticityJacobianFn;
+  if (2 == cellDim) {
+    elasticityJacobianFn = &pylith::feassemble::ElasticityImplicit::_elasticityJacobian2D;
+  } else if (3 == cellDim) {
+    elasticityJacobianFn = &pylith::feassemble::ElasticityImplicit::_elasticityJacobian3D;
+  } else {
+    assert(false);
+    throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateJacobianDiagonal().");
+  } // if/else
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+  const size_t cellConstsSize = numQuadPts*numConsts;
+  if (_elasticConstsCells.size() != numCells*cellConstsSize) {
+    throw std::logic_error("Elasticity constants for matrix-free Jacobian not computed. "
+			   "Call prepareJacobianAction() first.");
+  } // if
+  scalar_array elasticConsts(cellConstsSize);
+
+  topology::VecVisitorMesh diagonalVisitor(diagonal, "displacement");
+  diagonalVisitor.optimizeClosure();
+
+  scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  // Loop over cells
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+
+    // Compute geometry information for current cell
+    coordsVisitor.getClosure(&coordsCell, cell);
+    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+
+    _resetCellMatrix();
+    _resetCellVector();
+
+    for(size_t i = 0, iC = c*cellConstsSize; i < cellConstsSize; ++i) {
+      elasticConsts[i] = _elasticConstsCells[iC+i];
+    } // for
+    CALL_MEMBER_FN(*this, elasticityJacobianFn)(elasticConsts);
+
+    for (int i = 0; i < cellVectorSize; ++i) {
+      _cellVector[i] = _cellMatrix[i*cellVectorSize+i];
+    } // for
+    diagonalVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+  } // for
+
+  _logger->eventEnd(computeEvent);
+
+  PYLITH_METHOD_END;
+} // integrateJacobianDiagonal
+
+
+// ----------------------------------------------------------------------
+// Integrate residual using batched constitutive kernels.
+void
+pylith::feassemble::ElasticityImplicit::_integrateResidualBatched(const topology::Field& residual,
+								  const PylithScalar t,
+								  topology::SolutionFields* const fields)
+{ // _integrateResidualBatched
+  PYLITH_METHOD_BEGIN;
+
+  /// Member prototype for _elasticityResidualXD()
+  typedef void (pylith::feassemble::ElasticityImplicit::*elasticityResidual_fn_type)
+    (const scalar_array&);
+
+  // Number of cells in each call to the material's batched kernels.
+  const PetscInt batchSize = 64;
+
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(fields);
+
+  const int setupEvent = _logger->eventId("ElIR setup");
+  const int computeEvent = _logger->eventId("ElIR compute");
+
+  _logger->eventBegin(setupEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  const int numQuadPts = _quadrature->numQuadPts();
+  const scalar_array& quadWts = _quadrature->quadWts();
+  assert(quadWts.size() == size_t(numQuadPts));
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const int cellDim = _quadrature->cellDim();
+  const int tensorSize = _material->tensorSize();
+  if (cellDim != spaceDim)
+    throw std::logic_error("Integration for cells with spatial dimensions "
+			   "different than the spatial dimension of the "
+			   "domain not implemented yet.");
+
+  // Set variables dependent on dimension of cell
+  totalStrain_fn_type calcTotalStrainFn;
+  elasticityResidual_fn_type elasticityResidualFn;
+  if (2 == cellDim) {
+    elasticityResidualFn = &pylith::feassemble::ElasticityImplicit::_elasticityResidual2D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
+  } else if (3 == cellDim) {
+    elasticityResidualFn = &pylith::feassemble::ElasticityImplicit::_elasticityResidual3D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
+  } else {
+    assert(false);
+    throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateResidual().");
+  } // if/else		   
+
+  // Use kernels specialized for the cell type if available.
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
+
+  // Allocate vectors for cell values.
+  scalar_array dispTpdtCell(numBasis*spaceDim);
+  scalar_array strainCell(numQuadPts*tensorSize);
+  strainCell = 0.0;
+  scalar_array stressCell(numQuadPts*tensorSize);
+
+  // Strains for block of cells are stored in structure-of-arrays
+  // layout (see ElasticMaterial::retrievePropsAndVarsBatch()), and
+  // cell geometry is saved so it is only computed once per cell.
+  scalar_array strainBatch;
+  const int geometrySize = _quadrature->geometrySize();
+  scalar_array geometryBatch(batchSize*geometrySize);
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  // Setup field visitors.
+  scalar_array dispCell(numBasis*spaceDim);
+  topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
+  dispVisitor.optimizeClosure();
+
+  scalar_array dispIncrCell(numBasis*spaceDim);
+  topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
+  dispIncrVisitor.optimizeClosure();
+
+  topology::VecVisitorMesh residualVisitor(residual, "displacement");
+  residualVisitor.optimizeClosure();
+
+  scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  _material->createPropsAndVarsVisitors();
+
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(computeEvent);
+
+  // Loop over blocks of cells
+  for (PetscInt cBatch = 0; cBatch < numCells; cBatch += batchSize) {
+    const PetscInt numCellsBatch = std::min(batchSize, numCells-cBatch);
+    const int numPoints = numCellsBatch*numQuadPts;
+    if (strainBatch.size() != size_t(numPoints*tensorSize)) {
+      strainBatch.resize(numPoints*tensorSize);
+    } // if
+
+    // Compute geometry and total strain for cells in block.
+    for (PetscInt iCell = 0; iCell < numCellsBatch; ++iCell) {
+      const PetscInt cell = cells[cBatch+iCell];
+      coordsVisitor.getClosure(&coordsCell, cell);
+      _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+      _quadrature->packGeometry(&geometryBatch[iCell*geometrySize]);
+
+      // Restrict input fields to cell
+      dispVisitor.getClosure(&dispCell, cell);
+      dispIncrVisitor.getClosure(&dispIncrCell, cell);
+
+      // Compute current estimate of displacement at time t+dt using solution increment.
+      for(PetscInt i = 0, dispSize = dispCell.size(); i < dispSize; ++i) {
+	dispTpdtCell[i] = dispCell[i] + dispIncrCell[i];
+      } // for
+
+      calcTotalStrainFn(&strainCell, _quadrature->basisDeriv(), &dispTpdtCell[0], numBasis, spaceDim, numQuadPts);
+      for (int iQuad = 0, iPoint = iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	for (int iComp = 0; iComp < tensorSize; ++iComp) {
+	  strainBatch[iComp*numPoints+iPoint] = strainCell[iQuad*tensorSize+iComp];
+	} // for
+      } // for
+    } // for
+
+    // Compute stresses for all cells in block.
+    _material->retrievePropsAndVarsBatch(&cells[cBatch], numCellsBatch);
+    const scalar_array* densityBatch = (_gravityField) ? &_material->calcDensityBatch() : 0;
+    const scalar_array& stressBatch = _material->calcStressBatch(strainBatch, true);
+
+    // Integrate and assemble contributions of cells in block.
+    for (PetscInt iCell = 0; iCell < numCellsBatch; ++iCell) {
+      const PetscInt cell = cells[cBatch+iCell];
+      _quadrature->unpackGeometry(&geometryBatch[iCell*geometrySize]);
+
+      // Reset element vector to zero
+      _resetCellVector();
+
+      // Compute body force vector if gravity is being used.
+      if (_gravityField) {
+	const scalar_array& basis = _quadrature->basis();
+	const scalar_array& jacobianDet = _quadrature->jacobianDet();
+
+	// Density at quadrature points for this cell from block of cells
+	assert(densityBatch);
+	const PylithScalar* density = &(*densityBatch)[iCell*numQuadPts];
+
+	// Compute action for element body forces
+	const PylithScalar* gravCell = _gravityCell(cBatch+iCell);
+	for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+	  const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad] * density[iQuad];
+	  for (int iBasis = 0, iQ = iQuad * numBasis; iBasis < numBasis; ++iBasis) {
+	    const PylithScalar valI = wt * basis[iQ + iBasis];
+	    for (int iDim = 0; iDim < spaceDim; ++iDim) {
+	      _cellVector[iBasis * spaceDim + iDim] += valI * gravCell[iQuad*spaceDim+iDim];
+	    } // for
+	  } // for
+	} // for
+	PetscLogFlops(numQuadPts * (2 + numBasis * (1 + 2 * spaceDim)));
+      } // if
+
+      // Compute B(transpose) * sigma
+      for (int iQuad = 0, iPoint = iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	for (int iComp = 0; iComp < tensorSize; ++iComp) {
+	  stressCell[iQuad*tensorSize+iComp] = stressBatch[iComp*numPoints+iPoint];
+	} // for
+      } // for
+      CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell);
+
+      // Assemble cell contribution into field
+      residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    } // for
+  } // for
+  _material->destroyPropsAndVarsVisitors();
+
+  _logger->eventEnd(computeEvent);
+
+  PYLITH_METHOD_END;
+} // _integrateResidualBatched
+
+// ----------------------------------------------------------------------
+// Integrate Jacobian using batched constitutive kernels.
+void
+pylith::feassemble::ElasticityImplicit::_integrateJacobianBatched(topology::Jacobian* jacobian,
+								  const PylithScalar t,
+								  topology::SolutionFields* const fields)
+{ // _integrateJacobianBatched
+  PYLITH_METHOD_BEGIN;
+
+  /// Member prototype for _elasticityJacobianXD()
+  typedef void (pylith::feassemble::ElasticityImplicit::*elasticityJacobian_fn_type)
+    (const scalar_array&);
+
+  // Number of cells in each call to the material's batched kernels.
+  const PetscInt batchSize = 64;
+
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(jacobian);
+  assert(fields);
+
+  const int setupEvent = _logger->eventId("ElIJ setup");
+  const int computeEvent = _logger->eventId("ElIJ compute");
+
+  _logger->eventBegin(setupEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  const int numQuadPts = _quadrature->numQuadPts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const int cellDim = _quadrature->cellDim();
+  const int tensorSize = _material->tensorSize();
+  if (cellDim != spaceDim)
+    throw std::logic_error("Don't know how to integrate elasticity " \
+			   "contribution to Jacobian matrix for cells with " \
+			   "different dimensions than the spatial dimension.");
+
+  // Set variables dependent on dimension of cell
+  totalStrain_fn_type calcTotalStrainFn;
+  elasticityJacobian_fn_type elasticityJacobianFn;
+  if (2 == cellDim) {
+    elasticityJacobianFn = &pylith::feassemble::ElasticityImplicit::_elasticityJacobian2D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
+  } else if (3 == cellDim) {
+    elasticityJacobianFn = &pylith::feassemble::ElasticityImplicit::_elasticityJacobian3D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
+  } else {
+    assert(false);
+    throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateJacobian().");
+  } // if/else
+
+  // Use kernels specialized for the cell type if available.
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
+
+  // Allocate vectors for cell values.
+  scalar_array dispTpdtCell(numBasis*spaceDim);
+  scalar_array strainCell(numQuadPts*tensorSize);
+  strainCell = 0.0;
+  scalar_array elasticConstsCell;
+
+  // Strains for block of cells are stored in structure-of-arrays
+  // layout (see ElasticMaterial::retrievePropsAndVarsBatch()), and
+  // cell geometry is saved so it is only computed once per cell.
+  scalar_array strainBatch;
+  const int geometrySize = _quadrature->geometrySize();
+  scalar_array geometryBatch(batchSize*geometrySize);
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  // Setup field visitors.
+  scalar_array dispCell(numBasis*spaceDim);
+  topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
+  dispVisitor.optimizeClosure();
+
+  scalar_array dispIncrCell(numBasis*spaceDim);
+  topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
+  dispIncrVisitor.optimizeClosure();
+
+  scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  _material->createPropsAndVarsVisitors();
+
+  // Get sparse matrix
+  const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
+  topology::MatVisitorMesh jacobianVisitor(jacobianMat, fields->get("disp(t)"));
+
+  const int cellMatrixSize = _cellMatrix.size();
+  if (_reuseCellMatrices) {
+    _setupCellMatrixReuse(numCells, cellMatrixSize);
+  } // if
+
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(computeEvent);
+
+  // Loop over blocks of cells
+  for (PetscInt cBatch = 0; cBatch < numCells; cBatch += batchSize) {
+    const PetscInt numCellsBatch = std::min(batchSize, numCells-cBatch);
+    const int numPoints = numCellsBatch*numQuadPts;
+    if (strainBatch.size() != size_t(numPoints*tensorSize)) {
+      strainBatch.resize(numPoints*tensorSize);
+    } // if
+
+    // Compute geometry and total strain for cells in block.
+    for (PetscInt iCell = 0; iCell < numCellsBatch; ++iCell) {
+      const PetscInt cell = cells[cBatch+iCell];
+      coordsVisitor.getClosure(&coordsCell, cell);
+      _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+      _quadrature->packGeometry(&geometryBatch[iCell*geometrySize]);
+
+      // Restrict input fields to cell
+      dispVisitor.getClosure(&dispCell, cell);
+      dispIncrVisitor.getClosure(&dispIncrCell, cell);
+
+      // Compute current estimate of displacement at time t+dt using solution increment.
+      for(PetscInt i = 0, dispSize = dispCell.size(); i < dispSize; ++i) {
+	dispTpdtCell[i] = dispCell[i] + dispIncrCell[i];
+      } // for
+
+      calcTotalStrainFn(&strainCell, _quadrature->basisDeriv(), &dispTpdtCell[0], numBasis, spaceDim, numQuadPts);
+      for (int iQuad = 0, iPoint = iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	for (int iComp = 0; iComp < tensorSize; ++iComp) {
+	  strainBatch[iComp*numPoints+iPoint] = strainCell[iQuad*tensorSize+iComp];
+	} // for
+      } // for
+    } // for
+
+    // Compute elasticity constants for all cells in block.
+    _material->retrievePropsAndVarsBatch(&cells[cBatch], numCellsBatch);
+    const scalar_array& elasticConstsBatch = _material->calcDerivElasticBatch(strainBatch);
+    const int numElasticConsts = (numPoints > 0) ? elasticConstsBatch.size() / numPoints : 0;
+    if (elasticConstsCell.size() != size_t(numQuadPts*numElasticConsts)) {
+      elasticConstsCell.resize(numQuadPts*numElasticConsts);
+    } // if
+
+    // Integrate and assemble contributions of cells in block.
+    for (PetscInt iCell = 0; iCell < numCellsBatch; ++iCell) {
+      const PetscInt c = cBatch+iCell;
+      const PetscInt cell = cells[c];
+
+      for (int iQuad = 0, iPoint = iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	for (int iConst = 0; iConst < numElasticConsts; ++iConst) {
+	  elasticConstsCell[iQuad*numElasticConsts+iConst] = elasticConstsBatch[iConst*numPoints+iPoint];
+	} // for
+      } // for
+
+      // Add stored cell matrix if elasticity constants are unchanged.
+      unsigned long long elasticConstsHash = 0;
+      if (_reuseCellMatrices) {
+	elasticConstsHash = _hashElasticConsts(elasticConstsCell);
+	if (_cellMatricesValid && elasticConstsHash == _elasticConstsHashes[c]) {
+	  jacobianVisitor.setClosure(&_cellMatrices[c*cellMatrixSize], cellMatrixSize, cell, ADD_VALUES);
+	  continue;
+	} // if
+      } // if
+
+      _quadrature->unpackGeometry(&geometryBatch[iCell*geometrySize]);
+
+      // Reset element matrix to zero
+      _resetCellMatrix();
+
+      CALL_MEMBER_FN(*this, elasticityJacobianFn)(elasticConstsCell);
+
+      if (_reuseCellMatrices) {
+	for (int i = 0; i < cellMatrixSize; ++i) {
+	  _cellMatrices[c*cellMatrixSize+i] = _cellMatrix[i];
+	} // for
+	_elasticConstsHashes[c] = elasticConstsHash;
+      } // if
+
+      // Assemble cell contribution into PETSc matrix.
+      jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
+    } // for
+  } // for
+  _material->destroyPropsAndVarsVisitors();
+  _cellMatricesValid = _reuseCellMatrices;
+
+  _needNewJacobian = false;
+  _material->resetNeedNewJacobian();
+
+  _logger->eventEnd(computeEvent);
+
+  PYLITH_METHOD_END;
+} // _integrateJacobianBatched
+
+// ----------------------------------------------------------------------
+// Integrate residual using multiple threads.
+void
+pylith::feassemble::ElasticityImplicit::_integrateResidualThreaded(const topology::Field& residual,
+								  const PylithScalar t,
+								  topology::SolutionFields* const fields)
+{ // _integrateResidualThreaded
+  PYLITH_METHOD_BEGIN;
+
+#if defined(_OPENMP)
+  /// Prototype for _elasticityResidualXD() operating on caller-provided buffers.
+  typedef void (*elasticityResidual_fn_type)
+    (scalar_array*, const scalar_array&, const Quadrature&);
+  
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(fields);
+
+  const int setupEvent = _logger->eventId("ElIR setup");
+  const int computeEvent = _logger->eventId("ElIR compute");
+
+  _logger->eventBegin(setupEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  const int numQuadPts = _quadrature->numQuadPts();
+  const scalar_array& quadWts = _quadrature->quadWts();
+  assert(quadWts.size() == size_t(numQuadPts));
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const int cellDim = _quadrature->cellDim();
+  const int tensorSize = _material->tensorSize();
+  if (cellDim != spaceDim)
+    throw std::logic_error("Integration for cells with spatial dimensions "
+			   "different than the spatial dimension of the "
+			   "domain not implemented yet.");
+
+  // Set variables dependent on dimension of cell
+  totalStrain_fn_type calcTotalStrainFn;
+  elasticityResidual_fn_type elasticityResidualFn;
+  PetscLogDouble cellFlops = 0;
+  if (2 == cellDim) {
+    elasticityResidualFn = &pylith::feassemble::IntegratorElasticity::_elasticityResidual2D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
+    cellFlops = numQuadPts*(1+numBasis*(8+2+9));
+  } else if (3 == cellDim) {
+    elasticityResidualFn = &pylith::feassemble::IntegratorElasticity::_elasticityResidual3D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
+    cellFlops = numQuadPts*(1+numBasis*(3+12));
+  } else {
+    assert(false);
+    throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateResidual().");
+  } // if/else
+
+  // Use kernels specialized for the cell type if available.
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
+  if (_residualKernel) {
+    elasticityResidualFn = _residualKernel;
+  } // if
+  if (_gravityField) {
+    cellFlops += numQuadPts * (2 + numBasis * (1 + 2 * spaceDim));
+  } // if
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  // Setup field visitors.
+  topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
+  dispVisitor.optimizeClosure();
+
+  topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
+  dispIncrVisitor.optimizeClosure();
+
+  topology::VecVisitorMesh residualVisitor(residual, "displacement");
+  residualVisitor.optimizeClosure();
+  PetscScalar* residualArray = residualVisitor.localArray();
+
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  const int cellVectorSize = numBasis*spaceDim;
+  _setupThreadedAssembly(residualVisitor, cellVectorSize);
+  const bool deterministic = _deterministicAssembly;
+  const int numColors = (deterministic) ? _colorOffsets.size()-1 : 1;
+
+  _material->createPropsAndVarsVisitors();
+
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(computeEvent);
+
+  // Visitors are not thread-safe, so access to them is
+  // serialized. Geometry, strain, material evaluation, and
+  // integration use per-thread buffers. Flops logged by the material
+  // and geometry kernels are accumulated per thread and logged after
+  // the parallel region.
+  std::string errorMsg;
+  PetscLogDouble kernelFlops = 0;
+#pragma omp parallel num_threads(_numThreads) reduction(+:kernelFlops)
+  { // parallel
+    Quadrature quadrature(*_quadrature);
+    quadrature.shareGeometryCache(*_quadrature);
+    materials::ElasticMaterial::Workspace materialWorkspace;
+    _material->initWorkspace(&materialWorkspace);
+    scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+    scalar_array dispCell(numBasis*spaceDim);
+    scalar_array dispIncrCell(numBasis*spaceDim);
+    scalar_array dispTpdtCell(numBasis*spaceDim);
+    scalar_array strainCell(numQuadPts*tensorSize);
+    scalar_array cellVector(cellVectorSize);
+    std::string cellError;
+
+    for (int iColor=0; iColor < numColors; ++iColor) {
+      const PetscInt iStart = (deterministic) ? _colorOffsets[iColor] : 0;
+      const PetscInt iEnd = (deterministic) ? _colorOffsets[iColor+1] : numCells;
+
+#pragma omp for schedule(dynamic, 16)
+      for(PetscInt i = iStart; i < iEnd; ++i) {
+	const PetscInt c = (deterministic) ? _coloredCells[i] : i;
+	const PetscInt cell = cells[c];
+
+	// Restrict input fields and material parameters to cell
+#pragma omp critical (ElasticityImplicit_closure)
+	try {
+	  coordsVisitor.getClosure(&coordsCell, cell);
+	  dispVisitor.getClosure(&dispCell, cell);
+	  dispIncrVisitor.getClosure(&dispIncrCell, cell);
+	  _material->retrievePropsAndVars(&materialWorkspace, cell);
+	} catch (const std::exception& err) {
+	  cellError = err.what();
+	} // try/catch
+	if (!cellError.empty())
+	  continue;
+
+	try {
+	  // Compute geometry information for current cell
+	  quadrature.computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+	  
+	  // Compute current estimate of displacement at time t+dt using solution increment.
+	  for(PetscInt iDisp = 0, dispSize = dispCell.size(); iDisp < dispSize; ++iDisp) {
+	    dispTpdtCell[iDisp] = dispCell[iDisp] + dispIncrCell[iDisp];
+	  } // for
+	  calcTotalStrainFn(&strainCell, quadrature.basisDeriv(), &dispTpdtCell[0], numBasis, spaceDim, numQuadPts);
+
+	  // Get stress and density from material using this thread's workspace.
+	  if (_gravityField) {
+	    _material->calcDensity(&materialWorkspace);
+	  } // if
+	  _material->calcStress(&materialWorkspace, strainCell, true);
+	} catch (const std::exception& err) {
+	  cellError = err.what();
+	  continue;
+	} // try/catch
+	const scalar_array& densityCell = materialWorkspace.densityCell;
+	const scalar_array& stressCell = materialWorkspace.stressCell;
+
+	cellVector = 0.0;
+
+	// Compute body force vector if gravity is being used.
+	if (_gravityField) {
+	  const scalar_array& basis = quadrature.basis();
+	  const scalar_array& jacobianDet = quadrature.jacobianDet();
+	  const PylithScalar* gravCell = _gravityCell(c);
+	  for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+	    const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad] * densityCell[iQuad];
+	    for (int iBasis = 0, iQ = iQuad * numBasis; iBasis < numBasis; ++iBasis) {
+	      const PylithScalar valI = wt * basis[iQ + iBasis];
+	      for (int iDim = 0; iDim < spaceDim; ++iDim) {
+		cellVector[iBasis * spaceDim + iDim] += valI * gravCell[iQuad*spaceDim+iDim];
+	      } // for
+	    } // for
+	  } // for
+	} // if
+	
+	// Compute B(transpose) * sigma
+	elasticityResidualFn(&cellVector, stressCell, quadrature);
+
+	// Assemble cell contribution into field. Cells of the same
+	// color do not share any degrees of freedom.
+	const PylithInt* indices = &_closureIndices[c*cellVectorSize];
+	if (deterministic) {
+	  for (int iV = 0; iV < cellVectorSize; ++iV) {
+	    if (indices[iV] >= 0) {
+	      residualArray[indices[iV]] += cellVector[iV];
+	    } // if
+	  } // for
+	} else {
+	  for (int iV = 0; iV < cellVectorSize; ++iV) {
+	    if (indices[iV] >= 0) {
+#pragma omp atomic
+	      residualArray[indices[iV]] += cellVector[iV];
+	    } // if
+	  } // for
+	} // if/else
+      } // for
+    } // for
+
+    if (!cellError.empty()) {
+#pragma omp critical (ElasticityImplicit_error)
+      if (errorMsg.empty()) {
+	errorMsg = cellError;
+      } // if
+    } // if
+    kernelFlops += utils::EventLogger::threadFlops();
+  } // parallel
+  _material->destroyPropsAndVarsVisitors();
+  PetscLogFlops(numCells*cellFlops + kernelFlops);
+
+  if (!errorMsg.empty()) {
+    throw std::runtime_error(errorMsg);
+  } // if
+
+  _logger->eventEnd(computeEvent);
+#else
+  throw std::logic_error("Threaded integration of residual requires OpenMP.");
+#endif
+
+  PYLITH_METHOD_END;
+} // _integrateResidualThreaded
+
+// ----------------------------------------------------------------------
+// Integrate Jacobian using multiple threads.
+void
+pylith::feassemble::ElasticityImplicit::_integrateJacobianThreaded(topology::Jacobian* jacobian,
+								  const PylithScalar t,
+								  topology::SolutionFields* fields)
+{ // _integrateJacobianThreaded
+  PYLITH_METHOD_BEGIN;
+
+#if defined(_OPENMP)
+  /// Prototype for _elasticityJacobianXD() operating on caller-provided buffers.
+  typedef void (*elasticityJacobian_fn_type)
+    (scalar_array*, const scalar_array&, const Quadrature&);
+
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(jacobian);
+  assert(fields);
+
+  const int setupEvent = _logger->eventId("ElIJ setup");
+  const int computeEvent = _logger->eventId("ElIJ compute");
+
+  _logger->eventBegin(setupEvent);
+
+  // Get cell geometry information that doesn't depend on cell
+  const int numQuadPts = _quadrature->numQuadPts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const int cellDim = _quadrature->cellDim();
+  const int tensorSize = _material->tensorSize();
+  if (cellDim != spaceDim)
+    throw std::logic_error("Don't know how to integrate elasticity " \
+			   "contribution to Jacobian matrix for cells with " \
+			   "different dimensions than the spatial dimension.");
+
+  // Set variables dependent on dimension of cell
+  totalStrain_fn_type calcTotalStrainFn;
+  elasticityJacobian_fn_type elasticityJacobianFn;
+  PetscLogDouble cellFlops = 0;
+  if (2 == cellDim) {
+    elasticityJacobianFn = &pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D;
+    cellFlops = numQuadPts*(1+numBasis*(2+numBasis*(3*11+4)));
+  } else if (3 == cellDim) {
+    elasticityJacobianFn = &pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D;
+    calcTotalStrainFn = &pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D;
+    cellFlops = numQuadPts*(1+numBasis*(3+numBasis*(6*26+9)));
+  } else {
+    assert(false);
+    throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateJacobian().");
+  } // if/else
+
+  // Use kernels specialized for the cell type if available.
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
+  if (_jacobianKernel) {
+    elasticityJacobianFn = _jacobianKernel;
+  } // if
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  // Setup field visitors.
+  topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
+  dispVisitor.optimizeClosure();
+
+  topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
+  dispIncrVisitor.optimizeClosure();
+
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  _material->createPropsAndVarsVisitors();
+
+  // Get sparse matrix
+  const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
+  topology::MatVisitorMesh jacobianVisitor(jacobianMat, fields->get("disp(t)"));
+
+  // Get parameters used in integration.
+  const PylithScalar dt = _dt;
+  assert(dt > 0);
+
+  // Cell matrices are computed concurrently for a block of cells and
+  // then inserted into the sparse matrix in the order of the cells,
+  // because inserting values into a PETSc matrix is not thread-safe.
+  const int cellMatrixSize = numBasis*spaceDim*numBasis*spaceDim;
+  const PetscInt blockSize = 32*_numThreads;
+  std::vector<scalar_array> cellMatrices(std::min(blockSize, numCells), scalar_array(cellMatrixSize));
+
+  // Elasticity constants that depend only on properties are computed
+  // before the threaded loop.
+  const bool constantElasticConsts = _material->hasConstantElasticConsts();
+  const int numElasticConstsCell = numQuadPts*tensorSize*tensorSize;
+  if (constantElasticConsts) {
+    _material->updateElasticConstsCache();
+  } // if
+
+  if (_reuseCellMatrices) {
+    _setupCellMatrixReuse(numCells, cellMatrixSize);
+  } // if
+
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(computeEvent);
+
+  // Flops logged by the material and geometry kernels are
+  // accumulated per thread and logged after the parallel region.
+  std::string errorMsg;
+  PetscLogDouble kernelFlops = 0;
+#pragma omp parallel num_threads(_numThreads) reduction(+:kernelFlops)
+  { // parallel
+    Quadrature quadrature(*_quadrature);
+    quadrature.shareGeometryCache(*_quadrature);
+    materials::ElasticMaterial::Workspace materialWorkspace;
+    _material->initWorkspace(&materialWorkspace);
+    scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+    scalar_array dispCell(numBasis*spaceDim);
+    scalar_array dispIncrCell(numBasis*spaceDim);
+    scalar_array dispTpdtCell(numBasis*spaceDim);
+    scalar_array strainCell(numQuadPts*tensorSize);
+    scalar_array elasticConstsCell;
+    std::string cellError;
+
+    for (PetscInt cStart = 0; cStart < numCells; cStart += blockSize) {
+      const PetscInt cEnd = std::min(cStart+blockSize, numCells);
+
+#pragma omp for schedule(dynamic, 4)
+      for(PetscInt c = cStart; c < cEnd; ++c) {
+	const PetscInt cell = cells[c];
+	scalar_array& cellMatrix = cellMatrices[c-cStart];
+
+	// Restrict input fields and material parameters to cell. The
+	// cached elasticity constants are only read, but locating them
+	// calls PETSc, which is not thread-safe.
+	const PylithScalar* elasticConstsCached = 0;
+#pragma omp critical (ElasticityImplicit_closure)
+	try {
+	  coordsVisitor.getClosure(&coordsCell, cell);
+	  dispVisitor.getClosure(&dispCell, cell);
+	  dispIncrVisitor.getClosure(&dispIncrCell, cell);
+	  if (constantElasticConsts) {
+	    elasticConstsCached = _material->cachedElasticConsts(cell);
+	  } else {
+	    _material->retrievePropsAndVars(&materialWorkspace, cell);
+	  } // if/else
+	} catch (const std::exception& err) {
+	  cellError = err.what();
+	} // try/catch
+	if (!cellError.empty())
+	  continue;
+
+	try {
+	  // Compute geometry information for current cell
+	  quadrature.computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+
+	  // Compute current estimate of displacement at time t+dt using solution increment.
+	  for(PetscInt iDisp = 0, dispSize = dispCell.size(); iDisp < dispSize; ++iDisp) {
+	    dispTpdtCell[iDisp] = dispCell[iDisp] + dispIncrCell[iDisp];
+	  } // for
+	  calcTotalStrainFn(&strainCell, quadrature.basisDeriv(), &dispTpdtCell[0], numBasis, spaceDim, numQuadPts);
+	} catch (const std::exception& err) {
+	  cellError = err.what();
+	  continue;
+	} // try/catch
+
+	// Get "elasticity" matrix at quadrature points for this cell
+	if (constantElasticConsts) {
+	  assert(elasticConstsCached);
+	  elasticConstsCell.resize(numElasticConstsCell);
+	  for (int i = 0; i < numElasticConstsCell; ++i) {
+	    elasticConstsCell[i] = elasticConstsCached[i];
+	  } // for
+	} else {
+	  // Material is evaluated using this thread's workspace.
+	  try {
+	    const scalar_array& elasticConsts = _material->calcDerivElastic(&materialWorkspace, strainCell);
+	    elasticConstsCell.resize(elasticConsts.size());
+	    elasticConstsCell = elasticConsts;
+	  } catch (const std::exception& err) {
+	    cellError = err.what();
+	    continue;
+	  } // try/catch
+	} // if/else
+
+	// Use stored cell matrix if elasticity constants are unchanged.
+	if (_reuseCellMatrices) {
+	  const unsigned long long elasticConstsHash = _hashElasticConsts(elasticConstsCell);
+	  PylithScalar* cellMatrixStored = &_cellMatrices[c*cellMatrixSize];
+	  if (_cellMatricesValid && elasticConstsHash == _elasticConstsHashes[c]) {
+	    for (int i = 0; i < cellMatrixSize; ++i) {
+	      cellMatrix[i] = cellMatrixStored[i];
+	    } // for
+	  } else {
+	    cellMatrix = 0.0;
+	    elasticityJacobianFn(&cellMatrix, elasticConstsCell, quadrature);
+	    for (int i = 0; i < cellMatrixSize; ++i) {
+	      cellMatrixStored[i] = cellMatrix[i];
+	    } // for
+	    _elasticConstsHashes[c] = elasticConstsHash;
+	  } // if/else
+	} else {
+	  cellMatrix = 0.0;
+	  elasticityJacobianFn(&cellMatrix, elasticConstsCell, quadrature);
+	} // if/else
+      } // for
+
+#pragma omp single
+      { // single
+	// Assemble cell contributions into PETSc matrix.
+	//   Notice that we are using the default sections
+	try {
+	  for (PetscInt c = cStart; c < cEnd; ++c) {
+	    const scalar_array& cellMatrix = cellMatrices[c-cStart];
+	    jacobianVisitor.setClosure(&cellMatrix[0], cellMatrix.size(), cells[c], ADD_VALUES);
+	  } // for
+	} catch (const std::exception& err) {
+	  cellError = err.what();
+	} // try/catch
+      } // single
+    } // for
+
+    if (!cellError.empty()) {
+#pragma omp critical (ElasticityImplicit_error)
+      if (errorMsg.empty()) {
+	errorMsg = cellError;
+      } // if
+    } // if
+    kernelFlops += utils::EventLogger::threadFlops();
+  } // parallel
+  _material->destroyPropsAndVarsVisitors();
+  PetscLogFlops(numCells*cellFlops + kernelFlops);
+
+  if (!errorMsg.empty()) {
+    _cellMatricesValid = false;
+    throw std::runtime_error(errorMsg);
+  } // if
+  _cellMatricesValid = _reuseCellMatrices;
+
+  _needNewJacobian = false;
+  _material->resetNeedNewJacobian();
+
+  _logger->eventEnd(computeEvent);
+#else
+  throw std::logic_error("Threaded integration of Jacobian requires OpenMP.");
+#endif
+
+  PYLITH_METHOD_END;
+} // _integrateJacobianThreaded
+
+// ----------------------------------------------------------------------
+// Setup indices for cell closures and coloring of cells for threaded
+// assembly.
+void
+pylith::feassemble::ElasticityImplicit::_setupThreadedAssembly(const topology::VecVisitorMesh& visitor,
+							       const int cellVectorSize)
+{ // _setupThreadedAssembly
+  PYLITH_METHOD_BEGIN;
+
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  // A section may be reused after fields are reallocated, so we detect
+  // changes in layout using the chart and storage size of the section.
+  const PetscSection section = visitor.localSection();
+  PetscInt pStart = 0, pEnd = 0, storageSize = 0;
+  PetscErrorCode err = 0;
+  err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionGetStorageSize(section, &storageSize);PYLITH_CHECK_ERROR(err);
+  if (section == _closureSection && pStart == _closureChartStart && pEnd == _closureChartEnd &&
+      storageSize == _closureStorageSize && _closureIndices.size() == size_t(numCells*cellVectorSize)) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Indices into local array for closure of each cell.
+  _closureIndices.resize(numCells*cellVectorSize);
+  int_array indicesCell;
+  for (PetscInt c = 0; c < numCells; ++c) {
+    visitor.closureIndices(&indicesCell, cells[c]);
+    if (indicesCell.size() != size_t(cellVectorSize)) {
+      std::ostringstream msg;
+      msg << "Number of values in closure of cell " << cells[c] << " (" << indicesCell.size()
+	  << ") does not match size of cell vector (" << cellVectorSize << ").";
+      throw std::logic_error(msg.str());
+    } // if
+    for (int i = 0; i < cellVectorSize; ++i) {
+      _closureIndices[c*cellVectorSize+i] = indicesCell[i];
+    } // for
+  } // for
+
+  // Greedy coloring of cells in the order of the material index set,
+  // so the coloring (and the order of assembly) is reproducible. Each
+  // pass assigns the next color to the uncolored cells that do not
+  // share any degrees of freedom with cells already assigned that color.
+  PetscInt localSize = 0;
+  err = VecGetLocalSize(visitor.localVec(), &localSize);PYLITH_CHECK_ERROR(err);
+  int_vector dofColor(localSize, -1);
+  int_vector uncolored(numCells);
+  for (PetscInt c = 0; c < numCells; ++c) {
+    uncolored[c] = c;
+  } // for
+  _coloredCells.clear();
+  _coloredCells.reserve(numCells);
+  _colorOffsets.clear();
+  _colorOffsets.push_back(0);
+  for (int iColor = 0; !uncolored.empty(); ++iColor) {
+    int_vector remaining;
+    const size_t numUncolored = uncolored.size();
+    for (size_t iCell = 0; iCell < numUncolored; ++iCell) {
+      const int c = uncolored[iCell];
+      const PylithInt* indices = &_closureIndices[c*cellVectorSize];
+      bool conflict = false;
+      for (int i = 0; i < cellVectorSize && !conflict; ++i) {
+	conflict = indices[i] >= 0 && dofColor[indices[i]] == iColor;
+      } // for
+      if (conflict) {
+	remaining.push_back(c);
+      } else {
+	for (int i = 0; i < cellVectorSize; ++i) {
+	  if (indices[i] >= 0) {
+	    dofColor[indices[i]] = iColor;
+	  } // if
+	} // for
+	_coloredCells.push_back(c);
+      } // if/else
+    } // for
+    _colorOffsets.push_back(_coloredCells.size());
+    uncolored.swap(remaining);
+  } // for
+  _closureSection = section;
+  _closureChartStart = pStart;
+  _closureChartEnd = pEnd;
+  _closureStorageSize = storageSize;
+
+  PYLITH_METHOD_END;
+} // _setupThreadedAssembly
+
+// ----------------------------------------------------------------------
+// Allocate storage for reusing cell matrices if necessary.
+void
+pylith::feassemble::ElasticityImplicit::_setupCellMatrixReuse(const int numCells,
+							      const int cellMatrixSize)
+{ // _setupCellMatrixReuse
+  if (_cellMatrices.size() != size_t(numCells*cellMatrixSize) ||
+      _elasticConstsHashes.size() != size_t(numCells)) {
+    _cellMatrices.resize(numCells*cellMatrixSize);
+    _elasticConstsHashes.resize(numCells);
+    _cellMatricesValid = false;
+  } // if
+} // _setupCellMatrixReuse
+
+// ----------------------------------------------------------------------
+// Compute hash of elasticity constants at quadrature points of a cell.
+unsigned long long
+pylith::feassemble::ElasticityImplicit::_hashElasticConsts(const scalar_array& elasticConsts)
+{ // _hashElasticConsts
+  // 64-bit FNV-1a hash of the bytes of the values. Any change in the
+  // values is detected, barring a hash collision, which is negligibly
+  // unlikely for 64 bits.
+  unsigned long long hash = 14695981039346656037ULL;
+  const size_t numBytes = elasticConsts.size()*sizeof(PylithScalar);
+  const unsigned char* bytes = (numBytes > 0) ? reinterpret_cast<const unsigned char*>(&elasticConsts[0]) : 0;
+  for (size_t i = 0; i < numBytes; ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  } // for
+
+  return hash;
+} // _hashElasticConsts
 
 
 // End of file 
@@ -56,6 +56,9 @@
 // Include directives ---------------------------------------------------
 #include "IntegratorElasticity.hh" // ISA IntegratorElasticity
 
+#include "pylith/utils/petscfwd.h" // HASA PetscSection
+#include "pylith/utils/arrayfwd.hh" // HASA int_array, int_vector
+
 // ElasticityImplicit ---------------------------------------------------
 class pylith::feassemble::ElasticityImplicit : public IntegratorElasticity
 { // ElasticityImplicit
@@ -88,6 +91,62 @@ public :
    */
   PylithScalar stableTimeStep(const topology::Mesh& mesh) const;
 
+  /** Set number of threads used in loops over cells when integrating
+   * the residual and Jacobian.
+   *
+   * Threading requires building with OpenMP; otherwise a warning is
+   * printed for values larger than 1 and a single thread is used.
+   *
+   * @param value Number of threads (1 means no threading).
+   */
+  void numThreads(const int value);
+
+  /** Get number of threads used in loops over cells.
+   *
+   * @returns Number of threads.
+   */
+  int numThreads(void) const;
+
+  /** Set flag for bitwise-reproducible threaded assembly of the residual.
+   *
+   * If true, cells are colored so that cells processed concurrently do
+   * not share any degrees of freedom and the colors are assembled in a
+   * fixed order, so the result does not depend on the number of
+   * threads. If false, cell contributions are added atomically in the
+   * order the threads finish.
+   *
+   * @param flag True for deterministic assembly, false otherwise.
+   */
+  void deterministicAssembly(const bool flag);
+
+  /** Get flag for bitwise-reproducible threaded assembly of the residual.
+   *
+   * @returns True for deterministic assembly, false otherwise.
+   */
+  bool deterministicAssembly(void) const;
+
+  /** Set flag for reusing cell matrices between reformations of the
+   * Jacobian.
+   *
+   * If true, the cell matrices are stored along with a hash of the
+   * elasticity constants at the quadrature points of each cell. When
+   * the Jacobian is reformed, the cell matrix is recomputed only for
+   * cells whose elasticity constants have changed; the stored matrix
+   * is added for the other cells. This trades memory for speed when
+   * the tangent moduli rarely change, as for linear viscoelastic
+   * materials with a constant time step.
+   *
+   * @param flag True to reuse cell matrices, false otherwise.
+   */
+  void reuseCellMatrices(const bool flag);
+
+  /** Get flag for reusing cell matrices between reformations of the
+   * Jacobian.
+   *
+   * @returns True if cell matrices are reused, false otherwise.
+   */
+  bool reuseCellMatrices(void) const;
+
   /** Integrate residual part of RHS for 3-D finite elements.
    * Includes gravity and element internal force contribution.
    *
@@ -116,7 +175,121 @@ public :
   void integrateJacobian(topology::Jacobian* jacobian,
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
+
+  /** Check whether integrator can apply its contribution to the
+   * Jacobian without assembling a sparse matrix.
+   *
+   * @returns True.
+   */
+  bool hasJacobianAction(void) const;
+
+  /** Compute and store the elasticity constants at the quadrature
+   * points of all cells, linearized about the current estimate of the
+   * displacement at time t+dt, for applying the Jacobian without
+   * assembling it.
+   *
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void prepareJacobianAction(const PylithScalar t,
+			     topology::SolutionFields* const fields);
+
+  /** Integrate contributions to action of Jacobian matrix (A) on a
+   * field, A*input, cell by cell using the stored elasticity
+   * constants.
+   *
+   * @param action Field to which A*input is added.
+   * @param input Field to which the Jacobian is applied.
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateJacobianAction(const topology::Field& action,
+			       const topology::Field& input,
+			       const PylithScalar t,
+			       topology::SolutionFields* const fields);
+
+  /** Integrate contributions to diagonal of Jacobian matrix (A) using
+   * the stored elasticity constants.
+   *
+   * @param diagonal Field to which diagonal of A is added.
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateJacobianDiagonal(const topology::Field& diagonal,
+				 const PylithScalar t,
+				 topology::SolutionFields* const fields);
   
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Integrate residual using batched constitutive kernels of the
+   * material over blocks of cells.
+   *
+   * @param residual Field containing values for residual
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void _integrateResidualBatched(const topology::Field& residual,
+				 const PylithScalar t,
+				 topology::SolutionFields* const fields);
+
+  /** Integrate Jacobian using batched constitutive kernels of the
+   * material over blocks of cells.
+   *
+   * @param jacobian Sparse matrix for Jacobian of system.
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void _integrateJacobianBatched(topology::Jacobian* jacobian,
+				 const PylithScalar t,
+				 topology::SolutionFields* const fields);
+
+  /** Integrate residual using multiple threads.
+   *
+   * @param residual Field containing values for residual
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void _integrateResidualThreaded(const topology::Field& residual,
+				  const PylithScalar t,
+				  topology::SolutionFields* const fields);
+
+  /** Integrate Jacobian using multiple threads.
+   *
+   * @param jacobian Sparse matrix for Jacobian of system.
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void _integrateJacobianThreaded(topology::Jacobian* jacobian,
+				  const PylithScalar t,
+				  topology::SolutionFields* const fields);
+
+  /** Setup indices into local array for cell closures and coloring of
+   * cells for threaded assembly.
+   *
+   * @param visitor Visitor for residual field.
+   * @param cellVectorSize Number of values in closure of a cell.
+   */
+  void _setupThreadedAssembly(const topology::VecVisitorMesh& visitor,
+			      const int cellVectorSize);
+
+  /** Allocate storage for reusing cell matrices if necessary.
+   *
+   * @param numCells Number of cells in material.
+   * @param cellMatrixSize Number of values in cell matrix.
+   */
+  void _setupCellMatrixReuse(const int numCells,
+			     const int cellMatrixSize);
+
+  /** Compute hash of elasticity constants at quadrature points of a
+   * cell, used to detect whether the cell matrix has changed.
+   *
+   * @param elasticConsts Elasticity constants at quadrature points.
+   * @returns Hash of values.
+   */
+  static
+  unsigned long long _hashElasticConsts(const scalar_array& elasticConsts);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -131,6 +304,26 @@ private :
 
   PylithScalar _dtm1; ///< Time step for t-dt1 -> t
 
+  int _numThreads; ///< Number of threads in loops over cells.
+  bool _deterministicAssembly; ///< Assemble residual in fixed order of cell colors.
+
+  PetscSection _closureSection; ///< Section used to create closure indices.
+  PetscInt _closureChartStart; ///< Start of chart of section used to create closure indices.
+  PetscInt _closureChartEnd; ///< End of chart of section used to create closure indices.
+  PetscInt _closureStorageSize; ///< Storage size of section used to create closure indices.
+  int_array _closureIndices; ///< Indices into local array for closure of each cell.
+  int_vector _colorOffsets; ///< Offsets into _coloredCells for each color.
+  int_vector _coloredCells; ///< Indices of material cells ordered by color.
+
+  /// Elasticity constants at quadrature points of all material cells
+  /// for matrix-free Jacobian [numCells][numQuadPts][numElasticConsts].
+  scalar_array _elasticConstsCells;
+
+  bool _reuseCellMatrices; ///< Reuse cell matrices when elasticity constants are unchanged.
+  bool _cellMatricesValid; ///< True if stored cell matrices are valid.
+  scalar_array _cellMatrices; ///< Stored cell matrices [numCells][cellMatrixSize].
+  std::vector<unsigned long long> _elasticConstsHashes; ///< Hash of elasticity constants for each cell.
+
 }; // ElasticityImplicit
 
 #endif // pylith_feassemble_elasticityimplicit_hh
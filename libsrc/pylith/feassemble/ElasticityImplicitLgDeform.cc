@@ -34,12 +34,9 @@
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
-#include "pylith/utils/lapack.h" // USES LAPACKdgesvd
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
-#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
-#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimendional
 
@@ -161,8 +158,6 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
   scalar_array deformCell(numQuadPts*spaceDim*spaceDim);
   scalar_array strainCell(numQuadPts*tensorSize);
   strainCell = 0.0;
-  scalar_array gravVec(spaceDim);
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
 
   // Get cell information
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
@@ -187,10 +182,6 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
 
   _material->createPropsAndVarsVisitors();
 
-  assert(_normalizer);
-  const PylithScalar lengthScale = _normalizer->lengthScale();
-  const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
-
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(computeEvent);
 
@@ -216,32 +207,20 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
     const scalar_array& basis = _quadrature->basis();
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
     const scalar_array& jacobianDet = _quadrature->jacobianDet();
-    const scalar_array& quadPtsNondim = _quadrature->quadPts();
 
     // Compute body force vector if gravity is being used.
     if (_gravityField) {
-      const spatialdata::geocoords::CoordSys* cs = fields->mesh().coordsys();assert(cs);
-      
       // Get density at quadrature points for this cell
       const scalar_array& density = _material->calcDensity();
 
-      quadPtsGlobal = quadPtsNondim;
-      _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-
       // Compute action for element body forces
-      spatialdata::spatialdb::SpatialDB* db = _gravityField;
+      const PylithScalar* gravCell = _gravityCell(c);
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-	const int err = db->query(&gravVec[0], gravVec.size(), &quadPtsGlobal[0], spaceDim, cs);
-	if (err) {
-	  throw std::runtime_error("Unable to get gravity vector for point.");
-	} // if
-	_normalizer->nondimensionalize(&gravVec[0], gravVec.size(), gravityScale);
-
 	const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad] * density[iQuad];
 	for (int iBasis=0, iQ=iQuad*numBasis; iBasis < numBasis; ++iBasis) {
 	  const PylithScalar valI = wt*basis[iQ+iBasis];
 	  for (int iDim=0; iDim < spaceDim; ++iDim) {
-	    _cellVector[iBasis*spaceDim+iDim] += valI*gravVec[iDim];
+	    _cellVector[iBasis*spaceDim+iDim] += valI*gravCell[iQuad*spaceDim+iDim];
 	  } // for
 	} // for
       } // for
@@ -404,41 +383,6 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
 
     CALL_MEMBER_FN(*this, elasticityJacobianFn)(elasticConsts, stressCell, dispTpdtCell);
 
-    if (_quadrature->checkConditioning()) {
-      int n = numBasis*spaceDim;
-      int lwork = 5*n;
-      int idummy = 0;
-      int lierr = 0;
-      PylithScalar *elemMat = new PylithScalar[n*n];
-      PylithScalar *svalues = new PylithScalar[n];
-      PylithScalar *work    = new PylithScalar[lwork];
-#if 0
-      PylithScalar minSV = 0;
-      PylithScalar maxSV = 0;
-#endif
-      PylithScalar sdummy = 0;
-
-      const int n2 = n*n;
-      for (int i = 0; i < n2; ++i)
-	elemMat[i] = _cellMatrix[i];
-      lapack_dgesvd("N", "N", &n, &n, elemMat, &n, svalues, 
-		    &sdummy, &idummy, &sdummy, &idummy, work,
-		    &lwork, &lierr);
-      if (lierr)
-	throw std::runtime_error("Lapack SVD failed");
-#if 0
-      minSV = svalues[n-7];
-      maxSV = svalues[0];
-      std::cout << "Element " << cell << std::endl;
-      for(int i = 0; i < n; ++i)
-        std::cout << "    sV["<<i<<"] = " << svalues[i] << std::endl;
-      std::cout << "  kappa(elemMat) = " << maxSV/minSV << std::endl;
-#endif
-      delete [] elemMat;
-      delete [] svalues;
-      delete [] work;
-    } // if
-
     // Assemble cell contribution into PETSc matrix.
     jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
   } // for
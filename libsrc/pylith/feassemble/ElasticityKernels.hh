@@ -0,0 +1,153 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/feassemble/ElasticityKernels.hh
+ *
+ * @brief Element kernels for small strain elasticity specialized for
+ * a fixed number of basis functions and quadrature points.
+ */
+
+#if !defined(pylith_feassemble_elasticitykernels_hh)
+#define pylith_feassemble_elasticitykernels_hh
+
+// Include directives ---------------------------------------------------
+#include "feassemblefwd.hh" // forward declarations
+
+#include "pylith/utils/arrayfwd.hh" // USES scalar_array
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+// ElasticityKernels ----------------------------------------------------
+/** @brief Element kernels for small strain elasticity specialized for
+ * a fixed number of basis functions and quadrature points.
+ *
+ * The kernels compute the same quantities as the generic kernels in
+ * IntegratorElasticity, but the sizes are template parameters so all
+ * loops have compile-time trip counts and the intermediate values live
+ * in fixed-size arrays on the stack. The Jacobian kernels also factor
+ * the product B^T D B so that the elastic constants are contracted with
+ * the derivatives of basis function i once rather than once per (i,j)
+ * pair.
+ *
+ * The signatures match IntegratorElasticity::elasticityResidual_kernel_type,
+ * IntegratorElasticity::elasticityJacobian_kernel_type, and
+ * IntegratorElasticity::totalStrain_fn_type, so the kernels can be
+ * selected once when the integrator is initialized.
+ */
+class pylith::feassemble::ElasticityKernels
+{ // ElasticityKernels
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Integrate elasticity term in residual for 2-D cells.
+   *
+   * @param cellVector Cell vector to update.
+   * @param stress Stress tensor for cell at quadrature points.
+   * @param quadrature Quadrature with geometry for current cell.
+   */
+  template<int numBasis, int numQuadPts>
+  static
+  void residual2D(scalar_array* cellVector,
+		  const scalar_array& stress,
+		  const Quadrature& quadrature);
+
+  /** Integrate elasticity term in residual for 3-D cells.
+   *
+   * @param cellVector Cell vector to update.
+   * @param stress Stress tensor for cell at quadrature points.
+   * @param quadrature Quadrature with geometry for current cell.
+   */
+  template<int numBasis, int numQuadPts>
+  static
+  void residual3D(scalar_array* cellVector,
+		  const scalar_array& stress,
+		  const Quadrature& quadrature);
+
+  /** Integrate elasticity term in Jacobian for 2-D cells.
+   *
+   * @param cellMatrix Cell matrix to update.
+   * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   * @param quadrature Quadrature with geometry for current cell.
+   */
+  template<int numBasis, int numQuadPts>
+  static
+  void jacobian2D(scalar_array* cellMatrix,
+		  const scalar_array& elasticConsts,
+		  const Quadrature& quadrature);
+
+  /** Integrate elasticity term in Jacobian for 3-D cells.
+   *
+   * @param cellMatrix Cell matrix to update.
+   * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   * @param quadrature Quadrature with geometry for current cell.
+   */
+  template<int numBasis, int numQuadPts>
+  static
+  void jacobian3D(scalar_array* cellMatrix,
+		  const scalar_array& elasticConsts,
+		  const Quadrature& quadrature);
+
+  /** Compute total strain at quadrature points of a 2-D cell.
+   *
+   * The size arguments are only checked against the template parameters.
+   *
+   * @param strain Strain tensor at quadrature points.
+   * @param basisDeriv Derivatives of basis functions at quadrature points.
+   * @param disp Displacement at vertices of cell.
+   * @param nbasis Number of basis functions for cell.
+   * @param spaceDim Spatial dimension.
+   * @param nquadpts Number of quadrature points.
+   */
+  template<int numBasis, int numQuadPts>
+  static
+  void totalStrain2D(scalar_array* strain,
+		     const scalar_array& basisDeriv,
+		     const PylithScalar* disp,
+		     const int nbasis,
+		     const int spaceDim,
+		     const int nquadpts);
+
+  /** Compute total strain at quadrature points of a 3-D cell.
+   *
+   * The size arguments are only checked against the template parameters.
+   *
+   * @param strain Strain tensor at quadrature points.
+   * @param basisDeriv Derivatives of basis functions at quadrature points.
+   * @param disp Displacement at vertices of cell.
+   * @param nbasis Number of basis functions for cell.
+   * @param spaceDim Spatial dimension.
+   * @param nquadpts Number of quadrature points.
+   */
+  template<int numBasis, int numQuadPts>
+  static
+  void totalStrain3D(scalar_array* strain,
+		     const scalar_array& basisDeriv,
+		     const PylithScalar* disp,
+		     const int nbasis,
+		     const int spaceDim,
+		     const int nquadpts);
+
+}; // ElasticityKernels
+
+#endif // pylith_feassemble_elasticitykernels_hh
+
+#include "ElasticityKernels.icc" // template methods
+
+
+// End of file
@@ -22,7 +22,7 @@
 
 #include "GeometryQuad3D.hh" // USES GeometryQuad3D
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
@@ -161,7 +161,7 @@ pylith::feassemble::GeometryHex3D::ptsRefToGlobal(PylithScalar* ptsGlobal,
       + h_01*p0*p1 + h_12*p1*p2 + h_02*p0*p2 + h_012*p0*p1*p2;
   } // for
 
-  PetscLogFlops(57 + npts*57);
+  pylith::utils::EventLogger::logFlops(57 + npts*57);
 } // ptsRefToGlobal
 
 // ----------------------------------------------------------------------
@@ -261,7 +261,7 @@ pylith::feassemble::GeometryHex3D::jacobian(scalar_array* jacobian,
     (*jacobian)[2]*((*jacobian)[3]*(*jacobian)[7] -
 		    (*jacobian)[4]*(*jacobian)[6]);
 
-  PetscLogFlops(152);
+  pylith::utils::EventLogger::logFlops(152);
 } // jacobian
 
 // ----------------------------------------------------------------------
@@ -372,7 +372,7 @@ pylith::feassemble::GeometryHex3D::jacobian(PylithScalar* jacobian,
     det[i] = j0*(j4*j8 - j5*j7) - j1*(j3*j8 - j5*j6) + j2*(j3*j7 - j4*j6);
   } // for
 
-  PetscLogFlops(78 + npts*69);
+  pylith::utils::EventLogger::logFlops(78 + npts*69);
 } // jacobian
 
 // ----------------------------------------------------------------------
@@ -413,7 +413,7 @@ pylith::feassemble::GeometryHex3D::minCellWidth(const PylithScalar* coordinatesC
     } // if
   } // for
 
-  PetscLogFlops(numEdges*9);
+  pylith::utils::EventLogger::logFlops(numEdges*9);
 
   return minWidth;
 } // minCellWidth
@@ -23,7 +23,7 @@
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES scalar_array
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 
@@ -91,7 +91,7 @@ pylith::feassemble::GeometryLine2D::ptsRefToGlobal(PylithScalar* ptsGlobal,
     ptsGlobal[iG++] = y0 + g_1 * p0;
   } // for
 
-  PetscLogFlops(2 + npts*6);
+  pylith::utils::EventLogger::logFlops(2 + npts*6);
 } // ptsRefToGlobal
 
 // ----------------------------------------------------------------------
@@ -127,7 +127,7 @@ pylith::feassemble::GeometryLine2D::jacobian(scalar_array* jacobian,
   *det = sqrt(pow((*jacobian)[0], 2) +
 	      pow((*jacobian)[1], 2));
 
-  PetscLogFlops(8);
+  pylith::utils::EventLogger::logFlops(8);
 } // jacobian
 
 // ----------------------------------------------------------------------
@@ -163,7 +163,7 @@ pylith::feassemble::GeometryLine2D::jacobian(PylithScalar* jacobian,
     det[i] = jdet;
   } // for
 
-  PetscLogFlops(8);
+  pylith::utils::EventLogger::logFlops(8);
 } // jacobian
 
 
@@ -187,7 +187,7 @@ pylith::feassemble::GeometryLine2D::minCellWidth(const PylithScalar* coordinates
     
   const PylithScalar minWidth = sqrt(pow(xB-xA,2) + pow(yB-yA,2));
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 
   return minWidth;
 } // minCellWidth
@@ -20,7 +20,7 @@
 
 #include "GeometryLine3D.hh" // implementation of class methods
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES scalar_array
@@ -95,7 +95,7 @@ pylith::feassemble::GeometryLine3D::ptsRefToGlobal(PylithScalar* ptsGlobal,
     ptsGlobal[iG++] = z0 + h_1 * p0;
   } // for
 
-  PetscLogFlops(3 + npts*8);
+  pylith::utils::EventLogger::logFlops(3 + npts*8);
 } // ptsRefToGlobal
 
 // ----------------------------------------------------------------------
@@ -134,7 +134,7 @@ pylith::feassemble::GeometryLine3D::jacobian(scalar_array* jacobian,
   *det = sqrt(pow((*jacobian)[0], 2) +
 	      pow((*jacobian)[1], 2) +
 	      pow((*jacobian)[2], 2));
-  PetscLogFlops(12);
+  pylith::utils::EventLogger::logFlops(12);
 } // jacobian
 
 // ----------------------------------------------------------------------
@@ -174,7 +174,7 @@ pylith::feassemble::GeometryLine3D::jacobian(PylithScalar* jacobian,
     det[i] = jdet;
   } // for
 
-  PetscLogFlops(12);
+  pylith::utils::EventLogger::logFlops(12);
 } // jacobian
 
 
@@ -200,7 +200,7 @@ pylith::feassemble::GeometryLine3D::minCellWidth(const PylithScalar* coordinates
     
   const PylithScalar minWidth = sqrt(pow(xB-xA,2) + pow(yB-yA,2) + pow(zB-zA,2));
 
-  PetscLogFlops(9);
+  pylith::utils::EventLogger::logFlops(9);
 
   return minWidth;
 } // minCellWidth
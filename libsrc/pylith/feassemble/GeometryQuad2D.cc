@@ -22,7 +22,7 @@
 
 #include "GeometryLine2D.hh" // USES GeometryLine2D
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES scalar_array
@@ -108,7 +108,7 @@ pylith::feassemble::GeometryQuad2D::ptsRefToGlobal(PylithScalar* ptsGlobal,
     ptsGlobal[iG++] = y0 + g_1 * p0 + g_3 * p1 + g_01 * p0 * p1;
   } // for
 
-  PetscLogFlops(10 + npts*18);
+  pylith::utils::EventLogger::logFlops(10 + npts*18);
 } // ptsRefToGlobal
 
 // ----------------------------------------------------------------------
@@ -162,7 +162,7 @@ pylith::feassemble::GeometryQuad2D::jacobian(scalar_array* jacobian,
     (*jacobian)[0]*(*jacobian)[3] - 
     (*jacobian)[1]*(*jacobian)[2];
 
-  PetscLogFlops(31);
+  pylith::utils::EventLogger::logFlops(31);
 } // jacobian
 
 // ----------------------------------------------------------------------
@@ -220,7 +220,7 @@ pylith::feassemble::GeometryQuad2D::jacobian(PylithScalar* jacobian,
     det[i] = j00*j11 - j01*j10;
   } // for
 
-  PetscLogFlops(10 + npts*19);
+  pylith::utils::EventLogger::logFlops(10 + npts*19);
 } // jacobian
 
 
@@ -257,7 +257,7 @@ pylith::feassemble::GeometryQuad2D::minCellWidth(const PylithScalar* coordinates
     } // if
   } // for
 
-  PetscLogFlops(numEdges*6);
+  pylith::utils::EventLogger::logFlops(numEdges*6);
 
   return minWidth;
 } // minCellWidth
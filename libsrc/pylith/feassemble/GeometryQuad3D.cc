@@ -22,7 +22,7 @@
 
 #include "GeometryLine3D.hh" // USES GeometryLine3D
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES scalar_array
@@ -118,7 +118,7 @@ pylith::feassemble::GeometryQuad3D::ptsRefToGlobal(PylithScalar* ptsGlobal,
     ptsGlobal[iG++] = z0 + h_1 * p0 + h_3 * p1 + h_01 * p0 * p1;
   } // for
 
-  PetscLogFlops(15 + npts*25);
+  pylith::utils::EventLogger::logFlops(15 + npts*25);
 } // ptsRefToGlobal
 
 // ----------------------------------------------------------------------
@@ -192,7 +192,7 @@ pylith::feassemble::GeometryQuad3D::jacobian(scalar_array* jacobian,
     (*jacobian)[5]*(*jacobian)[5];
   *det = sqrt(jj00*jj11 - jj01*jj10);
 
-  PetscLogFlops(50);
+  pylith::utils::EventLogger::logFlops(50);
 } // jacobian
 
 // ----------------------------------------------------------------------
@@ -265,7 +265,7 @@ pylith::feassemble::GeometryQuad3D::jacobian(PylithScalar* jacobian,
     det[i] = sqrt(jj00*jj11 - jj01*jj10);
   } // for
 
-  PetscLogFlops(28 + npts*32);
+  pylith::utils::EventLogger::logFlops(28 + npts*32);
 } // jacobian
 
 
@@ -304,7 +304,7 @@ pylith::feassemble::GeometryQuad3D::minCellWidth(const PylithScalar* coordinates
     } // if
   } // for
 
-  PetscLogFlops(numEdges*9);
+  pylith::utils::EventLogger::logFlops(numEdges*9);
 
   return minWidth;
 } // minCellWidth
@@ -22,7 +22,7 @@
 
 #include "GeometryTri3D.hh" // USES GeometryTri3D
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES scalar_array
@@ -122,7 +122,7 @@ pylith::feassemble::GeometryTet3D::ptsRefToGlobal(PylithScalar* ptsGlobal,
     ptsGlobal[iG++] = z0 + h_1 * p0 + h_2 * p1 + h_3 * p2;
   } // for
 
-  PetscLogFlops(9 + npts*24);
+  pylith::utils::EventLogger::logFlops(9 + npts*24);
 } // ptsRefToGlobal
 
 // ----------------------------------------------------------------------
@@ -181,7 +181,7 @@ pylith::feassemble::GeometryTet3D::jacobian(scalar_array* jacobian,
     (*jacobian)[2]*((*jacobian)[3]*(*jacobian)[7] -
 		    (*jacobian)[4]*(*jacobian)[6]);
 
-  PetscLogFlops(32);
+  pylith::utils::EventLogger::logFlops(32);
 } // jacobian
 
 // ----------------------------------------------------------------------
@@ -247,7 +247,7 @@ pylith::feassemble::GeometryTet3D::jacobian(PylithScalar* jacobian,
     det[i] = jdet;
   } // for
 
-  PetscLogFlops(32);
+  pylith::utils::EventLogger::logFlops(32);
 } // jacobian
 
 
@@ -288,7 +288,7 @@ pylith::feassemble::GeometryTet3D::minCellWidth(const PylithScalar* coordinatesC
     } // if
   } // for
 
-  PetscLogFlops(numEdges*9);
+  pylith::utils::EventLogger::logFlops(numEdges*9);
 
   // Radius of inscribed sphere
   const PylithScalar v = volume(coordinatesCell, numVertices, spaceDim);
@@ -303,7 +303,7 @@ pylith::feassemble::GeometryTet3D::minCellWidth(const PylithScalar* coordinatesC
     minWidth = rwidth;
   } // if
 
-  PetscLogFlops(3);
+  pylith::utils::EventLogger::logFlops(3);
 
   return minWidth;
 } // minCellWidth
@@ -346,7 +346,7 @@ pylith::feassemble::GeometryTet3D::volume(const PylithScalar* coordinatesCell,
   assert(det > 0.0);
 
   const PylithScalar v = det / 6.0;
-  PetscLogFlops(48);
+  pylith::utils::EventLogger::logFlops(48);
   
   return v;  
 } // volume
@@ -427,7 +427,7 @@ pylith::feassemble::GeometryTet3D::faceArea(const PylithScalar* coordinatesCell,
   const PylithScalar areaZ = a[0]*b[1] - a[1]*b[0];
 
   const PylithScalar area = 0.5*sqrt(areaX*areaX + areaY*areaY + areaZ*areaZ);
-  PetscLogFlops(22);
+  pylith::utils::EventLogger::logFlops(22);
   
   return area;
 } // faceArea
@@ -22,7 +22,7 @@
 
 #include "GeometryLine2D.hh" // USES GeometryLine2D
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES scalar_array
@@ -101,7 +101,7 @@ pylith::feassemble::GeometryTri2D::ptsRefToGlobal(PylithScalar* ptsGlobal,
     ptsGlobal[iG++] = y0 + g_1 * p0 + g_2 * p1;
   } // for
 
-  PetscLogFlops(4 + npts*12);
+  pylith::utils::EventLogger::logFlops(4 + npts*12);
 } // ptsRefToGlobal
 
 // ----------------------------------------------------------------------
@@ -144,7 +144,7 @@ pylith::feassemble::GeometryTri2D::jacobian(scalar_array* jacobian,
     (*jacobian)[0]*(*jacobian)[3] - 
     (*jacobian)[1]*(*jacobian)[2];
 
-  PetscLogFlops(11);
+  pylith::utils::EventLogger::logFlops(11);
 } // jacobian
 
 // ----------------------------------------------------------------------
@@ -188,7 +188,7 @@ pylith::feassemble::GeometryTri2D::jacobian(PylithScalar* jacobian,
     det[i] = jdet;
   } // for
 
-  PetscLogFlops(11);
+  pylith::utils::EventLogger::logFlops(11);
 } // jacobian
 
 
@@ -226,7 +226,7 @@ pylith::feassemble::GeometryTri2D::minCellWidth(const PylithScalar* coordinatesC
     } // if
   } // for
 
-  PetscLogFlops(numEdges*6);
+  pylith::utils::EventLogger::logFlops(numEdges*6);
 
   // Ad-hoc to account for distorted cells.
   // Radius of inscribed circle.
@@ -248,7 +248,7 @@ pylith::feassemble::GeometryTri2D::minCellWidth(const PylithScalar* coordinatesC
     minWidth = rwidth;
   } // if
 
-  PetscLogFlops(3*6 + 3 + 8);
+  pylith::utils::EventLogger::logFlops(3*6 + 3 + 8);
 
   return minWidth;
 } // minCellWidth
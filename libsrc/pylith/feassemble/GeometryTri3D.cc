@@ -22,7 +22,7 @@
 
 #include "GeometryLine3D.hh" // USES GeometryLine3D
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES scalar_array
@@ -107,7 +107,7 @@ pylith::feassemble::GeometryTri3D::ptsRefToGlobal(PylithScalar* ptsGlobal,
     ptsGlobal[iG++] = z0 + h_1 * p0 + h_2 * p1;
   } // for
 
-  PetscLogFlops(22);
+  pylith::utils::EventLogger::logFlops(22);
 } // ptsRefToGlobal
 
 // ----------------------------------------------------------------------
@@ -167,7 +167,7 @@ pylith::feassemble::GeometryTri3D::jacobian(scalar_array* jacobian,
     (*jacobian)[3]*(*jacobian)[3] +
     (*jacobian)[5]*(*jacobian)[5];
   *det = sqrt(jj00*jj11 - jj01*jj10);
-  PetscLogFlops(25);
+  pylith::utils::EventLogger::logFlops(25);
 } // jacobian
 
 // ----------------------------------------------------------------------
@@ -224,7 +224,7 @@ pylith::feassemble::GeometryTri3D::jacobian(PylithScalar* jacobian,
     det[i] = jdet;
   } // for
 
-  PetscLogFlops(31);
+  pylith::utils::EventLogger::logFlops(31);
 } // jacobian
 
 
@@ -263,7 +263,7 @@ pylith::feassemble::GeometryTri3D::minCellWidth(const PylithScalar* coordinatesC
     } // if
   } // for
 
-  PetscLogFlops(numEdges*9);
+  pylith::utils::EventLogger::logFlops(numEdges*9);
 
 #if 1
   // Ad-hoc to account for distorted cells.
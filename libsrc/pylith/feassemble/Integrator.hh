@@ -181,6 +181,53 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Check whether integrator can apply its contribution to the
+   * Jacobian without assembling a sparse matrix.
+   *
+   * Default is true, because the default integrator does not
+   * contribute to the Jacobian.
+   *
+   * @returns True if integrator supports matrix-free Jacobian, false otherwise.
+   */
+  virtual
+  bool hasJacobianAction(void) const;
+
+  /** Update data needed to apply the Jacobian without assembling it,
+   * such as the linearization at the current solution.
+   *
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  virtual
+  void prepareJacobianAction(const PylithScalar t,
+			     topology::SolutionFields* const fields);
+
+  /** Integrate contributions to action of Jacobian matrix (A) on a
+   * field, A*input, without assembling A.
+   *
+   * @param action Field to which A*input is added.
+   * @param input Field to which the Jacobian is applied.
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  virtual
+  void integrateJacobianAction(const topology::Field& action,
+			       const topology::Field& input,
+			       const PylithScalar t,
+			       topology::SolutionFields* const fields);
+
+  /** Integrate contributions to diagonal of Jacobian matrix (A)
+   * without assembling A.
+   *
+   * @param diagonal Field to which diagonal of A is added.
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  virtual
+  void integrateJacobianDiagonal(const topology::Field& diagonal,
+				 const PylithScalar t,
+				 topology::SolutionFields* const fields);
+
   /** Integrate contributions to Jacobian matrix (A) associated with
    * operator.
    *
@@ -22,6 +22,7 @@
 
 #include "Quadrature.hh" // USES Quadrature
 #include "CellGeometry.hh" // USES CellGeometry
+#include "ElasticityKernels.hh" // USES ElasticityKernels
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
@@ -34,22 +35,30 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
 #include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 
 #include <strings.h> // USES strcasecmp()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <iostream> // USES std::cerr
-#include <algorithm> // USES std::transform()
+#include <algorithm> // USES std::transform(), std::max(), std::min()
+#include <cmath> // USES sqrt()
 
 // ----------------------------------------------------------------------
 // Constructor
 pylith::feassemble::IntegratorElasticity::IntegratorElasticity(void) :
     _material(0),
     _materialIS(0),
-    _outputFields(0)
+    _outputFields(0),
+    _allowGeometryCache(true),
+    _residualKernel(0),
+    _jacobianKernel(0),
+    _totalStrainKernel(0),
+    _gravityUniform(false)
 { // constructor
 } // constructor
 
@@ -72,6 +81,7 @@ pylith::feassemble::IntegratorElasticity::deallocate(void)
     _material = 0; // :TODO: Use shared pointer.
     delete _materialIS; _materialIS = 0;
     delete _outputFields; _outputFields = 0;
+    _gravityCells.resize(0);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -100,6 +110,14 @@ pylith::feassemble::IntegratorElasticity::needNewJacobian(void)
     PYLITH_METHOD_RETURN(_needNewJacobian);
 } // needNewJacobian
 
+// ----------------------------------------------------------------------
+// Check whether integrator supports matrix-free Jacobian.
+bool
+pylith::feassemble::IntegratorElasticity::hasJacobianAction(void) const
+{ // hasJacobianAction
+    return false;
+} // hasJacobianAction
+
 // ----------------------------------------------------------------------
 // Initialize integrator.
 void
@@ -111,6 +129,7 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
     assert(_material);
 
     _initializeLogger();
+    _selectKernels();
 
     // Setup index set for material.
     PetscDM dmMesh = mesh.dmMesh(); assert(dmMesh);
@@ -121,6 +140,9 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
 
     // Compute geometry for quadrature operations.
     _quadrature->initializeGeometry();
+    if (_allowGeometryCache && _quadrature->cacheGeometry()) {
+        _quadrature->initializeGeometryCache(mesh, _materialIS->points(), _materialIS->size());
+    } // if
 
     // Optimize coordinate retrieval in closure
     topology::CoordsVisitor::optimizeClosure(dmMesh);
@@ -139,6 +161,7 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
         _gravityField->open();
         const char* queryNames[3] = { "gravity_field_x", "gravity_field_y", "gravity_field_z" };
         _gravityField->queryVals(queryNames, spaceDim);
+        _setupGravityCache(mesh);
     } // if
 
     PYLITH_METHOD_END;
@@ -182,6 +205,11 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     scalar_array strainCell(numQuadPts*tensorSize);
     strainCell = 0.0;
 
+    // Strains for block of cells are stored in structure-of-arrays
+    // layout (see ElasticMaterial::retrievePropsAndVarsBatch()).
+    const PetscInt batchSize = 64;
+    scalar_array strainBatch;
+
     // Get cell information
     PetscDM dmMesh = fields->mesh().dmMesh(); assert(dmMesh);
     assert(_materialIS);
@@ -198,26 +226,38 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
 
     _material->createPropsAndVarsVisitors();
 
-    // Loop over cells
-    for(PetscInt c = 0; c < numCells; ++c) {
-        const PetscInt cell = cells[c];
+    // Loop over blocks of cells
+    for (PetscInt cBatch = 0; cBatch < numCells; cBatch += batchSize) {
+        const PetscInt numCellsBatch = std::min(batchSize, numCells-cBatch);
+        const int numPoints = numCellsBatch*numQuadPts;
+        if (strainBatch.size() != size_t(numPoints*tensorSize)) {
+            strainBatch.resize(numPoints*tensorSize);
+        } // if
 
-        // Retrieve geometry information for current cell
-        coordsVisitor.getClosure(&coordsCell, cell);
-        _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
-        const scalar_array& basisDeriv = _quadrature->basisDeriv();
+        // Compute strains for cells in block.
+        for (PetscInt iCell = 0; iCell < numCellsBatch; ++iCell) {
+            const PetscInt cell = cells[cBatch+iCell];
 
-        // Get physical properties and state variables for cell.
-        _material->retrievePropsAndVars(cell);
+            // Retrieve geometry information for current cell
+            coordsVisitor.getClosure(&coordsCell, cell);
+            _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+            const scalar_array& basisDeriv = _quadrature->basisDeriv();
 
-        // Restrict input fields to cell
-        dispVisitor.getClosure(&dispCell, cell);
+            // Restrict input fields to cell
+            dispVisitor.getClosure(&dispCell, cell);
 
-        // Compute strains
-        calcTotalStrainFn(&strainCell, basisDeriv, &dispCell[0], numBasis, spaceDim, numQuadPts);
+            // Compute strains
+            calcTotalStrainFn(&strainCell, basisDeriv, &dispCell[0], numBasis, spaceDim, numQuadPts);
+            for (int iQuad = 0, iPoint = iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+                for (int iComp = 0; iComp < tensorSize; ++iComp) {
+                    strainBatch[iComp*numPoints+iPoint] = strainCell[iQuad*tensorSize+iComp];
+                } // for
+            } // for
+        } // for
 
-        // Update material state
-        _material->updateStateVars(strainCell, cell);
+        // Update material state for cells in block.
+        _material->retrievePropsAndVarsBatch(&cells[cBatch], numCellsBatch);
+        _material->updateStateVarsBatch(strainBatch, &cells[cBatch], numCellsBatch);
     } // for
     _material->destroyPropsAndVarsVisitors();
 
@@ -365,6 +405,16 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
         buffer.dimensionalizeOkay(true);
         PYLITH_METHOD_RETURN(buffer);
 
+    } else if (0 == strcasecmp(name, "condition_number")) {
+        if (!_outputFields->hasField("buffer (condition number)")) {
+            _outputFields->add("buffer (condition number)", "condition_number");
+            topology::Field& buffer = _outputFields->get("buffer (condition number)");
+            _calcConditionNumberField(&buffer, mesh);
+        } // if
+        topology::Field& buffer = _outputFields->get("buffer (condition number)");
+        buffer.dimensionalizeOkay(true);
+        PYLITH_METHOD_RETURN(buffer);
+
     } else if (0 == strcasecmp(name, "stable_dt_explicit")) {
         if (!_outputFields->hasField("buffer (other)"))
             _outputFields->add("buffer (other)", "buffer");
@@ -429,6 +479,125 @@ pylith::feassemble::IntegratorElasticity::_initializeLogger(void)
     PYLITH_METHOD_END;
 } // initializeLogger
 
+// ----------------------------------------------------------------------
+// Select element kernels specialized for cell type and quadrature.
+void
+pylith::feassemble::IntegratorElasticity::_selectKernels(void)
+{ // _selectKernels
+    assert(_quadrature);
+
+    const int numBasis = _quadrature->numBasis();
+    const int numQuadPts = _quadrature->numQuadPts();
+    const int cellDim = _quadrature->cellDim();
+    const int spaceDim = _quadrature->spaceDim();
+
+    _residualKernel = 0;
+    _jacobianKernel = 0;
+    _totalStrainKernel = 0;
+
+    if (cellDim != spaceDim) {
+        return;
+    } // if
+
+    if (2 == cellDim && 3 == numBasis && 1 == numQuadPts) { // tri3
+        _residualKernel = &ElasticityKernels::residual2D<3,1>;
+        _jacobianKernel = &ElasticityKernels::jacobian2D<3,1>;
+        _totalStrainKernel = &ElasticityKernels::totalStrain2D<3,1>;
+    } else if (2 == cellDim && 4 == numBasis && 4 == numQuadPts) { // quad4
+        _residualKernel = &ElasticityKernels::residual2D<4,4>;
+        _jacobianKernel = &ElasticityKernels::jacobian2D<4,4>;
+        _totalStrainKernel = &ElasticityKernels::totalStrain2D<4,4>;
+    } else if (3 == cellDim && 4 == numBasis && 1 == numQuadPts) { // tet4
+        _residualKernel = &ElasticityKernels::residual3D<4,1>;
+        _jacobianKernel = &ElasticityKernels::jacobian3D<4,1>;
+        _totalStrainKernel = &ElasticityKernels::totalStrain3D<4,1>;
+    } else if (3 == cellDim && 8 == numBasis && 8 == numQuadPts) { // hex8
+        _residualKernel = &ElasticityKernels::residual3D<8,8>;
+        _jacobianKernel = &ElasticityKernels::jacobian3D<8,8>;
+        _totalStrainKernel = &ElasticityKernels::totalStrain3D<8,8>;
+    } // if/else
+} // _selectKernels
+
+// ----------------------------------------------------------------------
+// Compute and store gravitational acceleration at quadrature points.
+void
+pylith::feassemble::IntegratorElasticity::_setupGravityCache(const topology::Mesh& mesh)
+{ // _setupGravityCache
+    PYLITH_METHOD_BEGIN;
+
+    assert(_quadrature);
+    assert(_materialIS);
+    assert(_gravityField);
+    assert(_normalizer);
+
+    const int numQuadPts = _quadrature->numQuadPts();
+    const int spaceDim = _quadrature->spaceDim();
+    const int numCorners = _quadrature->refGeometry().numCorners();
+    const int cellSize = numQuadPts*spaceDim;
+
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+
+    PetscDM dmMesh = mesh.dmMesh(); assert(dmMesh);
+    const spatialdata::geocoords::CoordSys* cs = mesh.coordsys(); assert(cs);
+
+    scalar_array coordsCell(numCorners*spaceDim);
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+
+    const PylithScalar lengthScale = _normalizer->lengthScale();
+    const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
+
+    _gravityCells.resize(numCells*cellSize);
+    _gravityUniform = true;
+    scalar_array quadPtsGlobal(cellSize);
+    for (PetscInt c = 0; c < numCells; ++c) {
+        const PetscInt cell = cells[c];
+        coordsVisitor.getClosure(&coordsCell, cell);
+        _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+
+        quadPtsGlobal = _quadrature->quadPts();
+        _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
+
+        PylithScalar* gravCell = &_gravityCells[c*cellSize];
+        for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+            const int err = _gravityField->query(&gravCell[iQuad*spaceDim], spaceDim, &quadPtsGlobal[iQuad*spaceDim], spaceDim, cs);
+            if (err) {
+                throw std::runtime_error("Unable to get gravity vector for point.");
+            } // if
+        } // for
+        _normalizer->nondimensionalize(gravCell, cellSize, gravityScale);
+
+        for (int i = 0; i < cellSize && _gravityUniform; ++i) {
+            _gravityUniform = gravCell[i] == _gravityCells[i % spaceDim];
+        } // for
+    } // for
+
+    if (_gravityUniform && numCells > 0) {
+        // Keep only values for one cell.
+        const scalar_array gravCell(&_gravityCells[0], cellSize);
+        _gravityCells.resize(cellSize);
+        _gravityCells = gravCell;
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setupGravityCache
+
+// ----------------------------------------------------------------------
+// Get gravitational acceleration at quadrature points of a cell.
+const PylithScalar*
+pylith::feassemble::IntegratorElasticity::_gravityCell(const int iCell) const
+{ // _gravityCell
+    assert(_quadrature);
+    assert(_gravityCells.size() > 0);
+
+    if (_gravityUniform) {
+        return &_gravityCells[0];
+    } // if
+    const int cellSize = _quadrature->numQuadPts() * _quadrature->spaceDim();
+    assert(size_t((iCell+1)*cellSize) <= _gravityCells.size());
+    return &_gravityCells[iCell*cellSize];
+} // _gravityCell
+
 // ----------------------------------------------------------------------
 // Allocate buffer for tensor field at quadrature points.
 void
@@ -463,6 +632,115 @@ pylith::feassemble::IntegratorElasticity::_allocateTensorField(const topology::M
     PYLITH_METHOD_END;
 } // _allocateTensorField
 
+// ----------------------------------------------------------------------
+// Compute condition number of Jacobian of cells.
+void
+pylith::feassemble::IntegratorElasticity::_calcConditionNumberField(topology::Field* field,
+                                                                    const topology::Mesh& mesh)
+{ // _calcConditionNumberField
+    PYLITH_METHOD_BEGIN;
+
+    assert(field);
+    assert(_quadrature);
+
+    const int numQuadPts = _quadrature->numQuadPts();
+    const int cellDim = _quadrature->cellDim();
+    const int spaceDim = _quadrature->spaceDim();
+    const int numCorners = _quadrature->refGeometry().numCorners();
+    if (cellDim != spaceDim) {
+        throw std::logic_error("Condition number of cells requires cell dimension equal to spatial dimension.");
+    } // if
+    const int jacobianSize = cellDim*spaceDim;
+
+    // Get cell information
+    PetscDM dmMesh = mesh.dmMesh(); assert(dmMesh);
+    assert(_materialIS);
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+
+    int_array cellsTmp(cells, numCells);
+    field->newSection(cellsTmp, 1);
+    field->allocate();
+    field->label("condition_number");
+    field->scale(1.0);
+    field->vectorFieldType(topology::FieldBase::SCALAR);
+
+    scalar_array coordsCell(numCorners*spaceDim);
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+
+    topology::VecVisitorMesh fieldVisitor(*field);
+    PetscScalar* fieldArray = fieldVisitor.localArray(); assert(fieldArray);
+
+    for (PetscInt c = 0; c < numCells; ++c) {
+        const PetscInt cell = cells[c];
+        coordsVisitor.getClosure(&coordsCell, cell);
+        _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+
+        const scalar_array& jacobian = _quadrature->jacobian();
+        const scalar_array& jacobianDet = _quadrature->jacobianDet();
+        PylithScalar conditionNumber = 1.0;
+        for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+            const PylithScalar value = _jacobianConditionNumber(&jacobian[iQuad*jacobianSize], jacobianDet[iQuad], cellDim);
+            conditionNumber = std::max(conditionNumber, value);
+        } // for
+
+        const PetscInt off = fieldVisitor.sectionOffset(cell);
+        assert(1 == fieldVisitor.sectionDof(cell));
+        fieldArray[off] = conditionNumber;
+    } // for
+
+    PYLITH_METHOD_END;
+} // _calcConditionNumberField
+
+// ----------------------------------------------------------------------
+// Compute condition number of Jacobian at a quadrature point.
+PylithScalar
+pylith::feassemble::IntegratorElasticity::_jacobianConditionNumber(const PylithScalar* jacobian,
+                                                                   const PylithScalar jacobianDet,
+                                                                   const int dim)
+{ // _jacobianConditionNumber
+    assert(jacobian);
+
+    if (jacobianDet <= 0.0) {
+        return pylith::PYLITH_MAXSCALAR;
+    } // if
+
+    // ||J^{-1}|| = ||adj(J)|| / det(J)
+    PylithScalar normJ2 = 0.0;
+    for (int i = 0; i < dim*dim; ++i) {
+        normJ2 += jacobian[i]*jacobian[i];
+    } // for
+
+    PylithScalar normAdj2 = 0.0;
+    switch (dim) {
+    case 1:
+        normAdj2 = 1.0;
+        break;
+    case 2:
+        normAdj2 = normJ2;
+        break;
+    case 3: {
+        const PylithScalar* j = jacobian;
+        const PylithScalar a00 = j[4]*j[8] - j[5]*j[7];
+        const PylithScalar a01 = j[2]*j[7] - j[1]*j[8];
+        const PylithScalar a02 = j[1]*j[5] - j[2]*j[4];
+        const PylithScalar a10 = j[5]*j[6] - j[3]*j[8];
+        const PylithScalar a11 = j[0]*j[8] - j[2]*j[6];
+        const PylithScalar a12 = j[2]*j[3] - j[0]*j[5];
+        const PylithScalar a20 = j[3]*j[7] - j[4]*j[6];
+        const PylithScalar a21 = j[1]*j[6] - j[0]*j[7];
+        const PylithScalar a22 = j[0]*j[4] - j[1]*j[3];
+        normAdj2 = a00*a00 + a01*a01 + a02*a02 + a10*a10 + a11*a11 + a12*a12 + a20*a20 + a21*a21 + a22*a22;
+        break;
+    } // case 3
+    default:
+        assert(0);
+        throw std::logic_error("Unknown cell dimension in IntegratorElasticity::_jacobianConditionNumber().");
+    } // switch
+
+    return sqrt(normJ2*normAdj2) / (jacobianDet*dim);
+} // _jacobianConditionNumber
+
 // ----------------------------------------------------------------------
 void
 pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field* field,
@@ -561,18 +839,40 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
 void
 pylith::feassemble::IntegratorElasticity::_elasticityResidual2D(const scalar_array& stress)
 { // _elasticityResidual2D
+    assert(_quadrature);
+
+    if (_residualKernel) {
+        _residualKernel(&_cellVector, stress, *_quadrature);
+    } else {
+        _elasticityResidual2D(&_cellVector, stress, *_quadrature);
+    } // if/else
+
+    const int numQuadPts = _quadrature->numQuadPts();
+    const int numBasis = _quadrature->numBasis();
+    PetscLogFlops(numQuadPts*(1+numBasis*(8+2+9)));
+} // _elasticityResidual2D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in residual for 2-D cells using caller-provided buffers.
+void
+pylith::feassemble::IntegratorElasticity::_elasticityResidual2D(scalar_array* cellVector,
+                                                                const scalar_array& stress,
+                                                                const Quadrature& quadrature)
+{ // _elasticityResidual2D
+    assert(cellVector);
+
     const int cellDim = 2;
     const int spaceDim = 2;
     const int stressSize = 3;
 
-    const int numQuadPts = _quadrature->numQuadPts();
-    const int numBasis = _quadrature->numBasis();
-    const scalar_array& quadWts = _quadrature->quadWts();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
-    const scalar_array& basisDeriv = _quadrature->basisDeriv();
+    const int numQuadPts = quadrature.numQuadPts();
+    const int numBasis = quadrature.numBasis();
+    const scalar_array& quadWts = quadrature.quadWts();
+    const scalar_array& jacobianDet = quadrature.jacobianDet();
+    const scalar_array& basisDeriv = quadrature.basisDeriv();
 
-    assert(_quadrature->spaceDim() == spaceDim);
-    assert(_quadrature->cellDim() == cellDim);
+    assert(quadrature.spaceDim() == spaceDim);
+    assert(quadrature.cellDim() == cellDim);
     assert(quadWts.size() == size_t(numQuadPts));
 
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
@@ -586,11 +886,10 @@ pylith::feassemble::IntegratorElasticity::_elasticityResidual2D(const scalar_arr
             const PylithScalar Nip = wt*basisDeriv[iQ+iBlock  ];
             const PylithScalar Niq = wt*basisDeriv[iQ+iBlock+1];
 
-            _cellVector[iBlock  ] -= Nip*s11 + Niq*s12;
-            _cellVector[iBlock+1] -= Nip*s12 + Niq*s22;
+            (*cellVector)[iBlock  ] -= Nip*s11 + Niq*s12;
+            (*cellVector)[iBlock+1] -= Nip*s12 + Niq*s22;
         } // for
     } // for
-    PetscLogFlops(numQuadPts*(1+numBasis*(8+2+9)));
 } // _elasticityResidual2D
 
 // ----------------------------------------------------------------------
@@ -598,18 +897,40 @@ pylith::feassemble::IntegratorElasticity::_elasticityResidual2D(const scalar_arr
 void
 pylith::feassemble::IntegratorElasticity::_elasticityResidual3D(const scalar_array& stress)
 { // _elasticityResidual3D
+    assert(_quadrature);
+
+    if (_residualKernel) {
+        _residualKernel(&_cellVector, stress, *_quadrature);
+    } else {
+        _elasticityResidual3D(&_cellVector, stress, *_quadrature);
+    } // if/else
+
+    const int numQuadPts = _quadrature->numQuadPts();
+    const int numBasis = _quadrature->numBasis();
+    PetscLogFlops(numQuadPts*(1+numBasis*(3+12)));
+} // _elasticityResidual3D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in residual for 3-D cells using caller-provided buffers.
+void
+pylith::feassemble::IntegratorElasticity::_elasticityResidual3D(scalar_array* cellVector,
+                                                                const scalar_array& stress,
+                                                                const Quadrature& quadrature)
+{ // _elasticityResidual3D
+    assert(cellVector);
+
     const int spaceDim = 3;
     const int cellDim = 3;
     const int stressSize = 6;
 
-    const int numQuadPts = _quadrature->numQuadPts();
-    const int numBasis = _quadrature->numBasis();
-    const scalar_array& quadWts = _quadrature->quadWts();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
-    const scalar_array& basisDeriv = _quadrature->basisDeriv();
+    const int numQuadPts = quadrature.numQuadPts();
+    const int numBasis = quadrature.numBasis();
+    const scalar_array& quadWts = quadrature.quadWts();
+    const scalar_array& jacobianDet = quadrature.jacobianDet();
+    const scalar_array& basisDeriv = quadrature.basisDeriv();
 
-    assert(_quadrature->spaceDim() == spaceDim);
-    assert(_quadrature->cellDim() == cellDim);
+    assert(quadrature.spaceDim() == spaceDim);
+    assert(quadrature.cellDim() == cellDim);
     assert(quadWts.size() == size_t(numQuadPts));
 
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
@@ -630,12 +951,11 @@ pylith::feassemble::IntegratorElasticity::_elasticityResidual3D(const scalar_arr
             const PylithScalar N2 = wt*basisDeriv[iQ+iBlock+1];
             const PylithScalar N3 = wt*basisDeriv[iQ+iBlock+2];
 
-            _cellVector[iBlock  ] -= N1*s11 + N2*s12 + N3*s13;
-            _cellVector[iBlock+1] -= N1*s12 + N2*s22 + N3*s23;
-            _cellVector[iBlock+2] -= N1*s13 + N2*s23 + N3*s33;
+            (*cellVector)[iBlock  ] -= N1*s11 + N2*s12 + N3*s13;
+            (*cellVector)[iBlock+1] -= N1*s12 + N2*s22 + N3*s23;
+            (*cellVector)[iBlock+2] -= N1*s13 + N2*s23 + N3*s33;
         } // for
     } // for
-    PetscLogFlops(numQuadPts*(1+numBasis*(3+12)));
 } // _elasticityResidual3D
 
 // ----------------------------------------------------------------------
@@ -643,18 +963,40 @@ pylith::feassemble::IntegratorElasticity::_elasticityResidual3D(const scalar_arr
 void
 pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_array& elasticConsts)
 { // _elasticityJacobian2D
+    assert(_quadrature);
+
+    if (_jacobianKernel) {
+        _jacobianKernel(&_cellMatrix, elasticConsts, *_quadrature);
+    } else {
+        _elasticityJacobian2D(&_cellMatrix, elasticConsts, *_quadrature);
+    } // if/else
+
+    const int numQuadPts = _quadrature->numQuadPts();
+    const int numBasis = _quadrature->numBasis();
+    PetscLogFlops(numQuadPts*(1+numBasis*(2+numBasis*(3*11+4))));
+} // _elasticityJacobian2D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in Jacobian for 2-D cells using caller-provided buffers.
+void
+pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(scalar_array* cellMatrix,
+                                                                const scalar_array& elasticConsts,
+                                                                const Quadrature& quadrature)
+{ // _elasticityJacobian2D
+    assert(cellMatrix);
+
     const int spaceDim = 2;
     const int cellDim = 2;
     const int numConsts = 9;
 
-    const int numQuadPts = _quadrature->numQuadPts();
-    const int numBasis = _quadrature->numBasis();
-    const scalar_array& quadWts = _quadrature->quadWts();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
-    const scalar_array& basisDeriv = _quadrature->basisDeriv();
+    const int numQuadPts = quadrature.numQuadPts();
+    const int numBasis = quadrature.numBasis();
+    const scalar_array& quadWts = quadrature.quadWts();
+    const scalar_array& jacobianDet = quadrature.jacobianDet();
+    const scalar_array& basisDeriv = quadrature.basisDeriv();
 
-    assert(_quadrature->spaceDim() == spaceDim);
-    assert(_quadrature->cellDim() == cellDim);
+    assert(quadrature.spaceDim() == spaceDim);
+    assert(quadrature.cellDim() == cellDim);
     assert(quadWts.size() == size_t(numQuadPts));
 
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
@@ -695,14 +1037,13 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_arr
                     C2212 * Ni2 * Nj1 + C1212 * Ni1 * Nj1;
                 const int jBlock = (jBasis*spaceDim  );
                 const int jBlock1 = (jBasis*spaceDim+1);
-                _cellMatrix[iBlock +jBlock ] += ki0j0;
-                _cellMatrix[iBlock +jBlock1] += ki0j1;
-                _cellMatrix[iBlock1+jBlock ] += ki1j0;
-                _cellMatrix[iBlock1+jBlock1] += ki1j1;
+                (*cellMatrix)[iBlock +jBlock ] += ki0j0;
+                (*cellMatrix)[iBlock +jBlock1] += ki0j1;
+                (*cellMatrix)[iBlock1+jBlock ] += ki1j0;
+                (*cellMatrix)[iBlock1+jBlock1] += ki1j1;
             } // for
         } // for
     } // for
-    PetscLogFlops(numQuadPts*(1+numBasis*(2+numBasis*(3*11+4))));
 } // _elasticityJacobian2D
 
 // ----------------------------------------------------------------------
@@ -710,18 +1051,40 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_arr
 void
 pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_array& elasticConsts)
 { // _elasticityJacobian3D
+    assert(_quadrature);
+
+    if (_jacobianKernel) {
+        _jacobianKernel(&_cellMatrix, elasticConsts, *_quadrature);
+    } else {
+        _elasticityJacobian3D(&_cellMatrix, elasticConsts, *_quadrature);
+    } // if/else
+
+    const int numQuadPts = _quadrature->numQuadPts();
+    const int numBasis = _quadrature->numBasis();
+    PetscLogFlops(numQuadPts*(1+numBasis*(3+numBasis*(6*26+9))));
+} // _elasticityJacobian3D
+
+// ----------------------------------------------------------------------
+// Integrate elasticity term in Jacobian for 3-D cells using caller-provided buffers.
+void
+pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(scalar_array* cellMatrix,
+                                                                const scalar_array& elasticConsts,
+                                                                const Quadrature& quadrature)
+{ // _elasticityJacobian3D
+    assert(cellMatrix);
+
     const int spaceDim = 3;
     const int cellDim = 3;
     const int numConsts = 36;
 
-    const int numQuadPts = _quadrature->numQuadPts();
-    const int numBasis = _quadrature->numBasis();
-    const scalar_array& quadWts = _quadrature->quadWts();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
-    const scalar_array& basisDeriv = _quadrature->basisDeriv();
+    const int numQuadPts = quadrature.numQuadPts();
+    const int numBasis = quadrature.numBasis();
+    const scalar_array& quadWts = quadrature.quadWts();
+    const scalar_array& jacobianDet = quadrature.jacobianDet();
+    const scalar_array& basisDeriv = quadrature.basisDeriv();
 
-    assert(_quadrature->spaceDim() == spaceDim);
-    assert(_quadrature->cellDim() == cellDim);
+    assert(quadrature.spaceDim() == spaceDim);
+    assert(quadrature.cellDim() == cellDim);
     assert(quadWts.size() == size_t(numQuadPts));
 
     // Compute Jacobian for consistent tangent matrix
@@ -819,19 +1182,18 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_arr
                 const int jBlock = jBasis*spaceDim;
                 const int jBlock1 = jBasis*spaceDim+1;
                 const int jBlock2 = jBasis*spaceDim+2;
-                _cellMatrix[iBlock +jBlock ] += ki0j0;
-                _cellMatrix[iBlock +jBlock1] += ki0j1;
-                _cellMatrix[iBlock +jBlock2] += ki0j2;
-                _cellMatrix[iBlock1+jBlock ] += ki1j0;
-                _cellMatrix[iBlock1+jBlock1] += ki1j1;
-                _cellMatrix[iBlock1+jBlock2] += ki1j2;
-                _cellMatrix[iBlock2+jBlock ] += ki2j0;
-                _cellMatrix[iBlock2+jBlock1] += ki2j1;
-                _cellMatrix[iBlock2+jBlock2] += ki2j2;
+                (*cellMatrix)[iBlock +jBlock ] += ki0j0;
+                (*cellMatrix)[iBlock +jBlock1] += ki0j1;
+                (*cellMatrix)[iBlock +jBlock2] += ki0j2;
+                (*cellMatrix)[iBlock1+jBlock ] += ki1j0;
+                (*cellMatrix)[iBlock1+jBlock1] += ki1j1;
+                (*cellMatrix)[iBlock1+jBlock2] += ki1j2;
+                (*cellMatrix)[iBlock2+jBlock ] += ki2j0;
+                (*cellMatrix)[iBlock2+jBlock1] += ki2j1;
+                (*cellMatrix)[iBlock2+jBlock2] += ki2j2;
             } // for
         } // for
     } // for
-    PetscLogFlops(numQuadPts*(1+numBasis*(3+numBasis*(6*26+9))));
 } // _elasticityJacobian3D
 
 // ----------------------------------------------------------------------
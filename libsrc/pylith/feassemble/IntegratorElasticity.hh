@@ -53,6 +53,16 @@ public :
 				      const int,
 				      const int,
 				      const int);
+
+  /// Prototype for kernels integrating the residual for a cell.
+  typedef void (*elasticityResidual_kernel_type)(scalar_array*,
+						 const scalar_array&,
+						 const Quadrature&);
+
+  /// Prototype for kernels integrating the Jacobian for a cell.
+  typedef void (*elasticityJacobian_kernel_type)(scalar_array*,
+						 const scalar_array&,
+						 const Quadrature&);
   
 
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
@@ -82,6 +92,14 @@ public :
   virtual
   bool needNewJacobian(void);
 
+  /** Check whether integrator can apply its contribution to the
+   * Jacobian without assembling a sparse matrix.
+   *
+   * @returns False; only ElasticityImplicit supports a matrix-free Jacobian.
+   */
+  virtual
+  bool hasJacobianAction(void) const;
+
   /** Initialize integrator.
    *
    * @param mesh Finite-element mesh.
@@ -128,12 +146,70 @@ protected :
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /** Select element kernels specialized for the cell type and
+   * quadrature of the integrator.
+   *
+   * Specialized kernels are available for linear triangles,
+   * quadrilaterals, tetrahedra, and hexahedra with their default
+   * quadrature. Other cells use the generic kernels.
+   */
+  void _selectKernels(void);
+
+  /** Compute and store the gravitational acceleration at the
+   * quadrature points of all material cells.
+   *
+   * Gravity does not change during a simulation, so the gravity field
+   * is queried once instead of for every residual evaluation. If the
+   * values are the same at all quadrature points (as for a uniform
+   * gravity field in Cartesian coordinates), only the values for a
+   * single cell are stored.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void _setupGravityCache(const topology::Mesh& mesh);
+
+  /** Get nondimensional gravitational acceleration at the quadrature
+   * points of a cell.
+   *
+   * @param iCell Index of cell in material index set.
+   * @returns Array of gravity vectors [numQuadPts][spaceDim].
+   */
+  const PylithScalar* _gravityCell(const int iCell) const;
+
   /** Allocate buffer for tensor field at quadrature points.
    *
    * @param mesh Finite-element mesh.
    */
   void _allocateTensorField(const topology::Mesh& mesh);
 
+  /** Compute condition number of the Jacobian of the mapping from the
+   * reference cell for each cell (maximum over quadrature points).
+   *
+   * This is a cheap estimate of how much the shape of a cell degrades
+   * the conditioning of its element matrix; it is 1 for cells with the
+   * same shape as the reference cell and grows without bound as cells
+   * degenerate. The values are computed once, when the field is first
+   * requested, with no per-cell allocation.
+   *
+   * @param field Field in which to store condition numbers.
+   * @param mesh Finite-element mesh.
+   */
+  void _calcConditionNumberField(topology::Field* field,
+				 const topology::Mesh& mesh);
+
+  /** Compute condition number, ||J|| ||J^{-1}|| / dim with Frobenius
+   * norms, of the Jacobian at a quadrature point.
+   *
+   * @param jacobian Jacobian at quadrature point [dim*dim].
+   * @param jacobianDet Determinant of Jacobian.
+   * @param dim Dimension of cell (same as spatial dimension).
+   * @returns Condition number.
+   */
+  static
+  PylithScalar _jacobianConditionNumber(const PylithScalar* jacobian,
+					const PylithScalar jacobianDet,
+					const int dim);
+
   /** Calculate stress or strain field from solution field.
    *
    * @param field Field in which to store stress or strain.
@@ -152,6 +228,21 @@ protected :
   virtual
   void _elasticityResidual2D(const scalar_array& stress);
 
+  /** Integrate elasticity term in residual for 2-D cells using the
+   * geometry in the given quadrature and the given cell buffer.
+   *
+   * Does not touch any data members, so it may be called concurrently
+   * with separate quadrature objects and buffers.
+   *
+   * @param cellVector Cell vector to update.
+   * @param stress Stress tensor for cell at quadrature points.
+   * @param quadrature Quadrature with geometry for current cell.
+   */
+  static
+  void _elasticityResidual2D(scalar_array* cellVector,
+                             const scalar_array& stress,
+                             const Quadrature& quadrature);
+
   /** Integrate elasticity term in residual for 3-D cells.
    *
    * @param stress Stress tensor for cell at quadrature points.
@@ -159,6 +250,21 @@ protected :
   virtual
   void _elasticityResidual3D(const scalar_array& stress);
 
+  /** Integrate elasticity term in residual for 3-D cells using the
+   * geometry in the given quadrature and the given cell buffer.
+   *
+   * Does not touch any data members, so it may be called concurrently
+   * with separate quadrature objects and buffers.
+   *
+   * @param cellVector Cell vector to update.
+   * @param stress Stress tensor for cell at quadrature points.
+   * @param quadrature Quadrature with geometry for current cell.
+   */
+  static
+  void _elasticityResidual3D(scalar_array* cellVector,
+                             const scalar_array& stress,
+                             const Quadrature& quadrature);
+
   /** Integrate elasticity term in Jacobian for 2-D cells.
    *
    * @param elasticConsts Matrix of elasticity constants at quadrature points.
@@ -166,6 +272,21 @@ protected :
   virtual
   void _elasticityJacobian2D(const scalar_array& elasticConsts);
 
+  /** Integrate elasticity term in Jacobian for 2-D cells using the
+   * geometry in the given quadrature and the given cell buffer.
+   *
+   * Does not touch any data members, so it may be called concurrently
+   * with separate quadrature objects and buffers.
+   *
+   * @param cellMatrix Cell matrix to update.
+   * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   * @param quadrature Quadrature with geometry for current cell.
+   */
+  static
+  void _elasticityJacobian2D(scalar_array* cellMatrix,
+                             const scalar_array& elasticConsts,
+                             const Quadrature& quadrature);
+
   /** Integrate elasticity term in Jacobian for 3-D cells.
    *
    * @param elasticConsts Matrix of elasticity constants at quadrature points.
@@ -173,6 +294,21 @@ protected :
   virtual
   void _elasticityJacobian3D(const scalar_array& elasticConsts);
 
+  /** Integrate elasticity term in Jacobian for 3-D cells using the
+   * geometry in the given quadrature and the given cell buffer.
+   *
+   * Does not touch any data members, so it may be called concurrently
+   * with separate quadrature objects and buffers.
+   *
+   * @param cellMatrix Cell matrix to update.
+   * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   * @param quadrature Quadrature with geometry for current cell.
+   */
+  static
+  void _elasticityJacobian3D(scalar_array* cellMatrix,
+                             const scalar_array& elasticConsts,
+                             const Quadrature& quadrature);
+
   /** Compute total strain in at quadrature points of a cell.
    *
    * @param strain Strain tensor at quadrature points.
@@ -217,6 +353,20 @@ protected :
   
   topology::Fields* _outputFields; ///< Buffers for output.
 
+  /// True if geometry of cells can be cached (cells do not deform).
+  bool _allowGeometryCache;
+
+  /// Specialized kernels for current cell type (NULL if not available).
+  elasticityResidual_kernel_type _residualKernel;
+  elasticityJacobian_kernel_type _jacobianKernel;
+  totalStrain_fn_type _totalStrainKernel;
+
+  /// Nondimensional gravitational acceleration at quadrature points
+  /// of material cells [numCells][numQuadPts][spaceDim], or
+  /// [numQuadPts][spaceDim] if gravity is uniform.
+  scalar_array _gravityCells;
+  bool _gravityUniform; ///< True if gravity is the same at all quadrature points.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
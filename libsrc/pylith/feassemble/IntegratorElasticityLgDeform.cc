@@ -45,6 +45,8 @@
 // Constructor
 pylith::feassemble::IntegratorElasticityLgDeform::IntegratorElasticityLgDeform(void)
 { // constructor
+  // Recompute geometry on the fly for large deformations.
+  _allowGeometryCache = false;
 } // constructor
 
 // ----------------------------------------------------------------------
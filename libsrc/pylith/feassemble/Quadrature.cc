@@ -29,9 +29,13 @@
 #include "Quadrature2Din3D.hh"
 #include "Quadrature3D.hh"
 
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
 #include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
 #include <cassert> // USES assert()
+#include <algorithm> // USES std::min(), std::max()
 #include <stdexcept> // USES std::runtime_error
 #include <iostream> // USES std::cerr
 #include <sstream> // USES std::ostringstream
@@ -40,7 +44,11 @@
 // Constructor
 pylith::feassemble::Quadrature::Quadrature(void) :
   _engine(0),
-  _checkConditioning(false)
+  _checkConditioning(false),
+  _cacheGeometry(false),
+  _geometryCacheBudget(512.0),
+  _cacheOwner(this),
+  _geometryCacheStart(0)
 { // constructor
 } // constructor
 
@@ -56,13 +64,11 @@ pylith::feassemble::Quadrature::~Quadrature(void)
 void
 pylith::feassemble::Quadrature::deallocate(void)
 { // deallocate
-  PYLITH_METHOD_BEGIN;
-
+  // No PETSc function stack macros, because copies are created and
+  // destroyed within OpenMP parallel regions.
   QuadratureRefCell::deallocate();
 
   delete _engine; _engine = 0;
-
-  PYLITH_METHOD_END;
 } // deallocate
   
 // ----------------------------------------------------------------------
@@ -70,14 +76,14 @@ pylith::feassemble::Quadrature::deallocate(void)
 pylith::feassemble::Quadrature::Quadrature(const Quadrature& q) :
   QuadratureRefCell(q),
   _engine(0),
-  _checkConditioning(q._checkConditioning)
+  _checkConditioning(q._checkConditioning),
+  _cacheGeometry(q._cacheGeometry),
+  _geometryCacheBudget(q._geometryCacheBudget),
+  _cacheOwner(this),
+  _geometryCacheStart(0)
 { // copy constructor
-  PYLITH_METHOD_BEGIN;
-
   if (q._engine)
     _engine = q._engine->clone();
-
-  PYLITH_METHOD_END;
 } // copy constructor
 
 // ----------------------------------------------------------------------
@@ -138,9 +144,77 @@ pylith::feassemble::Quadrature::clear(void)
   PYLITH_METHOD_BEGIN;
 
   delete _engine; _engine = 0;
+  _geometryCache.resize(0);
+  _geometryCacheIndex.resize(0);
+  _geometryCacheStart = 0;
+  _cacheOwner = this;
 
   PYLITH_METHOD_END;
 } // clear
 
+// ----------------------------------------------------------------------
+// Compute and cache geometry at quadrature points for cells.
+void
+pylith::feassemble::Quadrature::initializeGeometryCache(const topology::Mesh& mesh,
+							const PylithInt* cells,
+							const PylithInt numCells)
+{ // initializeGeometryCache
+  PYLITH_METHOD_BEGIN;
+
+  assert(_engine);
+
+  _cacheOwner = this;
+  _geometryCache.resize(0);
+  _geometryCacheIndex.resize(0);
+  _geometryCacheStart = 0;
+  if (!_cacheGeometry || numCells <= 0) {
+    PYLITH_METHOD_END;
+  } // if
+  assert(cells);
+
+  // Index from cell to position in cache covers the range of cells.
+  PylithInt cellMin = cells[0];
+  PylithInt cellMax = cells[0];
+  for (PylithInt c=1; c < numCells; ++c) {
+    cellMin = std::min(cellMin, cells[c]);
+    cellMax = std::max(cellMax, cells[c]);
+  } // for
+  const PylithInt indexSize = cellMax - cellMin + 1;
+
+  const int geometrySize = _engine->geometrySize();
+  const PylithScalar cacheMB = (PylithScalar(numCells) * geometrySize * sizeof(PylithScalar) + 
+				PylithScalar(indexSize) * sizeof(PylithInt)) / (1024.0*1024.0);
+  if (cacheMB > _geometryCacheBudget) {
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+  scalar_array coordsCell(_numBasis*_spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+
+  _geometryCache.resize(numCells*geometrySize);
+  _geometryCacheIndex.resize(indexSize);
+  _geometryCacheIndex = -1;
+  _geometryCacheStart = cellMin;
+  for (PylithInt c=0; c < numCells; ++c) {
+    const PylithInt cell = cells[c];
+    coordsVisitor.getClosure(&coordsCell, cell);
+    _engine->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+    _engine->packGeometry(&_geometryCache[c*geometrySize]);
+    _geometryCacheIndex[cell-cellMin] = c;
+  } // for
+
+  PYLITH_METHOD_END;
+} // initializeGeometryCache
+
+// ----------------------------------------------------------------------
+// Use geometry cache of another quadrature object.
+void
+pylith::feassemble::Quadrature::shareGeometryCache(const Quadrature& q)
+{ // shareGeometryCache
+  assert(q._cacheOwner);
+  _cacheOwner = q._cacheOwner;
+} // shareGeometryCache
+
 
 // End of file 
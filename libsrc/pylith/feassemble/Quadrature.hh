@@ -84,6 +84,64 @@ public :
    */
   bool checkConditioning(void) const;
 
+  /** Set flag for caching geometry of cells at quadrature points.
+   *
+   * The cache is only useful when the mesh does not deform, so it is
+   * ignored by integrators for large deformations.
+   *
+   * @param flag True to cache geometry, false otherwise.
+   */
+  void cacheGeometry(const bool flag);
+
+  /** Get flag for caching geometry of cells at quadrature points.
+   *
+   * @returns True if caching geometry, false otherwise.
+   */
+  bool cacheGeometry(void) const;
+
+  /** Set maximum memory used by geometry cache.
+   *
+   * @param value Maximum size of cache in MB.
+   */
+  void geometryCacheBudget(const PylithScalar value);
+
+  /** Get maximum memory used by geometry cache.
+   *
+   * @returns Maximum size of cache in MB.
+   */
+  PylithScalar geometryCacheBudget(void) const;
+
+  /** Compute and cache geometry at quadrature points for cells.
+   *
+   * The cache is not created if it would exceed the memory budget. In
+   * either case computeGeometry() returns the same values.
+   *
+   * @pre Must be preceded by call to initializeGeometry().
+   *
+   * @param mesh Finite-element mesh with (nondimensional) coordinates.
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   */
+  void initializeGeometryCache(const topology::Mesh& mesh,
+			       const PylithInt* cells,
+			       const PylithInt numCells);
+
+  /** Check whether geometry of cells is cached.
+   *
+   * @returns True if geometry is cached, false otherwise.
+   */
+  bool hasGeometryCache(void) const;
+
+  /** Use geometry cache of another quadrature object instead of this
+   * object's own cache (e.g., for per-thread copies).
+   *
+   * @pre The other quadrature object must outlive this one or until
+   * clear() is called.
+   *
+   * @param q Quadrature object holding geometry cache.
+   */
+  void shareGeometryCache(const Quadrature& q);
+
   /** Get coordinates of quadrature points in cell (NOT reference cell).
    *
    * @returns Array of coordinates of quadrature points in cell
@@ -113,6 +171,9 @@ public :
   void clear(void);
 
   /** Compute geometric quantities for a cell at quadrature points.
+   *
+   * If the cell is in the geometry cache, the cached values are used
+   * instead of computing them from the coordinates.
    *
    * @param coordinatesCell Array of coordinates of cell's vertices.
    * @param coordinatesSize Size of coordinates array.
@@ -122,12 +183,42 @@ public :
 		       const int coordinatesSize,
 		       const int cell);
 
+  /** Get number of values in geometric quantities for a cell.
+   *
+   * @returns Size of array for packGeometry() and unpackGeometry().
+   */
+  int geometrySize(void) const;
+
+  /** Pack geometric quantities for current cell into array.
+   *
+   * @param values Array of values [geometrySize()].
+   */
+  void packGeometry(PylithScalar* values) const;
+
+  /** Restore geometric quantities for a cell from array packed with
+   * packGeometry().
+   *
+   * @param values Array of values [geometrySize()].
+   */
+  void unpackGeometry(const PylithScalar* values);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   QuadratureEngine* _engine; ///< Quadrature geometry engine.
   bool _checkConditioning; ///< True if checking for ill-conditioning.
 
+  /** Geometry cache. Copies of a quadrature object have their own
+   * (initially empty) cache unless shareGeometryCache() points them
+   * at the cache of another object (via _cacheOwner).
+   */
+  bool _cacheGeometry; ///< True if caching geometry.
+  PylithScalar _geometryCacheBudget; ///< Maximum size of geometry cache in MB.
+  const Quadrature* _cacheOwner; ///< Quadrature holding geometry cache.
+  scalar_array _geometryCache; ///< Packed geometry for cached cells.
+  int_array _geometryCacheIndex; ///< Index of cell in cache (-1 if not cached).
+  PylithInt _geometryCacheStart; ///< First cell in index of geometry cache.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
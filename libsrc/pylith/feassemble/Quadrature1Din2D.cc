@@ -23,7 +23,7 @@
 #include "QuadratureRefCell.hh" // USES QuadratureRefCell
 #include "CellGeometry.hh" // USES CellGeometry
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 
@@ -144,7 +144,7 @@ pylith::feassemble::Quadrature1Din2D::computeGeometry(const PylithScalar* coordi
     } // for
   } // for
 
-  PetscLogFlops(numQuadPts * (1 + numBasis*spaceDim*2 +
+  pylith::utils::EventLogger::logFlops(numQuadPts * (1 + numBasis*spaceDim*2 +
 			      spaceDim*1 +
 			      numBasis*spaceDim*cellDim*2));
 } // computeGeometry
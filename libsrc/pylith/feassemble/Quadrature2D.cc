@@ -23,7 +23,7 @@
 #include "QuadratureRefCell.hh" // USES QuadratureRefCell
 #include "CellGeometry.hh" // USES CellGeometry
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 
@@ -157,7 +157,7 @@ pylith::feassemble::Quadrature2D::computeGeometry(const PylithScalar* coordinate
     } // for
   } // for
 
-  PetscLogFlops(numQuadPts*(4 +
+  pylith::utils::EventLogger::logFlops(numQuadPts*(4 +
 			    numBasis*spaceDim*2 +
 			    numBasis*spaceDim*cellDim*2));
 } // computeGeometry
@@ -23,7 +23,7 @@
 #include "QuadratureRefCell.hh" // USES QuadratureRefCell
 #include "CellGeometry.hh" // USES CellGeometry
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cmath> // USES fabs()
 #include <cassert> // USES assert()
@@ -237,7 +237,7 @@ pylith::feassemble::Quadrature2Din3D::computeGeometry(const PylithScalar* coordi
     } // for
   } // for
   
-  PetscLogFlops(numQuadPts*(15 +
+  pylith::utils::EventLogger::logFlops(numQuadPts*(15 +
 			    numBasis*spaceDim*2 +
 			    numBasis*spaceDim*cellDim*2));
 } // computeGeometry
@@ -23,7 +23,7 @@
 #include "QuadratureRefCell.hh" // USES QuadratureRefCell
 #include "CellGeometry.hh" // USES CellGeometry
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 
@@ -192,7 +192,7 @@ pylith::feassemble::Quadrature3D::computeGeometry(const PylithScalar* coordinate
     } // for
   } // for
   
-  PetscLogFlops(numQuadPts*(2+36 + numBasis*spaceDim*cellDim*4));
+  pylith::utils::EventLogger::logFlops(numQuadPts*(2+36 + numBasis*spaceDim*cellDim*4));
 } // computeGeometry
 
 
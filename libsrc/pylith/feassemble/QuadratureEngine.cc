@@ -25,6 +25,7 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
+#include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
@@ -90,6 +91,42 @@ pylith::feassemble::QuadratureEngine::zero(void)
   _basisDeriv = 0.0;
 } // zero
 
+// ----------------------------------------------------------------------
+// Pack geometric quantities for current cell into array.
+void
+pylith::feassemble::QuadratureEngine::packGeometry(PylithScalar* values) const
+{ // packGeometry
+  assert(values);
+
+  int index = 0;
+  for (size_t i=0; i < _quadPts.size(); ++i)
+    values[index++] = _quadPts[i];
+  for (size_t i=0; i < _jacobian.size(); ++i)
+    values[index++] = _jacobian[i];
+  for (size_t i=0; i < _jacobianDet.size(); ++i)
+    values[index++] = _jacobianDet[i];
+  for (size_t i=0; i < _basisDeriv.size(); ++i)
+    values[index++] = _basisDeriv[i];
+} // packGeometry
+
+// ----------------------------------------------------------------------
+// Unpack geometric quantities for a cell from array into cell buffers.
+void
+pylith::feassemble::QuadratureEngine::unpackGeometry(const PylithScalar* values)
+{ // unpackGeometry
+  assert(values);
+
+  int index = 0;
+  for (size_t i=0; i < _quadPts.size(); ++i)
+    _quadPts[i] = values[index++];
+  for (size_t i=0; i < _jacobian.size(); ++i)
+    _jacobian[i] = values[index++];
+  for (size_t i=0; i < _jacobianDet.size(); ++i)
+    _jacobianDet[i] = values[index++];
+  for (size_t i=0; i < _basisDeriv.size(); ++i)
+    _basisDeriv[i] = values[index++];
+} // unpackGeometry
+
 // ----------------------------------------------------------------------
 // Copy constructor.
 pylith::feassemble::QuadratureEngine::QuadratureEngine(const QuadratureEngine& q) :
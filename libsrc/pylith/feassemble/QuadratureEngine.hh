@@ -84,6 +84,28 @@ public :
    */
   const scalar_array& jacobianDet(void) const;
 
+  /** Get number of values in geometric quantities for a cell.
+   *
+   * @returns Size of packed quadrature points, Jacobian, determinant
+   * of Jacobian, and derivatives of basis functions.
+   */
+  int geometrySize(void) const;
+
+  /** Pack geometric quantities for current cell into array.
+   *
+   * Packs quadrature points, Jacobian, determinant of Jacobian, and
+   * derivatives of basis functions (in that order).
+   *
+   * @param values Array of values [geometrySize()].
+   */
+  void packGeometry(PylithScalar* values) const;
+
+  /** Unpack geometric quantities for a cell from array into cell buffers.
+   *
+   * @param values Array of values packed with packGeometry().
+   */
+  void unpackGeometry(const PylithScalar* values);
+
   /// Allocate cell buffers.
   void initialize(void);
 
@@ -57,8 +57,11 @@ namespace pylith {
     class ElasticityExplicit;
 
     class ElasticityExplicitTet4;
+    class ElasticityExplicitHex8;
     class ElasticityExplicitTri3;
 
+    class ElasticityKernels;
+
     class IntegratorElasticityLgDeform;
     class ElasticityImplicitLgDeform;
     class ElasticityExplicitLgDeform;
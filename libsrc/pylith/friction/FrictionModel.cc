@@ -28,6 +28,7 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
+#include "pylith/utils/DBQueryCache.hh" // USES DBQueryCache
 #include "pylith/faults/FaultCohesiveLagrange.hh" // USES isClampedVertex()
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
@@ -49,7 +50,11 @@ pylith::friction::FrictionModel::FrictionModel(const materials::Metadata& metada
   _label(""),
   _dbProperties(0),
   _dbInitialState(0),
+  _dbQueryCache(""),
+  _dbPropertiesFingerprint(""),
+  _dbInitialStateFingerprint(""),
   _fieldsPropsStateVars(0),
+  _vStart(0),
   _propsFiberDim(0),
   _varsFiberDim(0)
 { // constructor
@@ -71,6 +76,9 @@ pylith::friction::FrictionModel::deallocate(void)
 
   delete _normalizer; _normalizer = 0;
   delete _fieldsPropsStateVars; _fieldsPropsStateVars = 0;
+  _propsStateVarsFields.clear();
+  _propsStateVars.resize(0);
+  _propsStateVarsBatch.resize(0);
   _propsFiberDim = 0;
   _varsFiberDim = 0;
 
@@ -118,9 +126,22 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
   assert(_normalizer);
   const PylithScalar lengthScale = _normalizer->lengthScale();
 
-  scalar_array coordsVertexGlobal(spaceDim);
+  // Gather coordinates of vertices, so we can query the databases
+  // for all vertices at once.
   topology::CoordsVisitor coordsVisitor(faultDMMesh);
   PetscScalar* coordArray = coordsVisitor.localArray();
+  const PetscInt numVertices = vEnd - vStart;
+  scalar_array coordsVertices(numVertices*spaceDim);
+  for(PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt coff = coordsVisitor.sectionOffset(v);
+    assert(spaceDim == coordsVisitor.sectionDof(v));
+    for (PetscInt d = 0; d < spaceDim; ++d) {
+      coordsVertices[(v-vStart)*spaceDim+d] = coordArray[coff+d];
+    } // for
+  } // for
+  if (numVertices > 0) {
+    _normalizer->dimensionalize(&coordsVertices[0], coordsVertices.size(), lengthScale);
+  } // if
 
   // Query database for properties
 
@@ -128,6 +149,13 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
   delete _fieldsPropsStateVars; _fieldsPropsStateVars = new topology::Fields(faultMesh);assert(_fieldsPropsStateVars);
   _setupPropsStateVars();
 
+  // Properties and state variables are stored interleaved by vertex
+  // and copied to the fields for output.
+  const int propsStateVarsSize = _propsFiberDim + _varsFiberDim;
+  _vStart = vStart;
+  _propsStateVars.resize(numVertices*propsStateVarsSize);
+  _propsStateVars = 0.0;
+
   // Create arrays for querying.
   const int numDBProperties = _metadata.numDBProperties();
   scalar_array propertiesDBQuery(numDBProperties);
@@ -139,42 +167,22 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
   _dbProperties->queryVals(_metadata.dbProperties(),
 			   _metadata.numDBProperties());
 
+  scalar_array propertiesDBQueryVertices;
+  utils::DBQueryCache::query(&propertiesDBQueryVertices, _dbProperties, _metadata.dbProperties(), numDBProperties, coordsVertices, NULL, spaceDim, cs,
+			     _dbQueryCache.c_str(), _dbPropertiesFingerprint.c_str(), _label.c_str(), "properties", "parameters for physical properties", "friction model");
+
   for(PetscInt v = vStart; v < vEnd; ++v) {
-    const PetscInt coff = coordsVisitor.sectionOffset(v);
-    assert(spaceDim == coordsVisitor.sectionDof(v));
-    for (PetscInt d = 0; d < spaceDim; ++d) {
-      coordsVertexGlobal[d] = coordArray[coff+d];
+    for (int i=0; i < numDBProperties; ++i) {
+      propertiesDBQuery[i] = propertiesDBQueryVertices[(v-vStart)*numDBProperties+i];
     } // for
-    _normalizer->dimensionalize(&coordsVertexGlobal[0], coordsVertexGlobal.size(), lengthScale);
-
-    int err = _dbProperties->query(&propertiesDBQuery[0], 
-				   propertiesDBQuery.size(),
-				   &coordsVertexGlobal[0], spaceDim, cs);
-    if (err) {
-      std::ostringstream msg;
-      msg << "Could not find parameters for physical properties at " << "(";
-      for (int i = 0; i < spaceDim; ++i)
-        msg << "  " << coordsVertexGlobal[i];
-      msg << ") in friction model '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
-      throw std::runtime_error(msg.str());
-    } // if
     assert(propertiesVertex.size() == propertiesDBQuery.size());
     _dbToProperties(&propertiesVertex[0], propertiesDBQuery);
 
     _nondimProperties(&propertiesVertex[0], propertiesVertex.size());
-    PetscInt iOff = 0;
-
-    for (int i=0; i < _metadata.numProperties(); ++i) {
-      const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-      // TODO This needs to be an integer instead of a string
-      topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-      topology::VecVisitorMesh propertyVisitor(propertyField);
-      PetscScalar* propertyArray = propertyVisitor.localArray();
-      const PetscInt off = propertyVisitor.sectionOffset(v);
-      const PetscInt dof = propertyVisitor.sectionDof(v);
-      for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-        propertyArray[off+d] += propertiesVertex[iOff];
-      } // for
+
+    PylithScalar* propsVertex = &_propsStateVars[(v-vStart)*propsStateVarsSize];
+    for (int i=0; i < _propsFiberDim; ++i) {
+      propsVertex[i] = propertiesVertex[i];
     } // for
   } // for
   // Close properties database
@@ -196,42 +204,37 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
     PetscDMLabel clamped = NULL;
     PetscErrorCode err = DMGetLabel(faultDMMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
 
+    // Gather coordinates of vertices that are not clamped.
+    std::vector<PetscInt> verticesState;
+    verticesState.reserve(numVertices);
     for(PetscInt v = vStart; v < vEnd; ++v) {
-      if (faults::FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
-	continue;
+      if (!faults::FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
+	verticesState.push_back(v);
       } // if
+    } // for
+    const size_t numVerticesState = verticesState.size();
+    scalar_array coordsVerticesState(numVerticesState*spaceDim);
+    for (size_t iVertex=0; iVertex < numVerticesState; ++iVertex) {
+      for (int d=0; d < spaceDim; ++d) {
+	coordsVerticesState[iVertex*spaceDim+d] = coordsVertices[(verticesState[iVertex]-vStart)*spaceDim+d];
+      } // for
+    } // for
+
+    scalar_array stateVarsDBQueryVertices;
+    utils::DBQueryCache::query(&stateVarsDBQueryVertices, _dbInitialState, _metadata.dbStateVars(), numDBStateVars, coordsVerticesState, NULL, spaceDim, cs,
+			       _dbQueryCache.c_str(), _dbInitialStateFingerprint.c_str(), _label.c_str(), "state_vars", "initial state variables", "friction model");
 
-      const PetscInt coff = coordsVisitor.sectionOffset(v);
-      assert(spaceDim == coordsVisitor.sectionDof(v));
-      for (PetscInt d = 0; d < spaceDim; ++d) {
-	coordsVertexGlobal[d] = coordArray[coff+d];
+    for (size_t iVertex=0; iVertex < numVerticesState; ++iVertex) {
+      const PetscInt v = verticesState[iVertex];
+      for (int i=0; i < numDBStateVars; ++i) {
+	stateVarsDBQuery[i] = stateVarsDBQueryVertices[iVertex*numDBStateVars+i];
       } // for
-      _normalizer->dimensionalize(&coordsVertexGlobal[0], coordsVertexGlobal.size(), lengthScale);
-      
-      int err = _dbInitialState->query(&stateVarsDBQuery[0], numDBStateVars, &coordsVertexGlobal[0], spaceDim, cs);
-      if (err) {
-        std::ostringstream msg;
-        msg << "Could not find initial state variables at " << "(";
-        for (int i = 0; i < spaceDim; ++i)
-          msg << "  " << coordsVertexGlobal[i];
-        msg << ") in friction model '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
-        throw std::runtime_error(msg.str());
-      } // if
       _dbToStateVars(&stateVarsVertex[0], stateVarsDBQuery);
       _nondimStateVars(&stateVarsVertex[0], stateVarsVertex.size());
-      PetscInt iOff = 0;
-
-      for (int i=0; i < _metadata.numStateVars(); ++i) {
-        const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-        // TODO This needs to be an integer instead of a string
-        topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-	topology::VecVisitorMesh stateVarVisitor(stateVarField);
-	PetscScalar* stateVarArray = stateVarVisitor.localArray();
-	const PetscInt off = stateVarVisitor.sectionOffset(v);
-	const PetscInt dof = stateVarVisitor.sectionDof(v);
-        for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-          stateVarArray[off+d] += stateVarsVertex[iOff];
-        } // for
+
+      PylithScalar* stateVarsVertexStorage = &_propsStateVars[(v-vStart)*propsStateVarsSize+_propsFiberDim];
+      for (int i=0; i < _varsFiberDim; ++i) {
+	stateVarsVertexStorage[i] = stateVarsVertex[i];
       } // for
     } // for
     // Close database
@@ -240,6 +243,10 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
     std::cerr << "WARNING: No initial state given for friction model '" << label() << "'. Using default value of zero." << std::endl;
   } // if/else
 
+  // Copy properties and state variables to the fields.
+  const bool includeProperties = true;
+  _scatterPropsStateVars(NULL, 0, includeProperties);
+
   // Setup buffers for restrict/update of properties and state variables.
   _propsStateVarsVertex.resize(_propsFiberDim+_varsFiberDim);
 
@@ -310,33 +317,43 @@ pylith::friction::FrictionModel::retrievePropsStateVars(const int point)
   PYLITH_METHOD_BEGIN;
 
   assert(_fieldsPropsStateVars);
-  PetscInt iOff = 0;
 
-  for (int i=0; i < _metadata.numProperties(); ++i) {
-    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-    topology::VecVisitorMesh propertyVisitor(propertyField);
-    PetscScalar* propertyArray = propertyVisitor.localArray();
-    const PetscInt off = propertyVisitor.sectionOffset(point);
-    const PetscInt dof = propertyVisitor.sectionDof(point);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      _propsStateVarsVertex[iOff] = propertyArray[off+d];
-    } // for
+  const int propsStateVarsSize = _propsFiberDim + _varsFiberDim;
+  assert(_propsStateVarsVertex.size() == size_t(propsStateVarsSize));
+  assert(point >= _vStart && size_t((point-_vStart+1)*propsStateVarsSize) <= _propsStateVars.size());
+  const PylithScalar* propsStateVars = &_propsStateVars[(point-_vStart)*propsStateVarsSize];
+  for (int i=0; i < propsStateVarsSize; ++i) {
+    _propsStateVarsVertex[i] = propsStateVars[i];
   } // for
-  for (int i=0; i < _metadata.numStateVars(); ++i) {
-    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-    topology::VecVisitorMesh stateVarVisitor(stateVarField);
-    PetscScalar* stateVarArray = stateVarVisitor.localArray();
-    const PetscInt off = stateVarVisitor.sectionOffset(point);
-    const PetscInt dof = stateVarVisitor.sectionDof(point);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      _propsStateVarsVertex[iOff] = stateVarArray[off+d];
+
+  PYLITH_METHOD_END;
+} // retrievePropsStateVars
+
+// ----------------------------------------------------------------------
+// Retrieve properties and state variables for a batch of points.
+void
+pylith::friction::FrictionModel::retrievePropsStateVars(scalar_array* propsStateVars,
+							 const int* points,
+							 const int numPoints) const
+{ // retrievePropsStateVars
+  PYLITH_METHOD_BEGIN;
+
+  assert(propsStateVars);
+  assert(!numPoints || points);
+
+  const int propsStateVarsSize = _propsFiberDim + _varsFiberDim;
+  if (propsStateVars->size() != size_t(numPoints*propsStateVarsSize)) {
+    propsStateVars->resize(numPoints*propsStateVarsSize);
+  } // if
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const int point = points[iPoint];
+    assert(point >= _vStart && size_t((point-_vStart+1)*propsStateVarsSize) <= _propsStateVars.size());
+    const PylithScalar* src = &_propsStateVars[(point-_vStart)*propsStateVarsSize];
+    PylithScalar* dest = &(*propsStateVars)[iPoint*propsStateVarsSize];
+    for (int i=0; i < propsStateVarsSize; ++i) {
+      dest[i] = src[i];
     } // for
   } // for
-  assert(_propsStateVarsVertex.size() == size_t(iOff));
 
   PYLITH_METHOD_END;
 } // retrievePropsStateVars
@@ -365,6 +382,36 @@ pylith::friction::FrictionModel::calcFriction(const PylithScalar t,
   PYLITH_METHOD_RETURN(friction);
 } // calcFriction
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of vertices.
+void
+pylith::friction::FrictionModel::calcFriction(PylithScalar* friction,
+					      const PylithScalar t,
+					      const PylithScalar* slip,
+					      const PylithScalar* slipRate,
+					      const PylithScalar* normalTraction,
+					      const int* vertices,
+					      const int numVertices)
+{ // calcFriction
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  if (0 == numVertices)
+    PYLITH_METHOD_END;
+
+  assert(friction);
+  assert(slip);
+  assert(slipRate);
+  assert(normalTraction);
+
+  retrievePropsStateVars(&_propsStateVarsBatch, vertices, numVertices);
+  _calcFrictionBatch(friction, t, slip, slipRate, normalTraction,
+		     &_propsStateVarsBatch[0], _propsFiberDim, _varsFiberDim,
+		     numVertices);
+
+  PYLITH_METHOD_END;
+} // calcFriction
+
 // ----------------------------------------------------------------------
 // Compute derivative of friction with slip at vertex.
 PylithScalar
@@ -389,6 +436,36 @@ pylith::friction::FrictionModel::calcFrictionDeriv(const PylithScalar t,
   PYLITH_METHOD_RETURN(frictionDeriv);
 } // calcFrictionDeriv
 
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of vertices.
+void
+pylith::friction::FrictionModel::calcFrictionDeriv(PylithScalar* frictionDeriv,
+						   const PylithScalar t,
+						   const PylithScalar* slip,
+						   const PylithScalar* slipRate,
+						   const PylithScalar* normalTraction,
+						   const int* vertices,
+						   const int numVertices)
+{ // calcFrictionDeriv
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  if (0 == numVertices)
+    PYLITH_METHOD_END;
+
+  assert(frictionDeriv);
+  assert(slip);
+  assert(slipRate);
+  assert(normalTraction);
+
+  retrievePropsStateVars(&_propsStateVarsBatch, vertices, numVertices);
+  _calcFrictionDerivBatch(frictionDeriv, t, slip, slipRate, normalTraction,
+			  &_propsStateVarsBatch[0], _propsFiberDim, _varsFiberDim,
+			  numVertices);
+
+  PYLITH_METHOD_END;
+} // calcFrictionDeriv
+
 // ----------------------------------------------------------------------
 // Update state variables (for next time step).
 void
@@ -411,33 +488,60 @@ pylith::friction::FrictionModel::updateStateVars(const PylithScalar t,
 		   &stateVarsVertex[0], _varsFiberDim,
 		   &propertiesVertex[0], _propsFiberDim);
 
-  PetscInt iOff = 0;
-
-  for (int i=0; i < _metadata.numProperties(); ++i) {
-    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-    topology::VecVisitorMesh propertyVisitor(propertyField);
-    PetscScalar* propertyArray = propertyVisitor.localArray();
-    const PetscInt off = propertyVisitor.sectionOffset(vertex);
-    const PetscInt dof = propertyVisitor.sectionDof(vertex);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      propertyArray[off+d] = _propsStateVarsVertex[iOff];
-    } // for
+  // Properties do not change, so only copy state variables to storage.
+  const int propsStateVarsSize = _propsFiberDim + _varsFiberDim;
+  assert(vertex >= _vStart && size_t((vertex-_vStart+1)*propsStateVarsSize) <= _propsStateVars.size());
+  PylithScalar* stateVars = &_propsStateVars[(vertex-_vStart)*propsStateVarsSize+_propsFiberDim];
+  for (int i=0; i < _varsFiberDim; ++i) {
+    stateVars[i] = stateVarsVertex[i];
   } // for
-  for (int i=0; i < _metadata.numStateVars(); ++i) {
-    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-    topology::VecVisitorMesh stateVarVisitor(stateVarField);
-    PetscScalar* stateVarArray = stateVarVisitor.localArray();
-    const PetscInt off = stateVarVisitor.sectionOffset(vertex);
-    const PetscInt dof = stateVarVisitor.sectionDof(vertex);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      stateVarArray[off+d] = _propsStateVarsVertex[iOff];
+
+  const bool includeProperties = false;
+  _scatterPropsStateVars(&vertex, 1, includeProperties);
+
+  PYLITH_METHOD_END;
+} // updateStateVars
+
+// ----------------------------------------------------------------------
+// Update state variables (for next time step) for a batch of vertices.
+void
+pylith::friction::FrictionModel::updateStateVars(const PylithScalar t,
+						 const PylithScalar* slip,
+						 const PylithScalar* slipRate,
+						 const PylithScalar* normalTraction,
+						 const int* vertices,
+						 const int numVertices)
+{ // updateStateVars
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+  if (0 == _varsFiberDim || 0 == numVertices)
+    PYLITH_METHOD_END;
+
+  assert(slip);
+  assert(slipRate);
+  assert(normalTraction);
+  assert(vertices);
+
+  retrievePropsStateVars(&_propsStateVarsBatch, vertices, numVertices);
+  _updateStateVarsBatch(t, slip, slipRate, normalTraction,
+			&_propsStateVarsBatch[0], _propsFiberDim, _varsFiberDim,
+			numVertices);
+
+  // Properties do not change, so only copy state variables to storage.
+  const int propsStateVarsSize = _propsFiberDim + _varsFiberDim;
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    const int vertex = vertices[iVertex];
+    assert(vertex >= _vStart && size_t((vertex-_vStart+1)*propsStateVarsSize) <= _propsStateVars.size());
+    const PylithScalar* src = &_propsStateVarsBatch[iVertex*propsStateVarsSize+_propsFiberDim];
+    PylithScalar* dest = &_propsStateVars[(vertex-_vStart)*propsStateVarsSize+_propsFiberDim];
+    for (int i=0; i < _varsFiberDim; ++i) {
+      dest[i] = src[i];
     } // for
   } // for
-  assert(_propsStateVarsVertex.size() == size_t(iOff));
+
+  const bool includeProperties = false;
+  _scatterPropsStateVars(vertices, numVertices, includeProperties);
 
   PYLITH_METHOD_END;
 } // updateStateVars
@@ -457,6 +561,79 @@ pylith::friction::FrictionModel::_updateStateVars(
 { // _updateStateVars
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of locations.
+void
+pylith::friction::FrictionModel::_calcFrictionBatch(PylithScalar* friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const PylithScalar* propsStateVars,
+						    const int numProperties,
+						    const int numStateVars,
+						    const int numLocs)
+{ // _calcFrictionBatch
+  assert(friction);
+  assert(!numLocs || propsStateVars);
+
+  const int propsStateVarsSize = numProperties + numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+    const PylithScalar* stateVars = (numStateVars > 0) ? &properties[numProperties] : 0;
+    friction[iLoc] = _calcFriction(t, slip[iLoc], slipRate[iLoc], normalTraction[iLoc],
+				   properties, numProperties, stateVars, numStateVars);
+  } // for
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of locations.
+void
+pylith::friction::FrictionModel::_calcFrictionDerivBatch(PylithScalar* frictionDeriv,
+							 const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 const PylithScalar* propsStateVars,
+							 const int numProperties,
+							 const int numStateVars,
+							 const int numLocs)
+{ // _calcFrictionDerivBatch
+  assert(frictionDeriv);
+  assert(!numLocs || propsStateVars);
+
+  const int propsStateVarsSize = numProperties + numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+    const PylithScalar* stateVars = (numStateVars > 0) ? &properties[numProperties] : 0;
+    frictionDeriv[iLoc] = _calcFrictionDeriv(t, slip[iLoc], slipRate[iLoc], normalTraction[iLoc],
+					     properties, numProperties, stateVars, numStateVars);
+  } // for
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables (for next time step) for a batch of locations.
+void
+pylith::friction::FrictionModel::_updateStateVarsBatch(const PylithScalar t,
+						       const PylithScalar* slip,
+						       const PylithScalar* slipRate,
+						       const PylithScalar* normalTraction,
+						       PylithScalar* const propsStateVars,
+						       const int numProperties,
+						       const int numStateVars,
+						       const int numLocs)
+{ // _updateStateVarsBatch
+  assert(!numLocs || propsStateVars);
+
+  const int propsStateVarsSize = numProperties + numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+    _updateStateVars(t, slip[iLoc], slipRate[iLoc], normalTraction[iLoc],
+		     &properties[numProperties], numStateVars,
+		     properties, numProperties);
+  } // for
+} // _updateStateVarsBatch
+
 // ----------------------------------------------------------------------
 // Setup fields for physical properties and state variables.
 void
@@ -492,6 +669,7 @@ pylith::friction::FrictionModel::_setupPropsStateVars(void)
 
   // Setup fields
   assert(_fieldsPropsStateVars);
+  _propsStateVarsFields.clear();
 
   for (int i=0, iScale=0; i < numProperties; ++i) {
     const materials::Metadata::ParamDescription& property = 
@@ -503,6 +681,7 @@ pylith::friction::FrictionModel::_setupPropsStateVars(void)
     propertyField.vectorFieldType(property.fieldType);
     propertyField.scale(propertiesVertex[iScale]);
     propertyField.zeroAll();
+    _propsStateVarsFields.push_back(&propertyField);
     iScale += property.fiberDim;
   } // for
   
@@ -516,6 +695,7 @@ pylith::friction::FrictionModel::_setupPropsStateVars(void)
     stateVarField.vectorFieldType(stateVar.fieldType);
     stateVarField.scale(stateVarsVertex[iScale]);
     stateVarField.zeroAll();
+    _propsStateVarsFields.push_back(&stateVarField);
     iScale += stateVar.fiberDim;
   } // for
   assert(_varsFiberDim >= 0);
@@ -523,5 +703,45 @@ pylith::friction::FrictionModel::_setupPropsStateVars(void)
   PYLITH_METHOD_END;
 } // _setupPropsStateVars
 
+// ----------------------------------------------------------------------
+// Copy properties and state variables from storage to fields.
+void
+pylith::friction::FrictionModel::_scatterPropsStateVars(const int* points,
+							 const int numPoints,
+							 const bool includeProperties)
+{ // _scatterPropsStateVars
+  PYLITH_METHOD_BEGIN;
+
+  const int numProperties = _metadata.numProperties();
+  const int numStateVars = _metadata.numStateVars();
+  assert(_propsStateVarsFields.size() == size_t(numProperties+numStateVars));
+
+  const int propsStateVarsSize = _propsFiberDim + _varsFiberDim;
+  const int numVertices = (propsStateVarsSize > 0) ? _propsStateVars.size() / propsStateVarsSize : 0;
+  const int numPointsScatter = (points) ? numPoints : numVertices;
+
+  const int iStart = (includeProperties) ? 0 : numProperties;
+  int iOff = (includeProperties) ? 0 : _propsFiberDim;
+  for (int i=iStart; i < numProperties+numStateVars; ++i) {
+    const int fiberDim = (i < numProperties) ? _metadata.getProperty(i).fiberDim : _metadata.getStateVar(i-numProperties).fiberDim;
+
+    assert(_propsStateVarsFields[i]);
+    topology::VecVisitorMesh fieldVisitor(*_propsStateVarsFields[i]);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (int iPoint=0; iPoint < numPointsScatter; ++iPoint) {
+      const PetscInt point = (points) ? points[iPoint] : _vStart + iPoint;
+      const PetscInt off = fieldVisitor.sectionOffset(point);
+      assert(fiberDim == fieldVisitor.sectionDof(point));
+      const PylithScalar* values = &_propsStateVars[(point-_vStart)*propsStateVarsSize+iOff];
+      for (int d=0; d < fiberDim; ++d) {
+	fieldArray[off+d] = values[d];
+      } // for
+    } // for
+    iOff += fiberDim;
+  } // for
+
+  PYLITH_METHOD_END;
+} // _scatterPropsStateVars
+
 
 // End of file 
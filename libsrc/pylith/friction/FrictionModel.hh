@@ -30,11 +30,13 @@
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // forward declarations
+#include "spatialdata/geocoords/geocoordsfwd.hh" // forward declarations
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
 
 #include "pylith/materials/Metadata.hh" // HASA Metadata
 
 #include <string> // HASA std::string
+#include <vector> // HASA std::vector
 
 // FrictionModel --------------------------------------------------------
 /** @brief C++ abstract base class for FrictionModel object.
@@ -102,6 +104,31 @@ public :
    */
   void dbInitialState(spatialdata::spatialdb::SpatialDB* value);
 
+  /** Set prefix for files caching values queried from the databases
+   * for physical properties and initial state variables.
+   *
+   * An empty prefix disables the cache.
+   *
+   * @param value Prefix for names of cache files.
+   */
+  void dbQueryCache(const char* value);
+
+  /** Set fingerprint of contents of database for physical properties.
+   *
+   * Queries are cached only for databases with a fingerprint.
+   *
+   * @param value Fingerprint of database (empty if unknown).
+   */
+  void dbPropertiesFingerprint(const char* value);
+
+  /** Set fingerprint of contents of database for initial state variables.
+   *
+   * Queries are cached only for databases with a fingerprint.
+   *
+   * @param value Fingerprint of database (empty if unknown).
+   */
+  void dbInitialStateFingerprint(const char* value);
+
   /** Set scales used to nondimensionalize physical properties.
    *
    * @param dim Nondimensionalizer
@@ -157,6 +184,20 @@ public :
    */
   void retrievePropsStateVars(const int point);
 
+  /** Retrieve properties and state variables for a batch of points.
+   *
+   * Values are interleaved with the properties followed by the state
+   * variables for each point.
+   *
+   * @param propsStateVars Array of properties and state variables
+   *   [numPoints][numProperties+numStateVars].
+   * @param points Array of finite-element points.
+   * @param numPoints Number of points.
+   */
+  void retrievePropsStateVars(scalar_array* propsStateVars,
+			      const int* points,
+			      const int numPoints) const;
+
   /** Compute friction at vertex.
    *
    * @pre Must call retrievePropsAndVars for cell before calling
@@ -174,6 +215,29 @@ public :
 			    const PylithScalar slipRate,
 			    const PylithScalar normalTraction);
   
+  /** Compute friction for a batch of vertices.
+   *
+   * Properties and state variables are taken from the model's
+   * storage, so retrievePropsStateVars() does not need to be called
+   * first.
+   *
+   * @param friction Array for friction (magnitude of shear traction)
+   *   at vertices [numVertices].
+   * @param t Time in simulation.
+   * @param slip Current slip at vertices [numVertices].
+   * @param slipRate Current slip rate at vertices [numVertices].
+   * @param normalTraction Normal traction at vertices [numVertices].
+   * @param vertices Finite-element vertices on friction interface [numVertices].
+   * @param numVertices Number of vertices.
+   */
+  void calcFriction(PylithScalar* friction,
+		    const PylithScalar t,
+		    const PylithScalar* slip,
+		    const PylithScalar* slipRate,
+		    const PylithScalar* normalTraction,
+		    const int* vertices,
+		    const int numVertices);
+
   /** Compute derivative of friction with slip at vertex.
    *
    * @pre Must call retrievePropsAndVars for cell before calling
@@ -191,6 +255,29 @@ public :
 				 const PylithScalar slipRate,
 				 const PylithScalar normalTraction);
   
+  /** Compute derivative of friction with slip for a batch of vertices.
+   *
+   * Properties and state variables are taken from the model's
+   * storage, so retrievePropsStateVars() does not need to be called
+   * first.
+   *
+   * @param frictionDeriv Array for derivative of friction at vertices
+   *   [numVertices].
+   * @param t Time in simulation.
+   * @param slip Current slip at vertices [numVertices].
+   * @param slipRate Current slip rate at vertices [numVertices].
+   * @param normalTraction Normal traction at vertices [numVertices].
+   * @param vertices Finite-element vertices on friction interface [numVertices].
+   * @param numVertices Number of vertices.
+   */
+  void calcFrictionDeriv(PylithScalar* frictionDeriv,
+			 const PylithScalar t,
+			 const PylithScalar* slip,
+			 const PylithScalar* slipRate,
+			 const PylithScalar* normalTraction,
+			 const int* vertices,
+			 const int numVertices);
+  
   /** Compute update to state variables at vertex.
    *
    * @pre Must call retrievePropsAndVars for cell before calling
@@ -207,6 +294,26 @@ public :
 		       const PylithScalar slipRate,
 		       const PylithScalar normalTraction,
 		       const int vertex);
+
+  /** Compute update to state variables for a batch of vertices.
+   *
+   * Properties and state variables are taken from the model's
+   * storage, so retrievePropsStateVars() does not need to be called
+   * first.
+   *
+   * @param t Time in simulation.
+   * @param slip Current slip at vertices [numVertices].
+   * @param slipRate Current slip rate at vertices [numVertices].
+   * @param normalTraction Normal traction at vertices [numVertices].
+   * @param vertices Finite-element vertices on friction interface [numVertices].
+   * @param numVertices Number of vertices.
+   */
+  void updateStateVars(const PylithScalar t,
+		       const PylithScalar* slip,
+		       const PylithScalar* slipRate,
+		       const PylithScalar* normalTraction,
+		       const int* vertices,
+		       const int numVertices);
   
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
@@ -335,12 +442,105 @@ protected :
 			const PylithScalar* properties,
 			const int numProperties);
 
+  /** Compute friction for a batch of locations from properties and
+   * state variables.
+   *
+   * Default implementation calls _calcFriction() at each location.
+   *
+   * @param friction Array for friction (magnitude of shear traction)
+   *   at locations [numLocs].
+   * @param t Time in simulation.
+   * @param slip Current slip at locations [numLocs].
+   * @param slipRate Current slip rate at locations [numLocs].
+   * @param normalTraction Normal traction at locations [numLocs].
+   * @param propsStateVars Properties followed by state variables at
+   *   locations [numLocs][numProperties+numStateVars].
+   * @param numProperties Number of properties.
+   * @param numStateVars Number of state variables.
+   * @param numLocs Number of locations.
+   */
+  virtual
+  void _calcFrictionBatch(PylithScalar* friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const PylithScalar* propsStateVars,
+			  const int numProperties,
+			  const int numStateVars,
+			  const int numLocs);
+
+  /** Compute derivative of friction with slip for a batch of
+   * locations from properties and state variables.
+   *
+   * Default implementation calls _calcFrictionDeriv() at each location.
+   *
+   * @param frictionDeriv Array for derivative of friction at
+   *   locations [numLocs].
+   * @param t Time in simulation.
+   * @param slip Current slip at locations [numLocs].
+   * @param slipRate Current slip rate at locations [numLocs].
+   * @param normalTraction Normal traction at locations [numLocs].
+   * @param propsStateVars Properties followed by state variables at
+   *   locations [numLocs][numProperties+numStateVars].
+   * @param numProperties Number of properties.
+   * @param numStateVars Number of state variables.
+   * @param numLocs Number of locations.
+   */
+  virtual
+  void _calcFrictionDerivBatch(PylithScalar* frictionDeriv,
+			       const PylithScalar t,
+			       const PylithScalar* slip,
+			       const PylithScalar* slipRate,
+			       const PylithScalar* normalTraction,
+			       const PylithScalar* propsStateVars,
+			       const int numProperties,
+			       const int numStateVars,
+			       const int numLocs);
+
+  /** Update state variables (for next time step) for a batch of
+   * locations.
+   *
+   * Default implementation calls _updateStateVars() at each location.
+   *
+   * @param t Time in simulation.
+   * @param slip Current slip at locations [numLocs].
+   * @param slipRate Current slip rate at locations [numLocs].
+   * @param normalTraction Normal traction at locations [numLocs].
+   * @param propsStateVars Properties followed by state variables at
+   *   locations [numLocs][numProperties+numStateVars]. State
+   *   variables are updated in place.
+   * @param numProperties Number of properties.
+   * @param numStateVars Number of state variables.
+   * @param numLocs Number of locations.
+   */
+  virtual
+  void _updateStateVarsBatch(const PylithScalar t,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* normalTraction,
+			     PylithScalar* const propsStateVars,
+			     const int numProperties,
+			     const int numStateVars,
+			     const int numLocs);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
   /// Setup fields for physical properties and state variables.
   void _setupPropsStateVars(void);
 
+  /** Copy properties and state variables from the interleaved storage
+   * to the fields.
+   *
+   * @param points Array of points to copy (NULL for all vertices).
+   * @param numPoints Number of points.
+   * @param includeProperties True to copy properties as well as state variables.
+   */
+  void _scatterPropsStateVars(const int* points,
+			      const int numPoints,
+			      const bool includeProperties);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -362,13 +562,31 @@ private :
   /// Database of initial state variables for the friction model.
   spatialdata::spatialdb::SpatialDB* _dbInitialState;
 
+  std::string _dbQueryCache; ///< Prefix for files caching database queries.
+  std::string _dbPropertiesFingerprint; ///< Fingerprint of database for properties.
+  std::string _dbInitialStateFingerprint; ///< Fingerprint of database for initial state.
+
   /// Field containing physical properties and state variables of
   /// friction model.
   topology::Fields* _fieldsPropsStateVars;
 
+  /// Properties and state variables fields in order of metadata
+  /// (properties followed by state variables).
+  std::vector<topology::Field*> _propsStateVarsFields;
+
+  /// Properties and state variables interleaved by vertex
+  /// [numVertices][numProperties+numStateVars].
+  scalar_array _propsStateVars;
+
   /// Buffer for properties and state variables at vertex.
   scalar_array _propsStateVarsVertex;
 
+  /// Buffer for properties and state variables of a batch of vertices
+  /// [numVertices][numProperties+numStateVars].
+  scalar_array _propsStateVarsBatch;
+
+  int _vStart; ///< First vertex in fault mesh.
+
   int _propsFiberDim; ///< Number of properties per point.
   int _varsFiberDim; ///< Number of state variables per point.
 
@@ -432,5 +432,140 @@ pylith::friction::RateStateAgeing::_updateStateVars(const PylithScalar t,
 
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of locations from properties and
+// state variables.
+void
+pylith::friction::RateStateAgeing::_calcFrictionBatch(PylithScalar* friction,
+						      const PylithScalar t,
+						      const PylithScalar* slip,
+						      const PylithScalar* slipRate,
+						      const PylithScalar* normalTraction,
+						      const PylithScalar* propsStateVars,
+						      const int numProperties,
+						      const int numStateVars,
+						      const int numLocs)
+{ // _calcFrictionBatch
+  assert(friction);
+  assert(!numLocs || propsStateVars);
+  assert(_RateStateAgeing::numProperties == numProperties);
+  assert(_RateStateAgeing::numStateVars == numStateVars);
+
+  // Same operations as _calcFriction() with the branches written as
+  // selects so the compiler can vectorize the loop over locations
+  // (including the logarithms when a vector math library is
+  // available).
+  const PylithScalar slipRateLinear = _linearSlipRate;
+  const int propsStateVarsSize = _RateStateAgeing::numProperties + _RateStateAgeing::numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+    const PylithScalar* stateVars = &properties[_RateStateAgeing::numProperties];
+
+    const PylithScalar f0 = properties[p_coef];
+    const PylithScalar a = properties[p_a];
+    const PylithScalar b = properties[p_b];
+    const PylithScalar L = properties[p_L];
+    const PylithScalar slipRate0 = properties[p_slipRate0];
+
+    // Prevent zero value for theta, reasonable value is L / slipRate0
+    const PylithScalar theta = (stateVars[s_state] > 0.0) ? stateVars[s_state] : L / slipRate0;
+
+    // Below the linear slip rate, the log term uses the linear slip
+    // rate plus a linear correction. Both branches are evaluated in
+    // every lane, so lanes that discard a term use a harmless
+    // denominator or log argument instead (the linear slip rate may
+    // be zero, and slip rate is often zero for faults in tension).
+    const bool isCompression = normalTraction[iLoc] <= 0.0;
+    const bool isLinear = slipRate[iLoc] < slipRateLinear;
+    const PylithScalar slipRateLinearDenom = (isLinear) ? slipRateLinear : 1.0;
+    const PylithScalar slipRateLog = (!isCompression) ? slipRate0 : (isLinear) ? slipRateLinear : slipRate[iLoc];
+    const PylithScalar linearTerm = (isLinear) ? a*(1.0 - slipRate[iLoc]/slipRateLinearDenom) : 0.0;
+    const PylithScalar mu_f = f0 + a*log(slipRateLog / slipRate0) + b*log(slipRate0*theta/L) - linearTerm;
+
+    friction[iLoc] = (isCompression) ?
+      -mu_f * normalTraction[iLoc] + properties[p_cohesion] :
+      properties[p_cohesion];
+  } // for
+
+  PetscLogFlops(numLocs*12);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of locations
+// from properties and state variables.
+void
+pylith::friction::RateStateAgeing::_calcFrictionDerivBatch(PylithScalar* frictionDeriv,
+							   const PylithScalar t,
+							   const PylithScalar* slip,
+							   const PylithScalar* slipRate,
+							   const PylithScalar* normalTraction,
+							   const PylithScalar* propsStateVars,
+							   const int numProperties,
+							   const int numStateVars,
+							   const int numLocs)
+{ // _calcFrictionDerivBatch
+  assert(frictionDeriv);
+  assert(!numLocs || propsStateVars);
+  assert(_RateStateAgeing::numProperties == numProperties);
+  assert(_RateStateAgeing::numStateVars == numStateVars);
+
+  const PylithScalar slipRateLinear = _linearSlipRate;
+  const PylithScalar dt = _dt;
+  const int propsStateVarsSize = _RateStateAgeing::numProperties + _RateStateAgeing::numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+
+    const PylithScalar a = properties[p_a];
+    const PylithScalar slipRateDeriv = (slipRate[iLoc] >= slipRateLinear) ? slipRate[iLoc] : slipRateLinear;
+    frictionDeriv[iLoc] = (normalTraction[iLoc] <= 0.0) ?
+      -normalTraction[iLoc] * a / (slipRateDeriv * dt) :
+      0.0;
+  } // for
+
+  PetscLogFlops(numLocs*12);
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables (for next time step) for a batch of
+// locations.
+void
+pylith::friction::RateStateAgeing::_updateStateVarsBatch(const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 PylithScalar* const propsStateVars,
+							 const int numProperties,
+							 const int numStateVars,
+							 const int numLocs)
+{ // _updateStateVarsBatch
+  assert(!numLocs || propsStateVars);
+  assert(_RateStateAgeing::numProperties == numProperties);
+  assert(_RateStateAgeing::numStateVars == numStateVars);
+
+  // See _updateStateVars() for the integration of the state variable
+  // and the Taylor series expansion near zero slip rate.
+  const PylithScalar dt = _dt;
+  const int propsStateVarsSize = _RateStateAgeing::numProperties + _RateStateAgeing::numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+    PylithScalar* stateVars = &propsStateVars[iLoc*propsStateVarsSize+_RateStateAgeing::numProperties];
+
+    const PylithScalar thetaTVertex = stateVars[s_state];
+    const PylithScalar L = properties[p_L];
+    const PylithScalar vDtL = slipRate[iLoc] * dt / L;
+    const PylithScalar expTerm = exp(-vDtL);
+
+    // Both branches are evaluated in every lane, so guard the slip
+    // rate denominator in lanes that use the Taylor series expansion.
+    const bool isExact = vDtL > 1.0e-20;
+    const PylithScalar slipRateDenom = (isExact) ? slipRate[iLoc] : 1.0;
+    stateVars[s_state] = (isExact) ?
+      thetaTVertex * expTerm + L / slipRateDenom * (1 - expTerm) :
+      thetaTVertex * expTerm + dt - 0.5 * slipRate[iLoc]/L * dt*dt;
+  } // for
+
+  PetscLogFlops(numLocs*9);
+} // _updateStateVarsBatch
+
 
 // End of file 
@@ -371,5 +371,109 @@ pylith::friction::SlipWeakening::_updateStateVars(const PylithScalar t,
   PetscLogFlops(3);
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of locations from properties and
+// state variables.
+void
+pylith::friction::SlipWeakening::_calcFrictionBatch(PylithScalar* friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const PylithScalar* propsStateVars,
+						    const int numProperties,
+						    const int numStateVars,
+						    const int numLocs)
+{ // _calcFrictionBatch
+  assert(friction);
+  assert(!numLocs || propsStateVars);
+  assert(_SlipWeakening::numProperties == numProperties);
+  assert(_SlipWeakening::numStateVars == numStateVars);
+
+  // Same operations as _calcFriction() with the branches written as
+  // selects so the compiler can vectorize the loop over locations.
+  const int propsStateVarsSize = _SlipWeakening::numProperties + _SlipWeakening::numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+    const PylithScalar* stateVars = &properties[_SlipWeakening::numProperties];
+
+    const PylithScalar slipCum = stateVars[s_slipCum] + fabs(slip[iLoc] - stateVars[s_slipPrev]);
+    const PylithScalar mu_f = (slipCum < properties[p_d0]) ?
+      properties[p_coefS] - (properties[p_coefS] - properties[p_coefD]) * slipCum / properties[p_d0] :
+      properties[p_coefD];
+    friction[iLoc] = (normalTraction[iLoc] <= 0.0) ?
+      -mu_f * normalTraction[iLoc] + properties[p_cohesion] :
+      properties[p_cohesion];
+  } // for
+
+  PetscLogFlops(numLocs*10);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of locations
+// from properties and state variables.
+void
+pylith::friction::SlipWeakening::_calcFrictionDerivBatch(PylithScalar* frictionDeriv,
+							 const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 const PylithScalar* propsStateVars,
+							 const int numProperties,
+							 const int numStateVars,
+							 const int numLocs)
+{ // _calcFrictionDerivBatch
+  assert(frictionDeriv);
+  assert(!numLocs || propsStateVars);
+  assert(_SlipWeakening::numProperties == numProperties);
+  assert(_SlipWeakening::numStateVars == numStateVars);
+
+  const int propsStateVarsSize = _SlipWeakening::numProperties + _SlipWeakening::numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+    const PylithScalar* stateVars = &properties[_SlipWeakening::numProperties];
+
+    const PylithScalar slipCum = stateVars[s_slipCum] + fabs(slip[iLoc] - stateVars[s_slipPrev]);
+    frictionDeriv[iLoc] = (normalTraction[iLoc] <= 0.0 && slipCum < properties[p_d0]) ?
+      normalTraction[iLoc] * (properties[p_coefS] - properties[p_coefD]) / properties[p_d0] :
+      0.0;
+  } // for
+
+  PetscLogFlops(numLocs*6);
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables (for next time step) for a batch of
+// locations.
+void
+pylith::friction::SlipWeakening::_updateStateVarsBatch(const PylithScalar t,
+						       const PylithScalar* slip,
+						       const PylithScalar* slipRate,
+						       const PylithScalar* normalTraction,
+						       PylithScalar* const propsStateVars,
+						       const int numProperties,
+						       const int numStateVars,
+						       const int numLocs)
+{ // _updateStateVarsBatch
+  assert(!numLocs || propsStateVars);
+  assert(_SlipWeakening::numProperties == numProperties);
+  assert(_SlipWeakening::numStateVars == numStateVars);
+
+  const PylithScalar tolerance = 1.0e-12;
+  const bool forceHealing = _forceHealing;
+  const int propsStateVarsSize = _SlipWeakening::numProperties + _SlipWeakening::numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    PylithScalar* stateVars = &propsStateVars[iLoc*propsStateVarsSize+_SlipWeakening::numProperties];
+
+    // Reset state variables if sliding has stopped.
+    const bool sliding = slipRate[iLoc] > tolerance && !forceHealing;
+    const PylithScalar slipPrev = stateVars[s_slipPrev];
+    stateVars[s_slipCum] = (sliding) ? stateVars[s_slipCum] + fabs(slip[iLoc] - slipPrev) : 0.0;
+    stateVars[s_slipPrev] = slip[iLoc];
+  } // for
+
+  PetscLogFlops(numLocs*3);
+} // _updateStateVarsBatch
+
 
 // End of file 
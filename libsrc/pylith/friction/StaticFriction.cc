@@ -182,5 +182,56 @@ pylith::friction::StaticFriction::_calcFrictionDeriv(const PylithScalar t,
   return 0.0;
 } // _calcFrictionDeriv
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of locations from properties and
+// state variables.
+void
+pylith::friction::StaticFriction::_calcFrictionBatch(PylithScalar* friction,
+						     const PylithScalar t,
+						     const PylithScalar* slip,
+						     const PylithScalar* slipRate,
+						     const PylithScalar* normalTraction,
+						     const PylithScalar* propsStateVars,
+						     const int numProperties,
+						     const int numStateVars,
+						     const int numLocs)
+{ // _calcFrictionBatch
+  assert(friction);
+  assert(!numLocs || propsStateVars);
+  assert(_StaticFriction::numProperties == numProperties);
+  assert(0 == numStateVars);
+
+  const int propsStateVarsSize = _StaticFriction::numProperties;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+    friction[iLoc] = (normalTraction[iLoc] <= 0.0) ?
+      properties[p_cohesion] - properties[p_coef] * normalTraction[iLoc] :
+      properties[p_cohesion];
+  } // for
+
+  PetscLogFlops(numLocs*2);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of locations
+// from properties and state variables.
+void
+pylith::friction::StaticFriction::_calcFrictionDerivBatch(PylithScalar* frictionDeriv,
+							  const PylithScalar t,
+							  const PylithScalar* slip,
+							  const PylithScalar* slipRate,
+							  const PylithScalar* normalTraction,
+							  const PylithScalar* propsStateVars,
+							  const int numProperties,
+							  const int numStateVars,
+							  const int numLocs)
+{ // _calcFrictionDerivBatch
+  assert(frictionDeriv);
+
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    frictionDeriv[iLoc] = 0.0;
+  } // for
+} // _calcFrictionDerivBatch
+
 
 // End of file 
@@ -328,5 +328,89 @@ pylith::friction::TimeWeakening::_updateStateVars(const PylithScalar t,
 
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction for a batch of locations from properties and
+// state variables.
+void
+pylith::friction::TimeWeakening::_calcFrictionBatch(PylithScalar* friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const PylithScalar* propsStateVars,
+						    const int numProperties,
+						    const int numStateVars,
+						    const int numLocs)
+{ // _calcFrictionBatch
+  assert(friction);
+  assert(!numLocs || propsStateVars);
+  assert(_TimeWeakening::numProperties == numProperties);
+  assert(_TimeWeakening::numStateVars == numStateVars);
+
+  // Same operations as _calcFriction() with the branches written as
+  // selects so the compiler can vectorize the loop over locations.
+  const int propsStateVarsSize = _TimeWeakening::numProperties + _TimeWeakening::numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar* properties = &propsStateVars[iLoc*propsStateVarsSize];
+    const PylithScalar* stateVars = &properties[_TimeWeakening::numProperties];
+
+    const PylithScalar mu_f = (stateVars[s_time] < properties[p_Tc]) ?
+      properties[p_coefS] - (properties[p_coefS] - properties[p_coefD]) * stateVars[s_time] / properties[p_Tc] :
+      properties[p_coefD];
+    friction[iLoc] = (normalTraction[iLoc] <= 0.0) ?
+      - mu_f * normalTraction[iLoc] + properties[p_cohesion] :
+      properties[p_cohesion];
+  } // for
+
+  PetscLogFlops(numLocs*6);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip for a batch of locations
+// from properties and state variables.
+void
+pylith::friction::TimeWeakening::_calcFrictionDerivBatch(PylithScalar* frictionDeriv,
+							 const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 const PylithScalar* propsStateVars,
+							 const int numProperties,
+							 const int numStateVars,
+							 const int numLocs)
+{ // _calcFrictionDerivBatch
+  assert(frictionDeriv);
+
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    frictionDeriv[iLoc] = 0.0;
+  } // for
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables (for next time step) for a batch of
+// locations.
+void
+pylith::friction::TimeWeakening::_updateStateVarsBatch(const PylithScalar t,
+						       const PylithScalar* slip,
+						       const PylithScalar* slipRate,
+						       const PylithScalar* normalTraction,
+						       PylithScalar* const propsStateVars,
+						       const int numProperties,
+						       const int numStateVars,
+						       const int numLocs)
+{ // _updateStateVarsBatch
+  assert(!numLocs || propsStateVars);
+  assert(_TimeWeakening::numProperties == numProperties);
+  assert(_TimeWeakening::numStateVars == numStateVars);
+
+  const PylithScalar tolerance = 1.0e-12;
+  const PylithScalar dt = _dt;
+  const int propsStateVarsSize = _TimeWeakening::numProperties + _TimeWeakening::numStateVars;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    PylithScalar* stateVars = &propsStateVars[iLoc*propsStateVarsSize+_TimeWeakening::numProperties];
+    stateVars[s_time] = (slipRate[iLoc] > tolerance) ? stateVars[s_time] + dt : 0.0;
+  } // for
+} // _updateStateVarsBatch
+
 
 // End of file 
@@ -167,6 +167,77 @@ protected :
 			const PylithScalar* properties,
 			const int numProperties);
 
+  /** Compute friction for a batch of locations from properties and
+   * state variables.
+   *
+   * @param friction Array for friction at locations [numLocs].
+   * @param t Time in simulation.
+   * @param slip Current slip at locations [numLocs].
+   * @param slipRate Current slip rate at locations [numLocs].
+   * @param normalTraction Normal traction at locations [numLocs].
+   * @param propsStateVars Properties followed by state variables at
+   *   locations [numLocs][numProperties+numStateVars].
+   * @param numProperties Number of properties.
+   * @param numStateVars Number of state variables.
+   * @param numLocs Number of locations.
+   */
+  void _calcFrictionBatch(PylithScalar* friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const PylithScalar* propsStateVars,
+			  const int numProperties,
+			  const int numStateVars,
+			  const int numLocs);
+
+  /** Compute derivative of friction with slip for a batch of
+   * locations from properties and state variables.
+   *
+   * @param frictionDeriv Array for derivative of friction at
+   *   locations [numLocs].
+   * @param t Time in simulation.
+   * @param slip Current slip at locations [numLocs].
+   * @param slipRate Current slip rate at locations [numLocs].
+   * @param normalTraction Normal traction at locations [numLocs].
+   * @param propsStateVars Properties followed by state variables at
+   *   locations [numLocs][numProperties+numStateVars].
+   * @param numProperties Number of properties.
+   * @param numStateVars Number of state variables.
+   * @param numLocs Number of locations.
+   */
+  void _calcFrictionDerivBatch(PylithScalar* frictionDeriv,
+			       const PylithScalar t,
+			       const PylithScalar* slip,
+			       const PylithScalar* slipRate,
+			       const PylithScalar* normalTraction,
+			       const PylithScalar* propsStateVars,
+			       const int numProperties,
+			       const int numStateVars,
+			       const int numLocs);
+
+  /** Update state variables (for next time step) for a batch of
+   * locations.
+   *
+   * @param t Time in simulation.
+   * @param slip Current slip at locations [numLocs].
+   * @param slipRate Current slip rate at locations [numLocs].
+   * @param normalTraction Normal traction at locations [numLocs].
+   * @param propsStateVars Properties followed by state variables at
+   *   locations [numLocs][numProperties+numStateVars].
+   * @param numProperties Number of properties.
+   * @param numStateVars Number of state variables.
+   * @param numLocs Number of locations.
+   */
+  void _updateStateVarsBatch(const PylithScalar t,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* normalTraction,
+			     PylithScalar* const propsStateVars,
+			     const int numProperties,
+			     const int numStateVars,
+			     const int numLocs);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
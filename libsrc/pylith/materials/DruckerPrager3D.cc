@@ -27,7 +27,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cmath> // USES fabs()
 #include <cassert> // USES assert()
@@ -156,6 +156,8 @@ pylith::materials::DruckerPrager3D::DruckerPrager3D(void) :
   _calcElasticConstsFn(0),
   _calcStressFn(0),
   _updateStateVarsFn(0),
+  _calcElasticConstsBatchFn(0),
+  _calcStressBatchFn(0),
   _fitMohrCoulomb(MOHR_COULOMB_INSCRIBED),
   _allowTensileYield(false)
 { // constructor
@@ -189,6 +191,8 @@ pylith::materials::DruckerPrager3D::fitMohrCoulomb(FitMohrCoulombEnum value)
 void
 pylith::materials::DruckerPrager3D::useElasticBehavior(const bool flag)
 { // useElasticBehavior
+  ElasticMaterial::useElasticBehavior(flag);
+
   if (flag) {
     _calcStressFn = 
       &pylith::materials::DruckerPrager3D::_calcStressElastic;
@@ -196,6 +200,10 @@ pylith::materials::DruckerPrager3D::useElasticBehavior(const bool flag)
       &pylith::materials::DruckerPrager3D::_calcElasticConstsElastic;
     _updateStateVarsFn = 
       &pylith::materials::DruckerPrager3D::_updateStateVarsElastic;
+    _calcStressBatchFn = 
+      &pylith::materials::DruckerPrager3D::_calcStressBatchElastic;
+    _calcElasticConstsBatchFn = 
+      &pylith::materials::DruckerPrager3D::_calcElasticConstsBatchElastic;
 
   } else {
     _calcStressFn = 
@@ -204,9 +212,22 @@ pylith::materials::DruckerPrager3D::useElasticBehavior(const bool flag)
       &pylith::materials::DruckerPrager3D::_calcElasticConstsElastoplastic;
     _updateStateVarsFn = 
       &pylith::materials::DruckerPrager3D::_updateStateVarsElastoplastic;
+    _calcStressBatchFn = 
+      &pylith::materials::DruckerPrager3D::_calcStressBatchElastoplastic;
+    _calcElasticConstsBatchFn = 
+      &pylith::materials::DruckerPrager3D::_calcElasticConstsBatchElastoplastic;
   } // if/else
 } // useElasticBehavior
 
+// ----------------------------------------------------------------------
+// Get flag indicating whether material implements batched
+// constitutive kernels.
+bool
+pylith::materials::DruckerPrager3D::hasBatchKernels(void) const
+{ // hasBatchKernels
+  return true;
+} // hasBatchKernels
+
 // ----------------------------------------------------------------------
 // Compute properties from values in spatial database.
 void
@@ -300,7 +321,7 @@ pylith::materials::DruckerPrager3D::_dbToProperties(
   propValues[p_beta] = beta;
   propValues[p_alphaFlow] = alphaFlow;
 
-  PetscLogFlops(28);
+  pylith::utils::EventLogger::logFlops(28);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -326,7 +347,7 @@ pylith::materials::DruckerPrager3D::_nondimProperties(PylithScalar* const values
     _normalizer->nondimensionalize(values[p_beta],
 				   pressureScale);
 
-  PetscLogFlops(4);
+  pylith::utils::EventLogger::logFlops(4);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -351,7 +372,7 @@ pylith::materials::DruckerPrager3D::_dimProperties(PylithScalar* const values,
   values[p_beta] = 
     _normalizer->dimensionalize(values[p_beta], pressureScale);
 
-  PetscLogFlops(4);
+  pylith::utils::EventLogger::logFlops(4);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -508,7 +529,7 @@ pylith::materials::DruckerPrager3D::_calcStressElastic(
   stress[4] = mu2 * e23 + initialStress[4];
   stress[5] = mu2 * e13 + initialStress[5];
 
-  PetscLogFlops(25);
+  pylith::utils::EventLogger::logFlops(25);
 } // _calcStressElastic
 
 // ----------------------------------------------------------------------
@@ -551,150 +572,10 @@ pylith::materials::DruckerPrager3D::_calcStressElastoplastic(
   // We need to compute the plastic strain increment if state variables are
   // from previous time step.
   if (computeStateVars) {
-
-    const PylithScalar alphaYield = properties[p_alphaYield];
-    const PylithScalar beta = properties[p_beta];
-    const PylithScalar alphaFlow = properties[p_alphaFlow];
-    const PylithScalar mu2 = 2.0 * mu;
-    const PylithScalar bulkModulus = lambda + mu2/3.0;
-    const PylithScalar ae = 1.0/mu2;
-    const PylithScalar am = 1.0/(3.0 * bulkModulus);
-
-    const PylithScalar plasticStrainT[tensorSize] = {
-      stateVars[s_plasticStrain  ],
-      stateVars[s_plasticStrain+1],
-      stateVars[s_plasticStrain+2],
-      stateVars[s_plasticStrain+3],
-      stateVars[s_plasticStrain+4],
-      stateVars[s_plasticStrain+5],
-    };
-    const PylithScalar meanPlasticStrainT = (plasticStrainT[0] +
-					     plasticStrainT[1] +
-					     plasticStrainT[2])/3.0;
-    PylithScalar devPlasticStrainT[tensorSize];
-    calcDeviatoric3D(devPlasticStrainT, plasticStrainT, meanPlasticStrainT);
-    
-    const PylithScalar diag[tensorSize] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
-    
-    // Initial stress values
-    const PylithScalar meanStressInitial = (initialStress[0] +
-					    initialStress[1] +
-					    initialStress[2])/3.0;
-    PylithScalar devStressInitial[tensorSize];
-    calcDeviatoric3D(devStressInitial, initialStress, meanStressInitial);
-    
-    // Initial strain values
-    const PylithScalar meanStrainInitial = (initialStrain[0] +
-					    initialStrain[1] +
-					    initialStrain[2])/3.0;
-    PylithScalar devStrainInitial[tensorSize];
-    calcDeviatoric3D(devStrainInitial, initialStrain, meanStrainInitial);
-    
-    // Values for current time step
-    const PylithScalar e11 = totalStrain[0];
-    const PylithScalar e22 = totalStrain[1];
-    const PylithScalar e33 = totalStrain[2];
-    const PylithScalar meanStrainTpdt = (e11 + e22 + e33)/3.0;
-    const PylithScalar meanStrainPPTpdt =
-      meanStrainTpdt - meanPlasticStrainT - meanStrainInitial;
-
-    const PylithScalar strainPPTpdt[tensorSize] = {
-      totalStrain[0] - meanStrainTpdt - devPlasticStrainT[0] -
-      devStrainInitial[0],
-      totalStrain[1] - meanStrainTpdt - devPlasticStrainT[1] -
-      devStrainInitial[1],
-      totalStrain[2] - meanStrainTpdt - devPlasticStrainT[2] -
-      devStrainInitial[2],
-      totalStrain[3] - devPlasticStrainT[3] - devStrainInitial[3],
-      totalStrain[4] - devPlasticStrainT[4] - devStrainInitial[4],
-      totalStrain[5] - devPlasticStrainT[5] - devStrainInitial[5],
-    };
-
-    // Compute trial elastic stresses and yield function to see if yield should
-    // occur.
-    const PylithScalar trialDevStress[tensorSize] = { 
-      strainPPTpdt[0]/ae + devStressInitial[0],
-      strainPPTpdt[1]/ae + devStressInitial[1],
-      strainPPTpdt[2]/ae + devStressInitial[2],
-      strainPPTpdt[3]/ae + devStressInitial[3],
-      strainPPTpdt[4]/ae + devStressInitial[4],
-      strainPPTpdt[5]/ae + devStressInitial[5],
-    };
-    const PylithScalar trialMeanStress =
-      meanStrainPPTpdt/am + meanStressInitial;
-    const PylithScalar stressInvar2 =
-      sqrt(0.5 * scalarProduct3D(trialDevStress, trialDevStress));
-    const PylithScalar yieldFunction =
-      3.0 * alphaYield * trialMeanStress + stressInvar2 - beta;
-#if 0 // DEBUGGING
-    std::cout << "Function _calcStressElastoPlastic: elastic" << std::endl;
-    std::cout << "  alphaYield:       " << alphaYield << std::endl;
-    std::cout << "  beta:             " << beta << std::endl;
-    std::cout << "  trialMeanStress:  " << trialMeanStress << std::endl;
-    std::cout << "  stressInvar2:     " << stressInvar2 << std::endl;
-    std::cout << "  yieldFunction:    " << yieldFunction << std::endl;
-#endif
-    PetscLogFlops(76);
-
-    // If yield function is greater than zero, compute elastoplastic stress.
-    if (yieldFunction >= 0.0) {
-      const PylithScalar devStressInitialProd = 
-	scalarProduct3D(devStressInitial, devStressInitial);
-      const PylithScalar strainPPTpdtProd = 
-	scalarProduct3D(strainPPTpdt, strainPPTpdt);
-      const PylithScalar d =
-	sqrt(ae * ae * devStressInitialProd + 2.0 * ae *
-	   scalarProduct3D(devStressInitial, strainPPTpdt) + strainPPTpdtProd);
-      
-      PylithScalar plasticMult = 0.0;
-      if(_allowTensileYield) {
-	plasticMult = 
-	  std::min(sqrt(2.0)*d,
-		   2.0 * ae * am *
-		   (3.0 * alphaYield * (meanStrainPPTpdt/am + meanStressInitial)
-		    + d/(sqrt(2.0) * ae)
-		    - beta)/ (6.0 * alphaYield * alphaFlow * ae + am));
-      } else {
-	plasticMult = 
-	  2.0 * ae * am *
-	  (3.0 * alphaYield * (meanStrainPPTpdt/am + meanStressInitial)
-	   + d/(sqrt(2.0) * ae) - beta)/
-	  (6.0 * alphaYield * alphaFlow * ae + am);
-      } // if/else
-
-      const PylithScalar meanStressTpdt =
-	(meanStrainPPTpdt - plasticMult * alphaFlow)/am + meanStressInitial;
-      PylithScalar deltaDevPlasticStrain = 0.0;
-      PylithScalar devStressTpdt = 0.0;
-      if (d > 0.0 || !_allowTensileYield) {
-	for (int iComp=0; iComp < tensorSize; ++iComp) {
-	  deltaDevPlasticStrain =
-	    plasticMult * (strainPPTpdt[iComp] + ae * devStressInitial[iComp])/
-	    (sqrt(2.0) * d);
-	  devStressTpdt =
-	    (strainPPTpdt[iComp] - deltaDevPlasticStrain)/ae +
-	    devStressInitial[iComp];
-	  stress[iComp] = devStressTpdt + diag[iComp] * meanStressTpdt;
-	} // for
-      } else {
-	for (int iComp=0; iComp < tensorSize; ++iComp) {
-	  devStressTpdt = (strainPPTpdt[iComp])/ae + devStressInitial[iComp];
-	  stress[iComp] = devStressTpdt + diag[iComp] * meanStressTpdt;
-	} // for
-      } // if/else
-
-    PetscLogFlops(62 + 11 * tensorSize);
-
-    } else {
-      // No plastic strain.
-      const PylithScalar meanStressTpdt = meanStrainPPTpdt/am + meanStressInitial;
-      stress[0] = strainPPTpdt[0]/ae + devStressInitial[0] + meanStressTpdt; 
-      stress[1] = strainPPTpdt[1]/ae + devStressInitial[1] + meanStressTpdt; 
-      stress[2] = strainPPTpdt[2]/ae + devStressInitial[2] + meanStressTpdt; 
-      stress[3] = strainPPTpdt[3]/ae + devStressInitial[3]; 
-      stress[4] = strainPPTpdt[4]/ae + devStressInitial[4]; 
-      stress[5] = strainPPTpdt[5]/ae + devStressInitial[5]; 
-    } // if
+    ReturnMapping rm;
+    _returnMapping(&rm, properties, &stateVars[s_plasticStrain],
+		   totalStrain, initialStress, initialStrain);
+    _stressReturnMapping(stress, rm, properties);
 
   } else {
     // If state variables have already been updated, the plastic strain for the
@@ -732,7 +613,7 @@ pylith::materials::DruckerPrager3D::_calcStressElastoplastic(
     stress[4] = mu2 * e23 + initialStress[4];
     stress[5] = mu2 * e13 + initialStress[5];
 
-    PetscLogFlops(31);
+    pylith::utils::EventLogger::logFlops(31);
 
   } // if/else
 #if 0 // DEBUGGING
@@ -836,7 +717,7 @@ pylith::materials::DruckerPrager3D::_calcElasticConstsElastic(
   elasticConsts[34] = 0; // C1323
   elasticConsts[35] = mu2; // C1313
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // _calcElasticConstsElastic
 
 // ----------------------------------------------------------------------
@@ -870,246 +751,10 @@ pylith::materials::DruckerPrager3D::_calcElasticConstsElastoplastic(
   assert(0 != initialStrain);
   assert(_DruckerPrager3D::tensorSize == initialStrainSize);
 
-  // Duplicate functionality of _calcStressElastoplastic
-  // Get properties
-  const int tensorSize = 6;
-  const PylithScalar mu = properties[p_mu];
-  const PylithScalar lambda = properties[p_lambda];
-  const PylithScalar alphaYield = properties[p_alphaYield];
-  const PylithScalar beta = properties[p_beta];
-  const PylithScalar alphaFlow = properties[p_alphaFlow];
-  const PylithScalar mu2 = 2.0 * mu;
-  const PylithScalar bulkModulus = lambda + mu2/3.0;
-  const PylithScalar ae = 1.0/mu2;
-  const PylithScalar am = 1.0/(3.0 * bulkModulus);
-  
-  // Get state variables from previous time step
-  const PylithScalar plasticStrainT[tensorSize] = {
-    stateVars[s_plasticStrain  ],
-    stateVars[s_plasticStrain+1],
-    stateVars[s_plasticStrain+2],
-    stateVars[s_plasticStrain+3],
-    stateVars[s_plasticStrain+4],
-    stateVars[s_plasticStrain+5],
-  };
-  const PylithScalar meanPlasticStrainT = (plasticStrainT[0] +
-					   plasticStrainT[1] +
-					   plasticStrainT[2])/3.0;
-  PylithScalar devPlasticStrainT[tensorSize];
-  calcDeviatoric3D(devPlasticStrainT, plasticStrainT, meanPlasticStrainT);
-  
-  const PylithScalar diag[tensorSize] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
-  
-  // Initial stress values
-  const PylithScalar meanStressInitial = (initialStress[0] +
-					  initialStress[1] +
-					  initialStress[2])/3.0;
-  PylithScalar devStressInitial[tensorSize];
-  calcDeviatoric3D(devStressInitial, initialStress, meanStressInitial);
-  
-  // Initial strain values
-  const PylithScalar meanStrainInitial = (initialStrain[0] +
-					  initialStrain[1] +
-					  initialStrain[2])/3.0;
-  PylithScalar devStrainInitial[tensorSize];
-  calcDeviatoric3D(devStrainInitial, initialStrain, meanStrainInitial);
-
-  // Values for current time step
-  const PylithScalar meanStrainTpdt = (totalStrain[0] +
-				       totalStrain[1] +
-				       totalStrain[2])/3.0;
-  const PylithScalar meanStrainPPTpdt = meanStrainTpdt - meanPlasticStrainT -
-    meanStrainInitial;
-  
-  const PylithScalar strainPPTpdt[tensorSize] = {
-    totalStrain[0] - meanStrainTpdt - devPlasticStrainT[0] -
-    devStrainInitial[0],
-    totalStrain[1] - meanStrainTpdt - devPlasticStrainT[1] -
-    devStrainInitial[1],
-    totalStrain[2] - meanStrainTpdt - devPlasticStrainT[2] -
-    devStrainInitial[2],
-    totalStrain[3] - devPlasticStrainT[3] - devStrainInitial[3],
-    totalStrain[4] - devPlasticStrainT[4] - devStrainInitial[4],
-    totalStrain[5] - devPlasticStrainT[5] - devStrainInitial[5],
-  };
-  
-  // Compute trial elastic stresses and yield function to see if yield should
-  // occur.
-  const PylithScalar trialDevStress[tensorSize] = {
-    strainPPTpdt[0]/ae + devStressInitial[0],
-    strainPPTpdt[1]/ae + devStressInitial[1],
-    strainPPTpdt[2]/ae + devStressInitial[2],
-    strainPPTpdt[3]/ae + devStressInitial[3],
-    strainPPTpdt[4]/ae + devStressInitial[4],
-    strainPPTpdt[5]/ae + devStressInitial[5]
-  };
-  const PylithScalar trialMeanStress = meanStrainPPTpdt/am + meanStressInitial;
-  const PylithScalar stressInvar2 =
-    sqrt(0.5 * scalarProduct3D(trialDevStress, trialDevStress));
-  const PylithScalar yieldFunction = 3.0 * alphaYield * trialMeanStress +
-    stressInvar2 - beta;
-#if 0 // DEBUGGING
-  std::cout << "Function _calcElasticConstsElastoPlastic:" << std::endl;
-  std::cout << "  alphaYield:       " << alphaYield << std::endl;
-  std::cout << "  beta:             " << beta << std::endl;
-  std::cout << "  trialMeanStress:  " << trialMeanStress << std::endl;
-  std::cout << "  stressInvar2:     " << stressInvar2 << std::endl;
-  std::cout << "  yieldFunction:    " << yieldFunction << std::endl;
-#endif
-  PetscLogFlops(76);
-  
-  // If yield function is greater than zero, compute elastoplastic stress and
-  // corresponding tangent matrix.
-  if (yieldFunction >= 0.0) {
-    const PylithScalar devStressInitialProd = 
-      scalarProduct3D(devStressInitial, devStressInitial);
-    const PylithScalar strainPPTpdtProd =
-      scalarProduct3D(strainPPTpdt, strainPPTpdt);
-    const PylithScalar d = 
-      sqrt(ae * ae * devStressInitialProd + 2.0 * ae *
-	   scalarProduct3D(devStressInitial, strainPPTpdt) + strainPPTpdtProd);
-    const PylithScalar plasticFac = 2.0 * ae * am/
-      (6.0 * alphaYield * alphaFlow * ae + am);
-    const PylithScalar meanStrainFac = 3.0 * alphaYield;
-    const PylithScalar dFac = 1.0/(sqrt(2.0) * ae);
-
-    PylithScalar plasticMult = 0.0;
-    bool tensileYield = false;
-    PylithScalar dFac2 = 0.0;
-    if (_allowTensileYield) {
-      const PylithScalar testMult = plasticFac *
-	(meanStrainFac * (meanStrainPPTpdt/am + meanStressInitial) +
-	 dFac * d - beta);
-      tensileYield = (sqrt(2.0)*d < testMult) ? true : false;
-      plasticMult = (tensileYield) ? sqrt(2.0)*d : testMult;
-      dFac2 = (d > 0.0) ? 1.0/(sqrt(2.0) * d) : 0.0;
-    } else {
-      plasticMult = plasticFac *
-	(meanStrainFac * (meanStrainPPTpdt/am + meanStressInitial) +
-	 dFac * d - beta);
-      dFac2 = 1.0/(sqrt(2.0) * d);
-    } // if/else
-
-    // Define some constants, vectors, and matrices.
-    const PylithScalar third = 1.0/3.0;
-    const PylithScalar dEdEpsilon[6][6] = {
-      { 2.0 * third,      -third,      -third, 0.0, 0.0, 0.0},
-      {      -third, 2.0 * third,      -third, 0.0, 0.0, 0.0},
-      {      -third,      -third, 2.0 * third, 0.0, 0.0, 0.0},
-      {         0.0,         0.0,         0.0, 1.0, 0.0, 0.0},
-      {         0.0,         0.0,         0.0, 0.0, 1.0, 0.0},
-      {         0.0,         0.0,         0.0, 0.0, 0.0, 1.0}};
-    const PylithScalar vec1[tensorSize] = {
-      strainPPTpdt[0] + ae * devStressInitial[0],
-      strainPPTpdt[1] + ae * devStressInitial[1],
-      strainPPTpdt[2] + ae * devStressInitial[2],
-      strainPPTpdt[3] + ae * devStressInitial[3],
-      strainPPTpdt[4] + ae * devStressInitial[4],
-      strainPPTpdt[5] + ae * devStressInitial[5]
-    };
-    PylithScalar dDeltaEdEpsilon = 0.0;
-
-    // Compute elasticity matrix.
-    if (d > 0.0) {
-      const PylithScalar dDdEpsilon[tensorSize] = {vec1[0]/d,
-						   vec1[1]/d,
-						   vec1[2]/d,
-						   2.0 * vec1[3]/d,
-						   2.0 * vec1[4]/d,
-						   2.0 * vec1[5]/d};
-      PylithScalar dLambdadEpsilon[tensorSize];
-      if (tensileYield) {
-	dLambdadEpsilon[0] = sqrt(2.0) * dDdEpsilon[0];
-	dLambdadEpsilon[1] = sqrt(2.0) * dDdEpsilon[1];
-	dLambdadEpsilon[2] = sqrt(2.0) * dDdEpsilon[2];
-	dLambdadEpsilon[3] = sqrt(2.0) * dDdEpsilon[3];
-	dLambdadEpsilon[4] = sqrt(2.0) * dDdEpsilon[4];
-	dLambdadEpsilon[5] = sqrt(2.0) * dDdEpsilon[5];
-      } else {
-	dLambdadEpsilon[0] = plasticFac *
-	  (alphaYield/am + dFac * dDdEpsilon[0]);
-	dLambdadEpsilon[1] = plasticFac *
-	  (alphaYield/am + dFac * dDdEpsilon[1]);
-	dLambdadEpsilon[2] = plasticFac *
-	  (alphaYield/am + dFac * dDdEpsilon[2]);
-	dLambdadEpsilon[3] = plasticFac * dFac * dDdEpsilon[3];
-	dLambdadEpsilon[4] = plasticFac * dFac * dDdEpsilon[4];
-	dLambdadEpsilon[5] = plasticFac * dFac * dDdEpsilon[5];
-      } // else
-      for (int iComp=0; iComp < tensorSize; ++iComp) {
-	for (int jComp=0; jComp < tensorSize; ++jComp) {
-	  int iCount = jComp + tensorSize * iComp;
-	  dDeltaEdEpsilon = dFac2 * (vec1[iComp] *
-				     (dLambdadEpsilon[jComp] -
-				      plasticMult * dDdEpsilon[jComp]/d) +
-				     plasticMult * dEdEpsilon[iComp][jComp]);
-	  elasticConsts[iCount] = (dEdEpsilon[iComp][jComp] -
-				   dDeltaEdEpsilon)/ae +
-	    diag[iComp] * (third * diag[jComp] -
-			   alphaFlow * dLambdadEpsilon[jComp])/am;
-	} // for
-      } // for
-    } else {
-      const PylithScalar dLambdadEpsilon[tensorSize] = {0.0,
-							0.0,	
-							0.0,	
-							0.0,
-							0.0,
-							0.0};
-      for (int iComp=0; iComp < tensorSize; ++iComp) {
-	for (int jComp=0; jComp < tensorSize; ++jComp) {
-	  int iCount = jComp + tensorSize * iComp;
-	  elasticConsts[iCount] = (dEdEpsilon[iComp][jComp])/ae +
-	    diag[iComp] * (third * diag[jComp] -
-			   alphaFlow * dLambdadEpsilon[jComp])/am;
-	} // for
-      } // for
-    } // if/else
-
-    PetscLogFlops(109 + tensorSize * tensorSize * 15);
-
-  } else {
-    // No plastic strain.
-    const PylithScalar lambda2mu = lambda + mu2;
-    elasticConsts[ 0] = lambda2mu; // C1111
-    elasticConsts[ 1] = lambda; // C1122
-    elasticConsts[ 2] = lambda; // C1133
-    elasticConsts[ 3] = 0; // C1112
-    elasticConsts[ 4] = 0; // C1123
-    elasticConsts[ 5] = 0; // C1113
-    elasticConsts[ 6] = lambda; // C2211
-    elasticConsts[ 7] = lambda2mu; // C2222
-    elasticConsts[ 8] = lambda; // C2233
-    elasticConsts[ 9] = 0; // C2212
-    elasticConsts[10] = 0; // C2223
-    elasticConsts[11] = 0; // C2213
-    elasticConsts[12] = lambda; // C3311
-    elasticConsts[13] = lambda; // C3322
-    elasticConsts[14] = lambda2mu; // C3333
-    elasticConsts[15] = 0; // C3312
-    elasticConsts[16] = 0; // C3323
-    elasticConsts[17] = 0; // C3313
-    elasticConsts[18] = 0; // C1211
-    elasticConsts[19] = 0; // C1222
-    elasticConsts[20] = 0; // C1233
-    elasticConsts[21] = mu2; // C1212
-    elasticConsts[22] = 0; // C1223
-    elasticConsts[23] = 0; // C1213
-    elasticConsts[24] = 0; // C2311
-    elasticConsts[25] = 0; // C2322
-    elasticConsts[26] = 0; // C2333
-    elasticConsts[27] = 0; // C2312
-    elasticConsts[28] = mu2; // C2323
-    elasticConsts[29] = 0; // C2313
-    elasticConsts[30] = 0; // C1311
-    elasticConsts[31] = 0; // C1322
-    elasticConsts[32] = 0; // C1333
-    elasticConsts[33] = 0; // C1312
-    elasticConsts[34] = 0; // C1323
-    elasticConsts[35] = mu2; // C1313
-
-    PetscLogFlops(1);
-  } // else
+  ReturnMapping rm;
+  _returnMapping(&rm, properties, &stateVars[s_plasticStrain],
+		 totalStrain, initialStress, initialStrain);
+  _elasticConstsReturnMapping(elasticConsts, rm, properties);
 
 } // _calcElasticConstsElastoplastic
 
@@ -1172,8 +817,76 @@ pylith::materials::DruckerPrager3D::_updateStateVarsElastoplastic(
   assert(0 != initialStrain);
   assert(_DruckerPrager3D::tensorSize == initialStrainSize);
 
-  // For now, we are duplicating the functionality of _calcStressElastoplastic,
-  // since otherwise we would have to redo a lot of calculations.
+  const int tensorSize = 6;
+  ReturnMapping rm;
+  _returnMapping(&rm, properties, &stateVars[s_plasticStrain],
+		 totalStrain, initialStress, initialStrain);
+
+  // If yield function is greater than zero, compute plastic strains.
+  // Otherwise, plastic strains remain the same.
+  if (rm.yield) {
+    const PylithScalar alphaFlow = properties[p_alphaFlow];
+    const PylithScalar ae = rm.ae;
+    const PylithScalar d = rm.d;
+
+    if (!_allowTensileYield && rm.plasticMultNormal > sqrt(2.0) * d) {
+      std::ostringstream msg;
+      const PylithScalar stressInvar2Comp = 0.5 *
+	(sqrt(2.0) * d - rm.plasticMultNormal)/ae;
+      msg << "Infeasible stress state. Cannot project back to yield surface.\n"
+	  << "  alphaYield:         " << properties[p_alphaYield] << "\n"
+	  << "  alphaFlow:          " << alphaFlow << "\n"
+	  << "  beta:               " << properties[p_beta] << "\n"
+	  << "  d:                  " << d << "\n"
+	  << "  plasticMultNormal:  " << rm.plasticMultNormal << "\n"
+	  << "  plasticMultTensile: " << sqrt(2.0) * d << "\n"
+	  << "  yieldFunction:      " << rm.yieldFunction << "\n"
+	  << "  stressInvar2Comp:   " << stressInvar2Comp << "\n";
+      throw std::runtime_error(msg.str());
+    } // if
+
+    const PylithScalar diag[tensorSize] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
+    const PylithScalar deltaMeanPlasticStrain = rm.plasticMult * alphaFlow;
+    if (d > 0.0 || !_allowTensileYield) {
+      const PylithScalar devFac = rm.plasticMult/(sqrt(2.0) * d);
+      for (int iComp=0; iComp < tensorSize; ++iComp) {
+	const PylithScalar deltaDevPlasticStrain = devFac *
+	  (rm.strainPPTpdt[iComp] + ae * rm.devStressInitial[iComp]);
+	stateVars[s_plasticStrain+iComp] += deltaDevPlasticStrain +
+	  diag[iComp] * deltaMeanPlasticStrain;
+      } // for
+    } else {
+      for (int iComp=0; iComp < tensorSize; ++iComp) {
+	stateVars[s_plasticStrain+iComp] +=
+	  diag[iComp] * deltaMeanPlasticStrain;
+      } // for
+    } // if/else
+
+    pylith::utils::EventLogger::logFlops(8 + 6 * tensorSize);
+
+  } // if
+
+  _needNewJacobian = true;
+
+} // _updateStateVarsElastoplastic
+
+// ----------------------------------------------------------------------
+// Compute trial stress, yield function, and plastic multiplier at a
+// point.
+void
+pylith::materials::DruckerPrager3D::_returnMapping(ReturnMapping* const rm,
+						   const PylithScalar* properties,
+						   const PylithScalar* plasticStrainT,
+						   const PylithScalar* totalStrain,
+						   const PylithScalar* initialStress,
+						   const PylithScalar* initialStrain) const
+{ // _returnMapping
+  assert(rm);
+  assert(properties);
+  assert(plasticStrainT);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
 
   const int tensorSize = 6;
   const PylithScalar mu = properties[p_mu];
@@ -1185,15 +898,9 @@ pylith::materials::DruckerPrager3D::_updateStateVarsElastoplastic(
   const PylithScalar bulkModulus = lambda + mu2/3.0;
   const PylithScalar ae = 1.0/mu2;
   const PylithScalar am = 1.0/(3.0 * bulkModulus);
+  rm->ae = ae;
+  rm->am = am;
 
-  const PylithScalar plasticStrainT[tensorSize] = {
-    stateVars[s_plasticStrain],
-    stateVars[s_plasticStrain + 1],
-    stateVars[s_plasticStrain + 2],
-    stateVars[s_plasticStrain + 3],
-    stateVars[s_plasticStrain + 4],
-    stateVars[s_plasticStrain + 5]
-  };
   const PylithScalar meanPlasticStrainT = (plasticStrainT[0] +
 					   plasticStrainT[1] +
 					   plasticStrainT[2])/3.0;
@@ -1206,8 +913,9 @@ pylith::materials::DruckerPrager3D::_updateStateVarsElastoplastic(
   const PylithScalar meanStressInitial = (initialStress[0] +
 					  initialStress[1] +
 					  initialStress[2])/3.0;
-  PylithScalar devStressInitial[tensorSize];
+  PylithScalar* devStressInitial = rm->devStressInitial;
   calcDeviatoric3D(devStressInitial, initialStress, meanStressInitial);
+  rm->meanStressInitial = meanStressInitial;
 
   // Initial strain values
   const PylithScalar meanStrainInitial = (initialStrain[0] +
@@ -1217,115 +925,536 @@ pylith::materials::DruckerPrager3D::_updateStateVarsElastoplastic(
   calcDeviatoric3D(devStrainInitial, initialStrain, meanStrainInitial);
 
   // Values for current time step
-  const PylithScalar e11 = totalStrain[0];
-  const PylithScalar e22 = totalStrain[1];
-  const PylithScalar e33 = totalStrain[2];
-  const PylithScalar meanStrainTpdt = (e11 + e22 + e33)/3.0;
+  const PylithScalar meanStrainTpdt = (totalStrain[0] +
+				       totalStrain[1] +
+				       totalStrain[2])/3.0;
   const PylithScalar meanStrainPPTpdt = meanStrainTpdt - meanPlasticStrainT -
     meanStrainInitial;
+  rm->meanStrainPPTpdt = meanStrainPPTpdt;
 
-  const PylithScalar strainPPTpdt[tensorSize] = {
-    totalStrain[0] - meanStrainTpdt - devPlasticStrainT[0] -
-    devStrainInitial[0],
-    totalStrain[1] - meanStrainTpdt - devPlasticStrainT[1] -
-    devStrainInitial[1],
-    totalStrain[2] - meanStrainTpdt - devPlasticStrainT[2] -
-    devStrainInitial[2],
-    totalStrain[3] - devPlasticStrainT[3] - devStrainInitial[3],
-    totalStrain[4] - devPlasticStrainT[4] - devStrainInitial[4],
-    totalStrain[5] - devPlasticStrainT[5] - devStrainInitial[5]
-  };
+  PylithScalar* strainPPTpdt = rm->strainPPTpdt;
+  for (int iComp=0; iComp < tensorSize; ++iComp) {
+    strainPPTpdt[iComp] = totalStrain[iComp] - diag[iComp] * meanStrainTpdt -
+      devPlasticStrainT[iComp] - devStrainInitial[iComp];
+  } // for
 
   // Compute trial elastic stresses and yield function to see if yield should
   // occur.
-  const PylithScalar trialDevStress[tensorSize] = {
-    strainPPTpdt[0]/ae + devStressInitial[0],
-    strainPPTpdt[1]/ae + devStressInitial[1],
-    strainPPTpdt[2]/ae + devStressInitial[2],
-    strainPPTpdt[3]/ae + devStressInitial[3],
-    strainPPTpdt[4]/ae + devStressInitial[4],
-    strainPPTpdt[5]/ae + devStressInitial[5]
-  };
+  PylithScalar trialDevStress[tensorSize];
+  for (int iComp=0; iComp < tensorSize; ++iComp) {
+    trialDevStress[iComp] = strainPPTpdt[iComp]/ae + devStressInitial[iComp];
+  } // for
   const PylithScalar trialMeanStress = meanStrainPPTpdt/am + meanStressInitial;
   const PylithScalar stressInvar2 =
     sqrt(0.5 * scalarProduct3D(trialDevStress, trialDevStress));
-  const PylithScalar yieldFunction =
-    3.0 * alphaYield * trialMeanStress + stressInvar2 - beta;
-
+  rm->yieldFunction = 3.0 * alphaYield * trialMeanStress + stressInvar2 - beta;
+  rm->yield = rm->yieldFunction >= 0.0;
 #if 0 // DEBUGGING
-  std::cout << "Function _updateStateVarsElastoPlastic:" << std::endl;
+  std::cout << "Function _returnMapping:" << std::endl;
   std::cout << "  alphaYield:       " << alphaYield << std::endl;
   std::cout << "  beta:             " << beta << std::endl;
   std::cout << "  trialMeanStress:  " << trialMeanStress << std::endl;
   std::cout << "  stressInvar2:     " << stressInvar2 << std::endl;
-  std::cout << "  yieldFunction:    " << yieldFunction << std::endl;
+  std::cout << "  yieldFunction:    " << rm->yieldFunction << std::endl;
 #endif
-  PetscLogFlops(76);
+  pylith::utils::EventLogger::logFlops(76);
 
-  // If yield function is greater than zero, compute plastic strains.
-  // Otherwise, plastic strains remain the same.
-  if (yieldFunction >= 0.0) {
-    const PylithScalar devStressInitialProd = 
-      scalarProduct3D(devStressInitial, devStressInitial);
-    const PylithScalar strainPPTpdtProd =
-      scalarProduct3D(strainPPTpdt, strainPPTpdt);
+  rm->d = 0.0;
+  rm->plasticMultNormal = 0.0;
+  rm->plasticMult = 0.0;
+  rm->tensileYield = false;
+  if (rm->yield) {
     const PylithScalar d =
-      sqrt(ae * ae * devStressInitialProd + 2.0 * ae *
-	   scalarProduct3D(devStressInitial, strainPPTpdt) + strainPPTpdtProd);
+      sqrt(ae * ae * scalarProduct3D(devStressInitial, devStressInitial) +
+	   2.0 * ae * scalarProduct3D(devStressInitial, strainPPTpdt) +
+	   scalarProduct3D(strainPPTpdt, strainPPTpdt));
     const PylithScalar plasticFac = 2.0 * ae * am/
       (6.0 * alphaYield * alphaFlow * ae + am);
-    const PylithScalar meanStrainFac = 3.0 * alphaYield;
     const PylithScalar dFac = 1.0/(sqrt(2.0) * ae);
-
-    PylithScalar plasticMult = 0.0;
     const PylithScalar plasticMultNormal = plasticFac *
-	(meanStrainFac * (meanStrainPPTpdt/am + meanStressInitial) +
-	 dFac * d - beta);
+      (3.0 * alphaYield * trialMeanStress + dFac * d - beta);
     const PylithScalar plasticMultTensile = sqrt(2.0) * d;
-    
-    if (_allowTensileYield) {
-      plasticMult = std::min(plasticMultNormal, plasticMultTensile);
-    } else if (plasticMultNormal <= plasticMultTensile) {
-      plasticMult = plasticMultNormal;
-    } else {
-      std::ostringstream msg;
-      const PylithScalar stressInvar2Comp = 0.5 *
-	(sqrt(2.0) * d - plasticMultNormal)/ae;
-      msg << "Infeasible stress state. Cannot project back to yield surface.\n"
-	  << "  alphaYield:         " << alphaYield << "\n"
-	  << "  alphaFlow:          " << alphaFlow << "\n"
-	  << "  beta:               " << beta << "\n"
-	  << "  d:                  " << d << "\n"
-	  << "  plasticMultNormal:  " << plasticMultNormal << "\n"
-	  << "  plasticMultTensile: " << plasticMultTensile << "\n"
-	  << "  yieldFunction:      " << yieldFunction << "\n"
-	  << "  stressInvar2Comp:   " << stressInvar2Comp << "\n";
-      throw std::runtime_error(msg.str());
-    } // if/else
 
-    const PylithScalar deltaMeanPlasticStrain = plasticMult * alphaFlow;
-    PylithScalar deltaDevPlasticStrain = 0.0;
-    if (d > 0.0 || !_allowTensileYield) {
-      for (int iComp=0; iComp < tensorSize; ++iComp) {
-	deltaDevPlasticStrain = plasticMult *(strainPPTpdt[iComp] +
-					      ae * devStressInitial[iComp])/
-	  (sqrt(2.0) * d);
-	stateVars[s_plasticStrain+iComp] += deltaDevPlasticStrain +
-	  diag[iComp] * deltaMeanPlasticStrain;
+    rm->d = d;
+    rm->plasticMultNormal = plasticMultNormal;
+    rm->tensileYield = _allowTensileYield &&
+      plasticMultTensile < plasticMultNormal;
+    rm->plasticMult = (rm->tensileYield) ? plasticMultTensile : plasticMultNormal;
+
+    pylith::utils::EventLogger::logFlops(52);
+  } // if
+} // _returnMapping
+
+// ----------------------------------------------------------------------
+// Compute stress tensor at a point from result of return mapping.
+void
+pylith::materials::DruckerPrager3D::_stressReturnMapping(PylithScalar* const stress,
+							 const ReturnMapping& rm,
+							 const PylithScalar* properties) const
+{ // _stressReturnMapping
+  assert(stress);
+  assert(properties);
+
+  const int tensorSize = 6;
+  const PylithScalar alphaFlow = properties[p_alphaFlow];
+  const PylithScalar ae = rm.ae;
+  const PylithScalar am = rm.am;
+  const PylithScalar* strainPPTpdt = rm.strainPPTpdt;
+  const PylithScalar* devStressInitial = rm.devStressInitial;
+
+  const PylithScalar diag[tensorSize] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
+
+  // Plastic multiplier is zero if there is no yield.
+  const PylithScalar meanStressTpdt =
+    (rm.meanStrainPPTpdt - rm.plasticMult * alphaFlow)/am + rm.meanStressInitial;
+  if (rm.yield && (rm.d > 0.0 || !_allowTensileYield)) {
+    const PylithScalar devFac = rm.plasticMult/(sqrt(2.0) * rm.d);
+    for (int iComp=0; iComp < tensorSize; ++iComp) {
+      const PylithScalar deltaDevPlasticStrain =
+	devFac * (strainPPTpdt[iComp] + ae * devStressInitial[iComp]);
+      const PylithScalar devStressTpdt =
+	(strainPPTpdt[iComp] - deltaDevPlasticStrain)/ae + devStressInitial[iComp];
+      stress[iComp] = devStressTpdt + diag[iComp] * meanStressTpdt;
+    } // for
+    pylith::utils::EventLogger::logFlops(9 + 7 * tensorSize);
+  } else {
+    for (int iComp=0; iComp < tensorSize; ++iComp) {
+      const PylithScalar devStressTpdt = strainPPTpdt[iComp]/ae + devStressInitial[iComp];
+      stress[iComp] = devStressTpdt + diag[iComp] * meanStressTpdt;
+    } // for
+    pylith::utils::EventLogger::logFlops(5 + 4 * tensorSize);
+  } // if/else
+} // _stressReturnMapping
+
+// ----------------------------------------------------------------------
+// Compute consistent tangent at a point from result of return mapping.
+void
+pylith::materials::DruckerPrager3D::_elasticConstsReturnMapping(PylithScalar* const elasticConsts,
+								const ReturnMapping& rm,
+								const PylithScalar* properties) const
+{ // _elasticConstsReturnMapping
+  assert(elasticConsts);
+  assert(properties);
+
+  const int tensorSize = 6;
+
+  if (!rm.yield) {
+    // No plastic strain.
+    const PylithScalar mu2 = 2.0 * properties[p_mu];
+    const PylithScalar lambda = properties[p_lambda];
+    const PylithScalar lambda2mu = lambda + mu2;
+    elasticConsts[ 0] = lambda2mu; // C1111
+    elasticConsts[ 1] = lambda; // C1122
+    elasticConsts[ 2] = lambda; // C1133
+    elasticConsts[ 3] = 0; // C1112
+    elasticConsts[ 4] = 0; // C1123
+    elasticConsts[ 5] = 0; // C1113
+    elasticConsts[ 6] = lambda; // C2211
+    elasticConsts[ 7] = lambda2mu; // C2222
+    elasticConsts[ 8] = lambda; // C2233
+    elasticConsts[ 9] = 0; // C2212
+    elasticConsts[10] = 0; // C2223
+    elasticConsts[11] = 0; // C2213
+    elasticConsts[12] = lambda; // C3311
+    elasticConsts[13] = lambda; // C3322
+    elasticConsts[14] = lambda2mu; // C3333
+    elasticConsts[15] = 0; // C3312
+    elasticConsts[16] = 0; // C3323
+    elasticConsts[17] = 0; // C3313
+    elasticConsts[18] = 0; // C1211
+    elasticConsts[19] = 0; // C1222
+    elasticConsts[20] = 0; // C1233
+    elasticConsts[21] = mu2; // C1212
+    elasticConsts[22] = 0; // C1223
+    elasticConsts[23] = 0; // C1213
+    elasticConsts[24] = 0; // C2311
+    elasticConsts[25] = 0; // C2322
+    elasticConsts[26] = 0; // C2333
+    elasticConsts[27] = 0; // C2312
+    elasticConsts[28] = mu2; // C2323
+    elasticConsts[29] = 0; // C2313
+    elasticConsts[30] = 0; // C1311
+    elasticConsts[31] = 0; // C1322
+    elasticConsts[32] = 0; // C1333
+    elasticConsts[33] = 0; // C1312
+    elasticConsts[34] = 0; // C1323
+    elasticConsts[35] = mu2; // C1313
+
+    pylith::utils::EventLogger::logFlops(2);
+    return;
+  } // if
+
+  const PylithScalar alphaYield = properties[p_alphaYield];
+  const PylithScalar alphaFlow = properties[p_alphaFlow];
+  const PylithScalar ae = rm.ae;
+  const PylithScalar am = rm.am;
+  const PylithScalar d = rm.d;
+  const PylithScalar plasticMult = rm.plasticMult;
+  const PylithScalar plasticFac = 2.0 * ae * am/
+    (6.0 * alphaYield * alphaFlow * ae + am);
+  const PylithScalar dFac = 1.0/(sqrt(2.0) * ae);
+
+  // Define some constants, vectors, and matrices.
+  const PylithScalar third = 1.0/3.0;
+  const PylithScalar diag[tensorSize] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
+  const PylithScalar dEdEpsilon[6][6] = {
+    { 2.0 * third,      -third,      -third, 0.0, 0.0, 0.0},
+    {      -third, 2.0 * third,      -third, 0.0, 0.0, 0.0},
+    {      -third,      -third, 2.0 * third, 0.0, 0.0, 0.0},
+    {         0.0,         0.0,         0.0, 1.0, 0.0, 0.0},
+    {         0.0,         0.0,         0.0, 0.0, 1.0, 0.0},
+    {         0.0,         0.0,         0.0, 0.0, 0.0, 1.0}};
+
+  // Compute elasticity matrix.
+  if (d > 0.0) {
+    const PylithScalar dFac2 = 1.0/(sqrt(2.0) * d);
+    PylithScalar vec1[tensorSize];
+    PylithScalar dDdEpsilon[tensorSize];
+    PylithScalar dLambdadEpsilon[tensorSize];
+    for (int iComp=0; iComp < tensorSize; ++iComp) {
+      vec1[iComp] = rm.strainPPTpdt[iComp] + ae * rm.devStressInitial[iComp];
+      dDdEpsilon[iComp] = (2.0 - diag[iComp]) * vec1[iComp]/d;
+      dLambdadEpsilon[iComp] = (rm.tensileYield) ?
+	sqrt(2.0) * dDdEpsilon[iComp] :
+	plasticFac * (diag[iComp] * alphaYield/am + dFac * dDdEpsilon[iComp]);
+    } // for
+    for (int iComp=0; iComp < tensorSize; ++iComp) {
+      for (int jComp=0; jComp < tensorSize; ++jComp) {
+	const int iCount = jComp + tensorSize * iComp;
+	const PylithScalar dDeltaEdEpsilon =
+	  dFac2 * (vec1[iComp] * (dLambdadEpsilon[jComp] -
+				  plasticMult * dDdEpsilon[jComp]/d) +
+		   plasticMult * dEdEpsilon[iComp][jComp]);
+	elasticConsts[iCount] = (dEdEpsilon[iComp][jComp] - dDeltaEdEpsilon)/ae +
+	  diag[iComp] * (third * diag[jComp] -
+			 alphaFlow * dLambdadEpsilon[jComp])/am;
       } // for
-    } else {
-      for (int iComp=0; iComp < tensorSize; ++iComp) {
-	stateVars[s_plasticStrain+iComp] +=
-	  diag[iComp] * deltaMeanPlasticStrain;
+    } // for
+  } else {
+    for (int iComp=0; iComp < tensorSize; ++iComp) {
+      for (int jComp=0; jComp < tensorSize; ++jComp) {
+	const int iCount = jComp + tensorSize * iComp;
+	elasticConsts[iCount] = dEdEpsilon[iComp][jComp]/ae +
+	  diag[iComp] * third * diag[jComp]/am;
       } // for
-    } // if/else
+    } // for
+  } // if/else
 
-    PetscLogFlops(60 + 9 * tensorSize);
+  pylith::utils::EventLogger::logFlops(33 + tensorSize * tensorSize * 15);
+} // _elasticConstsReturnMapping
 
+// ----------------------------------------------------------------------
+// Compute trial elastic stress and yield function for batch of points.
+void
+pylith::materials::DruckerPrager3D::_calcTrialStressBatch(PylithScalar* const stress,
+							  PylithScalar* const yieldFunction,
+							  const PylithScalar* properties,
+							  const PylithScalar* stateVars,
+							  const PylithScalar* totalStrain,
+							  const PylithScalar* initialStress,
+							  const PylithScalar* initialStrain,
+							  const int numPoints) const
+{ // _calcTrialStressBatch
+  assert(stress);
+  assert(properties);
+  assert(stateVars);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
+
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+  const PylithScalar* plasticStrain = &stateVars[s_plasticStrain*n];
+
+  // Components are contiguous over points and there are no branches,
+  // so the loops vectorize.
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0 * mu[i];
+
+    const PylithScalar e11 = totalStrain[0*n+i] - plasticStrain[0*n+i] - initialStrain[0*n+i];
+    const PylithScalar e22 = totalStrain[1*n+i] - plasticStrain[1*n+i] - initialStrain[1*n+i];
+    const PylithScalar e33 = totalStrain[2*n+i] - plasticStrain[2*n+i] - initialStrain[2*n+i];
+    const PylithScalar e12 = totalStrain[3*n+i] - plasticStrain[3*n+i] - initialStrain[3*n+i];
+    const PylithScalar e23 = totalStrain[4*n+i] - plasticStrain[4*n+i] - initialStrain[4*n+i];
+    const PylithScalar e13 = totalStrain[5*n+i] - plasticStrain[5*n+i] - initialStrain[5*n+i];
+
+    const PylithScalar s123 = lambda[i] * (e11 + e22 + e33);
+
+    stress[0*n+i] = s123 + mu2*e11 + initialStress[0*n+i];
+    stress[1*n+i] = s123 + mu2*e22 + initialStress[1*n+i];
+    stress[2*n+i] = s123 + mu2*e33 + initialStress[2*n+i];
+    stress[3*n+i] = mu2 * e12 + initialStress[3*n+i];
+    stress[4*n+i] = mu2 * e23 + initialStress[4*n+i];
+    stress[5*n+i] = mu2 * e13 + initialStress[5*n+i];
+  } // for
+  pylith::utils::EventLogger::logFlops(31*n);
+
+  if (yieldFunction) {
+    const PylithScalar* alphaYield = &properties[p_alphaYield*n];
+    const PylithScalar* beta = &properties[p_beta*n];
+    for (int i=0; i < n; ++i) {
+      const PylithScalar meanStress = (stress[0*n+i] + stress[1*n+i] + stress[2*n+i])/3.0;
+      const PylithScalar s11 = stress[0*n+i] - meanStress;
+      const PylithScalar s22 = stress[1*n+i] - meanStress;
+      const PylithScalar s33 = stress[2*n+i] - meanStress;
+      const PylithScalar s12 = stress[3*n+i];
+      const PylithScalar s23 = stress[4*n+i];
+      const PylithScalar s13 = stress[5*n+i];
+      const PylithScalar stressInvar2 =
+	sqrt(0.5 * (s11*s11 + s22*s22 + s33*s33 + 2.0*(s12*s12 + s23*s23 + s13*s13)));
+      yieldFunction[i] = 3.0 * alphaYield[i] * meanStress + stressInvar2 - beta[i];
+    } // for
+    pylith::utils::EventLogger::logFlops(25*n);
   } // if
+} // _calcTrialStressBatch
 
-  _needNewJacobian = true;
+// ----------------------------------------------------------------------
+// Compute stress tensors for batch of points from properties as an
+// elastic material.
+void
+pylith::materials::DruckerPrager3D::_calcStressBatchElastic(PylithScalar* const stress,
+							    const PylithScalar* properties,
+							    const PylithScalar* stateVars,
+							    const PylithScalar* totalStrain,
+							    const PylithScalar* initialStress,
+							    const PylithScalar* initialStrain,
+							    const int numPoints,
+							    const bool computeStateVars)
+{ // _calcStressBatchElastic
+  assert(stress);
+  assert(properties);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
 
-} // _updateStateVarsElastoplastic
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+
+  // Components are contiguous over points, so the loop vectorizes.
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0*mu[i];
+
+    const PylithScalar e11 = totalStrain[0*n+i] - initialStrain[0*n+i];
+    const PylithScalar e22 = totalStrain[1*n+i] - initialStrain[1*n+i];
+    const PylithScalar e33 = totalStrain[2*n+i] - initialStrain[2*n+i];
+    const PylithScalar e12 = totalStrain[3*n+i] - initialStrain[3*n+i];
+    const PylithScalar e23 = totalStrain[4*n+i] - initialStrain[4*n+i];
+    const PylithScalar e13 = totalStrain[5*n+i] - initialStrain[5*n+i];
+
+    const PylithScalar s123 = lambda[i] * (e11 + e22 + e33);
+
+    stress[0*n+i] = s123 + mu2*e11 + initialStress[0*n+i];
+    stress[1*n+i] = s123 + mu2*e22 + initialStress[1*n+i];
+    stress[2*n+i] = s123 + mu2*e33 + initialStress[2*n+i];
+    stress[3*n+i] = mu2 * e12 + initialStress[3*n+i];
+    stress[4*n+i] = mu2 * e23 + initialStress[4*n+i];
+    stress[5*n+i] = mu2 * e13 + initialStress[5*n+i];
+  } // for
+
+  pylith::utils::EventLogger::logFlops(25*n);
+} // _calcStressBatchElastic
+
+// ----------------------------------------------------------------------
+// Compute stress tensors for batch of points from properties and
+// state variables as an elastoplastic material.
+void
+pylith::materials::DruckerPrager3D::_calcStressBatchElastoplastic(PylithScalar* const stress,
+								  const PylithScalar* properties,
+								  const PylithScalar* stateVars,
+								  const PylithScalar* totalStrain,
+								  const PylithScalar* initialStress,
+								  const PylithScalar* initialStrain,
+								  const int numPoints,
+								  const bool computeStateVars)
+{ // _calcStressBatchElastoplastic
+  assert(stress);
+  assert(properties);
+  assert(stateVars);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
+
+  const int numProperties = _DruckerPrager3D::numProperties;
+  const int tensorSize = _DruckerPrager3D::tensorSize;
+  const int n = numPoints;
+
+  // If state variables have already been updated, the plastic strain
+  // for the time step has already been computed and the stress is the
+  // elastic stress for the elastic strain.
+  if (!computeStateVars) {
+    _calcTrialStressBatch(stress, 0, properties, stateVars,
+			  totalStrain, initialStress, initialStrain, n);
+    return;
+  } // if
+
+  // Trial stress and yield function for all points, then the return
+  // mapping for only those points on or outside the yield surface.
+  scalar_array yieldFunction(n);
+  _calcTrialStressBatch(stress, &yieldFunction[0], properties, stateVars,
+			totalStrain, initialStress, initialStrain, n);
+
+  PylithScalar propertiesPt[numProperties];
+  PylithScalar plasticStrainPt[tensorSize];
+  PylithScalar strainPt[tensorSize];
+  PylithScalar initialStressPt[tensorSize];
+  PylithScalar initialStrainPt[tensorSize];
+  PylithScalar stressPt[tensorSize];
+  ReturnMapping rm;
+  for (int i=0; i < n; ++i) {
+    if (yieldFunction[i] < 0.0) {
+      continue;
+    } // if
+
+    for (int iProp=0; iProp < numProperties; ++iProp) {
+      propertiesPt[iProp] = properties[iProp*n+i];
+    } // for
+    for (int iComp=0; iComp < tensorSize; ++iComp) {
+      plasticStrainPt[iComp] = stateVars[(s_plasticStrain+iComp)*n+i];
+      strainPt[iComp] = totalStrain[iComp*n+i];
+      initialStressPt[iComp] = initialStress[iComp*n+i];
+      initialStrainPt[iComp] = initialStrain[iComp*n+i];
+    } // for
+
+    _returnMapping(&rm, propertiesPt, plasticStrainPt,
+		   strainPt, initialStressPt, initialStrainPt);
+    _stressReturnMapping(stressPt, rm, propertiesPt);
+
+    for (int iComp=0; iComp < tensorSize; ++iComp) {
+      stress[iComp*n+i] = stressPt[iComp];
+    } // for
+  } // for
+} // _calcStressBatchElastoplastic
+
+// ----------------------------------------------------------------------
+// Compute derivatives of elasticity matrix for batch of points from
+// properties as an elastic material.
+void
+pylith::materials::DruckerPrager3D::_calcElasticConstsBatchElastic(PylithScalar* const elasticConsts,
+								   const PylithScalar* properties,
+								   const PylithScalar* stateVars,
+								   const PylithScalar* totalStrain,
+								   const PylithScalar* initialStress,
+								   const PylithScalar* initialStrain,
+								   const int numPoints)
+{ // _calcElasticConstsBatchElastic
+  assert(elasticConsts);
+  assert(properties);
+
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0 * mu[i];
+    const PylithScalar lambda2mu = lambda[i] + mu2;
+
+    elasticConsts[ 0*n+i] = lambda2mu; // C1111
+    elasticConsts[ 1*n+i] = lambda[i]; // C1122
+    elasticConsts[ 2*n+i] = lambda[i]; // C1133
+    elasticConsts[ 3*n+i] = 0; // C1112
+    elasticConsts[ 4*n+i] = 0; // C1123
+    elasticConsts[ 5*n+i] = 0; // C1113
+    elasticConsts[ 6*n+i] = lambda[i]; // C2211
+    elasticConsts[ 7*n+i] = lambda2mu; // C2222
+    elasticConsts[ 8*n+i] = lambda[i]; // C2233
+    elasticConsts[ 9*n+i] = 0; // C2212
+    elasticConsts[10*n+i] = 0; // C2223
+    elasticConsts[11*n+i] = 0; // C2213
+    elasticConsts[12*n+i] = lambda[i]; // C3311
+    elasticConsts[13*n+i] = lambda[i]; // C3322
+    elasticConsts[14*n+i] = lambda2mu; // C3333
+    elasticConsts[15*n+i] = 0; // C3312
+    elasticConsts[16*n+i] = 0; // C3323
+    elasticConsts[17*n+i] = 0; // C3313
+    elasticConsts[18*n+i] = 0; // C1211
+    elasticConsts[19*n+i] = 0; // C1222
+    elasticConsts[20*n+i] = 0; // C1233
+    elasticConsts[21*n+i] = mu2; // C1212
+    elasticConsts[22*n+i] = 0; // C1223
+    elasticConsts[23*n+i] = 0; // C1213
+    elasticConsts[24*n+i] = 0; // C2311
+    elasticConsts[25*n+i] = 0; // C2322
+    elasticConsts[26*n+i] = 0; // C2333
+    elasticConsts[27*n+i] = 0; // C2312
+    elasticConsts[28*n+i] = mu2; // C2323
+    elasticConsts[29*n+i] = 0; // C2313
+    elasticConsts[30*n+i] = 0; // C1311
+    elasticConsts[31*n+i] = 0; // C1322
+    elasticConsts[32*n+i] = 0; // C1333
+    elasticConsts[33*n+i] = 0; // C1312
+    elasticConsts[34*n+i] = 0; // C1323
+    elasticConsts[35*n+i] = mu2; // C1313
+  } // for
+
+  pylith::utils::EventLogger::logFlops(2*n);
+} // _calcElasticConstsBatchElastic
+
+// ----------------------------------------------------------------------
+// Compute derivatives of elasticity matrix for batch of points from
+// properties and state variables as an elastoplastic material.
+void
+pylith::materials::DruckerPrager3D::_calcElasticConstsBatchElastoplastic(PylithScalar* const elasticConsts,
+									 const PylithScalar* properties,
+									 const PylithScalar* stateVars,
+									 const PylithScalar* totalStrain,
+									 const PylithScalar* initialStress,
+									 const PylithScalar* initialStrain,
+									 const int numPoints)
+{ // _calcElasticConstsBatchElastoplastic
+  assert(elasticConsts);
+  assert(properties);
+  assert(stateVars);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
+
+  const int numProperties = _DruckerPrager3D::numProperties;
+  const int numElasticConsts = _DruckerPrager3D::numElasticConsts;
+  const int tensorSize = _DruckerPrager3D::tensorSize;
+  const int n = numPoints;
+
+  // Elastic constants for all points, then the consistent tangent for
+  // only those points on or outside the yield surface.
+  _calcElasticConstsBatchElastic(elasticConsts, properties, stateVars,
+				 totalStrain, initialStress, initialStrain, n);
+
+  scalar_array trialStress(tensorSize*n);
+  scalar_array yieldFunction(n);
+  _calcTrialStressBatch(&trialStress[0], &yieldFunction[0], properties, stateVars,
+			totalStrain, initialStress, initialStrain, n);
+
+  PylithScalar propertiesPt[numProperties];
+  PylithScalar plasticStrainPt[tensorSize];
+  PylithScalar strainPt[tensorSize];
+  PylithScalar initialStressPt[tensorSize];
+  PylithScalar initialStrainPt[tensorSize];
+  PylithScalar elasticConstsPt[numElasticConsts];
+  ReturnMapping rm;
+  for (int i=0; i < n; ++i) {
+    if (yieldFunction[i] < 0.0) {
+      continue;
+    } // if
+
+    for (int iProp=0; iProp < numProperties; ++iProp) {
+      propertiesPt[iProp] = properties[iProp*n+i];
+    } // for
+    for (int iComp=0; iComp < tensorSize; ++iComp) {
+      plasticStrainPt[iComp] = stateVars[(s_plasticStrain+iComp)*n+i];
+      strainPt[iComp] = totalStrain[iComp*n+i];
+      initialStressPt[iComp] = initialStress[iComp*n+i];
+      initialStrainPt[iComp] = initialStrain[iComp*n+i];
+    } // for
+
+    _returnMapping(&rm, propertiesPt, plasticStrainPt,
+		   strainPt, initialStressPt, initialStrainPt);
+    _elasticConstsReturnMapping(elasticConstsPt, rm, propertiesPt);
+
+    for (int iConst=0; iConst < numElasticConsts; ++iConst) {
+      elasticConsts[iConst*n+i] = elasticConstsPt[iConst];
+    } // for
+  } // for
+} // _calcElasticConstsBatchElastoplastic
 
 // End of file 
@@ -85,6 +85,13 @@ public :
    */
   void useElasticBehavior(const bool flag);
 
+  /** Get flag indicating whether material implements batched
+   * constitutive kernels.
+   *
+   * @returns True.
+   */
+  bool hasBatchKernels(void) const;
+
 
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
@@ -215,6 +222,47 @@ protected :
 		          const PylithScalar* initialStrain,
 		          const int initialStrainSize);
 
+  /** Compute stress tensors for a batch of points from properties
+   * and state variables stored in structure-of-arrays layout.
+   *
+   * @param stress Array for stress tensors [tensorSize][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   * @param computeStateVars Flag indicating to compute updated state variables.
+   */
+  void _calcStressBatch(PylithScalar* const stress,
+			const PylithScalar* properties,
+			const PylithScalar* stateVars,
+			const PylithScalar* totalStrain,
+			const PylithScalar* initialStress,
+			const PylithScalar* initialStrain,
+			const int numPoints,
+			const bool computeStateVars);
+
+  /** Compute derivatives of elasticity matrix for a batch of points
+   * from properties and state variables stored in
+   * structure-of-arrays layout.
+   *
+   * @param elasticConsts Array for elastic constants [numElasticConsts][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   */
+  void _calcElasticConstsBatch(PylithScalar* const elasticConsts,
+			       const PylithScalar* properties,
+			       const PylithScalar* stateVars,
+			       const PylithScalar* totalStrain,
+			       const PylithScalar* initialStress,
+			       const PylithScalar* initialStrain,
+			       const int numPoints);
+
   /** Get stable time step for implicit time integration.
    *
    * @param properties Properties at location.
@@ -316,9 +364,112 @@ private :
      const PylithScalar*,
      const int);
 
+  /// Member prototype for _calcStressBatch()
+  typedef void (pylith::materials::DruckerPrager3D::*calcStressBatch_fn_type)
+    (PylithScalar* const,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const int,
+     const bool);
+
+  /// Member prototype for _calcElasticConstsBatch()
+  typedef void (pylith::materials::DruckerPrager3D::*calcElasticConstsBatch_fn_type)
+    (PylithScalar* const,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const int);
+
+  // PRIVATE STRUCTS ////////////////////////////////////////////////////
+private :
+
+  /** Trial state and plastic multiplier from the return mapping at a
+   * point. Computed once by _returnMapping() and shared by the
+   * stress, tangent, and state variable update.
+   */
+  struct ReturnMapping {
+    PylithScalar strainPPTpdt[6]; ///< Deviatoric strain less plastic and initial strain.
+    PylithScalar devStressInitial[6]; ///< Deviatoric initial stress.
+    PylithScalar meanStrainPPTpdt; ///< Mean strain less plastic and initial strain.
+    PylithScalar meanStressInitial; ///< Mean initial stress.
+    PylithScalar ae; ///< Deviatoric compliance, 1/(2*mu).
+    PylithScalar am; ///< Volumetric compliance, 1/(3*bulkModulus).
+    PylithScalar yieldFunction; ///< Yield function for trial stress.
+    PylithScalar d; ///< Norm of trial deviatoric strain.
+    PylithScalar plasticMultNormal; ///< Plastic multiplier for projection normal to yield surface.
+    PylithScalar plasticMult; ///< Plastic multiplier.
+    bool yield; ///< True if trial stress is on or outside yield surface.
+    bool tensileYield; ///< True if plastic multiplier is limited by tensile yield.
+  }; // ReturnMapping
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
+  /** Compute trial stress, yield function, and plastic multiplier at
+   * a point.
+   *
+   * @param rm Result of return mapping.
+   * @param properties Properties at location.
+   * @param plasticStrainT Plastic strain from previous time step.
+   * @param totalStrain Total strain at location.
+   * @param initialStress Initial stress values.
+   * @param initialStrain Initial strain values.
+   */
+  void _returnMapping(ReturnMapping* const rm,
+		      const PylithScalar* properties,
+		      const PylithScalar* plasticStrainT,
+		      const PylithScalar* totalStrain,
+		      const PylithScalar* initialStress,
+		      const PylithScalar* initialStrain) const;
+
+  /** Compute stress tensor at a point from result of return mapping.
+   *
+   * @param stress Array for stress tensor.
+   * @param rm Result of return mapping.
+   * @param properties Properties at location.
+   */
+  void _stressReturnMapping(PylithScalar* const stress,
+			    const ReturnMapping& rm,
+			    const PylithScalar* properties) const;
+
+  /** Compute consistent tangent at a point from result of return
+   * mapping.
+   *
+   * @param elasticConsts Array for elastic constants.
+   * @param rm Result of return mapping.
+   * @param properties Properties at location.
+   */
+  void _elasticConstsReturnMapping(PylithScalar* const elasticConsts,
+				   const ReturnMapping& rm,
+				   const PylithScalar* properties) const;
+
+  /** Compute trial elastic stress and yield function for a batch of
+   * points stored in structure-of-arrays layout.
+   *
+   * @param stress Array for trial stress tensors [tensorSize][numPoints].
+   * @param yieldFunction Array for yield function [numPoints]
+   *   (ignored if NULL).
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   */
+  void _calcTrialStressBatch(PylithScalar* const stress,
+			     PylithScalar* const yieldFunction,
+			     const PylithScalar* properties,
+			     const PylithScalar* stateVars,
+			     const PylithScalar* totalStrain,
+			     const PylithScalar* initialStress,
+			     const PylithScalar* initialStrain,
+			     const int numPoints) const;
+
   /** Compute stress tensor from properties as an elastic material.
    *
    * @param stress Array for stress tensor.
@@ -481,6 +632,85 @@ private :
 				     const PylithScalar* initialStrain,
 				     const int initialStrainSize);
 
+  /** Compute stress tensors for a batch of points from properties
+   * as an elastic material.
+   *
+   * @param stress Array for stress tensors [tensorSize][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   * @param computeStateVars Flag indicating to compute updated state variables.
+   */
+  void _calcStressBatchElastic(PylithScalar* const stress,
+			       const PylithScalar* properties,
+			       const PylithScalar* stateVars,
+			       const PylithScalar* totalStrain,
+			       const PylithScalar* initialStress,
+			       const PylithScalar* initialStrain,
+			       const int numPoints,
+			       const bool computeStateVars);
+
+  /** Compute stress tensors for a batch of points from properties
+   * and state variables as an elastoplastic material.
+   *
+   * @param stress Array for stress tensors [tensorSize][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   * @param computeStateVars Flag indicating to compute updated state variables.
+   */
+  void _calcStressBatchElastoplastic(PylithScalar* const stress,
+				     const PylithScalar* properties,
+				     const PylithScalar* stateVars,
+				     const PylithScalar* totalStrain,
+				     const PylithScalar* initialStress,
+				     const PylithScalar* initialStrain,
+				     const int numPoints,
+				     const bool computeStateVars);
+
+  /** Compute derivatives of elasticity matrix for a batch of points
+   * from properties as an elastic material.
+   *
+   * @param elasticConsts Array for elastic constants [numElasticConsts][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   */
+  void _calcElasticConstsBatchElastic(PylithScalar* const elasticConsts,
+				      const PylithScalar* properties,
+				      const PylithScalar* stateVars,
+				      const PylithScalar* totalStrain,
+				      const PylithScalar* initialStress,
+				      const PylithScalar* initialStrain,
+				      const int numPoints);
+
+  /** Compute derivatives of elasticity matrix for a batch of points
+   * from properties and state variables as an elastoplastic material.
+   *
+   * @param elasticConsts Array for elastic constants [numElasticConsts][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   */
+  void _calcElasticConstsBatchElastoplastic(PylithScalar* const elasticConsts,
+					    const PylithScalar* properties,
+					    const PylithScalar* stateVars,
+					    const PylithScalar* totalStrain,
+					    const PylithScalar* initialStress,
+					    const PylithScalar* initialStrain,
+					    const int numPoints);
 
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
@@ -494,6 +724,12 @@ private :
   /// Method to use for _updateStateVars().
   updateStateVars_fn_type _updateStateVarsFn;
 
+  /// Method to use for _calcElasticConstsBatch().
+  calcElasticConstsBatch_fn_type _calcElasticConstsBatchFn;
+
+  /// Method to use for _calcStressBatch().
+  calcStressBatch_fn_type _calcStressBatchFn;
+
   /// Fit to Mohr Coulomb surface
   FitMohrCoulombEnum _fitMohrCoulomb;
 
@@ -27,7 +27,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cmath> // USES fabs()
 #include <cassert> // USES assert()
@@ -196,6 +196,8 @@ pylith::materials::DruckerPragerPlaneStrain::fitMohrCoulomb(
 void
 pylith::materials::DruckerPragerPlaneStrain::useElasticBehavior(const bool flag)
 { // useElasticBehavior
+  ElasticMaterial::useElasticBehavior(flag);
+
   if (flag) {
     _calcStressFn = 
       &pylith::materials::DruckerPragerPlaneStrain::_calcStressElastic;
@@ -307,7 +309,7 @@ pylith::materials::DruckerPragerPlaneStrain::_dbToProperties(
   propValues[p_beta] = beta;
   propValues[p_alphaFlow] = alphaFlow;
 
-  PetscLogFlops(28);
+  pylith::utils::EventLogger::logFlops(28);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -333,7 +335,7 @@ pylith::materials::DruckerPragerPlaneStrain::_nondimProperties(
   values[p_beta] = 
     _normalizer->nondimensionalize(values[p_beta], pressureScale);
 
-  PetscLogFlops(4);
+  pylith::utils::EventLogger::logFlops(4);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -359,7 +361,7 @@ pylith::materials::DruckerPragerPlaneStrain::_dimProperties(
   values[p_beta] = 
     _normalizer->dimensionalize(values[p_beta], pressureScale);
 
-  PetscLogFlops(4);
+  pylith::utils::EventLogger::logFlops(4);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -394,7 +396,7 @@ pylith::materials::DruckerPragerPlaneStrain::_nondimStateVars(
   const PylithScalar pressureScale = _normalizer->pressureScale();
   _normalizer->nondimensionalize(&values[s_stressZZInitial], 1, pressureScale);
 
-  PetscLogFlops(1);
+  pylith::utils::EventLogger::logFlops(1);
 } // _nondimStateVars
 
 // ----------------------------------------------------------------------
@@ -411,7 +413,7 @@ pylith::materials::DruckerPragerPlaneStrain::_dimStateVars(
   const PylithScalar pressureScale = _normalizer->pressureScale();
   _normalizer->dimensionalize(&values[s_stressZZInitial], 1, pressureScale);
 
-  PetscLogFlops(1);
+  pylith::utils::EventLogger::logFlops(1);
 } // _dimStateVars
 
 // ----------------------------------------------------------------------
@@ -521,7 +523,7 @@ pylith::materials::DruckerPragerPlaneStrain::_calcStressElastic(
   stress[1] = s12 + mu2 * e22 + initialStress[1];
   stress[2] = mu2 * e12 + initialStress[2];
 
-  PetscLogFlops(14);
+  pylith::utils::EventLogger::logFlops(14);
 } // _calcStressElastic
 
 // ----------------------------------------------------------------------
@@ -648,7 +650,7 @@ pylith::materials::DruckerPragerPlaneStrain::_calcStressElastoplastic(
     std::cout << "  stressInvar2:     " << stressInvar2 << std::endl;
     std::cout << "  yieldFunction:    " << yieldFunction << std::endl;
 #endif
-    PetscLogFlops(62);
+    pylith::utils::EventLogger::logFlops(62);
 
     // If yield function is greater than zero, compute elastoplastic stress.
     if (yieldFunction >= 0.0) {
@@ -732,7 +734,7 @@ pylith::materials::DruckerPragerPlaneStrain::_calcStressElastoplastic(
 	std::cout << "    " << totalStress[i] << "\n";
 #endif
 
-    PetscLogFlops(51 + 11 * tensorSizePS);
+    pylith::utils::EventLogger::logFlops(51 + 11 * tensorSizePS);
 
     } else {
       // No plastic strain.
@@ -742,7 +744,7 @@ pylith::materials::DruckerPragerPlaneStrain::_calcStressElastoplastic(
       stress[1] = strainPPTpdt[1]/ae + devStressInitial[1] + meanStressTpdt; 
       stress[2] = strainPPTpdt[3]/ae + devStressInitial[3]; 
 
-      PetscLogFlops(10);
+      pylith::utils::EventLogger::logFlops(10);
     } // if
 
     // If state variables have already been updated, the plastic strain for the
@@ -771,7 +773,7 @@ pylith::materials::DruckerPragerPlaneStrain::_calcStressElastoplastic(
     stress[1] = s12 + mu2 * e22 + initialStress[1];
     stress[2] = mu2 * e12 + initialStress[2];
 
-    PetscLogFlops(17);
+    pylith::utils::EventLogger::logFlops(17);
 
   } // else
 #if 0 // DEBUGGING
@@ -850,7 +852,7 @@ pylith::materials::DruckerPragerPlaneStrain::_calcElasticConstsElastic(
   elasticConsts[ 7] = 0; // C1222
   elasticConsts[ 8] = mu2; // C1212
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // _calcElasticConstsElastic
 
 // ----------------------------------------------------------------------
@@ -969,7 +971,7 @@ pylith::materials::DruckerPragerPlaneStrain::_calcElasticConstsElastoplastic(
   std::cout << "  stressInvar2:     " << stressInvar2 << std::endl;
   std::cout << "  yieldFunction:    " << yieldFunction << std::endl;
 #endif
-  PetscLogFlops(62);
+  pylith::utils::EventLogger::logFlops(62);
   
   // If yield function is greater than zero, compute elastoplastic stress and
   // corresponding tangent matrix.
@@ -1063,7 +1065,7 @@ pylith::materials::DruckerPragerPlaneStrain::_calcElasticConstsElastoplastic(
       } // for
     } // if/else
 
-    PetscLogFlops(76 + tensorSize * tensorSize * 15);
+    pylith::utils::EventLogger::logFlops(76 + tensorSize * tensorSize * 15);
 
   } else {
     // No plastic strain.
@@ -1078,7 +1080,7 @@ pylith::materials::DruckerPragerPlaneStrain::_calcElasticConstsElastoplastic(
     elasticConsts[ 7] = 0; // C1222
     elasticConsts[ 8] = mu2; // C1212
 
-    PetscLogFlops(1);
+    pylith::utils::EventLogger::logFlops(1);
   } // else
 
 } // _calcElasticConstsElastoplastic
@@ -1227,7 +1229,7 @@ pylith::materials::DruckerPragerPlaneStrain::_updateStateVarsElastoplastic(
   std::cout << "  stressInvar2:     " << stressInvar2 << std::endl;
   std::cout << "  yieldFunction:    " << yieldFunction << std::endl;
 #endif
-  PetscLogFlops(62);
+  pylith::utils::EventLogger::logFlops(62);
 
   // If yield function is greater than zero, compute plastic strains.
   // Otherwise, plastic strains remain the same.
@@ -1287,7 +1289,7 @@ pylith::materials::DruckerPragerPlaneStrain::_updateStateVarsElastoplastic(
       } // for
     } // if/else
     
-    PetscLogFlops(48 + 9 * tensorSizePS);
+    pylith::utils::EventLogger::logFlops(48 + 9 * tensorSizePS);
 
   } // if
 
@@ -32,10 +32,37 @@
  *
  * This class contains bracketing and root-finding functions for
  * materials that use an effective stress formulation.
+ *
+ * The material type must provide a structure EffStressStruct with
+ * the parameters for the effective stress function at a point and
+ * the static functions
+ *
+ *   effStressFunc(x, params)
+ *   effStressFuncDerivFunc(&f, &df, x, params).
+ *
+ * All data used during the solve is in the caller-owned parameters,
+ * so the effective stress may be computed concurrently for different
+ * points.
+ *
+ * The solve starts with Newton's method from the initial guess
+ * (usually the effective stress from the previous time step), which
+ * converges in a few iterations for small changes in stress. Only if
+ * Newton's method fails to converge quickly do we bracket the root
+ * and use Newton's method with bisection.
  */
 class pylith::materials::EffectiveStress
 { // class EffectiveStress
 
+  // PUBLIC STRUCTS /////////////////////////////////////////////////////
+public :
+
+  /// Iteration statistics accumulated over effective stress solves.
+  struct Stats {
+    long numSolves; ///< Number of effective stress solves.
+    long numIterations; ///< Total number of iterations over all solves.
+    long numBracketed; ///< Number of solves that required bracketing.
+  };
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -46,8 +73,9 @@ public :
    * actual initial guess is zero.
    *
    * @param effStressInitialGuess Initial guess for effective stress.
+   * @param stressScale Stress scale used when initial guess is zero.
    * @param effStressParams Parameters used in computing effective stress.
-   * @param material Material with effective stress function.
+   * @param stats Iteration statistics to update (may be NULL).
    *
    * @returns Computed effective stress.
    */
@@ -55,29 +83,57 @@ public :
   static
   PylithScalar calculate(const PylithScalar effStressInitialGuess,
 		   const PylithScalar stressScale,
-		   material_type* const material);
+		   const typename material_type::EffStressStruct& effStressParams,
+		   Stats* const stats =0);
+
+  /** Reset iteration statistics.
+   *
+   * @param stats Iteration statistics.
+   */
+  static
+  void resetStats(Stats* const stats);
 
   // PRIVATE METHODS /////////////////////////////////////////////////////
 private :
 
+  /** Solve for effective stress using Newton's method starting from
+   * an initial guess, keeping iterates positive.
+   *
+   * @param effStress Computed effective stress.
+   * @param numIterations Number of iterations (incremented).
+   * @param x0 Initial guess.
+   * @param effStressParams Parameters used in computing effective stress.
+   *
+   * @returns True if Newton's method converged, false otherwise.
+   */
+  template<typename material_type>
+  static
+  bool _newton(PylithScalar* const effStress,
+	       int* const numIterations,
+	       const PylithScalar x0,
+	       const typename material_type::EffStressStruct& effStressParams);
+
   /** Bracket effective stress.
    *
    * @param px1 Initial guess for first bracket.
    * @param px2 Initial guess for second bracket.
-   * @param material Material with effective stress function.
+   * @param numIterations Number of iterations (incremented).
+   * @param effStressParams Parameters used in computing effective stress.
    *
    */
   template<typename material_type>
   static
   void _bracket(PylithScalar* px1,
 		PylithScalar* px2,
-		material_type* const material);
+		int* const numIterations,
+		const typename material_type::EffStressStruct& effStressParams);
 
   /** Solve for effective stress using Newton's method with bisection.
    *
    * @param x1 Initial guess for first bracket.
    * @param x2 Initial guess for second bracket.
-   * @param material Material with effective stress function.
+   * @param numIterations Number of iterations (incremented).
+   * @param effStressParams Parameters used in computing effective stress.
    *
    * @returns Computed effective stress.
    */
@@ -85,12 +141,13 @@ private :
   static
   PylithScalar _search(PylithScalar x1,
 		 PylithScalar x2,
-		 material_type* const material);
+		 int* const numIterations,
+		 const typename material_type::EffStressStruct& effStressParams);
 
 }; // class EffectiveStress
 
-#endif // pylith_materials_effectivestress_hh
-
 #include "EffectiveStress.icc" // template methods
 
+#endif // pylith_materials_effectivestress_hh
+
 // End of file 
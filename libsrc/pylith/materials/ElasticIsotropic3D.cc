@@ -27,7 +27,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
@@ -145,7 +145,7 @@ pylith::materials::ElasticIsotropic3D::_dbToProperties(
   propValues[p_mu] = mu;
   propValues[p_lambda] = lambda;
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -168,7 +168,7 @@ pylith::materials::ElasticIsotropic3D::_nondimProperties(PylithScalar* const val
   values[p_lambda] = 
     _normalizer->nondimensionalize(values[p_lambda], pressureScale);
 
-  PetscLogFlops(3);
+  pylith::utils::EventLogger::logFlops(3);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -191,7 +191,7 @@ pylith::materials::ElasticIsotropic3D::_dimProperties(PylithScalar* const values
   values[p_lambda] = 
     _normalizer->dimensionalize(values[p_lambda], pressureScale);
 
-  PetscLogFlops(3);
+  pylith::utils::EventLogger::logFlops(3);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -244,7 +244,7 @@ pylith::materials::ElasticIsotropic3D::_calcStress(PylithScalar* const stress,
   stress[4] = mu2 * e23 + initialStress[4];
   stress[5] = mu2 * e13 + initialStress[5];
 
-  PetscLogFlops(25);
+  pylith::utils::EventLogger::logFlops(25);
 } // _calcStress
 
 // ----------------------------------------------------------------------
@@ -319,9 +319,118 @@ pylith::materials::ElasticIsotropic3D::_calcElasticConsts(
   elasticConsts[34] = 0; // C1323
   elasticConsts[35] = mu2; // C1313
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // _calcElasticConsts
 
+// ----------------------------------------------------------------------
+// Compute stress tensors for batch of points from properties.
+void
+pylith::materials::ElasticIsotropic3D::_calcStressBatch(PylithScalar* const stress,
+							const PylithScalar* properties,
+							const PylithScalar* stateVars,
+							const PylithScalar* totalStrain,
+							const PylithScalar* initialStress,
+							const PylithScalar* initialStrain,
+							const int numPoints,
+							const bool computeStateVars)
+{ // _calcStressBatch
+  assert(stress);
+  assert(properties);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
+
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+
+  // Components are contiguous over points, so the loop vectorizes.
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0*mu[i];
+
+    const PylithScalar e11 = totalStrain[0*n+i] - initialStrain[0*n+i];
+    const PylithScalar e22 = totalStrain[1*n+i] - initialStrain[1*n+i];
+    const PylithScalar e33 = totalStrain[2*n+i] - initialStrain[2*n+i];
+    const PylithScalar e12 = totalStrain[3*n+i] - initialStrain[3*n+i];
+    const PylithScalar e23 = totalStrain[4*n+i] - initialStrain[4*n+i];
+    const PylithScalar e13 = totalStrain[5*n+i] - initialStrain[5*n+i];
+
+    const PylithScalar s123 = lambda[i] * (e11 + e22 + e33);
+
+    stress[0*n+i] = s123 + mu2*e11 + initialStress[0*n+i];
+    stress[1*n+i] = s123 + mu2*e22 + initialStress[1*n+i];
+    stress[2*n+i] = s123 + mu2*e33 + initialStress[2*n+i];
+    stress[3*n+i] = mu2 * e12 + initialStress[3*n+i];
+    stress[4*n+i] = mu2 * e23 + initialStress[4*n+i];
+    stress[5*n+i] = mu2 * e13 + initialStress[5*n+i];
+  } // for
+
+  pylith::utils::EventLogger::logFlops(25*n);
+} // _calcStressBatch
+
+// ----------------------------------------------------------------------
+// Compute elastic constants for batch of points from properties.
+void
+pylith::materials::ElasticIsotropic3D::_calcElasticConstsBatch(PylithScalar* const elasticConsts,
+							       const PylithScalar* properties,
+							       const PylithScalar* stateVars,
+							       const PylithScalar* totalStrain,
+							       const PylithScalar* initialStress,
+							       const PylithScalar* initialStrain,
+							       const int numPoints)
+{ // _calcElasticConstsBatch
+  assert(elasticConsts);
+  assert(properties);
+
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0 * mu[i];
+    const PylithScalar lambda2mu = lambda[i] + mu2;
+
+    elasticConsts[ 0*n+i] = lambda2mu; // C1111
+    elasticConsts[ 1*n+i] = lambda[i]; // C1122
+    elasticConsts[ 2*n+i] = lambda[i]; // C1133
+    elasticConsts[ 3*n+i] = 0; // C1112
+    elasticConsts[ 4*n+i] = 0; // C1123
+    elasticConsts[ 5*n+i] = 0; // C1113
+    elasticConsts[ 6*n+i] = lambda[i]; // C2211
+    elasticConsts[ 7*n+i] = lambda2mu; // C2222
+    elasticConsts[ 8*n+i] = lambda[i]; // C2233
+    elasticConsts[ 9*n+i] = 0; // C2212
+    elasticConsts[10*n+i] = 0; // C2223
+    elasticConsts[11*n+i] = 0; // C2213
+    elasticConsts[12*n+i] = lambda[i]; // C3311
+    elasticConsts[13*n+i] = lambda[i]; // C3322
+    elasticConsts[14*n+i] = lambda2mu; // C3333
+    elasticConsts[15*n+i] = 0; // C3312
+    elasticConsts[16*n+i] = 0; // C3323
+    elasticConsts[17*n+i] = 0; // C3313
+    elasticConsts[18*n+i] = 0; // C1211
+    elasticConsts[19*n+i] = 0; // C1222
+    elasticConsts[20*n+i] = 0; // C1233
+    elasticConsts[21*n+i] = mu2; // C1212
+    elasticConsts[22*n+i] = 0; // C1223
+    elasticConsts[23*n+i] = 0; // C1213
+    elasticConsts[24*n+i] = 0; // C2311
+    elasticConsts[25*n+i] = 0; // C2322
+    elasticConsts[26*n+i] = 0; // C2333
+    elasticConsts[27*n+i] = 0; // C2312
+    elasticConsts[28*n+i] = mu2; // C2323
+    elasticConsts[29*n+i] = 0; // C2313
+    elasticConsts[30*n+i] = 0; // C1311
+    elasticConsts[31*n+i] = 0; // C1322
+    elasticConsts[32*n+i] = 0; // C1333
+    elasticConsts[33*n+i] = 0; // C1312
+    elasticConsts[34*n+i] = 0; // C1323
+    elasticConsts[35*n+i] = mu2; // C1313
+  } // for
+
+  pylith::utils::EventLogger::logFlops(2*n);
+} // _calcElasticConstsBatch
+
 // ----------------------------------------------------------------------
 // Get stable time step for implicit time integration.
 PylithScalar
@@ -330,6 +439,24 @@ pylith::materials::ElasticIsotropic3D::stableTimeStepImplicit(const topology::Me
   return ElasticMaterial::_stableTimeStepImplicitMax(mesh, field);
 } // stableTimeStepImplicitMax
 
+// ----------------------------------------------------------------------
+// Get flag indicating whether material implements batched
+// constitutive kernels.
+bool
+pylith::materials::ElasticIsotropic3D::hasBatchKernels(void) const
+{ // hasBatchKernels
+  return true;
+} // hasBatchKernels
+
+// ----------------------------------------------------------------------
+// Get flag indicating whether elasticity constants depend only on
+// physical properties.
+bool
+pylith::materials::ElasticIsotropic3D::hasConstantElasticConsts(void) const
+{ // hasConstantElasticConsts
+  return true;
+} // hasConstantElasticConsts
+
 // ----------------------------------------------------------------------
 // Get stable time step for implicit time integration.
 PylithScalar
@@ -38,6 +38,7 @@
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
+#include <algorithm> // USES std::min()
 
 // ----------------------------------------------------------------------
 // Default constructor.
@@ -49,12 +50,16 @@ pylith::materials::ElasticMaterial::ElasticMaterial(const int dimension,
   _dbInitialStress(0),
   _dbInitialStrain(0),
   _initialFields(0),
-  _numQuadPts(0),
   _numElasticConsts(numElasticConsts),
   _propertiesVisitor(0),
   _stateVarsVisitor(0),
   _stressVisitor(0),
-  _strainVisitor(0)
+  _strainVisitor(0),
+  _numPointsBatch(0),
+  _elasticConstsCache(0),
+  _elasticConstsCacheVisitor(0),
+  _elasticConstsCacheValid(false),
+  _dtStableExplicit(pylith::PYLITH_MAXSCALAR)
 { // constructor
 } // constructor
 
@@ -80,6 +85,12 @@ pylith::materials::ElasticMaterial::deallocate(void)
   delete _stressVisitor; _stressVisitor = 0;
   delete _strainVisitor; _strainVisitor = 0;
 
+  delete _elasticConstsCacheVisitor; _elasticConstsCacheVisitor = 0;
+  delete _elasticConstsCache; _elasticConstsCache = 0;
+  _elasticConstsHomogeneous.resize(0);
+  _elasticConstsCacheValid = false;
+  _dtStableExplicitCells.resize(0);
+
   _dbInitialStress = 0; // :TODO: Use shared pointer.
   _dbInitialStrain = 0; // :TODO: Use shared pointer.
 
@@ -97,9 +108,6 @@ pylith::materials::ElasticMaterial::initialize(const topology::Mesh& mesh,
 
   Material::initialize(mesh, quadrature);
 
-  assert(0 != quadrature);
-  _numQuadPts = quadrature->numQuadPts();
-
   if (_dbInitialStress || _dbInitialStrain) {
     delete _initialFields; 
     _initialFields = new topology::Fields(mesh);assert(_initialFields);
@@ -108,6 +116,11 @@ pylith::materials::ElasticMaterial::initialize(const topology::Mesh& mesh,
   _initializeInitialStrain(mesh, quadrature);
   _allocateCellArrays();
 
+  delete _elasticConstsCacheVisitor; _elasticConstsCacheVisitor = 0;
+  delete _elasticConstsCache; _elasticConstsCache = 0;
+  _elasticConstsCacheValid = false;
+  _dtStableExplicitCells.resize(0);
+
   PYLITH_METHOD_END;
 } // initialize
 
@@ -122,7 +135,7 @@ pylith::materials::ElasticMaterial::createPropsAndVarsVisitors(void)
 
   delete _propertiesVisitor; _propertiesVisitor = new pylith::topology::VecVisitorMesh(*_properties);assert(_propertiesVisitor);
   _propertiesVisitor->optimizeClosure();
-  if (hasStateVars()) {
+  if (hasStateVars() && !stateVarsSinglePrecision()) {
     delete _stateVarsVisitor; _stateVarsVisitor = new pylith::topology::VecVisitorMesh(*_stateVars);assert(_stateVarsVisitor);
     _stateVarsVisitor->optimizeClosure();
   } // if
@@ -161,58 +174,127 @@ pylith::materials::ElasticMaterial::destroyPropsAndVarsVisitors(void)
 // Retrieve parameters for physical properties and state variables for cell.
 void
 pylith::materials::ElasticMaterial::retrievePropsAndVars(const int cell)
+{ // retrievePropsAndVars
+  retrievePropsAndVars(&_workspace, cell);
+} // retrievePropsAndVars
+
+// ----------------------------------------------------------------------
+// Compute stress tensor for cell at quadrature points.
+const pylith::scalar_array&
+pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
+					       const bool computeStateVars)
+{ // calcStress
+  return calcStress(&_workspace, totalStrain, computeStateVars);
+} // calcStress
+
+// ----------------------------------------------------------------------
+// Compute derivative of elasticity matrix for cell at quadrature points.
+const pylith::scalar_array&
+pylith::materials::ElasticMaterial::calcDerivElastic(const scalar_array& totalStrain)
+{ // calcDerivElastic
+  return calcDerivElastic(&_workspace, totalStrain);
+} // calcDerivElastic
+
+// ----------------------------------------------------------------------
+// Allocate arrays in workspace.
+void
+pylith::materials::ElasticMaterial::initWorkspace(Workspace* workspace) const
+{ // initWorkspace
+  assert(workspace);
+
+  const int numQuadPts = _numQuadPts;
+  const int tensorSize = _tensorSize;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+  const int numElasticConsts = _numElasticConsts;
+
+  workspace->propertiesCell.resize(numQuadPts * numPropsQuadPt);
+  workspace->stateVarsCell.resize(numQuadPts * numVarsQuadPt);
+  workspace->initialStressCell.resize(numQuadPts * tensorSize);
+  workspace->initialStrainCell.resize(numQuadPts * tensorSize);
+  workspace->densityCell.resize(numQuadPts);
+  workspace->stressCell.resize(numQuadPts * tensorSize);
+  workspace->elasticConstsCell.resize(numQuadPts * numElasticConsts);
+} // initWorkspace
+
+// ----------------------------------------------------------------------
+// Retrieve parameters for physical properties and state variables for
+// cell into workspace.
+void
+pylith::materials::ElasticMaterial::retrievePropsAndVars(Workspace* workspace,
+							 const int cell) const
 { // retrievePropsAndVars
   PYLITH_METHOD_BEGIN;
 
+  assert(workspace);
   assert(_properties);
   assert(_stateVars);
 
   const int propertiesSize = _numQuadPts*_numPropsQuadPt;
   const int stateVarsSize = _numQuadPts*_numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(propertiesSize));
-  assert(_stateVarsCell.size() == size_t(stateVarsSize));
+  scalar_array& propertiesCell = workspace->propertiesCell;
+  scalar_array& stateVarsCell = workspace->stateVarsCell;
+  assert(propertiesCell.size() == size_t(propertiesSize));
+  assert(stateVarsCell.size() == size_t(stateVarsSize));
 
   assert(_propertiesVisitor);
-  PetscScalar* propertiesArray = _propertiesVisitor->localArray();
+  const PetscScalar* propertiesArray = _propertiesVisitor->localArray();
   const PetscInt poff = _propertiesVisitor->sectionOffset(cell);
-  assert(propertiesSize == _propertiesVisitor->sectionDof(cell));
-  for(PetscInt d = 0; d < propertiesSize; ++d) {
-    _propertiesCell[d] = propertiesArray[poff+d];
-  } // for
+  if (PROPS_QUADPTS == _propsStorage) {
+    assert(propertiesSize == _propertiesVisitor->sectionDof(cell));
+    for(PetscInt d = 0; d < propertiesSize; ++d) {
+      propertiesCell[d] = propertiesArray[poff+d];
+    } // for
+  } else {
+    // Broadcast compact properties to quadrature points.
+    const int numPropsQuadPt = _numPropsQuadPt;
+    for (int iQuad=0; iQuad < _numQuadPts; ++iQuad) {
+      const PylithScalar* propertiesQuadPt = _propertiesQuadPt(propertiesArray, poff, iQuad);
+      for (int i=0; i < numPropsQuadPt; ++i) {
+	propertiesCell[iQuad*numPropsQuadPt+i] = propertiesQuadPt[i];
+      } // for
+    } // for
+  } // if/else
 
   if (hasStateVars()) {
-    assert(_stateVarsVisitor);
-    PetscScalar* stateVarsArray = _stateVarsVisitor->localArray();
-    const PetscInt soff = _stateVarsVisitor->sectionOffset(cell);
-    assert(stateVarsSize == _stateVarsVisitor->sectionDof(cell));
-    for(PetscInt d = 0; d < stateVarsSize; ++d) {
-      _stateVarsCell[d] = stateVarsArray[soff+d];
-    } // for
+    if (stateVarsSinglePrecision()) {
+      _promoteStateVars(&stateVarsCell[0], stateVarsSize, cell);
+    } else {
+      assert(_stateVarsVisitor);
+      PetscScalar* stateVarsArray = _stateVarsVisitor->localArray();
+      const PetscInt soff = _stateVarsVisitor->sectionOffset(cell);
+      assert(stateVarsSize == _stateVarsVisitor->sectionDof(cell));
+      for(PetscInt d = 0; d < stateVarsSize; ++d) {
+	stateVarsCell[d] = stateVarsArray[soff+d];
+      } // for
+    } // if/else
   } // if
 
-  _initialStressCell = 0.0;
-  _initialStrainCell = 0.0;
+  scalar_array& initialStressCell = workspace->initialStressCell;
+  scalar_array& initialStrainCell = workspace->initialStrainCell;
+  initialStressCell = 0.0;
+  initialStrainCell = 0.0;
   if (_initialFields) {
     if (_initialFields->hasField("initial stress")) {
       const int stressSize = _numQuadPts*_tensorSize;
-      assert(_initialStressCell.size() == size_t(stressSize));
+      assert(initialStressCell.size() == size_t(stressSize));
       assert(_stressVisitor);
       PetscScalar* stressArray = _stressVisitor->localArray();
       const PetscInt ioff = _stressVisitor->sectionOffset(cell);
       assert(stressSize == _stressVisitor->sectionDof(cell));
       for(PetscInt d = 0; d < stressSize; ++d) {
-	_initialStressCell[d] = stressArray[ioff+d];
+	initialStressCell[d] = stressArray[ioff+d];
       } // for
     } // if
     if (_initialFields->hasField("initial strain")) {
       const int strainSize = _numQuadPts*_tensorSize;
-      assert(_initialStrainCell.size() == size_t(strainSize));
+      assert(initialStrainCell.size() == size_t(strainSize));
       assert(_strainVisitor);
       PetscScalar* strainArray = _strainVisitor->localArray();
       const PetscInt ioff = _strainVisitor->sectionOffset(cell);
       assert(strainSize == _strainVisitor->sectionDof(cell));
       for(PetscInt d = 0; d < strainSize; ++d) {
-	_initialStrainCell[d] = strainArray[ioff+d];
+	initialStrainCell[d] = strainArray[ioff+d];
       } // for
     } // if
   } // if
@@ -221,65 +303,370 @@ pylith::materials::ElasticMaterial::retrievePropsAndVars(const int cell)
 } // retrievePropsAndVars
 
 // ----------------------------------------------------------------------
-// Compute stress tensor for cell at quadrature points.
+// Compute stress tensor for cell at quadrature points using workspace.
 const pylith::scalar_array&
-pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
+pylith::materials::ElasticMaterial::calcStress(Workspace* workspace,
+					       const scalar_array& totalStrain,
 					       const bool computeStateVars)
 { // calcStress
-  PYLITH_METHOD_BEGIN;
+  assert(workspace);
 
   const int numQuadPts = _numQuadPts;
   const int numPropsQuadPt = _numPropsQuadPt;
   const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
-  assert(_stressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
+  const scalar_array& propertiesCell = workspace->propertiesCell;
+  const scalar_array& stateVarsCell = workspace->stateVarsCell;
+  const scalar_array& initialStressCell = workspace->initialStressCell;
+  const scalar_array& initialStrainCell = workspace->initialStrainCell;
+  scalar_array& stressCell = workspace->stressCell;
+  assert(propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
+  assert(stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
+  assert(stressCell.size() == size_t(numQuadPts*_tensorSize));
+  assert(initialStressCell.size() == size_t(numQuadPts*_tensorSize));
+  assert(initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
-    _calcStress(&_stressCell[iQuad*_tensorSize], _tensorSize,
-		&_propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt,
-		&_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
+    _calcStress(&stressCell[iQuad*_tensorSize], _tensorSize,
+		&propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt,
+		&stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
 		&totalStrain[iQuad*_tensorSize], _tensorSize, 
-		&_initialStressCell[iQuad*_tensorSize], _tensorSize,
-		&_initialStrainCell[iQuad*_tensorSize], _tensorSize,
+		&initialStressCell[iQuad*_tensorSize], _tensorSize,
+		&initialStrainCell[iQuad*_tensorSize], _tensorSize,
 		computeStateVars);
 
-  PYLITH_METHOD_RETURN(_stressCell);
+  return stressCell;
 } // calcStress
 
 // ----------------------------------------------------------------------
-// Compute derivative of elasticity matrix for cell at quadrature points.
+// Compute derivative of elasticity matrix for cell at quadrature
+// points using workspace.
 const pylith::scalar_array&
-pylith::materials::ElasticMaterial::calcDerivElastic(const scalar_array& totalStrain)
+pylith::materials::ElasticMaterial::calcDerivElastic(Workspace* workspace,
+						     const scalar_array& totalStrain)
 { // calcDerivElastic
-  PYLITH_METHOD_BEGIN;
+  assert(workspace);
 
   const int numQuadPts = _numQuadPts;
   const int numPropsQuadPt = _numPropsQuadPt;
   const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
-  assert(_elasticConstsCell.size() == size_t(numQuadPts*_numElasticConsts));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
+  const scalar_array& propertiesCell = workspace->propertiesCell;
+  const scalar_array& stateVarsCell = workspace->stateVarsCell;
+  const scalar_array& initialStressCell = workspace->initialStressCell;
+  const scalar_array& initialStrainCell = workspace->initialStrainCell;
+  scalar_array& elasticConstsCell = workspace->elasticConstsCell;
+  assert(propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
+  assert(stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
+  assert(elasticConstsCell.size() == size_t(numQuadPts*_numElasticConsts));
+  assert(initialStressCell.size() == size_t(numQuadPts*_tensorSize));
+  assert(initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
-    _calcElasticConsts(&_elasticConstsCell[iQuad*_numElasticConsts], 
+    _calcElasticConsts(&elasticConstsCell[iQuad*_numElasticConsts], 
 		       _numElasticConsts,
-		       &_propertiesCell[iQuad*numPropsQuadPt], 
+		       &propertiesCell[iQuad*numPropsQuadPt], 
 		       numPropsQuadPt, 
-		       &_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
+		       &stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
 		       &totalStrain[iQuad*_tensorSize], _tensorSize,
-		       &_initialStressCell[iQuad*_tensorSize], _tensorSize,
-		       &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
+		       &initialStressCell[iQuad*_tensorSize], _tensorSize,
+		       &initialStrainCell[iQuad*_tensorSize], _tensorSize);
 
-  PYLITH_METHOD_RETURN(_elasticConstsCell);
+  return elasticConstsCell;
 } // calcDerivElastic
 
+// ----------------------------------------------------------------------
+// Compute cache of elasticity constants for all cells.
+void
+pylith::materials::ElasticMaterial::updateElasticConstsCache(void)
+{ // updateElasticConstsCache
+  PYLITH_METHOD_BEGIN;
+
+  if (_elasticConstsCacheValid) {
+    PYLITH_METHOD_END;
+  } // if
+
+  if (!hasConstantElasticConsts()) {
+    throw std::logic_error("Cannot cache elasticity constants for material with "
+			   "elasticity constants that depend on the strain or "
+			   "state variables.");
+  } // if
+
+  assert(_properties);
+  assert(_materialIS);
+
+  const int numQuadPts = _numQuadPts;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+  const int numElasticConsts = _numElasticConsts;
+  const int tensorSize = _tensorSize;
+  const int propertiesSize = numQuadPts*numPropsQuadPt;
+  const int elasticConstsSize = numQuadPts*numElasticConsts;
+
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  topology::VecVisitorMesh propertiesVisitor(*_properties);
+  const PetscScalar* propertiesArray = propertiesVisitor.localArray();
+
+  // Properties are usually uniform within a material, in which case
+  // the elasticity constants are the same for every cell.
+  bool isHomogeneous = true;
+  const PetscInt poff0 = (numCells > 0) ? propertiesVisitor.sectionOffset(cells[0]) : 0;
+  const PetscInt propertiesStoredSize = (numCells > 0) ? propertiesVisitor.sectionDof(cells[0]) : 0;
+  assert(PROPS_QUADPTS != _propsStorage || propertiesSize == propertiesStoredSize);
+  for (PetscInt c = 1; c < numCells && isHomogeneous; ++c) {
+    const PetscInt poff = propertiesVisitor.sectionOffset(cells[c]);
+    assert(propertiesStoredSize == propertiesVisitor.sectionDof(cells[c]));
+    for (int d = 0; d < propertiesStoredSize; ++d) {
+      if (propertiesArray[poff+d] != propertiesArray[poff0+d]) {
+	isHomogeneous = false;
+	break;
+      } // if
+    } // for
+  } // for
+
+  // Elasticity constants do not depend on these values.
+  scalar_array stateVarsZero(numVarsQuadPt > 0 ? numVarsQuadPt : 1);
+  stateVarsZero = 0.0;
+  scalar_array tensorZero(tensorSize);
+  tensorZero = 0.0;
+
+  delete _elasticConstsCacheVisitor; _elasticConstsCacheVisitor = 0;
+  delete _elasticConstsCache; _elasticConstsCache = 0;
+  PylithScalar* elasticConstsArray = NULL;
+  if (isHomogeneous) {
+    _elasticConstsHomogeneous.resize(elasticConstsSize);
+    elasticConstsArray = &_elasticConstsHomogeneous[0];
+  } else {
+    _elasticConstsHomogeneous.resize(0);
+    _elasticConstsCache = new topology::Field(_properties->mesh());assert(_elasticConstsCache);
+    _elasticConstsCache->label("elastic_constants");
+    _elasticConstsCache->newSection(*_properties, elasticConstsSize);
+    _elasticConstsCache->allocate();
+    _elasticConstsCache->zeroAll();
+    _elasticConstsCacheVisitor = new topology::VecVisitorMesh(*_elasticConstsCache);assert(_elasticConstsCacheVisitor);
+    elasticConstsArray = _elasticConstsCacheVisitor->localArray();
+  } // if/else
+
+  const PetscInt numCellsCompute = (isHomogeneous) ? std::min(numCells, PetscInt(1)) : numCells;
+  for (PetscInt c = 0; c < numCellsCompute; ++c) {
+    const PetscInt poff = propertiesVisitor.sectionOffset(cells[c]);
+    const PetscInt eoff = (isHomogeneous) ? 0 : _elasticConstsCacheVisitor->sectionOffset(cells[c]);
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      _calcElasticConsts(&elasticConstsArray[eoff+iQuad*numElasticConsts], numElasticConsts,
+			 _propertiesQuadPt(propertiesArray, poff, iQuad), numPropsQuadPt,
+			 &stateVarsZero[0], numVarsQuadPt,
+			 &tensorZero[0], tensorSize,
+			 &tensorZero[0], tensorSize,
+			 &tensorZero[0], tensorSize);
+    } // for
+  } // for
+
+  _elasticConstsCacheValid = true;
+
+  PYLITH_METHOD_END;
+} // updateElasticConstsCache
+
+// ----------------------------------------------------------------------
+// Get cached elasticity constants for cell.
+const PylithScalar*
+pylith::materials::ElasticMaterial::cachedElasticConsts(const int cell) const
+{ // cachedElasticConsts
+  assert(_elasticConstsCacheValid);
+
+  if (!_elasticConstsCacheVisitor) {
+    assert(_elasticConstsHomogeneous.size() == size_t(_numQuadPts*_numElasticConsts));
+    return &_elasticConstsHomogeneous[0];
+  } // if
+
+  const PetscInt eoff = _elasticConstsCacheVisitor->sectionOffset(cell);
+  assert(_numQuadPts*_numElasticConsts == _elasticConstsCacheVisitor->sectionDof(cell));
+  return &_elasticConstsCacheVisitor->localArray()[eoff];
+} // cachedElasticConsts
+
+// ----------------------------------------------------------------------
+// Retrieve parameters for physical properties and state variables for
+// block of cells.
+void
+pylith::materials::ElasticMaterial::retrievePropsAndVarsBatch(const PylithInt* cells,
+							       const int numCells)
+{ // retrievePropsAndVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(cells || 0 == numCells);
+  assert(_properties);
+  assert(_stateVars);
+
+  const int numQuadPts = _numQuadPts;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+  const int tensorSize = _tensorSize;
+  const int numPoints = numCells*numQuadPts;
+
+  if (numPoints != _numPointsBatch) {
+    _propertiesBatch.resize(numPropsQuadPt*numPoints);
+    _stateVarsBatch.resize(numVarsQuadPt*numPoints);
+    _initialStressBatch.resize(tensorSize*numPoints);
+    _initialStrainBatch.resize(tensorSize*numPoints);
+    _densityBatch.resize(numPoints);
+    _stressBatch.resize(tensorSize*numPoints);
+    _elasticConstsBatch.resize(_numElasticConsts*numPoints);
+    _numPointsBatch = numPoints;
+  } // if
+
+  assert(_propertiesVisitor);
+  const PetscScalar* propertiesArray = _propertiesVisitor->localArray();
+  for (int iCell=0; iCell < numCells; ++iCell) {
+    const PetscInt poff = _propertiesVisitor->sectionOffset(cells[iCell]);
+    assert(PROPS_QUADPTS != _propsStorage || numQuadPts*numPropsQuadPt == _propertiesVisitor->sectionDof(cells[iCell]));
+    for (int iQuad=0, iPoint=iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+      const PylithScalar* propertiesQuadPt = _propertiesQuadPt(propertiesArray, poff, iQuad);
+      for (int iProp=0; iProp < numPropsQuadPt; ++iProp) {
+	_propertiesBatch[iProp*numPoints+iPoint] = propertiesQuadPt[iProp];
+      } // for
+    } // for
+  } // for
+
+  if (hasStateVars() && stateVarsSinglePrecision()) {
+    scalar_array stateVarsCell(numQuadPts*numVarsQuadPt);
+    for (int iCell=0; iCell < numCells; ++iCell) {
+      _promoteStateVars(&stateVarsCell[0], stateVarsCell.size(), cells[iCell]);
+      for (int iQuad=0, iPoint=iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	for (int iVar=0; iVar < numVarsQuadPt; ++iVar) {
+	  _stateVarsBatch[iVar*numPoints+iPoint] = stateVarsCell[iQuad*numVarsQuadPt+iVar];
+	} // for
+      } // for
+    } // for
+  } else if (hasStateVars()) {
+    assert(_stateVarsVisitor);
+    const PetscScalar* stateVarsArray = _stateVarsVisitor->localArray();
+    for (int iCell=0; iCell < numCells; ++iCell) {
+      const PetscInt soff = _stateVarsVisitor->sectionOffset(cells[iCell]);
+      assert(numQuadPts*numVarsQuadPt == _stateVarsVisitor->sectionDof(cells[iCell]));
+      for (int iQuad=0, iPoint=iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	for (int iVar=0; iVar < numVarsQuadPt; ++iVar) {
+	  _stateVarsBatch[iVar*numPoints+iPoint] = stateVarsArray[soff+iQuad*numVarsQuadPt+iVar];
+	} // for
+      } // for
+    } // for
+  } // if/else
+
+  _initialStressBatch = 0.0;
+  _initialStrainBatch = 0.0;
+  if (_initialFields) {
+    if (_initialFields->hasField("initial stress")) {
+      assert(_stressVisitor);
+      const PetscScalar* stressArray = _stressVisitor->localArray();
+      for (int iCell=0; iCell < numCells; ++iCell) {
+	const PetscInt ioff = _stressVisitor->sectionOffset(cells[iCell]);
+	assert(numQuadPts*tensorSize == _stressVisitor->sectionDof(cells[iCell]));
+	for (int iQuad=0, iPoint=iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	  for (int iComp=0; iComp < tensorSize; ++iComp) {
+	    _initialStressBatch[iComp*numPoints+iPoint] = stressArray[ioff+iQuad*tensorSize+iComp];
+	  } // for
+	} // for
+      } // for
+    } // if
+    if (_initialFields->hasField("initial strain")) {
+      assert(_strainVisitor);
+      const PetscScalar* strainArray = _strainVisitor->localArray();
+      for (int iCell=0; iCell < numCells; ++iCell) {
+	const PetscInt ioff = _strainVisitor->sectionOffset(cells[iCell]);
+	assert(numQuadPts*tensorSize == _strainVisitor->sectionDof(cells[iCell]));
+	for (int iQuad=0, iPoint=iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	  for (int iComp=0; iComp < tensorSize; ++iComp) {
+	    _initialStrainBatch[iComp*numPoints+iPoint] = strainArray[ioff+iQuad*tensorSize+iComp];
+	  } // for
+	} // for
+      } // for
+    } // if
+  } // if
+
+  PYLITH_METHOD_END;
+} // retrievePropsAndVarsBatch
+
+// ----------------------------------------------------------------------
+// Compute density at quadrature points for block of cells.
+const pylith::scalar_array&
+pylith::materials::ElasticMaterial::calcDensityBatch(void)
+{ // calcDensityBatch
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = _numPointsBatch;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+  assert(_propertiesBatch.size() == size_t(numPoints*numPropsQuadPt));
+  assert(_stateVarsBatch.size() == size_t(numPoints*numVarsQuadPt));
+  assert(_densityBatch.size() == size_t(numPoints));
+
+  scalar_array propertiesPt(numPropsQuadPt);
+  scalar_array stateVarsPt(numVarsQuadPt);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numPropsQuadPt; ++i)
+      propertiesPt[i] = _propertiesBatch[i*numPoints+iPoint];
+    for (int i=0; i < numVarsQuadPt; ++i)
+      stateVarsPt[i] = _stateVarsBatch[i*numPoints+iPoint];
+    _calcDensity(&_densityBatch[iPoint],
+		 &propertiesPt[0], numPropsQuadPt,
+		 (numVarsQuadPt > 0) ? &stateVarsPt[0] : 0, numVarsQuadPt);
+  } // for
+
+  PYLITH_METHOD_RETURN(_densityBatch);
+} // calcDensityBatch
+
+// ----------------------------------------------------------------------
+// Compute stress tensor at quadrature points for block of cells.
+const pylith::scalar_array&
+pylith::materials::ElasticMaterial::calcStressBatch(const scalar_array& totalStrain,
+						    const bool computeStateVars)
+{ // calcStressBatch
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = _numPointsBatch;
+  assert(_propertiesBatch.size() == size_t(numPoints*_numPropsQuadPt));
+  assert(_stateVarsBatch.size() == size_t(numPoints*_numVarsQuadPt));
+  assert(_stressBatch.size() == size_t(numPoints*_tensorSize));
+  assert(_initialStressBatch.size() == size_t(numPoints*_tensorSize));
+  assert(_initialStrainBatch.size() == size_t(numPoints*_tensorSize));
+  assert(totalStrain.size() == size_t(numPoints*_tensorSize));
+
+  if (numPoints > 0) {
+    _calcStressBatch(&_stressBatch[0], &_propertiesBatch[0],
+		     (_numVarsQuadPt > 0) ? &_stateVarsBatch[0] : 0,
+		     &totalStrain[0], &_initialStressBatch[0], &_initialStrainBatch[0],
+		     numPoints, computeStateVars);
+  } // if
+
+  PYLITH_METHOD_RETURN(_stressBatch);
+} // calcStressBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of elasticity matrix at quadrature points for
+// block of cells.
+const pylith::scalar_array&
+pylith::materials::ElasticMaterial::calcDerivElasticBatch(const scalar_array& totalStrain)
+{ // calcDerivElasticBatch
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = _numPointsBatch;
+  assert(_propertiesBatch.size() == size_t(numPoints*_numPropsQuadPt));
+  assert(_stateVarsBatch.size() == size_t(numPoints*_numVarsQuadPt));
+  assert(_elasticConstsBatch.size() == size_t(numPoints*_numElasticConsts));
+  assert(_initialStressBatch.size() == size_t(numPoints*_tensorSize));
+  assert(_initialStrainBatch.size() == size_t(numPoints*_tensorSize));
+  assert(totalStrain.size() == size_t(numPoints*_tensorSize));
+
+  if (numPoints > 0) {
+    _calcElasticConstsBatch(&_elasticConstsBatch[0], &_propertiesBatch[0],
+			    (_numVarsQuadPt > 0) ? &_stateVarsBatch[0] : 0,
+			    &totalStrain[0], &_initialStressBatch[0], &_initialStrainBatch[0],
+			    numPoints);
+  } // if
+
+  PYLITH_METHOD_RETURN(_elasticConstsBatch);
+} // calcDerivElasticBatch
+
 // ----------------------------------------------------------------------
 // Update state variables (for next time step).
 void
@@ -291,32 +678,86 @@ pylith::materials::ElasticMaterial::updateStateVars(const scalar_array& totalStr
   const int numQuadPts = _numQuadPts;
   const int numPropsQuadPt = _numPropsQuadPt;
   const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
+  assert(_workspace.propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
+  assert(_workspace.stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
+  assert(_workspace.initialStressCell.size() == size_t(numQuadPts*_tensorSize));
+  assert(_workspace.initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
-    _updateStateVars(&_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
-		     &_propertiesCell[iQuad*numPropsQuadPt], 
+    _updateStateVars(&_workspace.stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
+		     &_workspace.propertiesCell[iQuad*numPropsQuadPt], 
 		     numPropsQuadPt,
 		     &totalStrain[iQuad*_tensorSize], _tensorSize,
-		     &_initialStressCell[iQuad*_tensorSize], _tensorSize,
-		     &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
+		     &_workspace.initialStressCell[iQuad*_tensorSize], _tensorSize,
+		     &_workspace.initialStrainCell[iQuad*_tensorSize], _tensorSize);
   
-  topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
-  PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
-  const PetscInt soff = stateVarsVisitor.sectionOffset(cell);
-  const int stateVarsSize = numQuadPts*numVarsQuadPt;
-  assert(stateVarsSize == stateVarsVisitor.sectionDof(cell));
-  for (PetscInt d = 0; d < stateVarsSize; ++d) {
-    stateVarsArray[soff+d] = _stateVarsCell[d];
-  } // for
+  if (hasStateVars()) {
+    _storeStateVars(cell, &_workspace.stateVarsCell[0]);
+  } // if
 
   PYLITH_METHOD_END;
 } // updateStateVars
 
+// ----------------------------------------------------------------------
+// Update state variables (for next time step) for block of cells.
+void
+pylith::materials::ElasticMaterial::updateStateVarsBatch(const scalar_array& totalStrain,
+							  const PylithInt* cells,
+							  const int numCells)
+{ // updateStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(cells || 0 == numCells);
+
+  if (!hasStateVars()) {
+    PYLITH_METHOD_END;
+  } // if
+
+  const int numQuadPts = _numQuadPts;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+  const int tensorSize = _tensorSize;
+  const int numPoints = numCells*numQuadPts;
+  assert(numPoints == _numPointsBatch);
+  assert(totalStrain.size() == size_t(tensorSize*numPoints));
+
+  // Buffers for values at a quadrature point and state variables for
+  // a cell.
+  scalar_array propertiesQuadPt(numPropsQuadPt);
+  scalar_array strainQuadPt(tensorSize);
+  scalar_array initialStressQuadPt(tensorSize);
+  scalar_array initialStrainQuadPt(tensorSize);
+  scalar_array stateVarsCell(numQuadPts*numVarsQuadPt);
+
+  for (int iCell=0; iCell < numCells; ++iCell) {
+    for (int iQuad=0, iPoint=iCell*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+      for (int iProp=0; iProp < numPropsQuadPt; ++iProp) {
+	propertiesQuadPt[iProp] = _propertiesBatch[iProp*numPoints+iPoint];
+      } // for
+      PylithScalar* stateVarsQuadPt = &stateVarsCell[iQuad*numVarsQuadPt];
+      for (int iVar=0; iVar < numVarsQuadPt; ++iVar) {
+	stateVarsQuadPt[iVar] = _stateVarsBatch[iVar*numPoints+iPoint];
+      } // for
+      for (int iComp=0; iComp < tensorSize; ++iComp) {
+	strainQuadPt[iComp] = totalStrain[iComp*numPoints+iPoint];
+	initialStressQuadPt[iComp] = _initialStressBatch[iComp*numPoints+iPoint];
+	initialStrainQuadPt[iComp] = _initialStrainBatch[iComp*numPoints+iPoint];
+      } // for
+
+      _updateStateVars(stateVarsQuadPt, numVarsQuadPt,
+		       &propertiesQuadPt[0], numPropsQuadPt,
+		       &strainQuadPt[0], tensorSize,
+		       &initialStressQuadPt[0], tensorSize,
+		       &initialStrainQuadPt[0], tensorSize);
+    } // for
+
+    _storeStateVars(cells[iCell], &stateVarsCell[0]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // updateStateVarsBatch
+
 // ----------------------------------------------------------------------
 // Get stable time step for implicit time integration.
 PylithScalar
@@ -328,11 +769,11 @@ pylith::materials::ElasticMaterial::stableTimeStepImplicit(const topology::Mesh&
   const int numQuadPts = _numQuadPts;
   const int numPropsQuadPt = _numPropsQuadPt;
   const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
-  assert(_elasticConstsCell.size() == size_t(numQuadPts*_numElasticConsts));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
+  assert(_workspace.propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
+  assert(_workspace.stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
+  assert(_workspace.elasticConstsCell.size() == size_t(numQuadPts*_numElasticConsts));
+  assert(_workspace.initialStressCell.size() == size_t(numQuadPts*_tensorSize));
+  assert(_workspace.initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
 
   // Get cells associated with material
   PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
@@ -382,9 +823,9 @@ pylith::materials::ElasticMaterial::stableTimeStepImplicit(const topology::Mesh&
     retrievePropsAndVars(cell);
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
       const PylithScalar dt = 
-        _stableTimeStepImplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+        _stableTimeStepImplicit(&_workspace.propertiesCell[iQuad*numPropsQuadPt],
                                 numPropsQuadPt,
-                                &_stateVarsCell[iQuad*numVarsQuadPt],
+                                &_workspace.stateVarsCell[iQuad*numVarsQuadPt],
                                 numVarsQuadPt);
       dtStableCell[iQuad] = dt;
       if (dt < dtStable) {
@@ -413,29 +854,24 @@ PylithScalar
 pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh& mesh,
 							   feassemble::Quadrature* quadrature,
 							   topology::Field* field)
-{ // stableTimeStepImplicit
+{ // stableTimeStepExplicit
   PYLITH_METHOD_BEGIN;
 
   assert(quadrature);
 
   const int numQuadPts = _numQuadPts;
-  const int numPropsQuadPt = _numPropsQuadPt;
-  const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
-  assert(_elasticConstsCell.size() == size_t(numQuadPts*_numElasticConsts));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
 
   // Get cells associated with material
-  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
   assert(_materialIS);
   const PetscInt* cells = _materialIS->points();
   const PetscInt numCells = _materialIS->size();
 
-  // Setup field if necessary.
-  topology::VecVisitorMesh* fieldVisitor = NULL;
-  PetscScalar *fieldArray = NULL;
+  if (_dtStableExplicitCells.size() != size_t(numCells*numQuadPts)) {
+    _computeStableTimeStepExplicit(mesh, quadrature);
+  } // if
+  assert(_dtStableExplicitCells.size() == size_t(numCells*numQuadPts));
+
+  // Fill field from cache if necessary.
   if (field) {
     const int fiberDim = 1*numQuadPts;
     bool useCurrentField = false;
@@ -459,10 +895,44 @@ pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh&
     assert(_normalizer);
     field->scale(_normalizer->timeScale());
     field->vectorFieldType(topology::FieldBase::MULTI_SCALAR);
-    fieldVisitor = new topology::VecVisitorMesh(*field);assert(fieldVisitor);
-    fieldArray = fieldVisitor->localArray();
+
+    topology::VecVisitorMesh fieldVisitor(*field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt off = fieldVisitor.sectionOffset(cells[c]);
+      assert(numQuadPts == fieldVisitor.sectionDof(cells[c]));
+      for (PetscInt d = 0; d < numQuadPts; ++d) {
+        fieldArray[off+d] = _dtStableExplicitCells[c*numQuadPts+d];
+      } // for
+    } // for
   } // if
-  createPropsAndVarsVisitors();
+
+  assert(_dtStableExplicit > 0.0);
+
+  PYLITH_METHOD_RETURN(_dtStableExplicit);
+} // stableTimeStepExplicit
+
+// ----------------------------------------------------------------------
+// Compute stable time step for explicit time integration at all cells.
+void
+pylith::materials::ElasticMaterial::_computeStableTimeStepExplicit(const topology::Mesh& mesh,
+								   feassemble::Quadrature* quadrature)
+{ // _computeStableTimeStepExplicit
+  PYLITH_METHOD_BEGIN;
+
+  assert(quadrature);
+
+  const int numQuadPts = _numQuadPts;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+  assert(_workspace.propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
+  assert(_workspace.stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
+
+  // Get cells associated with material
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
 
   const int spaceDim = quadrature->spaceDim();
   const int numBasis = quadrature->numBasis();
@@ -470,8 +940,10 @@ pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh&
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
 
+  createPropsAndVarsVisitors();
+
+  _dtStableExplicitCells.resize(numCells*numQuadPts);
   PylithScalar dtStable = pylith::PYLITH_MAXSCALAR;
-  scalar_array dtStableCell(numQuadPts);
   for (PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
 
@@ -483,32 +955,23 @@ pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh&
 
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
       const PylithScalar dt = 
-	_stableTimeStepExplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+	_stableTimeStepExplicit(&_workspace.propertiesCell[iQuad*numPropsQuadPt],
 				numPropsQuadPt,
-				&_stateVarsCell[iQuad*numVarsQuadPt],
+				&_workspace.stateVarsCell[iQuad*numVarsQuadPt],
 				numVarsQuadPt,
 				minCellWidth);
-      dtStableCell[iQuad] = dt;
+      _dtStableExplicitCells[c*numQuadPts+iQuad] = dt;
       if (dt < dtStable) {
         dtStable = dt;
       } // if
     } // for
-    if (field) {
-      assert(fieldVisitor);
-      const PetscInt off = fieldVisitor->sectionOffset(cell);
-      assert(numQuadPts == fieldVisitor->sectionDof(cell));
-      for (PetscInt d = 0; d < numQuadPts; ++d) {
-        fieldArray[off+d] = dtStableCell[d];
-      } // for
-    } // if
   } // for
   destroyPropsAndVarsVisitors();
-  delete fieldVisitor; fieldVisitor = 0;
 
-  assert(dtStable > 0.0);
+  _dtStableExplicit = dtStable;
 
-  PYLITH_METHOD_RETURN(dtStable);
-} // stableTimeStepExplicit
+  PYLITH_METHOD_END;
+} // _computeStableTimeStepExplicit
 
 // ----------------------------------------------------------------------
 // Get stable time step for implicit time integration (return large value).
@@ -579,19 +1042,7 @@ pylith::materials::ElasticMaterial::_allocateCellArrays(void)
 { // _allocateCellArrays
   PYLITH_METHOD_BEGIN;
 
-  const int numQuadPts = _numQuadPts;
-  const int tensorSize = _tensorSize;
-  const int numPropsQuadPt = _numPropsQuadPt;
-  const int numVarsQuadPt = _numVarsQuadPt;
-  const int numElasticConsts = _numElasticConsts;
-
-  _propertiesCell.resize(numQuadPts * numPropsQuadPt);
-  _stateVarsCell.resize(numQuadPts * numVarsQuadPt);
-  _initialStressCell.resize(numQuadPts * tensorSize);
-  _initialStrainCell.resize(numQuadPts * tensorSize);
-  _densityCell.resize(numQuadPts);
-  _stressCell.resize(numQuadPts * tensorSize);
-  _elasticConstsCell.resize(numQuadPts * numElasticConsts);
+  initWorkspace(&_workspace);
 
   PYLITH_METHOD_END;
 } // _allocateCellArrays
@@ -863,5 +1314,148 @@ pylith::materials::ElasticMaterial::_updateStateVars(PylithScalar* const stateVa
 { // _updateStateVars
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute stress tensors for batch of points (reference implementation).
+void
+pylith::materials::ElasticMaterial::_calcStressBatch(PylithScalar* const stress,
+						     const PylithScalar* properties,
+						     const PylithScalar* stateVars,
+						     const PylithScalar* totalStrain,
+						     const PylithScalar* initialStress,
+						     const PylithScalar* initialStrain,
+						     const int numPoints,
+						     const bool computeStateVars)
+{ // _calcStressBatch
+  assert(stress);
+  assert(properties);
+  assert(stateVars || 0 == _numVarsQuadPt);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
+
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+  const int tensorSize = _tensorSize;
+
+  scalar_array stressPt(tensorSize);
+  scalar_array propertiesPt(numPropsQuadPt);
+  scalar_array stateVarsPt(numVarsQuadPt);
+  scalar_array strainPt(tensorSize);
+  scalar_array initialStressPt(tensorSize);
+  scalar_array initialStrainPt(tensorSize);
+
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numPropsQuadPt; ++i)
+      propertiesPt[i] = properties[i*numPoints+iPoint];
+    for (int i=0; i < numVarsQuadPt; ++i)
+      stateVarsPt[i] = stateVars[i*numPoints+iPoint];
+    for (int i=0; i < tensorSize; ++i) {
+      strainPt[i] = totalStrain[i*numPoints+iPoint];
+      initialStressPt[i] = initialStress[i*numPoints+iPoint];
+      initialStrainPt[i] = initialStrain[i*numPoints+iPoint];
+    } // for
+
+    _calcStress(&stressPt[0], tensorSize,
+		&propertiesPt[0], numPropsQuadPt,
+		(numVarsQuadPt > 0) ? &stateVarsPt[0] : 0, numVarsQuadPt,
+		&strainPt[0], tensorSize,
+		&initialStressPt[0], tensorSize,
+		&initialStrainPt[0], tensorSize,
+		computeStateVars);
+
+    for (int i=0; i < tensorSize; ++i)
+      stress[i*numPoints+iPoint] = stressPt[i];
+  } // for
+} // _calcStressBatch
+
+// ----------------------------------------------------------------------
+// Compute derivatives of elasticity matrix for batch of points
+// (reference implementation).
+void
+pylith::materials::ElasticMaterial::_calcElasticConstsBatch(PylithScalar* const elasticConsts,
+							    const PylithScalar* properties,
+							    const PylithScalar* stateVars,
+							    const PylithScalar* totalStrain,
+							    const PylithScalar* initialStress,
+							    const PylithScalar* initialStrain,
+							    const int numPoints)
+{ // _calcElasticConstsBatch
+  assert(elasticConsts);
+  assert(properties);
+  assert(stateVars || 0 == _numVarsQuadPt);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
+
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+  const int tensorSize = _tensorSize;
+  const int numElasticConsts = _numElasticConsts;
+
+  scalar_array elasticConstsPt(numElasticConsts);
+  scalar_array propertiesPt(numPropsQuadPt);
+  scalar_array stateVarsPt(numVarsQuadPt);
+  scalar_array strainPt(tensorSize);
+  scalar_array initialStressPt(tensorSize);
+  scalar_array initialStrainPt(tensorSize);
+
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numPropsQuadPt; ++i)
+      propertiesPt[i] = properties[i*numPoints+iPoint];
+    for (int i=0; i < numVarsQuadPt; ++i)
+      stateVarsPt[i] = stateVars[i*numPoints+iPoint];
+    for (int i=0; i < tensorSize; ++i) {
+      strainPt[i] = totalStrain[i*numPoints+iPoint];
+      initialStressPt[i] = initialStress[i*numPoints+iPoint];
+      initialStrainPt[i] = initialStrain[i*numPoints+iPoint];
+    } // for
+
+    _calcElasticConsts(&elasticConstsPt[0], numElasticConsts,
+		       &propertiesPt[0], numPropsQuadPt,
+		       (numVarsQuadPt > 0) ? &stateVarsPt[0] : 0, numVarsQuadPt,
+		       &strainPt[0], tensorSize,
+		       &initialStressPt[0], tensorSize,
+		       &initialStrainPt[0], tensorSize);
+
+    for (int i=0; i < numElasticConsts; ++i)
+      elasticConsts[i*numPoints+iPoint] = elasticConstsPt[i];
+  } // for
+} // _calcElasticConstsBatch
+
+
+// ----------------------------------------------------------------------
+// Store updated state variables for cell in state variables field.
+void
+pylith::materials::ElasticMaterial::_storeStateVars(const PylithInt cell,
+						    const PylithScalar* stateVarsCell)
+{ // _storeStateVars
+  PYLITH_METHOD_BEGIN;
+
+  assert(stateVarsCell);
+
+  const int stateVarsSize = _numQuadPts*_numVarsQuadPt;
+  if (stateVarsSinglePrecision()) {
+    _demoteStateVars(cell, stateVarsCell, stateVarsSize);
+  } else if (_stateVarsVisitor) {
+    // Reuse visitor from createPropsAndVarsVisitors().
+    PetscScalar* stateVarsArray = _stateVarsVisitor->localArray();
+    const PetscInt soff = _stateVarsVisitor->sectionOffset(cell);
+    assert(stateVarsSize == _stateVarsVisitor->sectionDof(cell));
+    for (PetscInt d = 0; d < stateVarsSize; ++d) {
+      stateVarsArray[soff+d] = stateVarsCell[d];
+    } // for
+  } else {
+    assert(_stateVars);
+    topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
+    PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
+    const PetscInt soff = stateVarsVisitor.sectionOffset(cell);
+    assert(stateVarsSize == stateVarsVisitor.sectionDof(cell));
+    for (PetscInt d = 0; d < stateVarsSize; ++d) {
+      stateVarsArray[soff+d] = stateVarsCell[d];
+    } // for
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // _storeStateVars
 
 // End of file 
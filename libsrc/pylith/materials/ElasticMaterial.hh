@@ -36,6 +36,35 @@ class pylith::materials::ElasticMaterial : public Material
 { // class ElasticMaterial
   friend class TestElasticMaterial; ///< unit testing
 
+  // PUBLIC STRUCTS /////////////////////////////////////////////////////
+public :
+
+  /** Scratch arrays for evaluating the constitutive model for a cell.
+   *
+   * The arrays for the current cell are owned by the caller, so
+   * several threads may evaluate the same material concurrently if
+   * each uses its own workspace. The methods that take a workspace
+   * do not use the PETSc function stack, and the constitutive models
+   * log flops with EventLogger::logFlops(), which is safe inside
+   * OpenMP parallel regions.
+   */
+  struct Workspace {
+    /// Properties [numQuadPts*numPropsQuadPt].
+    scalar_array propertiesCell;
+    /// State variables [numQuadPts*numVarsQuadPt].
+    scalar_array stateVarsCell;
+    /// Initial stress [numQuadPts*tensorSize].
+    scalar_array initialStressCell;
+    /// Initial strain [numQuadPts*tensorSize].
+    scalar_array initialStrainCell;
+    /// Density [numQuadPts].
+    scalar_array densityCell;
+    /// Stress tensor [numQuadPts*tensorSize].
+    scalar_array stressCell;
+    /// Elasticity constants [numQuadPts*numElasticConsts].
+    scalar_array elasticConstsCell;
+  }; // Workspace
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -160,6 +189,167 @@ public :
   const scalar_array&
   calcDerivElastic(const scalar_array& totalStrain);
 
+  /** Allocate arrays in workspace for evaluating the constitutive
+   * model for a cell.
+   *
+   * @pre Must call initialize() before calling initWorkspace().
+   *
+   * @param workspace Workspace to allocate.
+   */
+  void initWorkspace(Workspace* workspace) const;
+
+  /** Retrieve parameters for physical properties and state variables
+   * for cell into workspace.
+   *
+   * @pre Must call createPropsAndVarsVisitors() before calling
+   * retrievePropsAndVars(). Only reads from the visitors.
+   *
+   * @param workspace Workspace for cell.
+   * @param cell Finite-element cell
+   */
+  void retrievePropsAndVars(Workspace* workspace,
+			    const int cell) const;
+
+  /** Compute density for cell at quadrature points using workspace.
+   *
+   * Same as calcDensity() but all scratch data is held in the
+   * workspace, so the material is not modified.
+   *
+   * @param workspace Workspace with properties and state variables for cell.
+   *
+   * @returns Array of density values at cell's quadrature points.
+   */
+  const scalar_array& calcDensity(Workspace* workspace);
+
+  /** Get stress tensor at quadrature points using workspace.
+   *
+   * Same as calcStress() but all scratch data is held in the
+   * workspace, so the material is not modified.
+   *
+   * @param workspace Workspace with properties and state variables for cell.
+   * @param totalStrain Total strain tensor at quadrature points
+   *    [numQuadPts][tensorSize]
+   * @param computeStateVars Flag indicating to compute updated state vars.
+   *
+   * @returns Array of stresses at cell's quadrature points.
+   */
+  const scalar_array&
+  calcStress(Workspace* workspace,
+	     const scalar_array& totalStrain,
+	     const bool computeStateVars =false);
+
+  /** Compute derivative of elasticity matrix for cell at quadrature
+   * points using workspace.
+   *
+   * Same as calcDerivElastic() but all scratch data is held in the
+   * workspace, so the material is not modified.
+   *
+   * @param workspace Workspace with properties and state variables for cell.
+   * @param totalStrain Total strain tensor at quadrature points
+   *    [numQuadPts][tensorSize]
+   *
+   * @returns Array of elasticity constants at cell's quadrature points.
+   */
+  const scalar_array&
+  calcDerivElastic(Workspace* workspace,
+		   const scalar_array& totalStrain);
+
+  /** Get flag indicating whether the elasticity constants depend only
+   * on the physical properties (not on the strain, state variables,
+   * or initial stress/strain), so they can be computed once and
+   * reused every time the Jacobian is reformed.
+   *
+   * @returns True if elasticity constants are constant, false otherwise.
+   */
+  virtual
+  bool hasConstantElasticConsts(void) const;
+
+  /** Compute cache of elasticity constants at quadrature points of all
+   * cells, if it is not already current.
+   *
+   * If the physical properties are the same in every cell, only the
+   * elasticity constants for one cell are stored.
+   *
+   * @pre hasConstantElasticConsts() must be true.
+   */
+  void updateElasticConstsCache(void);
+
+  /** Get cached elasticity constants for cell at quadrature points.
+   *
+   * Does not require calling retrievePropsAndVars() and is safe to call
+   * concurrently after updateElasticConstsCache().
+   *
+   * @pre Must call updateElasticConstsCache() before calling
+   * cachedElasticConsts().
+   *
+   * @param cell Finite-element cell.
+   * @returns Array of elasticity constants [numQuadPts][numElasticConsts].
+   */
+  const PylithScalar* cachedElasticConsts(const int cell) const;
+
+  /** Get flag indicating whether material implements batched
+   * constitutive kernels (_calcStressBatch() and
+   * _calcElasticConstsBatch()) that are faster than evaluating the
+   * kernels point by point.
+   *
+   * @returns True if material has batched kernels, false otherwise.
+   */
+  virtual
+  bool hasBatchKernels(void) const;
+
+  /** Retrieve parameters for physical properties and state variables
+   * for a block of cells.
+   *
+   * Values are stored in structure-of-arrays layout for use with
+   * calcStressBatch() and calcDerivElasticBatch(). With numPoints =
+   * numCells*numQuadPts, component iComp at quadrature point iQuad of
+   * cell iCell is stored at iComp*numPoints + iCell*numQuadPts + iQuad.
+   *
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   */
+  void retrievePropsAndVarsBatch(const PylithInt* cells,
+				 const int numCells);
+
+  /** Compute density at quadrature points for block of cells.
+   *
+   * @pre Must call retrievePropsAndVarsBatch for block of cells
+   * before calling calcDensityBatch().
+   *
+   * @returns Array of density values at quadrature points [numPoints].
+   */
+  const scalar_array& calcDensityBatch(void);
+
+  /** Get stress tensor at quadrature points for block of cells.
+   *
+   * @pre Must call retrievePropsAndVarsBatch for block of cells
+   * before calling calcStressBatch().
+   *
+   * @param totalStrain Total strain tensor at quadrature points
+   *    [tensorSize][numPoints]
+   * @param computeStateVars Flag indicating to compute updated state vars.
+   *
+   * @returns Array of stresses at quadrature points [tensorSize][numPoints].
+   */
+  const scalar_array&
+  calcStressBatch(const scalar_array& totalStrain,
+		  const bool computeStateVars =false);
+
+  /** Compute derivative of elasticity matrix at quadrature points for
+   * block of cells.
+   *
+   * @pre Must call retrievePropsAndVarsBatch for block of cells
+   * before calling calcDerivElasticBatch().
+   *
+   * @param totalStrain Total strain tensor at quadrature points
+   *    [tensorSize][numPoints]
+   *
+   * @returns Array of elastic constants at quadrature points
+   *    [numElasticConsts][numPoints].
+   */
+  const scalar_array&
+  calcDerivElasticBatch(const scalar_array& totalStrain);
+
   /** Update state variables (for next time step).
    *
    * @param totalStrain Total strain tensor at quadrature points
@@ -169,6 +359,24 @@ public :
   void updateStateVars(const scalar_array& totalStrain,
 		       const int cell);
 
+  /** Update state variables (for next time step) for block of cells.
+   *
+   * Updated state variables are written directly to the state
+   * variables field using the visitor from
+   * createPropsAndVarsVisitors().
+   *
+   * @pre Must call retrievePropsAndVarsBatch for block of cells
+   * before calling updateStateVarsBatch().
+   *
+   * @param totalStrain Total strain tensor at quadrature points
+   *    [tensorSize][numPoints]
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   */
+  void updateStateVarsBatch(const scalar_array& totalStrain,
+			    const PylithInt* cells,
+			    const int numCells);
+
   /** Get flag indicating whether material implements an empty
    * _updateProperties() method.
    *
@@ -193,6 +401,11 @@ public :
    *
    * Default is MAXFLOAT (or 1.0e+30 if MAXFLOAT is not defined in math.h).
    *
+   * The stable time step at each quadrature point is computed on the
+   * first call and cached, because it depends only on the physical
+   * properties and the cell geometry. The cache is reset when the
+   * material is initialized.
+   *
    * @param mesh Finite-element mesh.
    * @param quadrature Quadrature for finite-element integration
    * @param field Field for storing min stable time step for each cell.
@@ -300,6 +513,56 @@ protected :
 			  const PylithScalar* initialStrain,
 			  const int initialStrainSize) = 0;
 
+  /** Compute stress tensors for a batch of points from properties
+   * and state variables stored in structure-of-arrays layout
+   * (component iComp of point iPt at iComp*numPoints + iPt).
+   *
+   * The default implementation evaluates _calcStress() point by
+   * point.
+   *
+   * @param stress Array for stress tensors [tensorSize][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   * @param computeStateVars Flag indicating to compute updated state variables.
+   */
+  virtual
+  void _calcStressBatch(PylithScalar* const stress,
+			const PylithScalar* properties,
+			const PylithScalar* stateVars,
+			const PylithScalar* totalStrain,
+			const PylithScalar* initialStress,
+			const PylithScalar* initialStrain,
+			const int numPoints,
+			const bool computeStateVars);
+
+  /** Compute derivatives of elasticity matrix for a batch of points
+   * from properties and state variables stored in structure-of-arrays
+   * layout (component iComp of point iPt at iComp*numPoints + iPt).
+   *
+   * The default implementation evaluates _calcElasticConsts() point
+   * by point.
+   *
+   * @param elasticConsts Array for elastic constants [numElasticConsts][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   */
+  virtual
+  void _calcElasticConstsBatch(PylithScalar* const elasticConsts,
+			       const PylithScalar* properties,
+			       const PylithScalar* stateVars,
+			       const PylithScalar* totalStrain,
+			       const PylithScalar* initialStress,
+			       const PylithScalar* initialStrain,
+			       const int numPoints);
+
   /** Update state variables (for next time step).
    *
    * @param stateVars State variables at location.
@@ -341,6 +604,9 @@ protected :
 				       const int numStateVars) const = 0;
 
   /** Get stable time step for explicit time integration.
+   *
+   * The stable time step is cached by stableTimeStepExplicit(), so it
+   * must not depend on the state variables.
    *
    * @param properties Properties at location.
    * @param numProperties Number of properties.
@@ -441,6 +707,15 @@ private :
    */
   void _allocateCellArrays(void);
 
+  /** Compute stable time step for explicit time integration at the
+   * quadrature points of all cells and store it in the cache.
+   *
+   * @param mesh Finite-element mesh.
+   * @param quadrature Quadrature for finite-element integration.
+   */
+  void _computeStableTimeStepExplicit(const topology::Mesh& mesh,
+				      feassemble::Quadrature* quadrature);
+
   /** Initialize initial stress field.
    *
    * @param mesh Finite-element mesh.
@@ -457,6 +732,14 @@ private :
   void _initializeInitialStrain(const topology::Mesh& mesh,
 				feassemble::Quadrature* quadrature);
 
+  /** Store updated state variables for cell in state variables field.
+   *
+   * @param cell Finite-element cell.
+   * @param stateVarsCell Array of state variables [numQuadPts][numVarsQuadPt].
+   */
+  void _storeStateVars(const PylithInt cell,
+		       const PylithScalar* stateVarsCell);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -469,56 +752,59 @@ private :
   /// Initial stress/strain fields.
   topology::Fields* _initialFields;
   
-  /** Properties at quadrature points for current cell.
+  /// Scratch arrays for current cell used by the single-cell
+  /// methods (retrievePropsAndVars(), calcStress(), etc.).
+  Workspace _workspace;
+
+  /** Properties at quadrature points for current block of cells.
    *
-   * size = numQuadPts * numPropsQuadPt
-   * index = iQuadPt * numPropsQuadPt + iPropQuadPt
+   * size = numPropsQuadPt * numPoints
+   * index = iPropQuadPt * numPoints + iPoint
    */
-  scalar_array _propertiesCell;
+  scalar_array _propertiesBatch;
 
-  /** State variables at quadrature points for current cell.
+  /** State variables at quadrature points for current block of cells.
    *
-   * size = numQuadPts * numVarsQuadPt
-   * index = iQuadPt * numVarsQuadPt + iStateVar
+   * size = numVarsQuadPt * numPoints
+   * index = iStateVar * numPoints + iPoint
    */
-  scalar_array _stateVarsCell;
+  scalar_array _stateVarsBatch;
 
-  /** Initial stress state for current cell.
+  /** Initial stress state for current block of cells.
    *
-   * size = numQuadPts * tensorSize
-   * index = iQuadPt * tensorSize + iComponent
+   * size = tensorSize * numPoints
+   * index = iComponent * numPoints + iPoint
    */
-  scalar_array _initialStressCell;
+  scalar_array _initialStressBatch;
 
-  /** Initial strain state for current cell.
+  /** Initial strain state for current block of cells.
    *
-   * size = numQuadPts * tensorSize
-   * index = iQuadPt * tensorSize + iComponent
+   * size = tensorSize * numPoints
+   * index = iComponent * numPoints + iPoint
    */
-  scalar_array _initialStrainCell;
+  scalar_array _initialStrainBatch;
 
-  /** Density value at quadrature points for current cell.
+  /** Density at quadrature points for current block of cells.
    *
-   * size = numQuadPts
-   * index = iQuadPt
+   * size = numPoints
+   * index = iPoint
    */
-  scalar_array _densityCell;
+  scalar_array _densityBatch;
 
-  /** Stress tensor at quadrature points for current cell.
+  /** Stress tensor at quadrature points for current block of cells.
    *
-   * size = numQuadPts * tensorSize
-   * index = iQuadPt * tensorSize + iStress
+   * size = tensorSize * numPoints
+   * index = iStress * numPoints + iPoint
    */
-  scalar_array _stressCell;
+  scalar_array _stressBatch;
 
-  /** Elasticity matrix at quadrature points for current cell.
+  /** Elasticity matrix at quadrature points for current block of cells.
    *
-   * size = numQuadPts * numElasticConsts
-   * index = iQuadPt * numElasticConsts + iConstant
+   * size = numElasticConsts * numPoints
+   * index = iConstant * numPoints + iPoint
    */
-  scalar_array _elasticConstsCell;
+  scalar_array _elasticConstsBatch;
 
-  int _numQuadPts; ///< Number of quadrature points
   const int _numElasticConsts; ///< Number of elastic constants.
 
   pylith::topology::VecVisitorMesh* _propertiesVisitor; ///< Visitor for properties field.
@@ -526,6 +812,32 @@ private :
   pylith::topology::VecVisitorMesh* _stressVisitor; ///< Visitor for initial stress field.
   pylith::topology::VecVisitorMesh* _strainVisitor; ///< Visitor for initial strain field.
 
+  int _numPointsBatch; ///< Number of points in current block of cells.
+
+  /// Elasticity constants at quadrature points of all cells (NULL if
+  /// material is homogeneous).
+  pylith::topology::Field* _elasticConstsCache;
+  pylith::topology::VecVisitorMesh* _elasticConstsCacheVisitor; ///< Visitor for cache of elasticity constants.
+
+  /** Elasticity constants at quadrature points for every cell of a
+   * homogeneous material.
+   *
+   * size = numQuadPts * numElasticConsts
+   * index = iQuadPt * numElasticConsts + iConstant
+   */
+  scalar_array _elasticConstsHomogeneous;
+
+  bool _elasticConstsCacheValid; ///< True if cache of elasticity constants is current.
+
+  /** Stable time step for explicit time integration at quadrature
+   * points of all cells (empty if not computed).
+   *
+   * size = numCells * numQuadPts
+   * index = iCell * numQuadPts + iQuadPt
+   */
+  scalar_array _dtStableExplicitCells;
+  PylithScalar _dtStableExplicit; ///< Minimum of _dtStableExplicitCells.
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
@@ -27,7 +27,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
@@ -145,7 +145,7 @@ pylith::materials::ElasticPlaneStrain::_dbToProperties(
   propValues[p_mu] = mu;
   propValues[p_lambda] = lambda;
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -168,7 +168,7 @@ pylith::materials::ElasticPlaneStrain::_nondimProperties(PylithScalar* const val
   values[p_lambda] = 
     _normalizer->nondimensionalize(values[p_lambda], pressureScale);
 
-  PetscLogFlops(3);
+  pylith::utils::EventLogger::logFlops(3);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -191,7 +191,7 @@ pylith::materials::ElasticPlaneStrain::_dimProperties(PylithScalar* const values
   values[p_lambda] = 
     _normalizer->dimensionalize(values[p_lambda], pressureScale);
 
-  PetscLogFlops(3);
+  pylith::utils::EventLogger::logFlops(3);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -255,7 +255,7 @@ pylith::materials::ElasticPlaneStrain::_calcStress(PylithScalar* const stress,
   stress[1] = s12 + mu2*e22 + initialStress[1];
   stress[2] = mu2 * e12 + initialStress[2];
 
-  PetscLogFlops(14);
+  pylith::utils::EventLogger::logFlops(14);
 } // _calcStress
 
 // ----------------------------------------------------------------------
@@ -302,9 +302,85 @@ pylith::materials::ElasticPlaneStrain::_calcElasticConsts(PylithScalar* const el
   elasticConsts[7] = 0; // C1222
   elasticConsts[8] = mu2; // C1212
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // calcElasticConsts
 
+// ----------------------------------------------------------------------
+// Compute stress tensors for batch of points from properties.
+void
+pylith::materials::ElasticPlaneStrain::_calcStressBatch(PylithScalar* const stress,
+							const PylithScalar* properties,
+							const PylithScalar* stateVars,
+							const PylithScalar* totalStrain,
+							const PylithScalar* initialStress,
+							const PylithScalar* initialStrain,
+							const int numPoints,
+							const bool computeStateVars)
+{ // _calcStressBatch
+  assert(stress);
+  assert(properties);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
+
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+
+  // Components are contiguous over points, so the loop vectorizes.
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0*mu[i];
+
+    const PylithScalar e11 = totalStrain[0*n+i] - initialStrain[0*n+i];
+    const PylithScalar e22 = totalStrain[1*n+i] - initialStrain[1*n+i];
+    const PylithScalar e12 = totalStrain[2*n+i] - initialStrain[2*n+i];
+
+    const PylithScalar s12 = lambda[i] * (e11 + e22);
+
+    stress[0*n+i] = s12 + mu2*e11 + initialStress[0*n+i];
+    stress[1*n+i] = s12 + mu2*e22 + initialStress[1*n+i];
+    stress[2*n+i] = mu2 * e12 + initialStress[2*n+i];
+  } // for
+
+  pylith::utils::EventLogger::logFlops(14*n);
+} // _calcStressBatch
+
+// ----------------------------------------------------------------------
+// Compute elastic constants for batch of points from properties.
+void
+pylith::materials::ElasticPlaneStrain::_calcElasticConstsBatch(PylithScalar* const elasticConsts,
+							       const PylithScalar* properties,
+							       const PylithScalar* stateVars,
+							       const PylithScalar* totalStrain,
+							       const PylithScalar* initialStress,
+							       const PylithScalar* initialStrain,
+							       const int numPoints)
+{ // _calcElasticConstsBatch
+  assert(elasticConsts);
+  assert(properties);
+
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0 * mu[i];
+    const PylithScalar lambda2mu = lambda[i] + mu2;
+
+    elasticConsts[0*n+i] = lambda2mu; // C1111
+    elasticConsts[1*n+i] = lambda[i]; // C1122
+    elasticConsts[2*n+i] = 0; // C1112
+    elasticConsts[3*n+i] = lambda[i]; // C2211
+    elasticConsts[4*n+i] = lambda2mu; // C2222
+    elasticConsts[5*n+i] = 0; // C2212
+    elasticConsts[6*n+i] = 0; // C1211
+    elasticConsts[7*n+i] = 0; // C1222
+    elasticConsts[8*n+i] = mu2; // C1212
+  } // for
+
+  pylith::utils::EventLogger::logFlops(2*n);
+} // _calcElasticConstsBatch
+
 // ----------------------------------------------------------------------
 // Get stable time step for implicit time integration.
 PylithScalar
@@ -313,6 +389,24 @@ pylith::materials::ElasticPlaneStrain::stableTimeStepImplicit(const topology::Me
   return ElasticMaterial::_stableTimeStepImplicitMax(mesh, field);
 }
 
+// ----------------------------------------------------------------------
+// Get flag indicating whether material implements batched
+// constitutive kernels.
+bool
+pylith::materials::ElasticPlaneStrain::hasBatchKernels(void) const
+{ // hasBatchKernels
+  return true;
+} // hasBatchKernels
+
+// ----------------------------------------------------------------------
+// Get flag indicating whether elasticity constants depend only on
+// physical properties.
+bool
+pylith::materials::ElasticPlaneStrain::hasConstantElasticConsts(void) const
+{ // hasConstantElasticConsts
+  return true;
+} // hasConstantElasticConsts
+
 // ----------------------------------------------------------------------
 // Get stable time step for implicit time integration.
 PylithScalar
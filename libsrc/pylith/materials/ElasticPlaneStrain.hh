@@ -66,6 +66,20 @@ public :
   PylithScalar stableTimeStepImplicit(const topology::Mesh& mesh,
 				      topology::Field* field =0);
 
+  /** Get flag indicating whether material implements batched
+   * constitutive kernels.
+   *
+   * @returns True.
+   */
+  bool hasBatchKernels(void) const;
+
+  /** Get flag indicating whether elasticity constants depend only on
+   * physical properties.
+   *
+   * @returns True.
+   */
+  bool hasConstantElasticConsts(void) const;
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -170,6 +184,46 @@ protected :
 			  const PylithScalar* initialStrain,
 			  const int initialStrainSize);
 
+  /** Compute stress tensors for a batch of points from properties
+   * stored in structure-of-arrays layout.
+   *
+   * @param stress Array for stress tensors [tensorSize][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   * @param computeStateVars Flag indicating to compute updated state variables.
+   */
+  void _calcStressBatch(PylithScalar* const stress,
+			const PylithScalar* properties,
+			const PylithScalar* stateVars,
+			const PylithScalar* totalStrain,
+			const PylithScalar* initialStress,
+			const PylithScalar* initialStrain,
+			const int numPoints,
+			const bool computeStateVars);
+
+  /** Compute derivatives of elasticity matrix for a batch of points
+   * from properties stored in structure-of-arrays layout.
+   *
+   * @param elasticConsts Array for elastic constants [numElasticConsts][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   */
+  void _calcElasticConstsBatch(PylithScalar* const elasticConsts,
+			       const PylithScalar* properties,
+			       const PylithScalar* stateVars,
+			       const PylithScalar* totalStrain,
+			       const PylithScalar* initialStress,
+			       const PylithScalar* initialStrain,
+			       const int numPoints);
+
   /** Get stable time step for implicit time integration.
    *
    * @param properties Properties at location.
@@ -27,7 +27,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
@@ -145,7 +145,7 @@ pylith::materials::ElasticPlaneStress::_dbToProperties(
   propValues[p_mu] = mu;
   propValues[p_lambda] = lambda;
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -168,7 +168,7 @@ pylith::materials::ElasticPlaneStress::_nondimProperties(PylithScalar* const val
   values[p_lambda] = 
     _normalizer->nondimensionalize(values[p_lambda], pressureScale);
 
-  PetscLogFlops(3);
+  pylith::utils::EventLogger::logFlops(3);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -191,7 +191,7 @@ pylith::materials::ElasticPlaneStress::_dimProperties(PylithScalar* const values
   values[p_lambda] = 
     _normalizer->dimensionalize(values[p_lambda], pressureScale);
 
-  PetscLogFlops(3);
+  pylith::utils::EventLogger::logFlops(3);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -257,7 +257,7 @@ pylith::materials::ElasticPlaneStress::_calcStress(PylithScalar* const stress,
     (mu2*lambda * e11 + 2.0*mu2*lambdamu * e22) / lambda2mu + initialStress[1];
   stress[2] = mu2 * e12 + initialStress[2];
 
-  PetscLogFlops(21);
+  pylith::utils::EventLogger::logFlops(21);
 } // _calcStress
 
 // ----------------------------------------------------------------------
@@ -306,7 +306,7 @@ pylith::materials::ElasticPlaneStress::_calcElasticConsts(
   elasticConsts[7] = 0; // C1222
   elasticConsts[8] = mu2; // C1212
 
-  PetscLogFlops(8);
+  pylith::utils::EventLogger::logFlops(8);
 } // calcElasticConsts
 
 // ----------------------------------------------------------------------
@@ -317,6 +317,15 @@ pylith::materials::ElasticPlaneStress::stableTimeStepImplicit(const topology::Me
   return ElasticMaterial::_stableTimeStepImplicitMax(mesh, field);
 }
 
+// ----------------------------------------------------------------------
+// Get flag indicating whether elasticity constants depend only on
+// physical properties.
+bool
+pylith::materials::ElasticPlaneStress::hasConstantElasticConsts(void) const
+{ // hasConstantElasticConsts
+  return true;
+} // hasConstantElasticConsts
+
 // ----------------------------------------------------------------------
 // Get stable time step for implicit time integration.
 PylithScalar
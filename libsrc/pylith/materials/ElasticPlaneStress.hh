@@ -68,6 +68,13 @@ public :
   PylithScalar stableTimeStepImplicit(const topology::Mesh& mesh,
 				      topology::Field* field =0);
 
+  /** Get flag indicating whether elasticity constants depend only on
+   * physical properties.
+   *
+   * @returns True.
+   */
+  bool hasConstantElasticConsts(void) const;
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
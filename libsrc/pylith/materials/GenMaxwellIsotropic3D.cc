@@ -28,7 +28,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
@@ -199,7 +199,6 @@ pylith::materials::GenMaxwellIsotropic3D::GenMaxwellIsotropic3D(void) :
   _updateStateVarsFn(0)  
 { // constructor
   useElasticBehavior(false);
-  _viscousStrain.resize(_GenMaxwellIsotropic3D::numMaxwellModels*_tensorSize);
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -213,6 +212,8 @@ pylith::materials::GenMaxwellIsotropic3D::~GenMaxwellIsotropic3D(void)
 void
 pylith::materials::GenMaxwellIsotropic3D::useElasticBehavior(const bool flag)
 { // useElasticBehavior
+  ElasticMaterial::useElasticBehavior(flag);
+
   if (flag) {
     _calcStressFn = 
       &pylith::materials::GenMaxwellIsotropic3D::_calcStressElastic;
@@ -309,7 +310,7 @@ pylith::materials::GenMaxwellIsotropic3D::_dbToProperties(
     propValues[p_maxwellTime + imodel] = maxwellTime;
   } // for
 
-  PetscLogFlops(6 + 3 * numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(6 + 3 * numMaxwellModels);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -335,7 +336,7 @@ pylith::materials::GenMaxwellIsotropic3D::_nondimProperties(PylithScalar* const
   _normalizer->nondimensionalize(&values[p_maxwellTime],
 				 numMaxwellModels, timeScale);
   
-  PetscLogFlops(3+1*numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(3+1*numMaxwellModels);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -361,7 +362,7 @@ pylith::materials::GenMaxwellIsotropic3D::_dimProperties(PylithScalar* const val
   _normalizer->dimensionalize(&values[p_maxwellTime],
 			      numMaxwellModels, timeScale);
 
-  PetscLogFlops(3+1*numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(3+1*numMaxwellModels);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -382,7 +383,7 @@ pylith::materials::GenMaxwellIsotropic3D::_dbToStateVars(
   for (int i=0; i < totalSize; ++i)
     stateValues[i] = dbValues[i];
 
-  PetscLogFlops(0);
+  pylith::utils::EventLogger::logFlops(0);
 } // _dbToStateVars
 
 // ----------------------------------------------------------------------
@@ -454,7 +455,7 @@ pylith::materials::GenMaxwellIsotropic3D::_calcStressElastic(
   stress[4] = mu2 * e23 + initialStress[4];
   stress[5] = mu2 * e13 + initialStress[5];
 
-  PetscLogFlops(25);
+  pylith::utils::EventLogger::logFlops(25);
 } // _calcStressElastic
 
 
@@ -491,7 +492,8 @@ pylith::materials::GenMaxwellIsotropic3D::_calcStressViscoelastic(
   assert(_GenMaxwellIsotropic3D::tensorSize == initialStrainSize);
 
   const int numMaxwellModels = _GenMaxwellIsotropic3D::numMaxwellModels;
-  const int tensorSize = _tensorSize;
+  const int tensorSize = _GenMaxwellIsotropic3D::tensorSize;
+  assert(_tensorSize == tensorSize);
 
   const PylithScalar mu = properties[p_muEff];
   const PylithScalar lambda = properties[p_lambdaEff];
@@ -532,24 +534,25 @@ pylith::materials::GenMaxwellIsotropic3D::_calcStressViscoelastic(
   assert(visFrac <= 1.0);
   const PylithScalar elasFrac = 1.0 - visFrac;
 
-  PetscLogFlops(23 + numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(23 + numMaxwellModels);
 
-  // Get viscous strains
+  // Get viscous strains. Viscous strains for the Maxwell models are
+  // contiguous in the state variables, so we use them in place if
+  // they do not need to be computed.
+  PylithScalar viscousStrainTpdt[numMaxwellModels*tensorSize];
+  const PylithScalar* viscousStrain = &stateVars[s_viscousStrain1];
   if (computeStateVars) {
-    _computeStateVars(stateVars, numStateVars,
+    PylithScalar decay[numMaxwellModels];
+    PylithScalar dq[numMaxwellModels];
+    _maxwellFactors(decay, dq, properties);
+    _computeStateVars(viscousStrainTpdt, decay, dq,
+		      stateVars, numStateVars,
 		      properties, numProperties,
 		      totalStrain, strainSize,
 		      initialStress, initialStressSize,
 		      initialStrain, initialStrainSize);
-  } else {
-    int index = 0;
-    for (int iComp=0; iComp < tensorSize; ++iComp)
-      _viscousStrain[index++] = stateVars[s_viscousStrain1+iComp];
-    for (int iComp=0; iComp < tensorSize; ++iComp)
-      _viscousStrain[index++] = stateVars[s_viscousStrain2+iComp];
-    for (int iComp=0; iComp < tensorSize; ++iComp)
-      _viscousStrain[index++] = stateVars[s_viscousStrain3+iComp];
-  } // else
+    viscousStrain = viscousStrainTpdt;
+  } // if
 
   // Compute new stresses
   PylithScalar devStrainTpdt = 0.0;
@@ -560,14 +563,14 @@ pylith::materials::GenMaxwellIsotropic3D::_calcStressViscoelastic(
     devStressTpdt = elasFrac * devStrainTpdt;
     for (int model=0; model < numMaxwellModels; ++model) {
       devStressTpdt += muRatio[model] *
-	_viscousStrain[model * tensorSize+iComp];
+	viscousStrain[model * tensorSize+iComp];
     } // for
 
     devStressTpdt = mu2 * devStressTpdt;
     stress[iComp] = diag[iComp] * meanStressTpdt + devStressTpdt;
   } // for
 
-  PetscLogFlops((9 + 3 * numMaxwellModels) * tensorSize);
+  pylith::utils::EventLogger::logFlops((9 + 3 * numMaxwellModels) * tensorSize);
 } // _calcStressViscoelastic
 
 // ----------------------------------------------------------------------
@@ -643,7 +646,7 @@ pylith::materials::GenMaxwellIsotropic3D::_calcElasticConstsElastic(
   elasticConsts[34] = 0; // C1323
   elasticConsts[35] = mu2; // C1313
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // _calcElasticConstsElastic
 
 // ----------------------------------------------------------------------
@@ -685,18 +688,15 @@ pylith::materials::GenMaxwellIsotropic3D::_calcElasticConstsViscoelastic(
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
   // Compute viscous contribution.
+  PylithScalar decay[numMaxwellModels];
+  PylithScalar dq[numMaxwellModels];
+  _maxwellFactors(decay, dq, properties);
   PylithScalar visFac = 0.0;
   PylithScalar visFrac = 0.0;
-  PylithScalar shearRatio = 0.0;
   for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
-    shearRatio = properties[p_shearRatio + imodel];
-    PylithScalar maxwellTime = pylith::PYLITH_MAXSCALAR;
+    const PylithScalar shearRatio = properties[p_shearRatio + imodel];
     visFrac += shearRatio;
-    if (shearRatio != 0.0) {
-      maxwellTime = properties[p_maxwellTime + imodel];
-      visFac +=
-	shearRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-    } // if
+    visFac += shearRatio*dq[imodel];
   } // for
   PylithScalar elasFrac = 1.0 - visFrac;
   PylithScalar shearFac = elasFrac + visFac;
@@ -748,7 +748,7 @@ pylith::materials::GenMaxwellIsotropic3D::_calcElasticConstsViscoelastic(
   std::cout << elasticConsts[20] << std::endl;
 #endif
 
-  PetscLogFlops(8 + 2 * numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(8 + 2 * numMaxwellModels);
 } // _calcElasticConstsViscoelastic
 
 // ----------------------------------------------------------------------
@@ -805,7 +805,7 @@ pylith::materials::GenMaxwellIsotropic3D::_updateStateVarsElastic(
     // Maxwell model 3
     stateVars[s_viscousStrain3+iComp] = devStrain;
   } // for
-  PetscLogFlops(9 + 2 * tensorSize);
+  pylith::utils::EventLogger::logFlops(9 + 2 * tensorSize);
 
   _needNewJacobian = true;
 } // _updateStateVarsElastic
@@ -836,27 +836,25 @@ pylith::materials::GenMaxwellIsotropic3D::_updateStateVarsViscoelastic(
   assert(0 != initialStrain);
   assert(_GenMaxwellIsotropic3D::tensorSize == initialStrainSize);
 
-  _computeStateVars(stateVars, numStateVars,
+  const int numMaxwellModels = _GenMaxwellIsotropic3D::numMaxwellModels;
+  const int tensorSize = _GenMaxwellIsotropic3D::tensorSize;
+
+  // Viscous strains are updated in place, so they must be computed
+  // before the total strain is updated.
+  PylithScalar decay[numMaxwellModels];
+  PylithScalar dq[numMaxwellModels];
+  _maxwellFactors(decay, dq, properties);
+  _computeStateVars(&stateVars[s_viscousStrain1], decay, dq,
+		    stateVars, numStateVars,
 		    properties, numProperties,
 		    totalStrain, strainSize,
 		    initialStress, initialStressSize,
 		    initialStrain, initialStrainSize);
 
-  const int tensorSize = _tensorSize;
-
   // Total strain
   for (int iComp=0; iComp < tensorSize; ++iComp)
     stateVars[s_totalStrain+iComp] = totalStrain[iComp];
 
-  // Viscous strain
-  int index = 0;
-  for (int iComp=0; iComp < tensorSize; ++iComp)
-    stateVars[s_viscousStrain1+iComp] = _viscousStrain[index++];
-  for (int iComp=0; iComp < tensorSize; ++iComp)
-    stateVars[s_viscousStrain2+iComp] = _viscousStrain[index++];
-  for (int iComp=0; iComp < tensorSize; ++iComp)
-    stateVars[s_viscousStrain3+iComp] = _viscousStrain[index++];
-
   _needNewJacobian = false;
 } // _updateStateVarsViscoelastic
 
@@ -911,10 +909,40 @@ pylith::materials::GenMaxwellIsotropic3D::_stableTimeStepExplicit(const PylithSc
 } // _stableTimeStepExplicit
 
 
+// ----------------------------------------------------------------------
+// Compute decay factors and viscous strain parameters for Maxwell models.
+void
+pylith::materials::GenMaxwellIsotropic3D::_maxwellFactors(PylithScalar decay[],
+							  PylithScalar dq[],
+							  const PylithScalar* properties) const
+{ // _maxwellFactors
+  assert(decay);
+  assert(dq);
+  assert(properties);
+
+  const int numMaxwellModels = _GenMaxwellIsotropic3D::numMaxwellModels;
+
+  // Maxwell models with a zero shear ratio do not contribute viscous
+  // strain, so we zero their factors.
+  PylithScalar maxwellTime[numMaxwellModels];
+  for (int i=0; i < numMaxwellModels; ++i)
+    maxwellTime[i] = (0.0 != properties[p_shearRatio+i]) ?
+      properties[p_maxwellTime+i] : pylith::PYLITH_MAXSCALAR;
+  ViscoelasticMaxwell::decayFactors<numMaxwellModels>(decay, dq, _dt, maxwellTime);
+  for (int i=0; i < numMaxwellModels; ++i)
+    if (0.0 == properties[p_shearRatio+i]) {
+      decay[i] = 0.0;
+      dq[i] = 0.0;
+    } // if
+} // _maxwellFactors
+
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
 void
 pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
+					       PylithScalar* const viscousStrain,
+					       const PylithScalar* decay,
+					       const PylithScalar* dq,
 					       const PylithScalar* stateVars,
 					       const int numStateVars,
 					       const PylithScalar* properties,
@@ -926,6 +954,9 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
 					       const PylithScalar* initialStrain,
 					       const int initialStrainSize)
 { // _computeStateVars
+  assert(0 != viscousStrain);
+  assert(0 != decay);
+  assert(0 != dq);
   assert(0 != stateVars);
   assert(_numVarsQuadPt == numStateVars);
   assert(0 != properties);
@@ -937,20 +968,9 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
   assert(0 != initialStrain);
   assert(_GenMaxwellIsotropic3D::tensorSize == initialStrainSize);
 
-  const int tensorSize = _tensorSize;
+  const int tensorSize = _GenMaxwellIsotropic3D::tensorSize;
   const int numMaxwellModels = _GenMaxwellIsotropic3D::numMaxwellModels;
 
-  const PylithScalar muRatio[numMaxwellModels] = {
-    properties[p_shearRatio  ],
-    properties[p_shearRatio+1],
-    properties[p_shearRatio+2]
-  };
-  const PylithScalar maxwellTime[numMaxwellModels] = {
-    properties[p_maxwellTime  ],
-    properties[p_maxwellTime+1],
-    properties[p_maxwellTime+2]
-  };
-
   // :TODO: Need to account for initial values for state variables
   const PylithScalar meanStrainTpdt =
     (totalStrain[0] + totalStrain[1] + totalStrain[2])/3.0;
@@ -961,55 +981,21 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
       stateVars[s_totalStrain+1] +
       stateVars[s_totalStrain+2] ) / 3.0;
   
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 
-  // Compute Prony series terms
-  scalar_array dq(numMaxwellModels);
-  dq = 0.0;
-  for (int i=0; i < numMaxwellModels; ++i)
-    if (muRatio[i] != 0.0)
-      dq[i] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
-
-  // Compute new viscous strains
-  PylithScalar devStrainTpdt = 0.0;
-  PylithScalar devStrainT = 0.0;
-  PylithScalar deltaStrain = 0.0;
-  
+  // Compute increment in deviatoric strain, which is the same for
+  // all of the Maxwell models.
+  PylithScalar deltaStrain[tensorSize];
   for (int iComp=0; iComp < tensorSize; ++iComp) {
-    devStrainTpdt = totalStrain[iComp] - diag[iComp] * meanStrainTpdt;
-    devStrainT = stateVars[s_totalStrain+iComp] - diag[iComp] * meanStrainT;
-    deltaStrain = devStrainTpdt - devStrainT;
-
-    // Maxwell model 1
-    int imodel = 0;
-    if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * tensorSize+iComp] = 
-	exp(-_dt/maxwellTime[imodel]) *
-	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
-    } // if
-
-    // Maxwell model 2
-    imodel = 1;
-    if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
-	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
-    } // if
-
-    // Maxwell model 3
-    imodel = 2;
-    if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
-	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
-    } // if
-
+    const PylithScalar devStrainTpdt = totalStrain[iComp] - diag[iComp] * meanStrainTpdt;
+    const PylithScalar devStrainT = stateVars[s_totalStrain+iComp] - diag[iComp] * meanStrainT;
+    deltaStrain[iComp] = devStrainTpdt - devStrainT;
   } // for
+  pylith::utils::EventLogger::logFlops(5 * tensorSize);
 
-  PetscLogFlops(5 * tensorSize);
+  // Compute new viscous strains for all Maxwell models. Viscous
+  // strains for the models are contiguous in the state variables.
+  ViscoelasticMaxwell::viscousStrains<numMaxwellModels, tensorSize>(viscousStrain, &stateVars[s_viscousStrain1], decay, dq, deltaStrain);
 } // _computeStateVars
 
 
@@ -462,9 +462,27 @@ private :
 				    const PylithScalar* initialStrain,
 				    const int initialStrainSize);
 
+  /** Compute decay factors and viscous strain parameters for the
+   * Maxwell models at a location.
+   *
+   * Factors for Maxwell models with a zero shear ratio are zero.
+   *
+   * @param decay Decay factors, exp(-dt/maxwellTime) [numMaxwellModels].
+   * @param dq Viscous strain parameters [numMaxwellModels].
+   * @param properties Properties at location.
+   */
+  void _maxwellFactors(PylithScalar decay[],
+		       PylithScalar dq[],
+		       const PylithScalar* properties) const;
+
   /** Compute viscous strains (state variables) for the current time
    * step.
    *
+   * The viscous strains may be computed in place in the state variables.
+   *
+   * @param viscousStrain Array for viscous strains [numMaxwellModels*tensorSize].
+   * @param decay Decay factors from _maxwellFactors() [numMaxwellModels].
+   * @param dq Viscous strain parameters from _maxwellFactors() [numMaxwellModels].
    * @param stateVars State variables at location.
    * @param numStateVars Number of state variables.
    * @param properties Properties at location.
@@ -476,7 +494,10 @@ private :
    * @param initialStrain Initial strain tensor at location.
    * @param initialStrainSize Size of initial strain array.
    */
-  void _computeStateVars(const PylithScalar* stateVars,
+  void _computeStateVars(PylithScalar* const viscousStrain,
+			 const PylithScalar* decay,
+			 const PylithScalar* dq,
+			 const PylithScalar* stateVars,
 			 const int numStateVars,
 			 const PylithScalar* properties,
 			 const int numProperties,
@@ -490,9 +511,6 @@ private :
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
-  /// Viscous strain array.
-  scalar_array _viscousStrain;
-
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
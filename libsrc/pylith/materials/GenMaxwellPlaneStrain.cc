@@ -28,7 +28,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
@@ -194,7 +194,6 @@ pylith::materials::GenMaxwellPlaneStrain::GenMaxwellPlaneStrain(void) :
   _updateStateVarsFn(0)  
 { // constructor
   useElasticBehavior(false);
-  _viscousStrain.resize(_GenMaxwellPlaneStrain::numMaxwellModels * 4);
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -208,6 +207,8 @@ pylith::materials::GenMaxwellPlaneStrain::~GenMaxwellPlaneStrain(void)
 void
 pylith::materials::GenMaxwellPlaneStrain::useElasticBehavior(const bool flag)
 { // useElasticBehavior
+  ElasticMaterial::useElasticBehavior(flag);
+
   if (flag) {
     _calcStressFn = 
       &pylith::materials::GenMaxwellPlaneStrain::_calcStressElastic;
@@ -304,7 +305,7 @@ pylith::materials::GenMaxwellPlaneStrain::_dbToProperties(
     propValues[p_maxwellTime + imodel] = maxwellTime;
   } // for
 
-  PetscLogFlops(6 + 3 * numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(6 + 3 * numMaxwellModels);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -330,7 +331,7 @@ pylith::materials::GenMaxwellPlaneStrain::_nondimProperties(PylithScalar* const
   _normalizer->nondimensionalize(&values[p_maxwellTime],
 				 numMaxwellModels, timeScale);
   
-  PetscLogFlops(3 + 1 * numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(3 + 1 * numMaxwellModels);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -356,7 +357,7 @@ pylith::materials::GenMaxwellPlaneStrain::_dimProperties(PylithScalar* const val
   _normalizer->dimensionalize(&values[p_maxwellTime],
 			      numMaxwellModels, timeScale);
 
-  PetscLogFlops(3 + 1 * numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(3 + 1 * numMaxwellModels);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -377,7 +378,7 @@ pylith::materials::GenMaxwellPlaneStrain::_dbToStateVars(
   for (int i=0; i < totalSize; ++i)
     stateValues[i] = dbValues[i];
 
-  PetscLogFlops(0);
+  pylith::utils::EventLogger::logFlops(0);
 } // _dbToStateVars
 
 // ----------------------------------------------------------------------
@@ -394,7 +395,7 @@ pylith::materials::GenMaxwellPlaneStrain::_nondimStateVars(
   const PylithScalar pressureScale = _normalizer->pressureScale();
   _normalizer->nondimensionalize(&values[s_stressZZInitial], 1, pressureScale);
 
-  PetscLogFlops(1);
+  pylith::utils::EventLogger::logFlops(1);
 } // _nondimStateVars
 
 // ----------------------------------------------------------------------
@@ -411,7 +412,7 @@ pylith::materials::GenMaxwellPlaneStrain::_dimStateVars(
   const PylithScalar pressureScale = _normalizer->pressureScale();
   _normalizer->dimensionalize(&values[s_stressZZInitial], 1, pressureScale);
 
-  PetscLogFlops(1);
+  pylith::utils::EventLogger::logFlops(1);
 } // _dimStateVars
 
 // ----------------------------------------------------------------------
@@ -477,7 +478,7 @@ pylith::materials::GenMaxwellPlaneStrain::_calcStressElastic(
   stress[1] = s12 + mu2 * e22 + initialStress[1];
   stress[2] = mu2 * e12 + initialStress[2];
 
-  PetscLogFlops(14);
+  pylith::utils::EventLogger::logFlops(14);
 } // _calcStressElastic
 
 
@@ -549,11 +550,13 @@ pylith::materials::GenMaxwellPlaneStrain::_calcStressViscoelastic(
   assert(visFrac <= 1.0);
   const PylithScalar elasFrac = 1.0 - visFrac;
 
-  PetscLogFlops(18 + numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(18 + numMaxwellModels);
 
   // Get viscous strains
+  PylithScalar viscousStrain[_GenMaxwellPlaneStrain::numMaxwellModels*4] = { 0.0 };
   if (computeStateVars) {
-    _computeStateVars(stateVars, numStateVars,
+    _computeStateVars(viscousStrain,
+		      stateVars, numStateVars,
 		      properties, numProperties,
 		      totalStrain, strainSize,
 		      initialStress, initialStressSize,
@@ -561,11 +564,11 @@ pylith::materials::GenMaxwellPlaneStrain::_calcStressViscoelastic(
   } else {
     int index = 0;
     for (int iComp=0; iComp < 4; ++iComp)
-      _viscousStrain[index++] = stateVars[s_viscousStrain1+iComp];
+      viscousStrain[index++] = stateVars[s_viscousStrain1+iComp];
     for (int iComp=0; iComp < 4; ++iComp)
-      _viscousStrain[index++] = stateVars[s_viscousStrain2+iComp];
+      viscousStrain[index++] = stateVars[s_viscousStrain2+iComp];
     for (int iComp=0; iComp < 4; ++iComp)
-      _viscousStrain[index++] = stateVars[s_viscousStrain3+iComp];
+      viscousStrain[index++] = stateVars[s_viscousStrain3+iComp];
   } // else
 
   // Compute new stresses
@@ -578,14 +581,14 @@ pylith::materials::GenMaxwellPlaneStrain::_calcStressViscoelastic(
     devStressTpdt = elasFrac * devStrainTpdt;
     for (int model=0; model < numMaxwellModels; ++model) {
       devStressTpdt += muRatio[model] *
-	_viscousStrain[4 * model + visIndex[iComp]];
+	viscousStrain[4 * model + visIndex[iComp]];
     } // for
 
     devStressTpdt = mu2 * devStressTpdt;
     stress[iComp] = diag[iComp] * meanStressTpdt + devStressTpdt;
   } // for
 
-  PetscLogFlops((9 + 2 * numMaxwellModels) * tensorSize);
+  pylith::utils::EventLogger::logFlops((9 + 2 * numMaxwellModels) * tensorSize);
 } // _calcStressViscoelastic
 
 // ----------------------------------------------------------------------
@@ -634,7 +637,7 @@ pylith::materials::GenMaxwellPlaneStrain::_calcElasticConstsElastic(
   elasticConsts[ 7] = 0; // C1222
   elasticConsts[ 8] = mu2; // C1212
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // _calcElasticConstsElastic
 
 // ----------------------------------------------------------------------
@@ -702,7 +705,7 @@ pylith::materials::GenMaxwellPlaneStrain::_calcElasticConstsViscoelastic(
   elasticConsts[ 7] = 0; // C1222
   elasticConsts[ 8] = 2.0 * mu * shearFac; // C1212
 
-  PetscLogFlops(15 + 3 * numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(15 + 3 * numMaxwellModels);
 } // _calcElasticConstsViscoelastic
 
 // ----------------------------------------------------------------------
@@ -756,7 +759,7 @@ pylith::materials::GenMaxwellPlaneStrain::_updateStateVarsElastic(
     // Maxwell model 3
     stateVars[s_viscousStrain3+iComp] = devStrain;
   } // for
-  PetscLogFlops(5 + 2 * 4);
+  pylith::utils::EventLogger::logFlops(5 + 2 * 4);
 
   _needNewJacobian = true;
 } // _updateStateVarsElastic
@@ -787,7 +790,9 @@ pylith::materials::GenMaxwellPlaneStrain::_updateStateVarsViscoelastic(
   assert(0 != initialStrain);
   assert(_GenMaxwellPlaneStrain::tensorSize == initialStrainSize);
 
-  _computeStateVars(stateVars, numStateVars,
+  PylithScalar viscousStrain[_GenMaxwellPlaneStrain::numMaxwellModels*4] = { 0.0 };
+  _computeStateVars(viscousStrain,
+		    stateVars, numStateVars,
 		    properties, numProperties,
 		    totalStrain, strainSize,
 		    initialStress, initialStressSize,
@@ -802,11 +807,11 @@ pylith::materials::GenMaxwellPlaneStrain::_updateStateVarsViscoelastic(
   // Viscous strain
   int index = 0;
   for (int iComp=0; iComp < 4; ++iComp)
-    stateVars[s_viscousStrain1+iComp] = _viscousStrain[index++];
+    stateVars[s_viscousStrain1+iComp] = viscousStrain[index++];
   for (int iComp=0; iComp < 4; ++iComp)
-    stateVars[s_viscousStrain2+iComp] = _viscousStrain[index++];
+    stateVars[s_viscousStrain2+iComp] = viscousStrain[index++];
   for (int iComp=0; iComp < 4; ++iComp)
-    stateVars[s_viscousStrain3+iComp] = _viscousStrain[index++];
+    stateVars[s_viscousStrain3+iComp] = viscousStrain[index++];
 
   _needNewJacobian = false;
 } // _updateStateVarsViscoelastic
@@ -867,6 +872,7 @@ pylith::materials::GenMaxwellPlaneStrain::_stableTimeStepExplicit(const PylithSc
 // Compute viscous strain for current time step.
 void
 pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
+					       PylithScalar* const viscousStrain,
 					       const PylithScalar* stateVars,
 					       const int numStateVars,
 					       const PylithScalar* properties,
@@ -916,7 +922,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
 
   const PylithScalar diag[] = { 1.0, 1.0, 1.0, 0.0 };
 
-  PetscLogFlops(4);
+  pylith::utils::EventLogger::logFlops(4);
 
   // Compute Prony series terms
   scalar_array dq(numMaxwellModels);
@@ -938,30 +944,30 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 1
     int imodel = 0;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
 	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
+      pylith::utils::EventLogger::logFlops(6);
     } // if
 
     // Maxwell model 2
     imodel = 1;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
 	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
+      pylith::utils::EventLogger::logFlops(6);
     } // if
 
     // Maxwell model 3
     imodel = 2;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
 	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
-      PetscLogFlops(6);
+      pylith::utils::EventLogger::logFlops(6);
     } // if
 
   } // for
 
-  PetscLogFlops(5 * 4);
+  pylith::utils::EventLogger::logFlops(5 * 4);
 } // _computeStateVars
 
 
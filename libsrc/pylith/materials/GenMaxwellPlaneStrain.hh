@@ -475,6 +475,7 @@ private :
   /** Compute viscous strains (state variables) for the current time
    * step.
    *
+   * @param viscousStrain Array for viscous strains [numMaxwellModels*4].
    * @param stateVars State variables at location.
    * @param numStateVars Number of state variables.
    * @param properties Properties at location.
@@ -486,7 +487,8 @@ private :
    * @param initialStrain Initial strain tensor at location.
    * @param initialStrainSize Size of initial strain array.
    */
-  void _computeStateVars(const PylithScalar* stateVars,
+  void _computeStateVars(PylithScalar* const viscousStrain,
+			 const PylithScalar* stateVars,
 			 const int numStateVars,
 			 const PylithScalar* properties,
 			 const int numProperties,
@@ -500,9 +502,6 @@ private :
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
-  /// Viscous strain array.
-  scalar_array _viscousStrain;
-
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
@@ -28,7 +28,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
@@ -239,8 +239,6 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::GenMaxwellQpQsIsotropic3D(void) :
   _updateStateVarsFn(0)  
 { // constructor
   useElasticBehavior(false);
-  _viscousDevStrain.resize(_GenMaxwellQpQsIsotropic3D::numMaxwellModels*_tensorSize);
-  _viscousMeanStrain.resize(_GenMaxwellQpQsIsotropic3D::numMaxwellModels);
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -254,6 +252,8 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::~GenMaxwellQpQsIsotropic3D(void)
 void
 pylith::materials::GenMaxwellQpQsIsotropic3D::useElasticBehavior(const bool flag)
 { // useElasticBehavior
+  ElasticMaterial::useElasticBehavior(flag);
+
   if (flag) {
     _calcStressFn = 
       &pylith::materials::GenMaxwellQpQsIsotropic3D::_calcStressElastic;
@@ -371,7 +371,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_dbToProperties(
     propValues[p_maxwellTimeBulk + imodel] = maxwellTimeBulk;
   } // for
 
-  PetscLogFlops(6+2*numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(6+2*numMaxwellModels);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -401,7 +401,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_nondimProperties(PylithScalar* co
   _normalizer->nondimensionalize(&values[p_maxwellTimeBulk],
 				 numMaxwellModels, timeScale);
   
-  PetscLogFlops(3+2*numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(3+2*numMaxwellModels);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -431,7 +431,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_dimProperties(PylithScalar* const
   _normalizer->dimensionalize(&values[p_maxwellTimeBulk],
 			      numMaxwellModels, timeScale);
 
-  PetscLogFlops(3+2*numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(3+2*numMaxwellModels);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -527,7 +527,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcStressElastic(
   stress[4] = mu2 * e23 + initialStress[4];
   stress[5] = mu2 * e13 + initialStress[5];
 
-  PetscLogFlops(28);
+  pylith::utils::EventLogger::logFlops(28);
 } // _calcStressElastic
 
 
@@ -589,31 +589,35 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcStressViscoelastic(
   assert(elasFracShear >= -tolerance);
   assert(elasFracBulk >= -tolerance);
   
-  PetscLogFlops(7 + 2*numMaxwellModels);
+  pylith::utils::EventLogger::logFlops(7 + 2*numMaxwellModels);
 
   // Get viscous strains (deviatoric + mean).
-  // Current viscous strains are in _viscousDevStrain and _viscousMeanStrain.
+  // Current viscous strains are used in place from the state
+  // variables if they do not need to be computed.
+  PylithScalar viscousDevStrainTpdt[numMaxwellModels*tensorSize];
+  PylithScalar viscousMeanStrainTpdt[numMaxwellModels];
+  const PylithScalar* viscousDevStrain = &stateVars[s_viscousDevStrain];
+  const PylithScalar* viscousMeanStrain = &stateVars[s_viscousMeanStrain];
   if (computeStateVars) {
-    _computeStateVars(stateVars, numStateVars,
+    PylithScalar decay[2*numMaxwellModels];
+    PylithScalar coef[2*numMaxwellModels];
+    _maxwellFactors(decay, coef, properties);
+    _computeStateVars(viscousDevStrainTpdt, viscousMeanStrainTpdt,
+		      decay, coef,
+		      stateVars, numStateVars,
 		      properties, numProperties,
 		      totalStrain, strainSize,
 		      initialStress, initialStressSize,
 		      initialStrain, initialStrainSize);
-  } else {
-    for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
-      for (int i=0; i < tensorSize; ++i)
-	_viscousDevStrain[iModel*tensorSize+i] = 
-	  stateVars[s_viscousDevStrain+iModel*tensorSize+i];
-
-      _viscousMeanStrain[iModel] = stateVars[s_viscousMeanStrain+iModel];
-    } // for
-  } // if/else
+    viscousDevStrain = viscousDevStrainTpdt;
+    viscousMeanStrain = viscousMeanStrainTpdt;
+  } // if
 
 
   // Compute mean stresses.
   PylithScalar meanStrain = elasFracBulk * meanStrainTpdt;
   for (int iModel=0; iModel < numMaxwellModels; ++iModel)
-    meanStrain += _viscousMeanStrain[iModel];
+    meanStrain += viscousMeanStrain[iModel];
   const PylithScalar meanStressTpdt = 3.0 * bulkModulus * meanStrain;
   
   // Compute stresses (mean + deviatoric)
@@ -624,11 +628,11 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcStressViscoelastic(
     PylithScalar devStrain = elasFracShear * 
       (totalStrain[i] - initialStrain[i] - diag[i]*meanStrainTpdt);
     for (int iModel=0; iModel < numMaxwellModels; ++iModel)
-      devStrain += _viscousDevStrain[iModel*tensorSize+i];
+      devStrain += viscousDevStrain[iModel*tensorSize+i];
     stress[i] = diag[i]*meanStressTpdt + mu2 * devStrain + initialStress[i];
   } // for
 
-  PetscLogFlops(3 + numMaxwellModels*1 + tensorSize*(6 + numMaxwellModels));
+  pylith::utils::EventLogger::logFlops(3 + numMaxwellModels*1 + tensorSize*(6 + numMaxwellModels));
 } // _calcStressViscoelastic
 
 // ----------------------------------------------------------------------
@@ -705,7 +709,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcElasticConstsElastic(
   elasticConsts[34] = 0; // C1323
   elasticConsts[35] = mu2; // C1313
 
-  PetscLogFlops(7);
+  pylith::utils::EventLogger::logFlops(7);
 } // _calcElasticConstsElastic
 
 // ----------------------------------------------------------------------
@@ -746,22 +750,18 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcElasticConstsViscoelastic(
   const PylithScalar bulkModulus = properties[p_kEff];
 
   // Compute viscous contribution. (deviatoric + mean)
+  PylithScalar decay[2*numMaxwellModels];
+  PylithScalar coef[2*numMaxwellModels];
+  _maxwellFactors(decay, coef, properties);
   PylithScalar elasFracShear = 1.0;  // deviatoric (shear) component
   PylithScalar visFactorDev = 0.0;
   PylithScalar elasFracBulk = 1.0; // mean (bulk) component
   PylithScalar visFactorBulk = 0.0;
   for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
-    const PylithScalar shearRatio = properties[p_shearRatio+iModel];
-    const PylithScalar bulkRatio = properties[p_bulkRatio+iModel];
-    elasFracShear -= shearRatio;
-    elasFracBulk -= bulkRatio;
-
-    const PylithScalar maxwellTimeShear = properties[p_maxwellTimeShear+iModel];
-    visFactorDev +=
-      shearRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeShear);
-    const PylithScalar maxwellTimeBulk = properties[p_maxwellTimeBulk+iModel];
-    visFactorBulk +=
-      bulkRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeBulk);
+    elasFracShear -= properties[p_shearRatio+iModel];
+    elasFracBulk -= properties[p_bulkRatio+iModel];
+    visFactorDev += coef[iModel];
+    visFactorBulk += coef[numMaxwellModels+iModel];
   } // for
   const PylithScalar tolerance = 1.0e-6;
   assert(elasFracShear >= -tolerance);
@@ -821,7 +821,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcElasticConstsViscoelastic(
 	    << std::endl;
 #endif
 
-  PetscLogFlops(1 + numMaxwellModels*6 + 11);
+  pylith::utils::EventLogger::logFlops(1 + numMaxwellModels*6 + 11);
 } // _calcElasticConstsViscoelastic
 
 // ----------------------------------------------------------------------
@@ -879,7 +879,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_updateStateVarsElastic(
     stateVars[s_viscousMeanStrain+iModel] = 
       properties[p_bulkRatio+iModel] * meanStrainTpdt;
 
-  PetscLogFlops(3 + 2 * tensorSize);
+  pylith::utils::EventLogger::logFlops(3 + 2 * tensorSize);
 
   _needNewJacobian = true;
 } // _updateStateVarsElastic
@@ -910,29 +910,27 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_updateStateVarsViscoelastic(
   assert(0 != initialStrain);
   assert(_GenMaxwellQpQsIsotropic3D::tensorSize == initialStrainSize);
 
-  _computeStateVars(stateVars, numStateVars,
+  const int tensorSize = _GenMaxwellQpQsIsotropic3D::tensorSize;
+  const int numMaxwellModels = _GenMaxwellQpQsIsotropic3D::numMaxwellModels;
+
+  // Viscous strains are updated in place, so they must be computed
+  // before the total strain is updated.
+  PylithScalar decay[2*numMaxwellModels];
+  PylithScalar coef[2*numMaxwellModels];
+  _maxwellFactors(decay, coef, properties);
+  _computeStateVars(&stateVars[s_viscousDevStrain],
+		    &stateVars[s_viscousMeanStrain],
+		    decay, coef,
+		    stateVars, numStateVars,
 		    properties, numProperties,
 		    totalStrain, strainSize,
 		    initialStress, initialStressSize,
 		    initialStrain, initialStrainSize);
 
-  const int tensorSize = _GenMaxwellQpQsIsotropic3D::tensorSize;
-  const int numMaxwellModels = _GenMaxwellQpQsIsotropic3D::numMaxwellModels;
-
   // Total strain
   for (int i=0; i < tensorSize; ++i)
     stateVars[s_totalStrain+i] = totalStrain[i];
 
-  // Viscous deviatoric strains.
-  for (int iModel=0; iModel < numMaxwellModels; ++iModel)
-    for (int i=0; i < tensorSize; ++i)
-      stateVars[s_viscousDevStrain+iModel*tensorSize+i] = 
-	_viscousDevStrain[iModel*tensorSize+i];
-
-  for (int iModel=0; iModel < numMaxwellModels; ++iModel)
-    stateVars[s_viscousMeanStrain+iModel] = 
-      _viscousMeanStrain[iModel];
-
   _needNewJacobian = false;
 } // _updateStateVarsViscoelastic
 
@@ -995,10 +993,44 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_stableTimeStepExplicit(const Pyli
 } // _stableTimeStepExplicit
 
 
+// ----------------------------------------------------------------------
+// Compute decay factors and coefficients of strain increments for
+// Maxwell models.
+void
+pylith::materials::GenMaxwellQpQsIsotropic3D::_maxwellFactors(PylithScalar decay[],
+							      PylithScalar coef[],
+							      const PylithScalar* properties) const
+{ // _maxwellFactors
+  assert(decay);
+  assert(coef);
+  assert(properties);
+
+  const int numMaxwellModels = _GenMaxwellQpQsIsotropic3D::numMaxwellModels;
+
+  // Shear models followed by bulk models.
+  PylithScalar maxwellTime[2*numMaxwellModels];
+  for (int i=0; i < numMaxwellModels; ++i) {
+    maxwellTime[i] = properties[p_maxwellTimeShear+i];
+    maxwellTime[numMaxwellModels+i] = properties[p_maxwellTimeBulk+i];
+  } // for
+  PylithScalar dq[2*numMaxwellModels];
+  ViscoelasticMaxwell::decayFactors<2*numMaxwellModels>(decay, dq, _dt, maxwellTime);
+  for (int i=0; i < numMaxwellModels; ++i) {
+    coef[i] = properties[p_shearRatio+i] * dq[i];
+    coef[numMaxwellModels+i] = properties[p_bulkRatio+i] * dq[numMaxwellModels+i];
+  } // for
+
+  pylith::utils::EventLogger::logFlops(2*numMaxwellModels);
+} // _maxwellFactors
+
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
 void
 pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
+					       PylithScalar* const viscousDevStrain,
+					       PylithScalar* const viscousMeanStrain,
+					       const PylithScalar* decay,
+					       const PylithScalar* coef,
 					       const PylithScalar* stateVars,
 					       const int numStateVars,
 					       const PylithScalar* properties,
@@ -1010,6 +1042,10 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
 					       const PylithScalar* initialStrain,
 					       const int initialStrainSize)
 { // _computeStateVars
+  assert(0 != viscousDevStrain);
+  assert(0 != viscousMeanStrain);
+  assert(0 != decay);
+  assert(0 != coef);
   assert(0 != stateVars);
   assert(_numVarsQuadPt == numStateVars);
   assert(0 != properties);
@@ -1037,46 +1073,24 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
       stateVars[s_totalStrain+1] +
       stateVars[s_totalStrain+2] ) / 3.0;
   
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 
   // Deviatoric viscous strains.
-
   assert(6 == tensorSize);
   const PylithScalar diag[6] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
-  for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
-
-    const PylithScalar dq = 
-      ViscoelasticMaxwell::viscousStrainParam(_dt, properties[p_maxwellTimeShear+iModel]);
-
-    for (int i=0; i < tensorSize; ++i) {
-      const PylithScalar devStrainTpdt = totalStrain[i] - diag[i]*meanStrainTpdt;
-      const PylithScalar devStrainT = stateVars[s_totalStrain+i] - diag[i]*meanStrainT;
-      const PylithScalar deltaStrain = devStrainTpdt - devStrainT;
-      
-      _viscousDevStrain[iModel*tensorSize+i] = 
-	exp(-_dt/properties[p_maxwellTimeShear+iModel]) * 
-	stateVars[s_viscousDevStrain+iModel*tensorSize+i] + 
-	properties[p_shearRatio+iModel] * dq * deltaStrain;
-    } // for
+  PylithScalar deltaDevStrain[tensorSize];
+  for (int i=0; i < tensorSize; ++i) {
+    const PylithScalar devStrainTpdt = totalStrain[i] - diag[i]*meanStrainTpdt;
+    const PylithScalar devStrainT = stateVars[s_totalStrain+i] - diag[i]*meanStrainT;
+    deltaDevStrain[i] = devStrainTpdt - devStrainT;
   } // for
-
+  pylith::utils::EventLogger::logFlops(5*tensorSize);
+  ViscoelasticMaxwell::viscousStrains<numMaxwellModels, tensorSize>(viscousDevStrain, &stateVars[s_viscousDevStrain], decay, coef, deltaDevStrain);
 
   // Mean viscous strains.
-
-  // Compute Prony series terms
-  for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
-
-    const PylithScalar dq = 
-      ViscoelasticMaxwell::viscousStrainParam(_dt, properties[p_maxwellTimeBulk+iModel]);
-
-    const PylithScalar deltaStrain = meanStrainTpdt - meanStrainT;
-
-    _viscousMeanStrain[iModel] =  
-      exp(-_dt/properties[p_maxwellTimeBulk+iModel]) * 
-      stateVars[s_viscousMeanStrain+iModel] + 
-      properties[p_bulkRatio+iModel] * dq * deltaStrain;
-  } // for
-
+  const PylithScalar deltaMeanStrain = meanStrainTpdt - meanStrainT;
+  pylith::utils::EventLogger::logFlops(1);
+  ViscoelasticMaxwell::viscousStrains<numMaxwellModels, 1>(viscousMeanStrain, &stateVars[s_viscousMeanStrain], &decay[numMaxwellModels], &coef[numMaxwellModels], &deltaMeanStrain);
 } // _computeStateVars
 
 
@@ -458,9 +458,30 @@ private :
 				    const PylithScalar* initialStrain,
 				    const int initialStrainSize);
 
+  /** Compute decay factors and coefficients of the strain increments
+   * for the Maxwell models at a location.
+   *
+   * Factors for the shear models are followed by those for the bulk
+   * models. The coefficients are the shear or bulk ratio times the
+   * viscous strain parameter.
+   *
+   * @param decay Decay factors, exp(-dt/maxwellTime) [2*numMaxwellModels].
+   * @param coef Coefficients of strain increments [2*numMaxwellModels].
+   * @param properties Properties at location.
+   */
+  void _maxwellFactors(PylithScalar decay[],
+		       PylithScalar coef[],
+		       const PylithScalar* properties) const;
+
   /** Compute viscous strains (state variables) for the current time
    * step.
    *
+   * The viscous strains may be computed in place in the state variables.
+   *
+   * @param viscousDevStrain Array for viscous deviatoric strains [numMaxwellModels*tensorSize].
+   * @param viscousMeanStrain Array for viscous mean strains [numMaxwellModels].
+   * @param decay Decay factors from _maxwellFactors() [2*numMaxwellModels].
+   * @param coef Coefficients from _maxwellFactors() [2*numMaxwellModels].
    * @param stateVars State variables at location.
    * @param numStateVars Number of state variables.
    * @param properties Properties at location.
@@ -472,7 +493,11 @@ private :
    * @param initialStrain Initial strain tensor at location.
    * @param initialStrainSize Size of initial strain array.
    */
-  void _computeStateVars(const PylithScalar* stateVars,
+  void _computeStateVars(PylithScalar* const viscousDevStrain,
+			 PylithScalar* const viscousMeanStrain,
+			 const PylithScalar* decay,
+			 const PylithScalar* coef,
+			 const PylithScalar* stateVars,
 			 const int numStateVars,
 			 const PylithScalar* properties,
 			 const int numProperties,
@@ -486,11 +511,6 @@ private :
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
-  /// Viscous deviatoric strain array [numMaxwellModels*tensorSize].
-  scalar_array _viscousDevStrain;
-
-  /// Viscous mean strain [numMaxwellModels].
-  scalar_array _viscousMeanStrain;
 
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
@@ -27,6 +27,7 @@
 #include "pylith/topology/Stratum.hh" // USES StratumIS
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
+#include "pylith/utils/DBQueryCache.hh" // USES DBQueryCache
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -35,6 +36,8 @@
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
+#include <algorithm> // USES std::sort(), std::min(), std::max()
+#include <utility> // USES std::pair
 
 // ----------------------------------------------------------------------
 // Default constructor.
@@ -46,7 +49,9 @@ pylith::materials::Material::Material(const int dimension,
   _stateVars(0),
   _normalizer(new spatialdata::units::Nondimensional),
   _materialIS(0),
+  _numQuadPts(0),
   _numPropsQuadPt(0),
+  _propsStorage(PROPS_QUADPTS),
   _numVarsQuadPt(0),
   _dimension(dimension),
   _tensorSize(tensorSize),
@@ -55,7 +60,12 @@ pylith::materials::Material::Material(const int dimension,
   _dbProperties(0),
   _dbInitialState(0),
   _id(0),
+  _compactProperties(false),
+  _stateVarsSinglePrecision(false),
   _label(""),
+  _dbQueryCache(""),
+  _dbPropertiesFingerprint(""),
+  _dbInitialStateFingerprint(""),
   _metadata(metadata)
 { // constructor
   const int numProperties = metadata.numProperties();
@@ -122,6 +132,7 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
 
   // Get quadrature information
   const int numQuadPts = quadrature->numQuadPts();
+  _numQuadPts = numQuadPts;
   const int numBasis = quadrature->numBasis();
   const int spaceDim = quadrature->spaceDim();
 
@@ -134,17 +145,30 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
 
   const spatialdata::geocoords::CoordSys* cs = mesh.coordsys();assert(cs);
 
-  // Create field to hold physical properties.
+  // Create field to hold physical properties. When storing uniform
+  // properties compactly, we do not know the layout until we have
+  // queried all of the cells, so we accumulate the properties in a
+  // buffer and create the field afterwards.
   delete _properties; _properties = new topology::Field(mesh);assert(_properties);
   _properties->label("properties");
-  const int propsFiberDim = numQuadPts * _numPropsQuadPt;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int propsFiberDim = numQuadPts * numPropsQuadPt;
   int_array cellsTmp(cells, numCells);
 
-  _properties->newSection(cellsTmp, propsFiberDim);
-  _properties->allocate();
-  _properties->zeroAll();
-  topology::VecVisitorMesh propertiesVisitor(*_properties);
-  PetscScalar* propertiesArray = propertiesVisitor.localArray();
+  topology::VecVisitorMesh* propertiesVisitor = 0;
+  PetscScalar* propertiesArray = NULL;
+  PropsStorageEnum propsStorage = (_compactProperties && numCells > 0) ? PROPS_UNIFORM : PROPS_QUADPTS;
+  scalar_array propertiesUniform;
+  scalar_array propertiesCompact;
+  if (_compactProperties) {
+    _properties->newSection(cellsTmp, 0);
+  } else {
+    _properties->newSection(cellsTmp, propsFiberDim);
+    _properties->allocate();
+    _properties->zeroAll();
+    propertiesVisitor = new topology::VecVisitorMesh(*_properties);
+    propertiesArray = propertiesVisitor->localArray();
+  } // if/else
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
@@ -154,7 +178,6 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
 
   // Create arrays for querying.
   const int numDBProperties = _metadata.numDBProperties();
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
   scalar_array propertiesQuery(numDBProperties);
   scalar_array propertiesCell(propsFiberDim);
 
@@ -201,6 +224,11 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   assert(_normalizer);
   const PylithScalar lengthScale = _normalizer->lengthScale();
 
+  // Gather coordinates of quadrature points for all cells, so we can
+  // query the databases for all points at once in an order that
+  // improves the locality of the search for consecutive points.
+  const PetscInt numPoints = numCells*numQuadPts;
+  scalar_array quadPtsGlobal(numPoints*spaceDim);
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
 
@@ -209,44 +237,121 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
     quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
     const scalar_array& quadPtsNonDim = quadrature->quadPts();
-    quadPtsGlobal = quadPtsNonDim;
+    assert(quadPtsNonDim.size() == size_t(numQuadPts*spaceDim));
+    for (int i=0; i < numQuadPts*spaceDim; ++i) {
+      quadPtsGlobal[c*numQuadPts*spaceDim+i] = quadPtsNonDim[i];
+    } // for
+  } // for
+  if (numPoints > 0) {
     _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
+  } // if
+  int_array queryOrder;
+  _spatialOrder(&queryOrder, quadPtsGlobal, spaceDim);
 
-    // Loop over quadrature points in cell and query database
-    for (int iQuadPt=0, index=0; iQuadPt < numQuadPts; ++iQuadPt, index+=spaceDim) {
-      int err = _dbProperties->query(&propertiesQuery[0], numDBProperties, &quadPtsGlobal[index], spaceDim, cs);
-      if (err) {
-	std::ostringstream msg;
-	msg << "Could not find parameters for physical properties at " << "(";
-	for (int i=0; i < spaceDim; ++i)
-	  msg << "  " << quadPtsGlobal[index+i];
-	msg << ") in material '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
-	throw std::runtime_error(msg.str());
-      } // if
+  scalar_array propertiesQueryPts;
+  utils::DBQueryCache::query(&propertiesQueryPts, _dbProperties, _metadata.dbProperties(), numDBProperties, quadPtsGlobal, &queryOrder, spaceDim, cs,
+			     _dbQueryCache.c_str(), _dbPropertiesFingerprint.c_str(), _label.c_str(), "properties", "parameters for physical properties", "material");
+  scalar_array stateVarsQueryPts;
+  if (_dbInitialState) {
+    utils::DBQueryCache::query(&stateVarsQueryPts, _dbInitialState, _metadata.dbStateVars(), numDBStateVars, quadPtsGlobal, &queryOrder, spaceDim, cs,
+			       _dbQueryCache.c_str(), _dbInitialStateFingerprint.c_str(), _label.c_str(), "state_vars", "initial state variables", "material");
+  } // if
+
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+
+    // Convert values from databases at quadrature points in cell
+    for (int iQuadPt=0; iQuadPt < numQuadPts; ++iQuadPt) {
+      const PetscInt iPoint = c*numQuadPts + iQuadPt;
+      for (int i=0; i < numDBProperties; ++i) {
+	propertiesQuery[i] = propertiesQueryPts[iPoint*numDBProperties+i];
+      } // for
       _dbToProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], propertiesQuery);
       _nondimProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], _numPropsQuadPt);
 
       if (_dbInitialState) {
-	err = _dbInitialState->query(&stateVarsQuery[0], numDBStateVars, &quadPtsGlobal[index], spaceDim, cs);
-	if (err) {
-	  std::ostringstream msg;
-	  msg << "Could not find initial state variables at \n" << "(";
-	  for (int i=0; i < spaceDim; ++i)
-	    msg << "  " << quadPtsGlobal[index+i];
-	  msg << ") in material '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
-	  throw std::runtime_error(msg.str());
-	} // if
+	for (int i=0; i < numDBStateVars; ++i) {
+	  stateVarsQuery[i] = stateVarsQueryPts[iPoint*numDBStateVars+i];
+	} // for
 	_dbToStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], stateVarsQuery);
 	_nondimStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], _numVarsQuadPt);
       } // if
 
     } // for
     // Insert cell contribution into fields
-    const PetscInt off = propertiesVisitor.sectionOffset(cell);
-    assert(propsFiberDim == propertiesVisitor.sectionDof(cell));
-    for(PetscInt d = 0; d < propsFiberDim; ++d) {
-      propertiesArray[off+d] = propertiesCell[d];
-    } // for
+    if (!_compactProperties) {
+      assert(propertiesVisitor);
+      const PetscInt off = propertiesVisitor->sectionOffset(cell);
+      assert(propsFiberDim == propertiesVisitor->sectionDof(cell));
+      for(PetscInt d = 0; d < propsFiberDim; ++d) {
+	propertiesArray[off+d] = propertiesCell[d];
+      } // for
+    } else {
+      bool isCellConstant = true;
+      for (int iQuadPt=1; iQuadPt < numQuadPts && isCellConstant; ++iQuadPt) {
+	for (int i=0; i < numPropsQuadPt; ++i) {
+	  if (propertiesCell[iQuadPt*numPropsQuadPt+i] != propertiesCell[i]) {
+	    isCellConstant = false;
+	    break;
+	  } // if
+	} // for
+      } // for
+
+      if (PROPS_UNIFORM == propsStorage) {
+	bool isUniform = isCellConstant;
+	if (0 == c) {
+	  propertiesUniform.resize(numPropsQuadPt);
+	  for (int i=0; i < numPropsQuadPt; ++i) {
+	    propertiesUniform[i] = propertiesCell[i];
+	  } // for
+	} else {
+	  for (int i=0; i < numPropsQuadPt && isUniform; ++i) {
+	    isUniform = propertiesCell[i] == propertiesUniform[i];
+	  } // for
+	} // if/else
+	if (!isUniform) {
+	  // Switch to storing properties once per cell.
+	  propertiesCompact.resize(numCells*numPropsQuadPt);
+	  for (PetscInt cPrev = 0; cPrev < c; ++cPrev) {
+	    for (int i=0; i < numPropsQuadPt; ++i) {
+	      propertiesCompact[cPrev*numPropsQuadPt+i] = propertiesUniform[i];
+	    } // for
+	  } // for
+	  propsStorage = PROPS_CELL;
+	} // if
+      } // if
+      if (PROPS_CELL == propsStorage && !isCellConstant) {
+	// Switch to storing properties at each quadrature point.
+	const scalar_array propertiesPrev(propertiesCompact);
+	propertiesCompact.resize(numCells*propsFiberDim);
+	for (PetscInt cPrev = 0; cPrev < c; ++cPrev) {
+	  for (int iQuadPt=0; iQuadPt < numQuadPts; ++iQuadPt) {
+	    for (int i=0; i < numPropsQuadPt; ++i) {
+	      propertiesCompact[cPrev*propsFiberDim+iQuadPt*numPropsQuadPt+i] = propertiesPrev[cPrev*numPropsQuadPt+i];
+	    } // for
+	  } // for
+	} // for
+	propsStorage = PROPS_QUADPTS;
+      } // if
+
+      switch (propsStorage) {
+      case PROPS_UNIFORM:
+	break;
+      case PROPS_CELL:
+	for (int i=0; i < numPropsQuadPt; ++i) {
+	  propertiesCompact[c*numPropsQuadPt+i] = propertiesCell[i];
+	} // for
+	break;
+      case PROPS_QUADPTS:
+	for (int d=0; d < propsFiberDim; ++d) {
+	  propertiesCompact[c*propsFiberDim+d] = propertiesCell[d];
+	} // for
+	break;
+      default:
+	assert(0);
+	throw std::logic_error("Unknown storage for physical properties.");
+      } // switch
+    } // if/else
     if (_dbInitialState) {
       assert(stateVarsVisitor);
       assert(stateVarsArray);
@@ -257,7 +362,49 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
       } // for
     } // if
   } // for
+
+  // Convert state variables to single precision and release the
+  // double precision vector; the section is retained for the layout.
+  _stateVarsSingle.resize(0);
+  if (_stateVarsSinglePrecision && stateVarsFiberDim > 0) {
+    assert(stateVarsArray);
+    PetscSection stateVarsSection = _stateVars->localSection();assert(stateVarsSection);
+    PetscInt storageSize = 0;
+    PetscErrorCode err = PetscSectionGetStorageSize(stateVarsSection, &storageSize);PYLITH_CHECK_ERROR(err);
+    _stateVarsSingle.resize(storageSize);
+    for (PetscInt i=0; i < storageSize; ++i) {
+      _stateVarsSingle[i] = float(stateVarsArray[i]);
+    } // for
+  } // if
   delete stateVarsVisitor; stateVarsVisitor = 0;
+  delete propertiesVisitor; propertiesVisitor = 0;
+  if (_stateVarsSingle.size() > 0) {
+    _stateVars->clear();
+  } // if
+
+  // Create properties field using compact storage.
+  if (_compactProperties) {
+    const int storageFiberDim = (PROPS_QUADPTS == propsStorage) ? propsFiberDim : (PROPS_CELL == propsStorage) ? numPropsQuadPt : 0;
+    _properties->newSection(cellsTmp, storageFiberDim);
+    _properties->allocate();
+    _properties->zeroAll();
+    if (storageFiberDim > 0) {
+      topology::VecVisitorMesh compactVisitor(*_properties);
+      PetscScalar* compactArray = compactVisitor.localArray();
+      for(PetscInt c = 0; c < numCells; ++c) {
+	const PetscInt off = compactVisitor.sectionOffset(cells[c]);
+	assert(storageFiberDim == compactVisitor.sectionDof(cells[c]));
+	for(PetscInt d = 0; d < storageFiberDim; ++d) {
+	  compactArray[off+d] = propertiesCompact[c*storageFiberDim+d];
+	} // for
+      } // for
+    } // if
+  } // if
+  _propsStorage = propsStorage;
+  _propertiesUniform.resize(PROPS_UNIFORM == propsStorage ? numPropsQuadPt : 0);
+  if (PROPS_UNIFORM == propsStorage) {
+    _propertiesUniform = propertiesUniform;
+  } // if
 
   // Close databases
   _dbProperties->close();
@@ -350,17 +497,12 @@ pylith::materials::Material::getField(topology::Field *field,
     topology::VecVisitorMesh propertiesVisitor(*_properties);
     PetscScalar* propertiesArray = propertiesVisitor.localArray();
 
-    // Get properties section
-    PetscInt totalPropsFiberDimLocal = 0;
-    PetscInt totalPropsFiberDim = 0;
-    if (numCells > 0) {
-      totalPropsFiberDimLocal = propertiesVisitor.sectionDof(cells[0]);
-    } // if
-    MPI_Allreduce((void *) &totalPropsFiberDimLocal, (void *) &totalPropsFiberDim, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
-    assert(totalPropsFiberDim > 0);
+    // Properties may be stored compactly, so use number of
+    // quadrature points from initialize() rather than the layout of
+    // the properties field.
     const int numPropsQuadPt = _numPropsQuadPt;
-    const int numQuadPts = totalPropsFiberDim / numPropsQuadPt;
-    assert(totalPropsFiberDim == numQuadPts * numPropsQuadPt);
+    const int numQuadPts = _numQuadPts;
+    assert(numQuadPts > 0);
     const int totalFiberDim = numQuadPts * fiberDim;
 
     // Allocate buffer for property field if necessary.
@@ -397,8 +539,9 @@ pylith::materials::Material::getField(topology::Field *field,
       const PetscInt poff = propertiesVisitor.sectionOffset(cell);
       const PetscInt foff = fieldVisitor.sectionOffset(cell);
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+        const PylithScalar* propertiesQuadPt = _propertiesQuadPt(propertiesArray, poff, iQuad);
         for (int i=0; i < numPropsQuadPt; ++i)
-          propertiesCell[i] = propertiesArray[iQuad*numPropsQuadPt + poff+i];
+          propertiesCell[i] = propertiesQuadPt[i];
         _dimProperties(&propertiesCell[0], numPropsQuadPt);
         for (int i=0; i < fiberDim; ++i)
           fieldArray[iQuad*fiberDim + foff+i] = propertiesCell[propOffset+i];
@@ -413,20 +556,12 @@ pylith::materials::Material::getField(topology::Field *field,
       varOffset += _metadata.getStateVar(i).fiberDim;
     const int fiberDim = _metadata.getStateVar(stateVarIndex).fiberDim;
 
-    // Get state variables
-    topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
-    PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
-
-    PetscInt totalVarsFiberDimLocal = 0;
-    PetscInt totalVarsFiberDim = 0;
-    if (numCells > 0) {
-      totalVarsFiberDimLocal = stateVarsVisitor.sectionDof(cells[0]);
-    } // if
-    MPI_Allreduce((void*) &totalVarsFiberDimLocal, (void*) &totalVarsFiberDim, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
-    assert(totalVarsFiberDim > 0);
+    // State variables may be stored in single precision, so use
+    // number of quadrature points from initialize() rather than the
+    // vector of the state variables field.
     const int numVarsQuadPt = _numVarsQuadPt;
-    const int numQuadPts = totalVarsFiberDim / numVarsQuadPt;
-    assert(totalVarsFiberDim == numQuadPts * numVarsQuadPt);
+    const int numQuadPts = _numQuadPts;
+    assert(numQuadPts > 0);
     const int totalFiberDim = numQuadPts * fiberDim;
 
     // Allocate buffer for state variable field if necessary.
@@ -453,7 +588,13 @@ pylith::materials::Material::getField(topology::Field *field,
     topology::VecVisitorMesh fieldVisitor(*field);
     PetscScalar* fieldArray = fieldVisitor.localArray();
 
-    // Buffer for state variable at cell's quadrature points
+    // Get state variables
+    const bool singlePrecision = _stateVarsSingle.size() > 0;
+    topology::VecVisitorMesh* stateVarsVisitor = (!singlePrecision) ? new topology::VecVisitorMesh(*_stateVars) : 0;
+    const PetscScalar* stateVarsArray = (stateVarsVisitor) ? stateVarsVisitor->localArray() : NULL;
+
+    // Buffers for state variables at cell's quadrature points
+    scalar_array stateVarsCellQuadPts(numQuadPts*numVarsQuadPt);
     scalar_array stateVarsCell(numVarsQuadPt);
     
     // Loop over cells
@@ -461,16 +602,25 @@ pylith::materials::Material::getField(topology::Field *field,
       const PetscInt cell = cells[c];
 
       const PetscInt foff = fieldVisitor.sectionOffset(cell);
-      const PetscInt soff = stateVarsVisitor.sectionOffset(cell);
+      if (singlePrecision) {
+	_promoteStateVars(&stateVarsCellQuadPts[0], stateVarsCellQuadPts.size(), cell);
+      } else {
+	assert(stateVarsVisitor);
+	const PetscInt soff = stateVarsVisitor->sectionOffset(cell);
+	for (size_t i=0; i < stateVarsCellQuadPts.size(); ++i) {
+	  stateVarsCellQuadPts[i] = stateVarsArray[soff+i];
+	} // for
+      } // if/else
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         for (int i=0; i < numVarsQuadPt; ++i) {
-          stateVarsCell[i] = stateVarsArray[iQuad*numVarsQuadPt + soff+i];
+          stateVarsCell[i] = stateVarsCellQuadPts[iQuad*numVarsQuadPt+i];
 	} // for
 	_dimStateVars(&stateVarsCell[0], numVarsQuadPt);
         for (int i=0; i < fiberDim; ++i)
           fieldArray[iQuad*fiberDim + foff+i] = stateVarsCell[varOffset+i];
       } // for
     } // for
+    delete stateVarsVisitor; stateVarsVisitor = 0;
   } // if/else
 
   topology::FieldBase::VectorFieldEnum multiType = topology::FieldBase::MULTI_OTHER;
@@ -502,6 +652,44 @@ pylith::materials::Material::getField(topology::Field *field,
   PYLITH_METHOD_END;
 } // getField
   
+// ----------------------------------------------------------------------
+// Get state variables for cell from single precision storage.
+void
+pylith::materials::Material::_promoteStateVars(PylithScalar* const stateVarsCell,
+					       const int size,
+					       const PylithInt cell) const
+{ // _promoteStateVars
+  assert(stateVarsCell);
+  assert(_stateVars);
+
+  PetscSection stateVarsSection = _stateVars->localSection();assert(stateVarsSection);
+  PetscInt soff = 0;
+  PetscErrorCode err = PetscSectionGetOffset(stateVarsSection, cell, &soff);PYLITH_CHECK_ERROR(err);
+  assert(soff + size <= PetscInt(_stateVarsSingle.size()));
+  for (int i=0; i < size; ++i) {
+    stateVarsCell[i] = PylithScalar(_stateVarsSingle[soff+i]);
+  } // for
+} // _promoteStateVars
+
+// ----------------------------------------------------------------------
+// Set state variables for cell in single precision storage.
+void
+pylith::materials::Material::_demoteStateVars(const PylithInt cell,
+					      const PylithScalar* stateVarsCell,
+					      const int size)
+{ // _demoteStateVars
+  assert(stateVarsCell);
+  assert(_stateVars);
+
+  PetscSection stateVarsSection = _stateVars->localSection();assert(stateVarsSection);
+  PetscInt soff = 0;
+  PetscErrorCode err = PetscSectionGetOffset(stateVarsSection, cell, &soff);PYLITH_CHECK_ERROR(err);
+  assert(soff + size <= PetscInt(_stateVarsSingle.size()));
+  for (int i=0; i < size; ++i) {
+    _stateVarsSingle[soff+i] = float(stateVarsCell[i]);
+  } // for
+} // _demoteStateVars
+
 // ----------------------------------------------------------------------
 // Get indices for physical property or state variable field.
 void
@@ -536,4 +724,62 @@ pylith::materials::Material::_findField(int* propertyIndex,
 } // _findField
   
 
+// ----------------------------------------------------------------------
+// Compute order of points that improves spatial locality of queries.
+void
+pylith::materials::Material::_spatialOrder(int_array* order,
+					   const scalar_array& points,
+					   const int spaceDim)
+{ // _spatialOrder
+  PYLITH_METHOD_BEGIN;
+
+  assert(order);
+  assert(spaceDim > 0 && spaceDim <= 3);
+
+  const size_t numPoints = points.size() / spaceDim;
+  order->resize(numPoints);
+  if (!numPoints) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Bounding box of points.
+  PylithScalar pointsMin[3] = { 0.0, 0.0, 0.0 };
+  PylithScalar pointsMax[3] = { 0.0, 0.0, 0.0 };
+  for (int iDim=0; iDim < spaceDim; ++iDim) {
+    pointsMin[iDim] = pointsMax[iDim] = points[iDim];
+  } // for
+  for (size_t iPoint=1; iPoint < numPoints; ++iPoint) {
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      pointsMin[iDim] = std::min(pointsMin[iDim], points[iPoint*spaceDim+iDim]);
+      pointsMax[iDim] = std::max(pointsMax[iDim], points[iPoint*spaceDim+iDim]);
+    } // for
+  } // for
+
+  // Interleave bits of grid indices (10 bits per dimension) to get
+  // Morton keys. Sorting keeps points in the same grid cell in their
+  // original order.
+  const int numBits = 10;
+  const PylithScalar maxIndex = PylithScalar((1 << numBits) - 1);
+  std::vector<std::pair<unsigned int, PylithInt> > keys(numPoints);
+  for (size_t iPoint=0; iPoint < numPoints; ++iPoint) {
+    unsigned int key = 0;
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      const PylithScalar range = pointsMax[iDim] - pointsMin[iDim];
+      const unsigned int index = (range > 0.0) ? (unsigned int)(maxIndex * (points[iPoint*spaceDim+iDim] - pointsMin[iDim]) / range) : 0;
+      for (int iBit=0; iBit < numBits; ++iBit) {
+	key |= ((index >> iBit) & 1u) << (iBit*spaceDim + iDim);
+      } // for
+    } // for
+    keys[iPoint] = std::make_pair(key, PylithInt(iPoint));
+  } // for
+  std::sort(keys.begin(), keys.end());
+
+  for (size_t iPoint=0; iPoint < numPoints; ++iPoint) {
+    (*order)[iPoint] = keys[iPoint].second;
+  } // for
+
+  PYLITH_METHOD_END;
+} // _spatialOrder
+
+
 // End of file 
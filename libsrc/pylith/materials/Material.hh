@@ -31,8 +31,10 @@
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // forward declarations
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
+#include "spatialdata/geocoords/geocoordsfwd.hh" // forward declarations
 
 #include "Metadata.hh" // HASA Metadata
+#include "pylith/utils/array.hh" // HASA scalar_array, float_array
 
 #include <string> // HASA std::string
 
@@ -48,6 +50,16 @@ class pylith::materials::Material
 { // class Material
   friend class TestMaterial; // unit testing
 
+  // PUBLIC ENUMS ///////////////////////////////////////////////////////
+public :
+
+  /// Storage of physical properties.
+  enum PropsStorageEnum {
+    PROPS_QUADPTS=0, ///< Properties at each quadrature point of each cell.
+    PROPS_CELL=1, ///< Properties once per cell.
+    PROPS_UNIFORM=2, ///< Properties once for the material.
+  };
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -124,12 +136,72 @@ public :
    */
   void dbInitialState(spatialdata::spatialdb::SpatialDB* value);
 
+  /** Set prefix for files caching values queried from the databases
+   * for physical properties and initial state variables.
+   *
+   * If set, initialize() reads the values from the cache files when
+   * they match the query and writes them otherwise. An empty prefix
+   * disables the cache.
+   *
+   * @param value Prefix for names of cache files.
+   */
+  void dbQueryCache(const char* value);
+
+  /** Set fingerprint of contents of database for physical properties.
+   *
+   * Queries are cached only for databases with a fingerprint.
+   *
+   * @param value Fingerprint of database (empty if unknown).
+   */
+  void dbPropertiesFingerprint(const char* value);
+
+  /** Set fingerprint of contents of database for initial state variables.
+   *
+   * Queries are cached only for databases with a fingerprint.
+   *
+   * @param value Fingerprint of database (empty if unknown).
+   */
+  void dbInitialStateFingerprint(const char* value);
+
   /** Set scales used to nondimensionalize physical properties.
    *
    * @param dim Nondimensionalizer
    */
   void normalizer(const spatialdata::units::Nondimensional& dim);
 
+  /** Set flag for storing uniform physical properties compactly.
+   *
+   * If true, initialize() stores the physical properties once for
+   * the material if they are uniform over its cells, or once per cell
+   * if they do not vary over the quadrature points within each cell.
+   *
+   * @param flag True to store uniform properties compactly.
+   */
+  void compactProperties(const bool flag);
+
+  /** Get storage of physical properties.
+   *
+   * @returns Storage of physical properties.
+   */
+  PropsStorageEnum propertiesStorage(void) const;
+
+  /** Set flag for storing state variables in single precision.
+   *
+   * If true, initialize() converts the state variables to single
+   * precision and releases the double precision vector. Values are
+   * promoted to PylithScalar when they are retrieved and demoted when
+   * they are updated.
+   *
+   * @param flag True to store state variables in single precision.
+   */
+  void stateVarsSinglePrecision(const bool flag);
+
+  /** Get flag for storing state variables in single precision.
+   *
+   * @returns True if state variables are stored in single precision.
+   */
+  bool stateVarsSinglePrecision(void) const;
+
   /** Initialize material by getting physical property parameters from
    * database.
    *
@@ -213,6 +285,20 @@ public :
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
+  /** Get physical properties at a quadrature point of a cell.
+   *
+   * Compact storage of physical properties is expanded transparently.
+   *
+   * @param propertiesArray Local array of properties field.
+   * @param poff Offset of cell in properties field.
+   * @param iQuad Index of quadrature point in cell.
+   *
+   * @returns Physical properties at quadrature point.
+   */
+  const PylithScalar* _propertiesQuadPt(const PylithScalar* propertiesArray,
+					const PylithInt poff,
+					const int iQuad) const;
+
   /// These methods should be implemented by every constitutive model.
 
   /** Compute properties from values in spatial database.
@@ -269,6 +355,26 @@ protected :
   void _dimStateVars(PylithScalar* const values,
 			const int nvalues) const;
 
+  /** Get state variables for cell from single precision storage.
+   *
+   * @param stateVarsCell Array of state variables for cell.
+   * @param size Size of array (number of values at all quadrature points).
+   * @param cell Finite-element cell.
+   */
+  void _promoteStateVars(PylithScalar* const stateVarsCell,
+			 const int size,
+			 const PylithInt cell) const;
+
+  /** Set state variables for cell in single precision storage.
+   *
+   * @param cell Finite-element cell.
+   * @param stateVarsCell Array of state variables for cell.
+   * @param size Size of array (number of values at all quadrature points).
+   */
+  void _demoteStateVars(const PylithInt cell,
+			const PylithScalar* stateVarsCell,
+			const int size);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -280,11 +386,17 @@ protected :
   /// Field containing the state variables for the material.
   topology::Field *_stateVars;
 
+  /// State variables in single precision (uses layout of _stateVars).
+  float_array _stateVarsSingle;
+
   spatialdata::units::Nondimensional* _normalizer; ///< Nondimensionalizer
   
   topology::StratumIS* _materialIS; ///< Index set for material cells.
 
+  int _numQuadPts; ///< Number of quadrature points
   int _numPropsQuadPt; ///< Number of properties per quad point.
+  PropsStorageEnum _propsStorage; ///< Storage of physical properties.
+  scalar_array _propertiesUniform; ///< Properties for PROPS_UNIFORM storage.
   int _numVarsQuadPt; ///< Number of state variables per quad point.
   const int _dimension; ///< Spatial dimension associated with material.
   const int _tensorSize; ///< Tensor size for material.
@@ -306,6 +418,19 @@ private :
 		  int* stateVarIndex,
 		  const char* name) const;
 
+  /** Compute order of points that improves spatial locality of
+   * consecutive queries (Morton order of points on a regular grid
+   * over their bounding box).
+   *
+   * @param order Indices of points in query order.
+   * @param points Coordinates of points [numPoints][spaceDim].
+   * @param spaceDim Spatial dimension of coordinates.
+   */
+  static
+  void _spatialOrder(int_array* order,
+		     const scalar_array& points,
+		     const int spaceDim);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -316,7 +441,12 @@ private :
   spatialdata::spatialdb::SpatialDB* _dbInitialState;
 
   int _id; ///< Material identifier.
+  bool _compactProperties; ///< True if uniform properties are stored compactly.
+  bool _stateVarsSinglePrecision; ///< True if state variables are stored in single precision.
   std::string _label; ///< Label of material.
+  std::string _dbQueryCache; ///< Prefix for files caching database queries.
+  std::string _dbPropertiesFingerprint; ///< Fingerprint of database for properties.
+  std::string _dbInitialStateFingerprint; ///< Fingerprint of database for initial state.
 
   const Metadata _metadata; ///< Property and state variable metadata.
 
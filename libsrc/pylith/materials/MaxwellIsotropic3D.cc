@@ -27,7 +27,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 #include <cstring> // USES memcpy()
@@ -144,10 +144,11 @@ pylith::materials::MaxwellIsotropic3D::MaxwellIsotropic3D(void) :
 			   _MaxwellIsotropic3D::numDBStateVars)),
   _calcElasticConstsFn(0),
   _calcStressFn(0),
-  _updateStateVarsFn(0)
+  _updateStateVarsFn(0),
+  _calcElasticConstsBatchFn(0),
+  _calcStressBatchFn(0)
 { // constructor
   useElasticBehavior(false);
-  _viscousStrain.resize(_tensorSize);
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -161,11 +162,17 @@ pylith::materials::MaxwellIsotropic3D::~MaxwellIsotropic3D(void)
 void
 pylith::materials::MaxwellIsotropic3D::useElasticBehavior(const bool flag)
 { // useElasticBehavior
+  ElasticMaterial::useElasticBehavior(flag);
+
   if (flag) {
     _calcStressFn = 
       &pylith::materials::MaxwellIsotropic3D::_calcStressElastic;
     _calcElasticConstsFn = 
       &pylith::materials::MaxwellIsotropic3D::_calcElasticConstsElastic;
+    _calcStressBatchFn = 
+      &pylith::materials::MaxwellIsotropic3D::_calcStressBatchElastic;
+    _calcElasticConstsBatchFn = 
+      &pylith::materials::MaxwellIsotropic3D::_calcElasticConstsBatchElastic;
     _updateStateVarsFn = 
       &pylith::materials::MaxwellIsotropic3D::_updateStateVarsElastic;
 
@@ -174,11 +181,24 @@ pylith::materials::MaxwellIsotropic3D::useElasticBehavior(const bool flag)
       &pylith::materials::MaxwellIsotropic3D::_calcStressViscoelastic;
     _calcElasticConstsFn = 
       &pylith::materials::MaxwellIsotropic3D::_calcElasticConstsViscoelastic;
+    _calcStressBatchFn = 
+      &pylith::materials::MaxwellIsotropic3D::_calcStressBatchViscoelastic;
+    _calcElasticConstsBatchFn = 
+      &pylith::materials::MaxwellIsotropic3D::_calcElasticConstsBatchViscoelastic;
     _updateStateVarsFn = 
       &pylith::materials::MaxwellIsotropic3D::_updateStateVarsViscoelastic;
   } // if/else
 } // useElasticBehavior
 
+// ----------------------------------------------------------------------
+// Get flag indicating whether material implements batched
+// constitutive kernels.
+bool
+pylith::materials::MaxwellIsotropic3D::hasBatchKernels(void) const
+{ // hasBatchKernels
+  return true;
+} // hasBatchKernels
+
 // ----------------------------------------------------------------------
 // Compute properties from values in spatial database.
 void
@@ -227,7 +247,7 @@ pylith::materials::MaxwellIsotropic3D::_dbToProperties(
   propValues[p_lambda] = lambda;
   propValues[p_maxwellTime] = maxwellTime;
 
-  PetscLogFlops(7);
+  pylith::utils::EventLogger::logFlops(7);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -252,7 +272,7 @@ pylith::materials::MaxwellIsotropic3D::_nondimProperties(PylithScalar* const val
   values[p_maxwellTime] = 
     _normalizer->nondimensionalize(values[p_maxwellTime], timeScale);
 
-  PetscLogFlops(4);
+  pylith::utils::EventLogger::logFlops(4);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -277,7 +297,7 @@ pylith::materials::MaxwellIsotropic3D::_dimProperties(PylithScalar* const values
   values[p_maxwellTime] = 
     _normalizer->dimensionalize(values[p_maxwellTime], timeScale);
 
-  PetscLogFlops(4);
+  pylith::utils::EventLogger::logFlops(4);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -296,7 +316,7 @@ pylith::materials::MaxwellIsotropic3D::_dbToStateVars(
   assert(totalSize == numDBValues);
   memcpy(stateValues, &dbValues[0], totalSize*sizeof(PylithScalar));
 
-  PetscLogFlops(0);
+  pylith::utils::EventLogger::logFlops(0);
 } // _dbToStateVars
 
 // ----------------------------------------------------------------------
@@ -368,7 +388,7 @@ pylith::materials::MaxwellIsotropic3D::_calcStressElastic(
   stress[4] = mu2 * e23 + initialStress[4];
   stress[5] = mu2 * e13 + initialStress[5];
 
-  PetscLogFlops(25);
+  pylith::utils::EventLogger::logFlops(25);
 } // _calcStressElastic
 
 // ----------------------------------------------------------------------
@@ -436,28 +456,159 @@ pylith::materials::MaxwellIsotropic3D::_calcStressViscoelastic(
   const PylithScalar diag[] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
 
   // Get viscous strains
+  PylithScalar viscousStrain[_MaxwellIsotropic3D::tensorSize];
   if (computeStateVars)
-    _computeStateVars(stateVars, numStateVars,
+    _computeStateVars(viscousStrain,
+		      stateVars, numStateVars,
 		      properties, numProperties,
 		      totalStrain, strainSize,
 		      initialStress, initialStressSize,
 		      initialStrain, initialStrainSize);
   else
-    memcpy(&_viscousStrain[0], &stateVars[s_viscousStrain],
+    memcpy(viscousStrain, &stateVars[s_viscousStrain],
 	   tensorSize*sizeof(PylithScalar));
 
   // Compute new stresses
   PylithScalar devStressTpdt = 0.0;
 
   for (int iComp=0; iComp < tensorSize; ++iComp) {
-    devStressTpdt = mu2 * (_viscousStrain[iComp] - devStrainInitial[iComp]);
+    devStressTpdt = mu2 * (viscousStrain[iComp] - devStrainInitial[iComp]);
 
     stress[iComp] = diag[iComp] * meanStressTpdt + devStressTpdt;
   } // for
 
-  PetscLogFlops(22 + 5 * tensorSize);
+  pylith::utils::EventLogger::logFlops(22 + 5 * tensorSize);
 } // _calcStressViscoelastic
 
+// ----------------------------------------------------------------------
+// Compute stress tensors for batch of points from properties as an
+// elastic material.
+void
+pylith::materials::MaxwellIsotropic3D::_calcStressBatchElastic(PylithScalar* const stress,
+							       const PylithScalar* properties,
+							       const PylithScalar* stateVars,
+							       const PylithScalar* totalStrain,
+							       const PylithScalar* initialStress,
+							       const PylithScalar* initialStrain,
+							       const int numPoints,
+							       const bool computeStateVars)
+{ // _calcStressBatchElastic
+  assert(stress);
+  assert(properties);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
+
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+
+  // Components are contiguous over points, so the loop vectorizes.
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0*mu[i];
+
+    const PylithScalar e11 = totalStrain[0*n+i] - initialStrain[0*n+i];
+    const PylithScalar e22 = totalStrain[1*n+i] - initialStrain[1*n+i];
+    const PylithScalar e33 = totalStrain[2*n+i] - initialStrain[2*n+i];
+    const PylithScalar e12 = totalStrain[3*n+i] - initialStrain[3*n+i];
+    const PylithScalar e23 = totalStrain[4*n+i] - initialStrain[4*n+i];
+    const PylithScalar e13 = totalStrain[5*n+i] - initialStrain[5*n+i];
+
+    const PylithScalar s123 = lambda[i] * (e11 + e22 + e33);
+
+    stress[0*n+i] = s123 + mu2*e11 + initialStress[0*n+i];
+    stress[1*n+i] = s123 + mu2*e22 + initialStress[1*n+i];
+    stress[2*n+i] = s123 + mu2*e33 + initialStress[2*n+i];
+    stress[3*n+i] = mu2 * e12 + initialStress[3*n+i];
+    stress[4*n+i] = mu2 * e23 + initialStress[4*n+i];
+    stress[5*n+i] = mu2 * e13 + initialStress[5*n+i];
+  } // for
+
+  pylith::utils::EventLogger::logFlops(25*n);
+} // _calcStressBatchElastic
+
+// ----------------------------------------------------------------------
+// Compute stress tensors for batch of points from properties and
+// state variables as a viscoelastic material.
+void
+pylith::materials::MaxwellIsotropic3D::_calcStressBatchViscoelastic(PylithScalar* const stress,
+								    const PylithScalar* properties,
+								    const PylithScalar* stateVars,
+								    const PylithScalar* totalStrain,
+								    const PylithScalar* initialStress,
+								    const PylithScalar* initialStrain,
+								    const int numPoints,
+								    const bool computeStateVars)
+{ // _calcStressBatchViscoelastic
+  assert(stress);
+  assert(properties);
+  assert(stateVars);
+  assert(totalStrain);
+  assert(initialStress);
+  assert(initialStrain);
+
+  const int tensorSize = _MaxwellIsotropic3D::tensorSize;
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+  const PylithScalar* maxwellTime = &properties[p_maxwellTime*n];
+  const PylithScalar* totalStrainT = &stateVars[s_totalStrain*n];
+  const PylithScalar* viscousStrainT = &stateVars[s_viscousStrain*n];
+  const PylithScalar dt = _dt;
+
+  const PylithScalar diag[] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
+
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0 * mu[i];
+    const PylithScalar bulkModulus = lambda[i] + mu2 / 3.0;
+
+    // Initial stress and strain values
+    const PylithScalar meanStrainInitial = (initialStrain[0*n+i] +
+					    initialStrain[1*n+i] +
+					    initialStrain[2*n+i]) / 3.0;
+    const PylithScalar meanStressInitial = (initialStress[0*n+i] +
+					    initialStress[1*n+i] +
+					    initialStress[2*n+i]) / 3.0;
+
+    const PylithScalar meanStrainTpdt = (totalStrain[0*n+i] +
+					 totalStrain[1*n+i] +
+					 totalStrain[2*n+i]) / 3.0;
+    const PylithScalar meanStressTpdt = 3.0 * bulkModulus *
+      (meanStrainTpdt - meanStrainInitial) + meanStressInitial;
+
+    // Get viscous strains (see _computeStateVars()).
+    PylithScalar viscousStrain[tensorSize];
+    if (computeStateVars) {
+      const PylithScalar meanStrainT = (totalStrainT[0*n+i] +
+					totalStrainT[1*n+i] +
+					totalStrainT[2*n+i]) / 3.0;
+      const PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime[i]);
+      const PylithScalar expFac = exp(-dt/maxwellTime[i]);
+      for (int iComp=0; iComp < tensorSize; ++iComp) {
+	const PylithScalar devStrainTpdt = totalStrain[iComp*n+i] - diag[iComp] * meanStrainTpdt;
+	const PylithScalar devStrainT = totalStrainT[iComp*n+i] - diag[iComp] * meanStrainT;
+	viscousStrain[iComp] = expFac * viscousStrainT[iComp*n+i] + dq * (devStrainTpdt - devStrainT);
+      } // for
+    } else {
+      for (int iComp=0; iComp < tensorSize; ++iComp) {
+	viscousStrain[iComp] = viscousStrainT[iComp*n+i];
+      } // for
+    } // if/else
+
+    // Compute new stresses
+    for (int iComp=0; iComp < tensorSize; ++iComp) {
+      const PylithScalar devStrainInitial = initialStrain[iComp*n+i] - diag[iComp] * meanStrainInitial;
+      const PylithScalar devStressTpdt = mu2 * (viscousStrain[iComp] - devStrainInitial);
+      stress[iComp*n+i] = diag[iComp] * meanStressTpdt + devStressTpdt;
+    } // for
+  } // for
+
+  pylith::utils::EventLogger::logFlops((22 + 5 * tensorSize)*n);
+  if (computeStateVars) {
+    pylith::utils::EventLogger::logFlops((9 + 7 * tensorSize)*n);
+  } // if
+} // _calcStressBatchViscoelastic
+
 // ----------------------------------------------------------------------
 // Compute derivative of elasticity matrix at location from properties.
 void
@@ -531,7 +682,7 @@ pylith::materials::MaxwellIsotropic3D::_calcElasticConstsElastic(
   elasticConsts[34] = 0; // C1323
   elasticConsts[35] = mu2; // C1313
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // _calcElasticConstsElastic
 
 // ----------------------------------------------------------------------
@@ -613,9 +764,144 @@ pylith::materials::MaxwellIsotropic3D::_calcElasticConstsViscoelastic(
   elasticConsts[34] = 0; // C1323
   elasticConsts[35] = elasticConsts[21]; // C1313
 
-  PetscLogFlops(10);
+  pylith::utils::EventLogger::logFlops(10);
 } // _calcElasticConstsViscoelastic
 
+// ----------------------------------------------------------------------
+// Compute derivatives of elasticity matrix for batch of points from
+// properties as an elastic material.
+void
+pylith::materials::MaxwellIsotropic3D::_calcElasticConstsBatchElastic(PylithScalar* const elasticConsts,
+								      const PylithScalar* properties,
+								      const PylithScalar* stateVars,
+								      const PylithScalar* totalStrain,
+								      const PylithScalar* initialStress,
+								      const PylithScalar* initialStrain,
+								      const int numPoints)
+{ // _calcElasticConstsBatchElastic
+  assert(elasticConsts);
+  assert(properties);
+
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0 * mu[i];
+    const PylithScalar lambda2mu = lambda[i] + mu2;
+
+    elasticConsts[ 0*n+i] = lambda2mu; // C1111
+    elasticConsts[ 1*n+i] = lambda[i]; // C1122
+    elasticConsts[ 2*n+i] = lambda[i]; // C1133
+    elasticConsts[ 3*n+i] = 0; // C1112
+    elasticConsts[ 4*n+i] = 0; // C1123
+    elasticConsts[ 5*n+i] = 0; // C1113
+    elasticConsts[ 6*n+i] = lambda[i]; // C2211
+    elasticConsts[ 7*n+i] = lambda2mu; // C2222
+    elasticConsts[ 8*n+i] = lambda[i]; // C2233
+    elasticConsts[ 9*n+i] = 0; // C2212
+    elasticConsts[10*n+i] = 0; // C2223
+    elasticConsts[11*n+i] = 0; // C2213
+    elasticConsts[12*n+i] = lambda[i]; // C3311
+    elasticConsts[13*n+i] = lambda[i]; // C3322
+    elasticConsts[14*n+i] = lambda2mu; // C3333
+    elasticConsts[15*n+i] = 0; // C3312
+    elasticConsts[16*n+i] = 0; // C3323
+    elasticConsts[17*n+i] = 0; // C3313
+    elasticConsts[18*n+i] = 0; // C1211
+    elasticConsts[19*n+i] = 0; // C1222
+    elasticConsts[20*n+i] = 0; // C1233
+    elasticConsts[21*n+i] = mu2; // C1212
+    elasticConsts[22*n+i] = 0; // C1223
+    elasticConsts[23*n+i] = 0; // C1213
+    elasticConsts[24*n+i] = 0; // C2311
+    elasticConsts[25*n+i] = 0; // C2322
+    elasticConsts[26*n+i] = 0; // C2333
+    elasticConsts[27*n+i] = 0; // C2312
+    elasticConsts[28*n+i] = mu2; // C2323
+    elasticConsts[29*n+i] = 0; // C2313
+    elasticConsts[30*n+i] = 0; // C1311
+    elasticConsts[31*n+i] = 0; // C1322
+    elasticConsts[32*n+i] = 0; // C1333
+    elasticConsts[33*n+i] = 0; // C1312
+    elasticConsts[34*n+i] = 0; // C1323
+    elasticConsts[35*n+i] = mu2; // C1313
+  } // for
+
+  pylith::utils::EventLogger::logFlops(2*n);
+} // _calcElasticConstsBatchElastic
+
+// ----------------------------------------------------------------------
+// Compute derivatives of elasticity matrix for batch of points from
+// properties as a viscoelastic material.
+void
+pylith::materials::MaxwellIsotropic3D::_calcElasticConstsBatchViscoelastic(PylithScalar* const elasticConsts,
+									   const PylithScalar* properties,
+									   const PylithScalar* stateVars,
+									   const PylithScalar* totalStrain,
+									   const PylithScalar* initialStress,
+									   const PylithScalar* initialStrain,
+									   const int numPoints)
+{ // _calcElasticConstsBatchViscoelastic
+  assert(elasticConsts);
+  assert(properties);
+
+  const int n = numPoints;
+  const PylithScalar* mu = &properties[p_mu*n];
+  const PylithScalar* lambda = &properties[p_lambda*n];
+  const PylithScalar* maxwellTime = &properties[p_maxwellTime*n];
+
+  for (int i=0; i < n; ++i) {
+    const PylithScalar mu2 = 2.0 * mu[i];
+    const PylithScalar bulkModulus = lambda[i] + mu2 / 3.0;
+
+    const PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
+    const PylithScalar visFac = mu[i] * dq / 3.0;
+    const PylithScalar c11 = bulkModulus + 4.0 * visFac;
+    const PylithScalar c12 = bulkModulus - 2.0 * visFac;
+    const PylithScalar c44 = 6.0 * visFac;
+
+    elasticConsts[ 0*n+i] = c11; // C1111
+    elasticConsts[ 1*n+i] = c12; // C1122
+    elasticConsts[ 2*n+i] = c12; // C1133
+    elasticConsts[ 3*n+i] = 0; // C1112
+    elasticConsts[ 4*n+i] = 0; // C1123
+    elasticConsts[ 5*n+i] = 0; // C1113
+    elasticConsts[ 6*n+i] = c12; // C2211
+    elasticConsts[ 7*n+i] = c11; // C2222
+    elasticConsts[ 8*n+i] = c12; // C2233
+    elasticConsts[ 9*n+i] = 0; // C2212
+    elasticConsts[10*n+i] = 0; // C2223
+    elasticConsts[11*n+i] = 0; // C2213
+    elasticConsts[12*n+i] = c12; // C3311
+    elasticConsts[13*n+i] = c12; // C3322
+    elasticConsts[14*n+i] = c11; // C3333
+    elasticConsts[15*n+i] = 0; // C3312
+    elasticConsts[16*n+i] = 0; // C3323
+    elasticConsts[17*n+i] = 0; // C3313
+    elasticConsts[18*n+i] = 0; // C1211
+    elasticConsts[19*n+i] = 0; // C1222
+    elasticConsts[20*n+i] = 0; // C1233
+    elasticConsts[21*n+i] = c44; // C1212
+    elasticConsts[22*n+i] = 0; // C1223
+    elasticConsts[23*n+i] = 0; // C1213
+    elasticConsts[24*n+i] = 0; // C2311
+    elasticConsts[25*n+i] = 0; // C2322
+    elasticConsts[26*n+i] = 0; // C2333
+    elasticConsts[27*n+i] = 0; // C2312
+    elasticConsts[28*n+i] = c44; // C2323
+    elasticConsts[29*n+i] = 0; // C2313
+    elasticConsts[30*n+i] = 0; // C1311
+    elasticConsts[31*n+i] = 0; // C1322
+    elasticConsts[32*n+i] = 0; // C1333
+    elasticConsts[33*n+i] = 0; // C1312
+    elasticConsts[34*n+i] = 0; // C1323
+    elasticConsts[35*n+i] = c44; // C1313
+  } // for
+
+  pylith::utils::EventLogger::logFlops(10*n);
+} // _calcElasticConstsBatchViscoelastic
+
 // ----------------------------------------------------------------------
 // Update state variables as an elastic material.
 void
@@ -662,7 +948,7 @@ pylith::materials::MaxwellIsotropic3D::_updateStateVarsElastic(
     stateVars[s_viscousStrain+iComp] =
       strainTpdt[iComp] - diag[iComp] * meanStrainTpdt;
   } // for
-  PetscLogFlops(9 + 2 * _tensorSize);
+  pylith::utils::EventLogger::logFlops(9 + 2 * _tensorSize);
 
   _needNewJacobian = true;
 } // _updateStateVarsElastic
@@ -695,7 +981,9 @@ pylith::materials::MaxwellIsotropic3D::_updateStateVarsViscoelastic(
 
   const int tensorSize = _tensorSize;
 
-  _computeStateVars(stateVars, numStateVars,
+  PylithScalar viscousStrain[_MaxwellIsotropic3D::tensorSize];
+  _computeStateVars(viscousStrain,
+		    stateVars, numStateVars,
 		    properties, numProperties,
 		    totalStrain, strainSize,
 		    initialStress, initialStressSize,
@@ -703,7 +991,7 @@ pylith::materials::MaxwellIsotropic3D::_updateStateVarsViscoelastic(
 
   memcpy(&stateVars[s_totalStrain], totalStrain, tensorSize*sizeof(PylithScalar));
 
-  memcpy(&stateVars[s_viscousStrain], &_viscousStrain[0], 
+  memcpy(&stateVars[s_viscousStrain], viscousStrain, 
 	 tensorSize*sizeof(PylithScalar));
 
   _needNewJacobian = false;
@@ -757,6 +1045,7 @@ pylith::materials::MaxwellIsotropic3D::_stableTimeStepExplicit(const PylithScala
 // Compute viscous strain for current time step.
 void
 pylith::materials::MaxwellIsotropic3D::_computeStateVars(
+					       PylithScalar* const viscousStrain,
 					       const PylithScalar* stateVars,
 					       const int numStateVars,
 					       const PylithScalar* properties,
@@ -808,11 +1097,11 @@ pylith::materials::MaxwellIsotropic3D::_computeStateVars(
   for (int iComp=0; iComp < tensorSize; ++iComp) {
     devStrainTpdt = totalStrain[iComp] - diag[iComp] * meanStrainTpdt;
     devStrainT = stateVars[s_totalStrain+iComp] - diag[iComp] * meanStrainT;
-    _viscousStrain[iComp] = expFac * stateVars[s_viscousStrain+iComp] +
+    viscousStrain[iComp] = expFac * stateVars[s_viscousStrain+iComp] +
       dq * (devStrainTpdt - devStrainT);
   } // for
 
-  PetscLogFlops(9 + 7 * tensorSize);
+  pylith::utils::EventLogger::logFlops(9 + 7 * tensorSize);
 } // _computeStateVars
 
 
@@ -62,6 +62,13 @@ public :
    */
   void useElasticBehavior(const bool flag);
 
+  /** Get flag indicating whether material implements batched
+   * constitutive kernels.
+   *
+   * @returns True.
+   */
+  bool hasBatchKernels(void) const;
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -180,6 +187,47 @@ protected :
 			  const PylithScalar* initialStrain,
 			  const int initialStrainSize);
 
+  /** Compute stress tensors for a batch of points from properties
+   * and state variables stored in structure-of-arrays layout.
+   *
+   * @param stress Array for stress tensors [tensorSize][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   * @param computeStateVars Flag indicating to compute updated state variables.
+   */
+  void _calcStressBatch(PylithScalar* const stress,
+			const PylithScalar* properties,
+			const PylithScalar* stateVars,
+			const PylithScalar* totalStrain,
+			const PylithScalar* initialStress,
+			const PylithScalar* initialStrain,
+			const int numPoints,
+			const bool computeStateVars);
+
+  /** Compute derivatives of elasticity matrix for a batch of points
+   * from properties and state variables stored in
+   * structure-of-arrays layout.
+   *
+   * @param elasticConsts Array for elastic constants [numElasticConsts][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   */
+  void _calcElasticConstsBatch(PylithScalar* const elasticConsts,
+			       const PylithScalar* properties,
+			       const PylithScalar* stateVars,
+			       const PylithScalar* totalStrain,
+			       const PylithScalar* initialStress,
+			       const PylithScalar* initialStrain,
+			       const int numPoints);
+
   /** Update state variables (for next time step).
    *
    * @param stateVars State variables at location.
@@ -281,6 +329,27 @@ private :
      const PylithScalar*,
      const int);
 
+  /// Member prototype for _calcStressBatch()
+  typedef void (pylith::materials::MaxwellIsotropic3D::*calcStressBatch_fn_type)
+    (PylithScalar* const,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const int,
+     const bool);
+
+  /// Member prototype for _calcElasticConstsBatch()
+  typedef void (pylith::materials::MaxwellIsotropic3D::*calcElasticConstsBatch_fn_type)
+    (PylithScalar* const,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const PylithScalar*,
+     const int);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -402,6 +471,86 @@ private :
 				      const PylithScalar* initialStrain,
 				      const int initialStrainSize);
 
+  /** Compute stress tensors for a batch of points from properties
+   * as an elastic material.
+   *
+   * @param stress Array for stress tensors [tensorSize][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   * @param computeStateVars Flag indicating to compute updated state variables.
+   */
+  void _calcStressBatchElastic(PylithScalar* const stress,
+			       const PylithScalar* properties,
+			       const PylithScalar* stateVars,
+			       const PylithScalar* totalStrain,
+			       const PylithScalar* initialStress,
+			       const PylithScalar* initialStrain,
+			       const int numPoints,
+			       const bool computeStateVars);
+
+  /** Compute derivatives of elasticity matrix for a batch of points
+   * from properties as an elastic material.
+   *
+   * @param elasticConsts Array for elastic constants [numElasticConsts][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   */
+  void _calcElasticConstsBatchElastic(PylithScalar* const elasticConsts,
+				      const PylithScalar* properties,
+				      const PylithScalar* stateVars,
+				      const PylithScalar* totalStrain,
+				      const PylithScalar* initialStress,
+				      const PylithScalar* initialStrain,
+				      const int numPoints);
+
+  /** Compute stress tensors for a batch of points from properties
+   * and state variables as a viscoelastic material.
+   *
+   * @param stress Array for stress tensors [tensorSize][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   * @param computeStateVars Flag indicating to compute updated state variables.
+   */
+  void _calcStressBatchViscoelastic(PylithScalar* const stress,
+				    const PylithScalar* properties,
+				    const PylithScalar* stateVars,
+				    const PylithScalar* totalStrain,
+				    const PylithScalar* initialStress,
+				    const PylithScalar* initialStrain,
+				    const int numPoints,
+				    const bool computeStateVars);
+
+  /** Compute derivatives of elasticity matrix for a batch of points
+   * from properties as a viscoelastic material.
+   *
+   * @param elasticConsts Array for elastic constants [numElasticConsts][numPoints].
+   * @param properties Properties [numPropsQuadPt][numPoints].
+   * @param stateVars State variables [numVarsQuadPt][numPoints].
+   * @param totalStrain Total strain [tensorSize][numPoints].
+   * @param initialStress Initial stress [tensorSize][numPoints].
+   * @param initialStrain Initial strain [tensorSize][numPoints].
+   * @param numPoints Number of points in batch.
+   */
+  void _calcElasticConstsBatchViscoelastic(PylithScalar* const elasticConsts,
+					   const PylithScalar* properties,
+					   const PylithScalar* stateVars,
+					   const PylithScalar* totalStrain,
+					   const PylithScalar* initialStress,
+					   const PylithScalar* initialStrain,
+					   const int numPoints);
+
   /** Update state variables after solve as an elastic material.
    *
    * @param stateVars State variables at location.
@@ -453,6 +602,7 @@ private :
   /** Compute viscous strains (state variables) for the current time
    * step.
    *
+   * @param viscousStrain Array for viscous strain tensor [tensorSize].
    * @param stateVars State variables at location.
    * @param numStateVars Number of state variables.
    * @param properties Properties at location.
@@ -464,7 +614,8 @@ private :
    * @param initialStrain Initial strain tensor at location.
    * @param initialStrainSize Size of initial strain array.
    */
-  void _computeStateVars(const PylithScalar* stateVars,
+  void _computeStateVars(PylithScalar* const viscousStrain,
+			 const PylithScalar* stateVars,
 			 const int numStateVars,
 			 const PylithScalar* properties,
 			 const int numProperties,
@@ -478,8 +629,6 @@ private :
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
-  scalar_array _viscousStrain; ///< Array for viscous strain tensor
-
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
@@ -489,6 +638,12 @@ private :
   /// Method to use for _updateStateVars().
   updateStateVars_fn_type _updateStateVarsFn;
 
+  /// Method to use for _calcElasticConstsBatch().
+  calcElasticConstsBatch_fn_type _calcElasticConstsBatchFn;
+
+  /// Method to use for _calcStressBatch().
+  calcStressBatch_fn_type _calcStressBatchFn;
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -28,7 +28,7 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <cassert> // USES assert()
 #include <cstring> // USES memcpy()
@@ -150,7 +150,6 @@ pylith::materials::MaxwellPlaneStrain::MaxwellPlaneStrain(void) :
   _updateStateVarsFn(0)
 { // constructor
   useElasticBehavior(false);
-  _viscousStrain.resize(4);
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -164,6 +163,8 @@ pylith::materials::MaxwellPlaneStrain::~MaxwellPlaneStrain(void)
 void
 pylith::materials::MaxwellPlaneStrain::useElasticBehavior(const bool flag)
 { // useElasticBehavior
+  ElasticMaterial::useElasticBehavior(flag);
+
   if (flag) {
     _calcStressFn = 
       &pylith::materials::MaxwellPlaneStrain::_calcStressElastic;
@@ -230,7 +231,7 @@ pylith::materials::MaxwellPlaneStrain::_dbToProperties(
   propValues[p_lambda] = lambda;
   propValues[p_maxwellTime] = maxwellTime;
 
-  PetscLogFlops(7);
+  pylith::utils::EventLogger::logFlops(7);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -255,7 +256,7 @@ pylith::materials::MaxwellPlaneStrain::_nondimProperties(PylithScalar* const val
   values[p_maxwellTime] = 
     _normalizer->nondimensionalize(values[p_maxwellTime], timeScale);
 
-  PetscLogFlops(4);
+  pylith::utils::EventLogger::logFlops(4);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -280,7 +281,7 @@ pylith::materials::MaxwellPlaneStrain::_dimProperties(PylithScalar* const values
   values[p_maxwellTime] = 
     _normalizer->dimensionalize(values[p_maxwellTime], timeScale);
 
-  PetscLogFlops(4);
+  pylith::utils::EventLogger::logFlops(4);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -299,7 +300,7 @@ pylith::materials::MaxwellPlaneStrain::_dbToStateVars(
   assert(totalSize == numDBValues);
   memcpy(stateValues, &dbValues[0], totalSize*sizeof(PylithScalar));
 
-  PetscLogFlops(0);
+  pylith::utils::EventLogger::logFlops(0);
 } // _dbToStateVars
 
 // ----------------------------------------------------------------------
@@ -315,7 +316,7 @@ pylith::materials::MaxwellPlaneStrain::_nondimStateVars(PylithScalar* const valu
   const PylithScalar pressureScale = _normalizer->pressureScale();
   _normalizer->nondimensionalize(&values[s_stressZZInitial], 1, pressureScale);
 
-  PetscLogFlops(1);
+  pylith::utils::EventLogger::logFlops(1);
 } // _nondimStateVars
 
 // ----------------------------------------------------------------------
@@ -331,7 +332,7 @@ pylith::materials::MaxwellPlaneStrain::_dimStateVars(PylithScalar* const values,
   const PylithScalar pressureScale = _normalizer->pressureScale();
   _normalizer->dimensionalize(&values[s_stressZZInitial], 1, pressureScale);
 
-  PetscLogFlops(1);
+  pylith::utils::EventLogger::logFlops(1);
 } // _dimStateVars
 
 // ----------------------------------------------------------------------
@@ -396,7 +397,7 @@ pylith::materials::MaxwellPlaneStrain::_calcStressElastic(
   stress[1] = s12 + mu2 * e22 + initialStress[1];
   stress[2] = mu2 * e12 + initialStress[2];
 
-  PetscLogFlops(14);
+  pylith::utils::EventLogger::logFlops(14);
 } // _calcStressElastic
 
 #if 0
@@ -455,30 +456,32 @@ pylith::materials::MaxwellPlaneStrain::_calcStressViscoelastic(
   const PylithScalar meanStressTpdt = 3.0 * bulkModulus * (meanStrainTpdt - meanStrainInitial) + meanStressInitial;
 
   // Get viscous strains
+  PylithScalar viscousStrain[4];
   if (computeStateVars) {
-    _computeStateVars(stateVars, numStateVars,
+    _computeStateVars(viscousStrain,
+		      stateVars, numStateVars,
 		      properties, numProperties,
 		      totalStrain, strainSize,
 		      initialStress, initialStressSize,
 		      initialStrain, initialStrainSize);
   } else {
-    memcpy(&_viscousStrain[0], &stateVars[s_viscousStrain], 4*sizeof(PylithScalar));
+    memcpy(viscousStrain, &stateVars[s_viscousStrain], 4*sizeof(PylithScalar));
   } // else
 
   // Compute new stresses
-  stress[0] = meanStressTpdt + mu2 * (_viscousStrain[0] - devStrainInitial[0]);
-  stress[1] = meanStressTpdt + mu2 * (_viscousStrain[1] - devStrainInitial[1]);
-  stress[2] = mu2 * (_viscousStrain[3] - devStrainInitial[2]);
+  stress[0] = meanStressTpdt + mu2 * (viscousStrain[0] - devStrainInitial[0]);
+  stress[1] = meanStressTpdt + mu2 * (viscousStrain[1] - devStrainInitial[1]);
+  stress[2] = mu2 * (viscousStrain[3] - devStrainInitial[2]);
 
 #if 0
-  std::cout << "CALCSTRESS, viscousStrain:"; for(int i=0;i<4;++i) {std::cout << " " << _viscousStrain[i]; } std::cout << std::endl;
+  std::cout << "CALCSTRESS, viscousStrain:"; for(int i=0;i<4;++i) {std::cout << " " << viscousStrain[i]; } std::cout << std::endl;
   std::cout << "CALCSTRESS, totalStrain:"; for(int i=0;i<3;++i) {std::cout << " " << totalStrain[i]; } std::cout << std::endl;
   std::cout << "CALCSTRESS, meanStrain: " << meanStrainTpdt << std::endl;
   std::cout << "CALCSTRESS, meanStress: " << meanStressTpdt << std::endl;
   std::cout << "CALCSTRESS, stress:"; for(int i=0;i<3;++i) {std::cout << " " << stress[i]; } std::cout << std::endl;
 #endif
 
-  PetscLogFlops(30);
+  pylith::utils::EventLogger::logFlops(30);
 } // _calcStressViscoelastic
 
 // ----------------------------------------------------------------------
@@ -527,7 +530,7 @@ pylith::materials::MaxwellPlaneStrain::_calcElasticConstsElastic(
   elasticConsts[ 7] = 0; // C1222
   elasticConsts[ 8] = mu2; // C1212
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // _calcElasticConstsElastic
 
 // ----------------------------------------------------------------------
@@ -581,7 +584,7 @@ pylith::materials::MaxwellPlaneStrain::_calcElasticConstsViscoelastic(
   elasticConsts[ 7] = 0; // C1222
   elasticConsts[ 8] = 6.0 * visFac; // C1212
 
-  PetscLogFlops(10);
+  pylith::utils::EventLogger::logFlops(10);
 } // _calcElasticConstsViscoelastic
 
 // ----------------------------------------------------------------------
@@ -628,7 +631,7 @@ pylith::materials::MaxwellPlaneStrain::_updateStateVarsElastic(
   for (int iComp=0; iComp < 4; ++iComp) {
     stateVars[s_viscousStrain + iComp] = strainTpdt[iComp] - diag[iComp] * meanStrainTpdt;
   } // for
-  PetscLogFlops(13);
+  pylith::utils::EventLogger::logFlops(13);
 
   _needNewJacobian = true;
 } // _updateStateVarsElastic
@@ -661,7 +664,9 @@ pylith::materials::MaxwellPlaneStrain::_updateStateVarsViscoelastic(
 
   const int tensorSize = _tensorSize;
 
-  _computeStateVars(stateVars, numStateVars,
+  PylithScalar viscousStrain[4];
+  _computeStateVars(viscousStrain,
+		    stateVars, numStateVars,
 		    properties, numProperties,
 		    totalStrain, strainSize,
 		    initialStress, initialStressSize,
@@ -669,7 +674,7 @@ pylith::materials::MaxwellPlaneStrain::_updateStateVarsViscoelastic(
 
   memcpy(&stateVars[s_totalStrain], totalStrain, tensorSize * sizeof(PylithScalar));
 
-  memcpy(&stateVars[s_viscousStrain], &_viscousStrain[0], 4 * sizeof(PylithScalar));
+  memcpy(&stateVars[s_viscousStrain], viscousStrain, 4 * sizeof(PylithScalar));
 
   _needNewJacobian = false;
 
@@ -726,6 +731,7 @@ pylith::materials::MaxwellPlaneStrain::_stableTimeStepExplicit(const PylithScala
 // Compute viscous strain for current time step.
 void
 pylith::materials::MaxwellPlaneStrain::_computeStateVars(
+				         PylithScalar* const viscousStrain,
 				         const PylithScalar* stateVars,
 					 const int numStateVars,
 				         const PylithScalar* properties,
@@ -778,10 +784,10 @@ pylith::materials::MaxwellPlaneStrain::_computeStateVars(
   for (int iComp=0; iComp < 4; ++iComp) {
     devStrainTpdt = strainTpdt[iComp] - diag[iComp] * meanStrainTpdt;
     devStrainT = strainT[iComp] - diag[iComp] * meanStrainT;
-    _viscousStrain[iComp] = expFac * stateVars[s_viscousStrain+iComp] + dq * (devStrainTpdt - devStrainT);
+    viscousStrain[iComp] = expFac * stateVars[s_viscousStrain+iComp] + dq * (devStrainTpdt - devStrainT);
   } // for
 
-  PetscLogFlops(39);
+  pylith::utils::EventLogger::logFlops(39);
 } // _computeStateVars
 
 
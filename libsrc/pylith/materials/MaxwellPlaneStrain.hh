@@ -467,6 +467,7 @@ private :
   /** Compute viscous strains (state variables) for the current time
    * step.
    *
+   * @param viscousStrain Array for viscous strain tensor [4].
    * @param stateVars State variables at location.
    * @param numStateVars Number of state variables.
    * @param properties Properties at location.
@@ -478,7 +479,8 @@ private :
    * @param initialStrain Initial strain tensor at location.
    * @param initialStrainSize Size of initial strain array.
    */
-  void _computeStateVars(const PylithScalar* stateVars,
+  void _computeStateVars(PylithScalar* const viscousStrain,
+			 const PylithScalar* stateVars,
 			 const int numStateVars,
 			 const PylithScalar* properties,
 			 const int numProperties,
@@ -492,8 +494,6 @@ private :
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
-  scalar_array _viscousStrain; ///< Array for viscous strain tensor
-
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
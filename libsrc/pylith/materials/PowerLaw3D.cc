@@ -28,7 +28,10 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
+#include "petsc.h" // USES PetscInfo
 
 #include <cmath> // USES fabs()
 #include <cassert> // USES assert()
@@ -168,6 +171,7 @@ pylith::materials::PowerLaw3D::PowerLaw3D(void) :
   _calcStressFn(0),
   _updateStateVarsFn(0)
 { // constructor
+  EffectiveStress::resetStats(&_effStressStats);
   useElasticBehavior(false);
 } // constructor
 
@@ -182,6 +186,8 @@ pylith::materials::PowerLaw3D::~PowerLaw3D(void)
 void
 pylith::materials::PowerLaw3D::useElasticBehavior(const bool flag)
 { // useElasticBehavior
+  ElasticMaterial::useElasticBehavior(flag);
+
   if (flag) {
     _calcStressFn = 
       &pylith::materials::PowerLaw3D::_calcStressElastic;
@@ -200,6 +206,23 @@ pylith::materials::PowerLaw3D::useElasticBehavior(const bool flag)
   } // if/else
 } // useElasticBehavior
 
+// ----------------------------------------------------------------------
+// Log and reset iteration statistics for effective stress solves.
+void
+pylith::materials::PowerLaw3D::_logEffStressStats(void)
+{ // _logEffStressStats
+  if (_effStressStats.numSolves > 0) {
+    PetscErrorCode err =
+      PetscInfo5(NULL, "%s effective stress: %ld solves, %ld iterations, "
+		 "%ld solves required bracketing, %g iterations/solve.\n",
+		 label(), _effStressStats.numSolves,
+		 _effStressStats.numIterations, _effStressStats.numBracketed,
+		 double(_effStressStats.numIterations) / double(_effStressStats.numSolves));
+    PYLITH_CHECK_ERROR(err);
+  } // if
+  EffectiveStress::resetStats(&_effStressStats);
+} // _logEffStressStats
+
 // ----------------------------------------------------------------------
 // Compute properties from values in spatial database.
 void
@@ -252,7 +275,7 @@ pylith::materials::PowerLaw3D::_dbToProperties(
   propValues[p_referenceStress] = referenceStress;
   propValues[p_powerLawExponent] = powerLawExponent;
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -282,7 +305,7 @@ pylith::materials::PowerLaw3D::_nondimProperties(PylithScalar* const values,
   values[p_referenceStress] = 
     _normalizer->nondimensionalize(values[p_referenceStress], pressureScale);
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -311,7 +334,7 @@ pylith::materials::PowerLaw3D::_dimProperties(PylithScalar* const values,
   values[p_referenceStress] = 
     _normalizer->dimensionalize(values[p_referenceStress], pressureScale);
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -333,7 +356,7 @@ pylith::materials::PowerLaw3D::_dbToStateVars(
   memcpy(&stateValues[s_stress], &dbValues[db_stress],
 	 _tensorSize*sizeof(PylithScalar));
 
-  PetscLogFlops(0);
+  pylith::utils::EventLogger::logFlops(0);
 } // _dbToStateVars
 
 // ----------------------------------------------------------------------
@@ -349,7 +372,7 @@ pylith::materials::PowerLaw3D::_nondimStateVars(PylithScalar* const values,
   const PylithScalar pressureScale = _normalizer->pressureScale();
   _normalizer->nondimensionalize(&values[s_stress], _tensorSize, pressureScale);
 
-  PetscLogFlops(_tensorSize);
+  pylith::utils::EventLogger::logFlops(_tensorSize);
 } // _nondimStateVars
 
 // ----------------------------------------------------------------------
@@ -365,7 +388,7 @@ pylith::materials::PowerLaw3D::_dimStateVars(PylithScalar* const values,
   const PylithScalar pressureScale = _normalizer->pressureScale();
   _normalizer->dimensionalize(&values[s_stress], _tensorSize, pressureScale);
 
-  PetscLogFlops(_tensorSize);
+  pylith::utils::EventLogger::logFlops(_tensorSize);
 } // _dimStateVars
 
 // ----------------------------------------------------------------------
@@ -430,7 +453,7 @@ pylith::materials::PowerLaw3D::_stableTimeStepImplicit(
   PylithScalar maxwellTime = 10.0 * dtStable;
   std::cout << "Maxwell time:  " << maxwellTime << std::endl;
 #endif
-  PetscLogFlops(27);
+  pylith::utils::EventLogger::logFlops(27);
   return dtStable;
 } // _stableTimeStepImplicit
 
@@ -511,7 +534,7 @@ pylith::materials::PowerLaw3D::_calcStressElastic(
   stress[4] = mu2 * e23 + initialStress[4];
   stress[5] = mu2 * e13 + initialStress[5];
 
-  PetscLogFlops(25);
+  pylith::utils::EventLogger::logFlops(25);
 } // _calcStressElastic
 
 // ----------------------------------------------------------------------
@@ -649,7 +672,7 @@ pylith::materials::PowerLaw3D::_calcStressViscoelastic(
        ae * scalarProduct3D(devStressT, devStressInitial)) * timeFac;
     const PylithScalar d = timeFac * effStressT;
 
-    PetscLogFlops(92);
+    pylith::utils::EventLogger::logFlops(92);
 
     // If b, c, and d are all zero, then the effective stress is zero and we
     // don't need a root-finding algorithm. Otherwise, use the algorithm to
@@ -659,22 +682,24 @@ pylith::materials::PowerLaw3D::_calcStressViscoelastic(
       const PylithScalar stressScale = mu;
 
       // Put parameters into a struct and call root-finding algorithm.
-      _effStressParams.ae = ae;
-      _effStressParams.b = b;
-      _effStressParams.c = c;
-      _effStressParams.d = d;
-      _effStressParams.alpha = alpha;
-      _effStressParams.dt = _dt;
-      _effStressParams.effStressT = effStressT;
-      _effStressParams.powerLawExp = powerLawExp;
-      _effStressParams.referenceStrainRate = referenceStrainRate;
-      _effStressParams.referenceStress = referenceStress;
+      EffStressStruct effStressParams;
+      effStressParams.ae = ae;
+      effStressParams.b = b;
+      effStressParams.c = c;
+      effStressParams.d = d;
+      effStressParams.alpha = alpha;
+      effStressParams.dt = _dt;
+      effStressParams.effStressT = effStressT;
+      effStressParams.powerLawExp = powerLawExp;
+      effStressParams.referenceStrainRate = referenceStrainRate;
+      effStressParams.referenceStress = referenceStress;
       
       const PylithScalar effStressInitialGuess = effStressT;
 
       effStressTpdt =
 	EffectiveStress::calculate<PowerLaw3D>(effStressInitialGuess,
-					       stressScale, this);
+					       stressScale, effStressParams,
+					       &_effStressStats);
     } // if
 
     // Compute stresses from effective stress.
@@ -694,7 +719,7 @@ pylith::materials::PowerLaw3D::_calcStressViscoelastic(
       stress[iComp] = devStressTpdt + diag[iComp] *
 	(meanStressTpdt + meanStressInitial);
     } // for
-    PetscLogFlops(14 + 8 * tensorSize);
+    pylith::utils::EventLogger::logFlops(14 + 8 * tensorSize);
 
     // If state variables have already been updated, current stress is already
     // contained in stress.
@@ -708,18 +733,19 @@ pylith::materials::PowerLaw3D::_calcStressViscoelastic(
 // Effective stress function that computes effective stress function only
 // (no derivative).
 PylithScalar
-pylith::materials::PowerLaw3D::effStressFunc(const PylithScalar effStressTpdt)
+pylith::materials::PowerLaw3D::effStressFunc(const PylithScalar effStressTpdt,
+					     const EffStressStruct& params)
 { // effStressFunc
-  const PylithScalar ae = _effStressParams.ae;
-  const PylithScalar b = _effStressParams.b;
-  const PylithScalar c = _effStressParams.c;
-  const PylithScalar d = _effStressParams.d;
-  const PylithScalar alpha = _effStressParams.alpha;
-  const PylithScalar dt = _effStressParams.dt;
-  const PylithScalar effStressT = _effStressParams.effStressT;
-  const PylithScalar powerLawExp = _effStressParams.powerLawExp;
-  const PylithScalar referenceStrainRate = _effStressParams.referenceStrainRate;
-  const PylithScalar referenceStress = _effStressParams.referenceStress;
+  const PylithScalar ae = params.ae;
+  const PylithScalar b = params.b;
+  const PylithScalar c = params.c;
+  const PylithScalar d = params.d;
+  const PylithScalar alpha = params.alpha;
+  const PylithScalar dt = params.dt;
+  const PylithScalar effStressT = params.effStressT;
+  const PylithScalar powerLawExp = params.powerLawExp;
+  const PylithScalar referenceStrainRate = params.referenceStrainRate;
+  const PylithScalar referenceStress = params.referenceStress;
   const PylithScalar factor1 = 1.0-alpha;
   const PylithScalar effStressTau = factor1 * effStressT +
     alpha * effStressTpdt;
@@ -729,7 +755,7 @@ pylith::materials::PowerLaw3D::effStressFunc(const PylithScalar effStressTpdt)
   const PylithScalar y = a * a * effStressTpdt * effStressTpdt - b +
     c * gammaTau - d * d * gammaTau * gammaTau;
 
-  PetscLogFlops(21);
+  pylith::utils::EventLogger::logFlops(21);
 
   return y;
 } // effStressFunc
@@ -738,17 +764,18 @@ pylith::materials::PowerLaw3D::effStressFunc(const PylithScalar effStressTpdt)
 // Effective stress function that computes effective stress function
 // derivative only (no function value).
 PylithScalar
-pylith::materials::PowerLaw3D::effStressDerivFunc(const PylithScalar effStressTpdt)
+pylith::materials::PowerLaw3D::effStressDerivFunc(const PylithScalar effStressTpdt,
+						  const EffStressStruct& params)
 { // effStressDFunc
-  const PylithScalar ae = _effStressParams.ae;
-  const PylithScalar c = _effStressParams.c;
-  const PylithScalar d = _effStressParams.d;
-  const PylithScalar alpha = _effStressParams.alpha;
-  const PylithScalar dt = _effStressParams.dt;
-  const PylithScalar effStressT = _effStressParams.effStressT;
-  const PylithScalar powerLawExp = _effStressParams.powerLawExp;
-  const PylithScalar referenceStrainRate = _effStressParams.referenceStrainRate;
-  const PylithScalar referenceStress = _effStressParams.referenceStress;
+  const PylithScalar ae = params.ae;
+  const PylithScalar c = params.c;
+  const PylithScalar d = params.d;
+  const PylithScalar alpha = params.alpha;
+  const PylithScalar dt = params.dt;
+  const PylithScalar effStressT = params.effStressT;
+  const PylithScalar powerLawExp = params.powerLawExp;
+  const PylithScalar referenceStrainRate = params.referenceStrainRate;
+  const PylithScalar referenceStress = params.referenceStress;
   const PylithScalar factor1 = 1.0-alpha;
   const PylithScalar effStressTau = factor1 * effStressT +
     alpha * effStressTpdt;
@@ -762,7 +789,7 @@ pylith::materials::PowerLaw3D::effStressDerivFunc(const PylithScalar effStressTp
   const PylithScalar dy = 2.0 * a * a * effStressTpdt + dGammaTau *
     (2.0 * a * alpha * dt * effStressTpdt * effStressTpdt +
      c - 2.0 * d * d * gammaTau);
-  PetscLogFlops(36);
+  pylith::utils::EventLogger::logFlops(36);
 
   return dy;
 } // effStressDFunc
@@ -773,21 +800,22 @@ pylith::materials::PowerLaw3D::effStressDerivFunc(const PylithScalar effStressTp
 void
 pylith::materials::PowerLaw3D::effStressFuncDerivFunc(PylithScalar* func,
 						      PylithScalar* dfunc,
-						      const PylithScalar effStressTpdt)
+						      const PylithScalar effStressTpdt,
+						      const EffStressStruct& params)
 { // effStressFuncDFunc
   PylithScalar y = *func;
   PylithScalar dy = *dfunc;
 
-  const PylithScalar ae = _effStressParams.ae;
-  const PylithScalar b = _effStressParams.b;
-  const PylithScalar c = _effStressParams.c;
-  const PylithScalar d = _effStressParams.d;
-  const PylithScalar alpha = _effStressParams.alpha;
-  const PylithScalar dt = _effStressParams.dt;
-  const PylithScalar effStressT = _effStressParams.effStressT;
-  const PylithScalar powerLawExp = _effStressParams.powerLawExp;
-  const PylithScalar referenceStrainRate = _effStressParams.referenceStrainRate;
-  const PylithScalar referenceStress = _effStressParams.referenceStress;
+  const PylithScalar ae = params.ae;
+  const PylithScalar b = params.b;
+  const PylithScalar c = params.c;
+  const PylithScalar d = params.d;
+  const PylithScalar alpha = params.alpha;
+  const PylithScalar dt = params.dt;
+  const PylithScalar effStressT = params.effStressT;
+  const PylithScalar powerLawExp = params.powerLawExp;
+  const PylithScalar referenceStrainRate = params.referenceStrainRate;
+  const PylithScalar referenceStress = params.referenceStress;
   const PylithScalar factor1 = 1.0-alpha;
   const PylithScalar effStressTau = factor1 * effStressT +
     alpha * effStressTpdt;
@@ -810,7 +838,7 @@ pylith::materials::PowerLaw3D::effStressFuncDerivFunc(PylithScalar* func,
   *func = y;
   *dfunc = dy;
 
-  PetscLogFlops(46);
+  pylith::utils::EventLogger::logFlops(46);
 } // effStressFuncDFunc
 
 // ----------------------------------------------------------------------
@@ -886,7 +914,7 @@ pylith::materials::PowerLaw3D::_calcElasticConstsElastic(
   elasticConsts[34] = 0; // C1323
   elasticConsts[35] = mu2; // C1313
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // _calcElasticConstsElastic
 
 // ----------------------------------------------------------------------
@@ -1017,7 +1045,7 @@ pylith::materials::PowerLaw3D::_calcElasticConstsViscoelastic(
      ae * scalarProduct3D(devStressT, devStressInitial)) * timeFac;
   const PylithScalar d = timeFac * effStressT;
 
-  PetscLogFlops(92);
+  pylith::utils::EventLogger::logFlops(92);
 
   // If b = c = d = 0, the effective stress is zero and the elastic constants
   // will be the same as for the elastic case. Otherwise, compute the tangent
@@ -1039,22 +1067,24 @@ pylith::materials::PowerLaw3D::_calcElasticConstsViscoelastic(
     const PylithScalar stressScale = mu;
   
     // Put parameters into a struct and call root-finding algorithm.
-    _effStressParams.ae = ae;
-    _effStressParams.b = b;
-    _effStressParams.c = c;
-    _effStressParams.d = d;
-    _effStressParams.alpha = alpha;
-    _effStressParams.dt = _dt;
-    _effStressParams.effStressT = effStressT;
-    _effStressParams.powerLawExp = powerLawExp;
-    _effStressParams.referenceStrainRate = referenceStrainRate;
-    _effStressParams.referenceStress = referenceStress;
+    EffStressStruct effStressParams;
+    effStressParams.ae = ae;
+    effStressParams.b = b;
+    effStressParams.c = c;
+    effStressParams.d = d;
+    effStressParams.alpha = alpha;
+    effStressParams.dt = _dt;
+    effStressParams.effStressT = effStressT;
+    effStressParams.powerLawExp = powerLawExp;
+    effStressParams.referenceStrainRate = referenceStrainRate;
+    effStressParams.referenceStress = referenceStress;
     
     const PylithScalar effStressInitialGuess = effStressT;
     
     const PylithScalar effStressTpdt =
       EffectiveStress::calculate<PowerLaw3D>(effStressInitialGuess,
-					     stressScale, this);
+					     stressScale, effStressParams,
+					     &_effStressStats);
   
     // Compute quantities at intermediate time tau used to compute values at
     // end of time step.
@@ -1145,7 +1175,7 @@ pylith::materials::PowerLaw3D::_calcElasticConstsViscoelastic(
     elasticConsts[33] = 0; // C1312
     elasticConsts[34] = 0; // C1323
     elasticConsts[35] = dStress13dStrain13; // C1313
-    PetscLogFlops(114);
+    pylith::utils::EventLogger::logFlops(114);
   } // else
 } // _calcElasticConstsViscoelastic
 
@@ -1318,7 +1348,7 @@ pylith::materials::PowerLaw3D::_updateStateVarsViscoelastic(
     (scalarProduct3D(strainPPTpdt, devStressT) +
      ae * scalarProduct3D(devStressT, devStressInitial)) * timeFac;
   const PylithScalar d = timeFac * effStressT;
-  PetscLogFlops(92);
+  pylith::utils::EventLogger::logFlops(92);
 
   // If b, c, and d are all zero, then the effective stress is zero and we
   // don't need a root-finding algorithm. Otherwise, use the algorithm to
@@ -1328,22 +1358,24 @@ pylith::materials::PowerLaw3D::_updateStateVarsViscoelastic(
     const PylithScalar stressScale = mu;
 
     // Put parameters into a struct and call root-finding algorithm.
-    _effStressParams.ae = ae;
-    _effStressParams.b = b;
-    _effStressParams.c = c;
-    _effStressParams.d = d;
-    _effStressParams.alpha = alpha;
-    _effStressParams.dt = _dt;
-    _effStressParams.effStressT = effStressT;
-    _effStressParams.powerLawExp = powerLawExp;
-    _effStressParams.referenceStrainRate = referenceStrainRate;
-    _effStressParams.referenceStress = referenceStress;
+    EffStressStruct effStressParams;
+    effStressParams.ae = ae;
+    effStressParams.b = b;
+    effStressParams.c = c;
+    effStressParams.d = d;
+    effStressParams.alpha = alpha;
+    effStressParams.dt = _dt;
+    effStressParams.effStressT = effStressT;
+    effStressParams.powerLawExp = powerLawExp;
+    effStressParams.referenceStrainRate = referenceStrainRate;
+    effStressParams.referenceStress = referenceStress;
 
     const PylithScalar effStressInitialGuess = effStressT;
 
     effStressTpdt =
       EffectiveStress::calculate<PowerLaw3D>(effStressInitialGuess,
-					     stressScale, this);
+					     stressScale, effStressParams,
+					     &_effStressStats);
 
   } // if
 
@@ -1369,7 +1401,7 @@ pylith::materials::PowerLaw3D::_updateStateVarsViscoelastic(
   } // for
 
   _needNewJacobian = true;
-  PetscLogFlops(14 + _tensorSize * 15);
+  pylith::utils::EventLogger::logFlops(14 + _tensorSize * 15);
 
 } // _updateStateVarsViscoelastic
 
@@ -28,7 +28,10 @@
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
+#include "petsc.h" // USES PetscInfo
 
 #include <cmath> // USES fabs()
 #include <cassert> // USES assert()
@@ -170,6 +173,7 @@ pylith::materials::PowerLawPlaneStrain::PowerLawPlaneStrain(void) :
   _calcStressFn(0),
   _updateStateVarsFn(0)
 { // constructor
+  EffectiveStress::resetStats(&_effStressStats);
   useElasticBehavior(false);
 } // constructor
 
@@ -184,6 +188,8 @@ pylith::materials::PowerLawPlaneStrain::~PowerLawPlaneStrain(void)
 void
 pylith::materials::PowerLawPlaneStrain::useElasticBehavior(const bool flag)
 { // useElasticBehavior
+  ElasticMaterial::useElasticBehavior(flag);
+
   if (flag) {
     _calcStressFn = 
       &pylith::materials::PowerLawPlaneStrain::_calcStressElastic;
@@ -202,6 +208,23 @@ pylith::materials::PowerLawPlaneStrain::useElasticBehavior(const bool flag)
   } // if/else
 } // useElasticBehavior
 
+// ----------------------------------------------------------------------
+// Log and reset iteration statistics for effective stress solves.
+void
+pylith::materials::PowerLawPlaneStrain::_logEffStressStats(void)
+{ // _logEffStressStats
+  if (_effStressStats.numSolves > 0) {
+    PetscErrorCode err =
+      PetscInfo5(NULL, "%s effective stress: %ld solves, %ld iterations, "
+		 "%ld solves required bracketing, %g iterations/solve.\n",
+		 label(), _effStressStats.numSolves,
+		 _effStressStats.numIterations, _effStressStats.numBracketed,
+		 double(_effStressStats.numIterations) / double(_effStressStats.numSolves));
+    PYLITH_CHECK_ERROR(err);
+  } // if
+  EffectiveStress::resetStats(&_effStressStats);
+} // _logEffStressStats
+
 // ----------------------------------------------------------------------
 // Compute properties from values in spatial database.
 void
@@ -254,7 +277,7 @@ pylith::materials::PowerLawPlaneStrain::_dbToProperties(
   propValues[p_referenceStress] = referenceStress;
   propValues[p_powerLawExponent] = powerLawExponent;
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 } // _dbToProperties
 
 // ----------------------------------------------------------------------
@@ -284,7 +307,7 @@ pylith::materials::PowerLawPlaneStrain::_nondimProperties(PylithScalar* const va
   values[p_referenceStress] = 
     _normalizer->nondimensionalize(values[p_referenceStress], pressureScale);
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 } // _nondimProperties
 
 // ----------------------------------------------------------------------
@@ -313,7 +336,7 @@ pylith::materials::PowerLawPlaneStrain::_dimProperties(PylithScalar* const value
   values[p_referenceStress] = 
     _normalizer->dimensionalize(values[p_referenceStress], pressureScale);
 
-  PetscLogFlops(6);
+  pylith::utils::EventLogger::logFlops(6);
 } // _dimProperties
 
 // ----------------------------------------------------------------------
@@ -332,7 +355,7 @@ pylith::materials::PowerLawPlaneStrain::_dbToStateVars(
   assert(totalSize == numDBValues);
   memcpy(stateValues, &dbValues[0], totalSize*sizeof(PylithScalar));
 
-  PetscLogFlops(0);
+  pylith::utils::EventLogger::logFlops(0);
 } // _dbToStateVars
 
 // ----------------------------------------------------------------------
@@ -349,7 +372,7 @@ pylith::materials::PowerLawPlaneStrain::_nondimStateVars(PylithScalar* const val
   _normalizer->nondimensionalize(&values[s_stress4], 4, pressureScale);
   _normalizer->nondimensionalize(&values[s_stressZZInitial], 1, pressureScale);
 
-  PetscLogFlops(5);
+  pylith::utils::EventLogger::logFlops(5);
 } // _nondimStateVars
 
 // ----------------------------------------------------------------------
@@ -366,7 +389,7 @@ pylith::materials::PowerLawPlaneStrain::_dimStateVars(PylithScalar* const values
   _normalizer->dimensionalize(&values[s_stress4], 4, pressureScale);
   _normalizer->dimensionalize(&values[s_stressZZInitial], 1, pressureScale);
 
-  PetscLogFlops(_tensorSize);
+  pylith::utils::EventLogger::logFlops(_tensorSize);
 } // _dimStateVars
 
 // ----------------------------------------------------------------------
@@ -430,7 +453,7 @@ pylith::materials::PowerLawPlaneStrain::_stableTimeStepImplicit(
   PylithScalar maxwellTime = 10.0 * dtStable;
   std::cout << "Maxwell time:  " << maxwellTime << std::endl;
 #endif
-  PetscLogFlops(23);
+  pylith::utils::EventLogger::logFlops(23);
   return dtStable;
 } // _stableTimeStepImplicit
 
@@ -504,7 +527,7 @@ pylith::materials::PowerLawPlaneStrain::_calcStressElastic(
   stress[1] = s12 + mu2 * e22 + initialStress[1];
   stress[2] = mu2 * e12 + initialStress[2];
 
-  PetscLogFlops(14);
+  pylith::utils::EventLogger::logFlops(14);
 } // _calcStressElastic
 
 // ----------------------------------------------------------------------
@@ -631,7 +654,7 @@ pylith::materials::PowerLawPlaneStrain::_calcStressViscoelastic(
        ae * scalarProduct2DPS(devStressT, devStressInitial)) * timeFac;
     const PylithScalar d = timeFac * effStressT;
 
-    PetscLogFlops(94);
+    pylith::utils::EventLogger::logFlops(94);
 
     // If b, c, and d are all zero, then the effective stress is zero and we
     // don't need a root-finding algorithm. Otherwise, use the algorithm to
@@ -641,22 +664,24 @@ pylith::materials::PowerLawPlaneStrain::_calcStressViscoelastic(
       const PylithScalar stressScale = mu;
 
       // Put parameters into a struct and call root-finding algorithm.
-      _effStressParams.ae = ae;
-      _effStressParams.b = b;
-      _effStressParams.c = c;
-      _effStressParams.d = d;
-      _effStressParams.alpha = alpha;
-      _effStressParams.dt = _dt;
-      _effStressParams.effStressT = effStressT;
-      _effStressParams.powerLawExp = powerLawExp;
-      _effStressParams.referenceStrainRate = referenceStrainRate;
-      _effStressParams.referenceStress = referenceStress;
+      EffStressStruct effStressParams;
+      effStressParams.ae = ae;
+      effStressParams.b = b;
+      effStressParams.c = c;
+      effStressParams.d = d;
+      effStressParams.alpha = alpha;
+      effStressParams.dt = _dt;
+      effStressParams.effStressT = effStressT;
+      effStressParams.powerLawExp = powerLawExp;
+      effStressParams.referenceStrainRate = referenceStrainRate;
+      effStressParams.referenceStress = referenceStress;
       
       const PylithScalar effStressInitialGuess = effStressT;
 
       effStressTpdt =
 	EffectiveStress::calculate<PowerLawPlaneStrain>(effStressInitialGuess,
-					       stressScale, this);
+					       stressScale, effStressParams,
+					       &_effStressStats);
     } // if
 
     // Compute stresses from effective stress.
@@ -680,7 +705,7 @@ pylith::materials::PowerLawPlaneStrain::_calcStressViscoelastic(
     stress[0] = totalStress[0];
     stress[1] = totalStress[1];
     stress[2] = totalStress[3];
-    PetscLogFlops(14 + 8 * tensorSizePS);
+    pylith::utils::EventLogger::logFlops(14 + 8 * tensorSizePS);
 
     // If state variables have already been updated, current stress is already
     // contained in stress.
@@ -696,18 +721,19 @@ pylith::materials::PowerLawPlaneStrain::_calcStressViscoelastic(
 // Effective stress function that computes effective stress function only
 // (no derivative).
 PylithScalar
-pylith::materials::PowerLawPlaneStrain::effStressFunc(const PylithScalar effStressTpdt)
+pylith::materials::PowerLawPlaneStrain::effStressFunc(const PylithScalar effStressTpdt,
+						      const EffStressStruct& params)
 { // effStressFunc
-  const PylithScalar ae = _effStressParams.ae;
-  const PylithScalar b = _effStressParams.b;
-  const PylithScalar c = _effStressParams.c;
-  const PylithScalar d = _effStressParams.d;
-  const PylithScalar alpha = _effStressParams.alpha;
-  const PylithScalar dt = _effStressParams.dt;
-  const PylithScalar effStressT = _effStressParams.effStressT;
-  const PylithScalar powerLawExp = _effStressParams.powerLawExp;
-  const PylithScalar referenceStrainRate = _effStressParams.referenceStrainRate;
-  const PylithScalar referenceStress = _effStressParams.referenceStress;
+  const PylithScalar ae = params.ae;
+  const PylithScalar b = params.b;
+  const PylithScalar c = params.c;
+  const PylithScalar d = params.d;
+  const PylithScalar alpha = params.alpha;
+  const PylithScalar dt = params.dt;
+  const PylithScalar effStressT = params.effStressT;
+  const PylithScalar powerLawExp = params.powerLawExp;
+  const PylithScalar referenceStrainRate = params.referenceStrainRate;
+  const PylithScalar referenceStress = params.referenceStress;
   const PylithScalar factor1 = 1.0-alpha;
   const PylithScalar effStressTau = factor1 * effStressT +
     alpha * effStressTpdt;
@@ -717,7 +743,7 @@ pylith::materials::PowerLawPlaneStrain::effStressFunc(const PylithScalar effStre
   const PylithScalar y = a * a * effStressTpdt * effStressTpdt - b +
     c * gammaTau - d * d * gammaTau * gammaTau;
 
-  PetscLogFlops(22);
+  pylith::utils::EventLogger::logFlops(22);
 
   return y;
 } // effStressFunc
@@ -726,17 +752,18 @@ pylith::materials::PowerLawPlaneStrain::effStressFunc(const PylithScalar effStre
 // Effective stress function that computes effective stress function
 // derivative only (no function value).
 PylithScalar
-pylith::materials::PowerLawPlaneStrain::effStressDerivFunc(const PylithScalar effStressTpdt)
+pylith::materials::PowerLawPlaneStrain::effStressDerivFunc(const PylithScalar effStressTpdt,
+							   const EffStressStruct& params)
 { // effStressDFunc
-  const PylithScalar ae = _effStressParams.ae;
-  const PylithScalar c = _effStressParams.c;
-  const PylithScalar d = _effStressParams.d;
-  const PylithScalar alpha = _effStressParams.alpha;
-  const PylithScalar dt = _effStressParams.dt;
-  const PylithScalar effStressT = _effStressParams.effStressT;
-  const PylithScalar powerLawExp = _effStressParams.powerLawExp;
-  const PylithScalar referenceStrainRate = _effStressParams.referenceStrainRate;
-  const PylithScalar referenceStress = _effStressParams.referenceStress;
+  const PylithScalar ae = params.ae;
+  const PylithScalar c = params.c;
+  const PylithScalar d = params.d;
+  const PylithScalar alpha = params.alpha;
+  const PylithScalar dt = params.dt;
+  const PylithScalar effStressT = params.effStressT;
+  const PylithScalar powerLawExp = params.powerLawExp;
+  const PylithScalar referenceStrainRate = params.referenceStrainRate;
+  const PylithScalar referenceStress = params.referenceStress;
   const PylithScalar factor1 = 1.0-alpha;
   const PylithScalar effStressTau = factor1 * effStressT +
     alpha * effStressTpdt;
@@ -750,7 +777,7 @@ pylith::materials::PowerLawPlaneStrain::effStressDerivFunc(const PylithScalar ef
   const PylithScalar dy = 2.0 * a * a * effStressTpdt + dGammaTau *
     (2.0 * a * alpha * dt * effStressTpdt * effStressTpdt +
      c - 2.0 * d * d * gammaTau);
-  PetscLogFlops(36);
+  pylith::utils::EventLogger::logFlops(36);
 
   return dy;
 } // effStressDFunc
@@ -761,21 +788,22 @@ pylith::materials::PowerLawPlaneStrain::effStressDerivFunc(const PylithScalar ef
 void
 pylith::materials::PowerLawPlaneStrain::effStressFuncDerivFunc( PylithScalar* func,
 								PylithScalar* dfunc,
-								const PylithScalar effStressTpdt)
+								const PylithScalar effStressTpdt,
+								const EffStressStruct& params)
 { // effStressFuncDFunc
   PylithScalar y = *func;
   PylithScalar dy = *dfunc;
 
-  const PylithScalar ae = _effStressParams.ae;
-  const PylithScalar b = _effStressParams.b;
-  const PylithScalar c = _effStressParams.c;
-  const PylithScalar d = _effStressParams.d;
-  const PylithScalar alpha = _effStressParams.alpha;
-  const PylithScalar dt = _effStressParams.dt;
-  const PylithScalar effStressT = _effStressParams.effStressT;
-  const PylithScalar powerLawExp = _effStressParams.powerLawExp;
-  const PylithScalar referenceStrainRate = _effStressParams.referenceStrainRate;
-  const PylithScalar referenceStress = _effStressParams.referenceStress;
+  const PylithScalar ae = params.ae;
+  const PylithScalar b = params.b;
+  const PylithScalar c = params.c;
+  const PylithScalar d = params.d;
+  const PylithScalar alpha = params.alpha;
+  const PylithScalar dt = params.dt;
+  const PylithScalar effStressT = params.effStressT;
+  const PylithScalar powerLawExp = params.powerLawExp;
+  const PylithScalar referenceStrainRate = params.referenceStrainRate;
+  const PylithScalar referenceStress = params.referenceStress;
   const PylithScalar factor1 = 1.0-alpha;
   const PylithScalar effStressTau = factor1 * effStressT + alpha *
     effStressTpdt;
@@ -798,7 +826,7 @@ pylith::materials::PowerLawPlaneStrain::effStressFuncDerivFunc( PylithScalar* fu
   *func = y;
   *dfunc = dy;
 
-  PetscLogFlops(46);
+  pylith::utils::EventLogger::logFlops(46);
 } // effStressFuncDFunc
 
 // ----------------------------------------------------------------------
@@ -847,7 +875,7 @@ pylith::materials::PowerLawPlaneStrain::_calcElasticConstsElastic(
   elasticConsts[ 7] = 0; // C1222
   elasticConsts[ 8] = mu2; // C1212
 
-  PetscLogFlops(2);
+  pylith::utils::EventLogger::logFlops(2);
 } // _calcElasticConstsElastic
 
 // ----------------------------------------------------------------------
@@ -968,7 +996,7 @@ pylith::materials::PowerLawPlaneStrain::_calcElasticConstsViscoelastic(
      ae * scalarProduct2DPS(devStressT, devStressInitial)) * timeFac;
   const PylithScalar d = timeFac * effStressT;
 
-  PetscLogFlops(96);
+  pylith::utils::EventLogger::logFlops(96);
 
   // If b = c = d = 0, the effective stress is zero and the elastic constants
   // will be the same as for the elastic case. Otherwise, compute the tangent
@@ -990,22 +1018,24 @@ pylith::materials::PowerLawPlaneStrain::_calcElasticConstsViscoelastic(
     const PylithScalar stressScale = mu;
   
     // Put parameters into a struct and call root-finding algorithm.
-    _effStressParams.ae = ae;
-    _effStressParams.b = b;
-    _effStressParams.c = c;
-    _effStressParams.d = d;
-    _effStressParams.alpha = alpha;
-    _effStressParams.dt = _dt;
-    _effStressParams.effStressT = effStressT;
-    _effStressParams.powerLawExp = powerLawExp;
-    _effStressParams.referenceStrainRate = referenceStrainRate;
-    _effStressParams.referenceStress = referenceStress;
+    EffStressStruct effStressParams;
+    effStressParams.ae = ae;
+    effStressParams.b = b;
+    effStressParams.c = c;
+    effStressParams.d = d;
+    effStressParams.alpha = alpha;
+    effStressParams.dt = _dt;
+    effStressParams.effStressT = effStressT;
+    effStressParams.powerLawExp = powerLawExp;
+    effStressParams.referenceStrainRate = referenceStrainRate;
+    effStressParams.referenceStress = referenceStress;
     
     const PylithScalar effStressInitialGuess = effStressT;
     
     const PylithScalar effStressTpdt =
       EffectiveStress::calculate<PowerLawPlaneStrain>(effStressInitialGuess,
-					     stressScale, this);
+					     stressScale, effStressParams,
+					     &_effStressStats);
   
     // Compute quantities at intermediate time tau used to compute values at
     // end of time step.
@@ -1054,7 +1084,7 @@ pylith::materials::PowerLawPlaneStrain::_calcElasticConstsViscoelastic(
     elasticConsts[ 6] = 0.0; // C1211
     elasticConsts[ 7] = 0.0; // C1222
     elasticConsts[ 8] = dStress12dStrain12; // C1212
-    PetscLogFlops(71);
+    pylith::utils::EventLogger::logFlops(71);
   } // else
 } // _calcElasticConstsViscoelastic
 
@@ -1225,7 +1255,7 @@ pylith::materials::PowerLawPlaneStrain::_updateStateVarsViscoelastic(
     (scalarProduct2DPS(strainPPTpdt, devStressT) +
      ae * scalarProduct2DPS(devStressT, devStressInitial)) * timeFac;
   const PylithScalar d = timeFac * effStressT;
-  PetscLogFlops(96);
+  pylith::utils::EventLogger::logFlops(96);
 
   // If b, c, and d are all zero, then the effective stress is zero and we
   // don't need a root-finding algorithm. Otherwise, use the algorithm to
@@ -1235,22 +1265,24 @@ pylith::materials::PowerLawPlaneStrain::_updateStateVarsViscoelastic(
     const PylithScalar stressScale = mu;
 
     // Put parameters into a struct and call root-finding algorithm.
-    _effStressParams.ae = ae;
-    _effStressParams.b = b;
-    _effStressParams.c = c;
-    _effStressParams.d = d;
-    _effStressParams.alpha = alpha;
-    _effStressParams.dt = _dt;
-    _effStressParams.effStressT = effStressT;
-    _effStressParams.powerLawExp = powerLawExp;
-    _effStressParams.referenceStrainRate = referenceStrainRate;
-    _effStressParams.referenceStress = referenceStress;
+    EffStressStruct effStressParams;
+    effStressParams.ae = ae;
+    effStressParams.b = b;
+    effStressParams.c = c;
+    effStressParams.d = d;
+    effStressParams.alpha = alpha;
+    effStressParams.dt = _dt;
+    effStressParams.effStressT = effStressT;
+    effStressParams.powerLawExp = powerLawExp;
+    effStressParams.referenceStrainRate = referenceStrainRate;
+    effStressParams.referenceStress = referenceStress;
 
     const PylithScalar effStressInitialGuess = effStressT;
 
     effStressTpdt =
       EffectiveStress::calculate<PowerLawPlaneStrain>(effStressInitialGuess,
-					     stressScale, this);
+					     stressScale, effStressParams,
+					     &_effStressStats);
 
   } // if
 
@@ -1276,7 +1308,7 @@ pylith::materials::PowerLawPlaneStrain::_updateStateVarsViscoelastic(
   } // for
 
   _needNewJacobian = true;
-  PetscLogFlops(14 + tensorSizePS * 15);
+  pylith::utils::EventLogger::logFlops(14 + tensorSizePS * 15);
 
 } // _updateStateVarsViscoelastic
 
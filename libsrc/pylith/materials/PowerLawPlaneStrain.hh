@@ -26,6 +26,7 @@
 
 // Include directives ---------------------------------------------------
 #include "ElasticMaterial.hh" // ISA ElasticMaterial
+#include "EffectiveStress.hh" // HASA EffectiveStress::Stats
 
 // PowerlawPlaneStrain----------------------------------------------------------
 /** @brief 2-D, plane strain, power-law viscoelastic material. 
@@ -42,6 +43,28 @@ class pylith::materials::PowerLawPlaneStrain : public ElasticMaterial
 { // class PowerLawPlaneStrain
   friend class TestPowerLawPlaneStrain; // unit testing
 
+  // PUBLIC STRUCTS /////////////////////////////////////////////////////
+public :
+
+  /** Parameters for the effective stress function at a point.
+   *
+   * The structure is owned by the caller computing the stress, so
+   * the effective stress functions do not depend on any data stored
+   * in the material and may be evaluated concurrently.
+   */
+  struct EffStressStruct {
+    PylithScalar ae;
+    PylithScalar b;
+    PylithScalar c;
+    PylithScalar d;
+    PylithScalar alpha;
+    PylithScalar dt;
+    PylithScalar effStressT;
+    PylithScalar powerLawExp;
+    PylithScalar referenceStrainRate;
+    PylithScalar referenceStress;
+  };
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -63,32 +86,48 @@ public :
    */
   void useElasticBehavior(const bool flag);
 
+  /** Get iteration statistics for effective stress solves since the
+   * last time step was set.
+   *
+   * @returns Iteration statistics.
+   */
+  const EffectiveStress::Stats& effStressStats(void) const;
+
   /** Compute effective stress function.
    *
    * @param effStressTpdt Effective stress value.
+   * @param params Parameters for effective stress function.
    *
    * @returns Effective stress function value.
    */
-  PylithScalar effStressFunc(const PylithScalar effStressTpdt);
+  static
+  PylithScalar effStressFunc(const PylithScalar effStressTpdt,
+			     const EffStressStruct& params);
 
   /** Compute effective stress function derivative.
    *
    * @param effStressTpdt Effective stress value.
+   * @param params Parameters for effective stress function.
    *
    * @returns Effective stress function derivative value.
    */
-  PylithScalar effStressDerivFunc(const PylithScalar effStressTpdt);
+  static
+  PylithScalar effStressDerivFunc(const PylithScalar effStressTpdt,
+				  const EffStressStruct& params);
 
   /** Compute effective stress function and derivative.
    *
    * @param func Returned effective stress function value.
    * @param dfunc Returned effective stress function derivative value.
    * @param effStressTpdt Effective stress value.
+   * @param params Parameters for effective stress function.
    *
    */
+  static
   void effStressFuncDerivFunc(PylithScalar* func,
 			      PylithScalar* dfunc,
-			      const PylithScalar effStressTpdt);
+			      const PylithScalar effStressTpdt,
+			      const EffStressStruct& params);
 
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
@@ -323,6 +362,9 @@ private :
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
+  /// Log and reset iteration statistics for effective stress solves.
+  void _logEffStressStats(void);
+
   /** Compute stress tensor from properties as an elastic material.
    *
    * @param stress Array for stress tensor.
@@ -486,28 +528,9 @@ private :
 				    const int initialStrainSize);
 
 
-  // PRIVATE STRUCTS ////////////////////////////////////////////////////
-private :
-
-  struct EffStressStruct {
-    PylithScalar ae;
-    PylithScalar b;
-    PylithScalar c;
-    PylithScalar d;
-    PylithScalar alpha;
-    PylithScalar dt;
-    PylithScalar effStressT;
-    PylithScalar powerLawExp;
-    PylithScalar referenceStrainRate;
-    PylithScalar referenceStress;
-  };
-
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
-  /// Structure to hold parameters for effective stress computation.
-  EffStressStruct _effStressParams;
-
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
@@ -517,6 +540,9 @@ private :
   /// Method to use for _updateStateVars().
   updateStateVars_fn_type _updateStateVarsFn;
 
+  /// Iteration statistics for effective stress solves.
+  EffectiveStress::Stats _effStressStats;
+
   static const int p_density;
   static const int p_mu;
   static const int p_lambda;
@@ -20,10 +20,13 @@
 
 #include "ViscoelasticMaxwell.hh" // implementation of object methods
 
-#include "petsc.h" // USES PetscLogFlops
+#include "pylith/utils/EventLogger.hh" // USES EventLogger::logFlops()
 
 #include <stdexcept> // USES std::runtime_error
 
+// ----------------------------------------------------------------------
+pylith::materials::_ViscoelasticMaxwell::DecayFactorsCache pylith::materials::_ViscoelasticMaxwell::decayFactorsCache;
+
 // ----------------------------------------------------------------------
 // Compute viscous strain parameter for a linear Maxwell model.
 PylithScalar
@@ -60,15 +63,15 @@ pylith::materials::ViscoelasticMaxwell::viscousStrainParam(const PylithScalar dt
       fraction *= dt / maxwellTime;
       dq += fSign * fraction / factorial;
     } // for
-    PetscLogFlops(8*(numTerms-1));
+    pylith::utils::EventLogger::logFlops(8*(numTerms-1));
   } else if (maxwellTime < timeFrac*dt) {
     // Throw away exponential term if maxwellTime is very small.
     dq = maxwellTime / dt;
-    PetscLogFlops(1);
+    pylith::utils::EventLogger::logFlops(1);
   } else{
     // Default solution.
     dq = maxwellTime*(1.0-exp(-dt/maxwellTime))/dt;
-    PetscLogFlops(6);
+    pylith::utils::EventLogger::logFlops(6);
   } // else
 
   return dq;
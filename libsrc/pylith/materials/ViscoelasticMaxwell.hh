@@ -29,6 +29,31 @@
 
 #include "pylith/utils/types.hh" // USES PylithScalar
 
+namespace pylith {
+  namespace materials {
+    namespace _ViscoelasticMaxwell {
+      /// Maximum number of Maxwell models with cached decay factors.
+      const int maxCachedModels = 8;
+
+      /// Most recently computed decay factors and viscous strain
+      /// parameters (see ViscoelasticMaxwell::decayFactors()).
+      struct DecayFactorsCache {
+	int numModels; ///< Number of Maxwell models (0 if empty).
+	PylithScalar dt; ///< Time step.
+	PylithScalar maxwellTime[maxCachedModels]; ///< Maxwell times.
+	PylithScalar decay[maxCachedModels]; ///< Decay factors.
+	PylithScalar dq[maxCachedModels]; ///< Viscous strain parameters.
+      }; // DecayFactorsCache
+
+      /// Decay factors cached by the current thread.
+      extern DecayFactorsCache decayFactorsCache;
+#if defined(_OPENMP)
+#pragma omp threadprivate(decayFactorsCache)
+#endif
+    } // _ViscoelasticMaxwell
+  } // materials
+} // pylith
+
 // ViscoelasticMaxwell --------------------------------------------------
 /** @brief Class for basic Maxwell viscoelastic functions.
  *
@@ -51,8 +76,58 @@ public :
   static PylithScalar viscousStrainParam(const PylithScalar dt,
 				   const PylithScalar maxwellTime);
 
+  /** Compute decay factors and viscous strain parameters for a series
+   * of Maxwell models.
+   *
+   * The viscous strain for Maxwell model i is updated using the
+   * recurrence
+   *
+   *   viscousStrain(t+dt) = decay[i] * viscousStrain(t) + dq[i] * deltaStrain,
+   *
+   * where decay[i] = exp(-dt/maxwellTime[i]) and dq[i] is the viscous
+   * strain parameter. Both depend only on the time step and the
+   * Maxwell times, so the most recently computed values are reused
+   * when the time step and Maxwell times are unchanged. Each thread
+   * has its own cache.
+   *
+   * @param decay Decay factors [numModels].
+   * @param dq Viscous strain parameters [numModels].
+   * @param dt Time step.
+   * @param maxwellTime Maxwell times [numModels].
+   */
+  template<int numModels>
+  static
+  void decayFactors(PylithScalar decay[],
+		    PylithScalar dq[],
+		    const PylithScalar dt,
+		    const PylithScalar maxwellTime[]);
+
+  /** Compute viscous strains for a series of Maxwell models at time
+   * t+dt using the recurrence with precomputed decay factors.
+   *
+   * The loops have compile-time bounds, so all of the Maxwell models
+   * are updated together for each strain component without a runtime
+   * loop over models. Viscous strains at time t and t+dt may be the
+   * same array.
+   *
+   * @param viscousStrainTpdt Viscous strains at time t+dt [numModels*tensorSize].
+   * @param viscousStrainT Viscous strains at time t [numModels*tensorSize].
+   * @param decay Decay factors [numModels].
+   * @param coef Coefficients of strain increment [numModels].
+   * @param deltaStrain Increment in deviatoric strain [tensorSize].
+   */
+  template<int numModels, int tensorSize>
+  static
+  void viscousStrains(PylithScalar viscousStrainTpdt[],
+		      const PylithScalar viscousStrainT[],
+		      const PylithScalar decay[],
+		      const PylithScalar coef[],
+		      const PylithScalar deltaStrain[]);
+
 }; // class ViscoelasticMaxwell
 
+#include "ViscoelasticMaxwell.icc" // template methods
+
 #endif // pylith_materials_viscoelasticmaxwell_hh
 
 
@@ -29,6 +29,63 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 #include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ----------------------------------------------------------------------
+// Apply matrix-free Jacobian (MatMult of PETSc shell matrix).
+EXTERN_C_BEGIN
+static
+PetscErrorCode
+MatMultMatrixFreeJacobian(PetscMat mat,
+			  PetscVec x,
+			  PetscVec y)
+{ // MatMultMatrixFreeJacobian
+  PYLITH_METHOD_BEGIN;
+
+  pylith::problems::Formulation* formulation = 0;
+  PetscErrorCode err = MatShellGetContext(mat, (void**) &formulation);CHKERRQ(err);
+  assert(formulation);
+
+  // Exceptions must not propagate into PETSc, so we convert them to
+  // PETSc errors.
+  try {
+    formulation->jacobianAction(x, y);
+  } catch (const std::exception& err) {
+    SETERRQ1(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", err.what());
+  } catch (...) {
+    SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Unknown exception in MatMultMatrixFreeJacobian().");
+  } // try/catch
+
+  PYLITH_METHOD_RETURN(0);
+} // MatMultMatrixFreeJacobian
+
+// ----------------------------------------------------------------------
+// Get diagonal of matrix-free Jacobian (MatGetDiagonal of PETSc shell matrix).
+static
+PetscErrorCode
+MatGetDiagonalMatrixFreeJacobian(PetscMat mat,
+				 PetscVec diagonal)
+{ // MatGetDiagonalMatrixFreeJacobian
+  PYLITH_METHOD_BEGIN;
+
+  pylith::problems::Formulation* formulation = 0;
+  PetscErrorCode err = MatShellGetContext(mat, (void**) &formulation);CHKERRQ(err);
+  assert(formulation);
+
+  // Exceptions must not propagate into PETSc, so we convert them to
+  // PETSc errors.
+  try {
+    formulation->jacobianDiagonal(diagonal);
+  } catch (const std::exception& err) {
+    SETERRQ1(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", err.what());
+  } catch (...) {
+    SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Unknown exception in MatGetDiagonalMatrixFreeJacobian().");
+  } // try/catch
+
+  PYLITH_METHOD_RETURN(0);
+} // MatGetDiagonalMatrixFreeJacobian
+EXTERN_C_END
 
 // ----------------------------------------------------------------------
 // Constructor
@@ -40,7 +97,11 @@ pylith::problems::Formulation::Formulation(void) :
   _jacobianLumped(0),
   _fields(0),
   _isJacobianSymmetric(false),
-  _splitFields(false)
+  _splitFields(false),
+  _useCustomConstraintPC(false),
+  _matrixFree(false),
+  _matrixFreePC("diagonal"),
+  _jacobianPC(0)
 { // constructor
 } // constructor
 
@@ -61,6 +122,7 @@ pylith::problems::Formulation::deallocate(void)
   _jacobian = 0; // :TODO: Use shared pointer.
   _jacobianLumped = 0; // :TODO: Use shared pointer.
   _fields = 0; // :TODO: Use shared pointer.
+  delete _jacobianPC; _jacobianPC = 0;
 
 #if 0   // :KLUDGE: Assume Solver deallocates matrix.
   PetscErrorCode err = 0;
@@ -107,6 +169,158 @@ pylith::problems::Formulation::useCustomConstraintPC(void) const
   return _useCustomConstraintPC;
 } // useCustomConstraintPC
 
+// ----------------------------------------------------------------------
+// Set flag for applying the Jacobian without assembling it.
+void
+pylith::problems::Formulation::matrixFree(const bool flag)
+{ // matrixFree
+  _matrixFree = flag;
+} // matrixFree
+
+// ----------------------------------------------------------------------
+// Get flag for applying the Jacobian without assembling it.
+bool
+pylith::problems::Formulation::matrixFree(void) const
+{ // matrixFree
+  return _matrixFree;
+} // matrixFree
+
+// ----------------------------------------------------------------------
+// Set preconditioner for matrix-free Jacobian.
+void
+pylith::problems::Formulation::matrixFreePC(const char* value)
+{ // matrixFreePC
+  assert(value);
+  const std::string name(value);
+  if (name != "diagonal" && name != "assembled") {
+    std::ostringstream msg;
+    msg << "Unknown preconditioner '" << name << "' for matrix-free Jacobian. "
+	<< "Options are 'diagonal' and 'assembled'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _matrixFreePC = name;
+} // matrixFreePC
+
+// ----------------------------------------------------------------------
+// Get preconditioner for matrix-free Jacobian.
+const char*
+pylith::problems::Formulation::matrixFreePC(void) const
+{ // matrixFreePC
+  return _matrixFreePC.c_str();
+} // matrixFreePC
+
+// ----------------------------------------------------------------------
+// Get sparse preconditioning matrix for matrix-free Jacobian.
+PetscMat
+pylith::problems::Formulation::matrixFreePCMatrix(void) const
+{ // matrixFreePCMatrix
+  return (_jacobianPC) ? _jacobianPC->matrix() : NULL;
+} // matrixFreePCMatrix
+
+// ----------------------------------------------------------------------
+// Setup operations of matrix-free Jacobian.
+void
+pylith::problems::Formulation::initializeMatrixFree(topology::Jacobian* jacobian,
+						    topology::SolutionFields* fields)
+{ // initializeMatrixFree
+  PYLITH_METHOD_BEGIN;
+
+  assert(jacobian);
+  assert(fields);
+
+  if (std::string("shell") != jacobian->matrixType()) {
+    std::ostringstream msg;
+    msg << "Matrix-free Jacobian requires matrix type 'shell', not '" << jacobian->matrixType() << "'.";
+    throw std::logic_error(msg.str());
+  } // if
+
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    assert(_integrators[i]);
+    if (!_integrators[i]->hasJacobianAction()) {
+      throw std::runtime_error("Matrix-free Jacobian is only supported for problems "
+			       "with small strain elasticity and boundary conditions "
+			       "that do not contribute to the Jacobian (no faults or "
+			       "absorbing boundaries).");
+    } // if
+  } // for
+
+  _matrixFree = true;
+  _jacobian = jacobian;
+  _fields = fields;
+
+  PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
+  PetscErrorCode err = 0;
+  err = MatShellSetContext(jacobianMat, (void*) this);PYLITH_CHECK_ERROR(err);
+  err = MatShellSetOperation(jacobianMat, MATOP_MULT, (void (*)(void)) MatMultMatrixFreeJacobian);PYLITH_CHECK_ERROR(err);
+  err = MatShellSetOperation(jacobianMat, MATOP_GET_DIAGONAL, (void (*)(void)) MatGetDiagonalMatrixFreeJacobian);PYLITH_CHECK_ERROR(err);
+
+  const topology::Field& solution = fields->solution();
+  const char* fieldNames[3] = { "jacobian action input", "jacobian action", "jacobian diagonal" };
+  const char* fieldLabels[3] = { "jacobian_action_input", "jacobian_action", "jacobian_diagonal" };
+  for (int i=0; i < 3; ++i) {
+    if (!fields->hasField(fieldNames[i])) {
+      fields->add(fieldNames[i], fieldLabels[i]);
+      topology::Field& field = fields->get(fieldNames[i]);
+      field.cloneSection(solution);
+      field.zeroAll();
+    } // if
+  } // for
+
+  delete _jacobianPC; _jacobianPC = 0;
+  if (_matrixFreePC == "assembled") {
+    _jacobianPC = new topology::Jacobian(solution, "aij");
+  } // if
+
+  PYLITH_METHOD_END;
+} // initializeMatrixFree
+
+// ----------------------------------------------------------------------
+// Compute action of matrix-free Jacobian.
+void
+pylith::problems::Formulation::jacobianAction(const PetscVec input,
+					      PetscVec action)
+{ // jacobianAction
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  topology::Field& inputField = _fields->get("jacobian action input");
+  inputField.zeroAll();
+  inputField.scatterGlobalToLocal(input);
+
+  topology::Field& actionField = _fields->get("jacobian action");
+  actionField.zeroAll();
+
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    _integrators[i]->integrateJacobianAction(actionField, inputField, _t, _fields);
+  } // for
+
+  actionField.complete();
+  actionField.scatterLocalToGlobal(action);
+
+  PYLITH_METHOD_END;
+} // jacobianAction
+
+// ----------------------------------------------------------------------
+// Get diagonal of matrix-free Jacobian.
+void
+pylith::problems::Formulation::jacobianDiagonal(PetscVec diagonal)
+{ // jacobianDiagonal
+  PYLITH_METHOD_BEGIN;
+
+  if (_jacobianPC) {
+    PetscErrorCode err = MatGetDiagonal(_jacobianPC->matrix(), diagonal);PYLITH_CHECK_ERROR(err);
+  } else {
+    assert(_fields);
+    const topology::Field& diagonalField = _fields->get("jacobian diagonal");
+    diagonalField.scatterLocalToGlobal(diagonal);
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // jacobianDiagonal
+
 // ----------------------------------------------------------------------
 // Return the fields
 const pylith::topology::SolutionFields&
@@ -250,11 +464,38 @@ pylith::problems::Formulation::reformJacobian(const PetscVec* tmpSolutionVec)
     solution.scatterGlobalToLocal(*tmpSolutionVec);
   } // if
 
+  const int numIntegrators = _integrators.size();
+  if (_matrixFree) {
+    // Update linearization used to apply the Jacobian.
+    for (int i=0; i < numIntegrators; ++i) {
+      _integrators[i]->prepareJacobianAction(_t, _fields);
+    } // for
+
+    if (_jacobianPC) {
+      _jacobianPC->zero();
+      for (int i=0; i < numIntegrators; ++i) {
+	_integrators[i]->integrateJacobian(_jacobianPC, _t, _fields);
+      } // for
+      _jacobianPC->assemble("final_assembly");
+    } else {
+      topology::Field& diagonal = _fields->get("jacobian diagonal");
+      diagonal.zeroAll();
+      for (int i=0; i < numIntegrators; ++i) {
+	_integrators[i]->integrateJacobianDiagonal(diagonal, _t, _fields);
+      } // for
+      diagonal.complete();
+    } // if/else
+
+    // Shell matrix has no entries, but PETSc tracks state changes via assembly.
+    _jacobian->assemble("final_assembly");
+
+    PYLITH_METHOD_END;
+  } // if
+
   // Set jacobian to zero.
   _jacobian->zero();
 
   // Add in contributions that require assembly.
-  const int numIntegrators = _integrators.size();
   for (int i=0; i < numIntegrators; ++i) {
     _integrators[i]->integrateJacobian(_jacobian, _t, _fields);
   } // for
@@ -36,6 +36,8 @@
 
 #include "pylith/utils/array.hh" // HASA std::vector
 
+#include <string> // HASA std::string
+
 
 // Formulation ----------------------------------------------------------
 /// Reform the Jacobian and residual for the problem.
@@ -79,6 +81,62 @@ public :
    */
   bool useCustomConstraintPC(void) const;
 
+  /** Set flag for applying the Jacobian without assembling it.
+   *
+   * @param flag True if using matrix-free Jacobian, false otherwise.
+   */
+  void matrixFree(const bool flag);
+
+  /** Get flag for applying the Jacobian without assembling it.
+   *
+   * @returns True if using matrix-free Jacobian, false otherwise.
+   */
+  bool matrixFree(void) const;
+
+  /** Set preconditioner for matrix-free Jacobian.
+   *
+   * "diagonal" computes the diagonal of the Jacobian (Jacobi
+   * preconditioner); "assembled" also assembles the Jacobian into a
+   * separate sparse preconditioning matrix.
+   *
+   * @param value Name of preconditioner ("diagonal" or "assembled").
+   */
+  void matrixFreePC(const char* value);
+
+  /** Get preconditioner for matrix-free Jacobian.
+   *
+   * @returns Name of preconditioner.
+   */
+  const char* matrixFreePC(void) const;
+
+  /** Get sparse preconditioning matrix for matrix-free Jacobian.
+   *
+   * @returns PETSc matrix if preconditioner is "assembled", NULL otherwise.
+   */
+  PetscMat matrixFreePCMatrix(void) const;
+
+  /** Setup operations of matrix-free Jacobian.
+   *
+   * @param jacobian Jacobian of system with PETSc shell matrix.
+   * @param fields Solution fields.
+   */
+  void initializeMatrixFree(topology::Jacobian* jacobian,
+			    topology::SolutionFields* fields);
+
+  /** Compute action of matrix-free Jacobian, action = A * input.
+   *
+   * @param input PETSc global vector to which the Jacobian is applied.
+   * @param action PETSc global vector for result.
+   */
+  void jacobianAction(const PetscVec input,
+		      PetscVec action);
+
+  /** Get diagonal of matrix-free Jacobian computed in reformJacobian().
+   *
+   * @param diagonal PETSc global vector for diagonal.
+   */
+  void jacobianDiagonal(PetscVec diagonal);
+
   /** Get solution fields.
    *
    * @returns solution fields.
@@ -187,6 +245,10 @@ protected :
 
   bool _useCustomConstraintPC; ///< True if using custom preconditioner for Lagrange constraints.
 
+  bool _matrixFree; ///< True if applying Jacobian without assembling it.
+  std::string _matrixFreePC; ///< Name of preconditioner for matrix-free Jacobian.
+  topology::Jacobian* _jacobianPC; ///< Sparse preconditioning matrix for matrix-free Jacobian.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -152,6 +152,11 @@ pylith::problems::Solver::initialize(const topology::SolutionFields& fields,
         err = MatCreateShell(fields.mesh().comm(), m, n, M, N, &_ctx, &_jacobianPC); PYLITH_CHECK_ERROR(err);
         err = MatShellSetOperation(_jacobianPC, MATOP_CREATE_SUBMATRIX,
                                    (void (*)(void))MyMatGetSubMatrix); PYLITH_CHECK_ERROR(err);
+    } else if (formulation->matrixFree() && formulation->matrixFreePCMatrix()) {
+        // Matrix-free Jacobian with assembled preconditioning matrix.
+        err = MatDestroy(&_jacobianPC); PYLITH_CHECK_ERROR(err);
+        _jacobianPC = formulation->matrixFreePCMatrix();
+        err = PetscObjectReference((PetscObject) _jacobianPC); PYLITH_CHECK_ERROR(err);
     } else {
         _jacobianPC = jacobianMat;
         err = PetscObjectReference((PetscObject) jacobianMat); PYLITH_CHECK_ERROR(err);
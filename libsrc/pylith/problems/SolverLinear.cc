@@ -79,6 +79,13 @@ pylith::problems::SolverLinear::initialize(const topology::SolutionFields& field
   err = KSPDestroy(&_ksp);PYLITH_CHECK_ERROR(err);
   err = KSPCreate(fields.mesh().comm(), &_ksp);PYLITH_CHECK_ERROR(err);
   err = KSPSetInitialGuessNonzero(_ksp, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+  if (formulation->matrixFree() && !formulation->matrixFreePCMatrix()) {
+    // Only the diagonal of a matrix-free Jacobian is available; use
+    // Jacobi as the default preconditioner.
+    PetscPC pc = 0;
+    err = KSPGetPC(_ksp, &pc);PYLITH_CHECK_ERROR(err);
+    err = PCSetType(pc, PCJACOBI);PYLITH_CHECK_ERROR(err);
+  } // if
   err = KSPSetFromOptions(_ksp);PYLITH_CHECK_ERROR(err);
 
   if (formulation->splitFields()) {
@@ -120,7 +127,8 @@ pylith::problems::SolverLinear::solve(topology::Field* solution,
 
   PetscErrorCode err = 0;
   const PetscMat jacobianMat = jacobian->matrix();
-  err = KSPSetOperators(_ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+  const PetscMat precondMat = (_formulation->matrixFree()) ? _jacobianPC : jacobianMat;
+  err = KSPSetOperators(_ksp, jacobianMat, precondMat);PYLITH_CHECK_ERROR(err);
   jacobian->resetValuesChanged();
 
   const PetscVec residualVec = residual.globalVector();
@@ -112,6 +112,16 @@ pylith::problems::SolverNonlinear::initialize(const topology::SolutionFields& fi
   err = SNESLineSearchSetOrder(ls, SNES_LINESEARCH_ORDER_CUBIC);PYLITH_CHECK_ERROR(err);
   err = SNESLineSearchShellSetUserFunc(ls, lineSearch, (void*) formulation);PYLITH_CHECK_ERROR(err);
 
+  if (formulation->matrixFree() && !formulation->matrixFreePCMatrix()) {
+    // Only the diagonal of a matrix-free Jacobian is available; use
+    // Jacobi as the default preconditioner.
+    PetscKSP ksp = 0;
+    PetscPC pc = 0;
+    err = SNESGetKSP(_snes, &ksp); PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pc); PYLITH_CHECK_ERROR(err);
+    err = PCSetType(pc, PCJACOBI); PYLITH_CHECK_ERROR(err);
+  } // if
+
   // Get SNES options and allow the user to override the line search type
   err = SNESSetFromOptions(_snes);PYLITH_CHECK_ERROR(err);
   err = SNESSetComputeInitialGuess(_snes, initialGuess, (void*) formulation);PYLITH_CHECK_ERROR(err);
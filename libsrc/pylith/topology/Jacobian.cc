@@ -32,17 +32,32 @@ pylith::topology::Jacobian::Jacobian(const Field& field,
                                      const char* matrixType,
                                      const bool blockOkay) :
   _matrix(0),
-  _valuesChanged(true)
+  _valuesChanged(true),
+  _valuesState(0)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
   PetscDM dmMesh = field.dmMesh();assert(dmMesh);
 
-  const char* msg = "Could not create PETSc sparse matrix associated with system Jacobian.";
-  PetscErrorCode err = DMCreateMatrix(dmMesh, &_matrix);PYLITH_CHECK_ERROR_MSG(err, msg);
-
   _type = matrixType;
 
+  PetscErrorCode err = 0;
+  if (_type == "shell") {
+    // Matrix-free Jacobian; the operations are supplied by the owner of the matrix.
+    PetscVec vec = NULL;
+    PetscInt nrowsLocal = 0, nrowsGlobal = 0;
+    err = DMCreateGlobalVector(dmMesh, &vec);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(vec, &nrowsLocal);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(vec, &nrowsGlobal);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&vec);PYLITH_CHECK_ERROR(err);
+
+    const char* msg = "Could not create PETSc shell matrix associated with system Jacobian.";
+    err = MatCreateShell(PetscObjectComm((PetscObject) dmMesh), nrowsLocal, nrowsLocal, nrowsGlobal, nrowsGlobal, NULL, &_matrix);PYLITH_CHECK_ERROR_MSG(err, msg);
+  } else {
+    const char* msg = "Could not create PETSc sparse matrix associated with system Jacobian.";
+    err = DMCreateMatrix(dmMesh, &_matrix);PYLITH_CHECK_ERROR_MSG(err, msg);
+  } // if/else
+
   PYLITH_METHOD_END;
 } // constructor
 
@@ -136,6 +151,7 @@ pylith::topology::Jacobian::assemble(const char* mode)
 			     "associated with system Jacobian.");
 
   _valuesChanged = true;
+  ++_valuesState;
 
   PYLITH_METHOD_END;
 } // assemble
@@ -147,8 +163,11 @@ pylith::topology::Jacobian::zero(void)
 { // zero
   PYLITH_METHOD_BEGIN;
 
-  PetscErrorCode err = MatZeroEntries(_matrix);PYLITH_CHECK_ERROR(err);
+  if (_type != "shell") {
+    PetscErrorCode err = MatZeroEntries(_matrix);PYLITH_CHECK_ERROR(err);
+  } // if
   _valuesChanged = true;
+  ++_valuesState;
 
   PYLITH_METHOD_END;
 } // zero
@@ -252,6 +271,14 @@ pylith::topology::Jacobian::valuesChanged(void) const
   return _valuesChanged;
 } // valuesChanged
 
+// ----------------------------------------------------------------------
+// Get counter for updates to sparse matrix values.
+long
+pylith::topology::Jacobian::valuesState(void) const
+{ // valuesState
+  return _valuesState;
+} // valuesState
+
 // ----------------------------------------------------------------------
 // Reset flag indicating if sparse matrix values have been updated.
 void
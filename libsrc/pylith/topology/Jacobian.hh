@@ -45,7 +45,8 @@ public :
   /** Default constructor.
    *
    * @param field Field associated with mesh and solution of the problem.
-   * @param matrixType Type of PETSc sparse matrix.
+   * @param matrixType Type of PETSc sparse matrix ("shell" creates a
+   * matrix-free matrix without any operations).
    * @param blockOkay True if okay to use block size equal to fiberDim
    * (all or none of the DOF at each point are constrained).
    */
@@ -111,12 +112,22 @@ public :
   /// Reset flag indicating if sparse matrix values have been updated.
   void resetValuesChanged(void);
 
+  /** Get counter that is incremented whenever the sparse matrix
+   * values are updated. Unlike valuesChanged(), the counter is never
+   * reset, so several objects can each detect updates to the values
+   * by comparing against the counter they saw last.
+   *
+   * @returns Number of updates to values.
+   */
+  long valuesState(void) const;
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   PetscMat _matrix; ///< Sparse matrix for Jacobian of problem.
 
   bool _valuesChanged; ///< Sparse matrix values have been updated.
+  long _valuesState; ///< Number of updates to sparse matrix values.
 
   std::string _type; ///< String associated with matrix type.
 
@@ -30,7 +30,7 @@
 #include "topologyfwd.hh" // forward declarations
 
 #include "pylith/utils/petscfwd.h" // HASA PetscVec, PetscSection
-#include "pylith/utils/arrayfwd.hh" // USES scalar_array
+#include "pylith/utils/arrayfwd.hh" // USES scalar_array, int_array
 
 // VecVisitorMesh ----------------------------------------------------------
 /** @brief Helper class for accessing field values at points in a
@@ -156,6 +156,19 @@ public :
 		  const PetscInt cell,
 		  const InsertMode mode) const;
 
+  /** Get indices into local array of values associated with closure.
+   *
+   * Indices follow the same ordering as getClosure() and
+   * setClosure(). Constrained values, which are skipped by
+   * setClosure() with ADD_VALUES, have an index of -1. Only valid
+   * for sections with a single field.
+   *
+   * @param indices Array of indices into local array for cell.
+   * @param cell Finite-element cell.
+   */
+  void closureIndices(int_array* indices,
+		      const PetscInt cell) const;
+
   /** Optimize the closure operator by creating index for closures.
    *
    * :TODO: Remove this method. Call static version when setting up fields.
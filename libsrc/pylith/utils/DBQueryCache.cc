@@ -0,0 +1,270 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DBQueryCache.hh" // Implementation of class methods
+
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
+
+#include "petsc.h" // USES PETSC_COMM_WORLD
+
+#include <stdint.h> // USES uint64_t
+#include <fstream> // USES std::ifstream, std::ofstream
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <cstring> // USES strncmp(), strlen()
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+const char* pylith::utils::DBQueryCache::_magic = "PYLITHDBQC01";
+const int pylith::utils::DBQueryCache::_magicSize = 12;
+
+// ----------------------------------------------------------------------
+// Get name of cache file for current process.
+std::string
+pylith::utils::DBQueryCache::filename(const char* prefix,
+				      const char* label,
+				      const char* name)
+{ // filename
+  PYLITH_METHOD_BEGIN;
+
+  assert(prefix);
+  assert(label);
+  assert(name);
+
+  int rank = 0;
+  PetscErrorCode err = MPI_Comm_rank(PETSC_COMM_WORLD, &rank);PYLITH_CHECK_ERROR(err);
+
+  std::ostringstream filename;
+  filename << prefix << "_" << label << "_" << name << "_p" << rank << ".dat";
+
+  PYLITH_METHOD_RETURN(std::string(filename.str()));
+} // filename
+
+// ----------------------------------------------------------------------
+// Create key identifying query.
+std::string
+pylith::utils::DBQueryCache::key(const spatialdata::spatialdb::SpatialDB& db,
+				 const char* fingerprint,
+				 const char* queryName,
+				 const char* const* names,
+				 const int numValues,
+				 const scalar_array& points,
+				 const int spaceDim)
+{ // key
+  PYLITH_METHOD_BEGIN;
+
+  assert(fingerprint);
+  assert(queryName);
+  assert(names || 0 == numValues);
+  assert(spaceDim > 0);
+
+  int size = 0;
+  PetscErrorCode err = MPI_Comm_size(PETSC_COMM_WORLD, &size);PYLITH_CHECK_ERROR(err);
+
+  // FNV-1a hash of coordinates of points.
+  uint64_t hash = 14695981039346656037ULL;
+  const unsigned char* bytes = (points.size() > 0) ? (const unsigned char*)&points[0] : 0;
+  const size_t numBytes = points.size()*sizeof(PylithScalar);
+  for (size_t i=0; i < numBytes; ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  } // for
+
+  std::ostringstream key;
+  key << "db=" << db.label()
+      << ";fingerprint=" << fingerprint
+      << ";query=" << queryName
+      << ";values=";
+  for (int i=0; i < numValues; ++i) {
+    key << (i ? "," : "") << names[i];
+  } // for
+  key << ";scalar=" << sizeof(PylithScalar)
+      << ";dim=" << spaceDim
+      << ";points=" << points.size()/spaceDim
+      << ";procs=" << size
+      << ";coordinates=" << std::hex << hash;
+
+  PYLITH_METHOD_RETURN(std::string(key.str()));
+} // key
+
+// ----------------------------------------------------------------------
+// Query spatial database at points using cache file.
+void
+pylith::utils::DBQueryCache::query(scalar_array* values,
+				   spatialdata::spatialdb::SpatialDB* db,
+				   const char* const* names,
+				   const int numValues,
+				   const scalar_array& points,
+				   const int_array* order,
+				   const int spaceDim,
+				   const spatialdata::geocoords::CoordSys* cs,
+				   const char* prefix,
+				   const char* fingerprint,
+				   const char* label,
+				   const char* queryName,
+				   const char* description,
+				   const char* objectType)
+{ // query
+  PYLITH_METHOD_BEGIN;
+
+  assert(values);
+  assert(db);
+  assert(spaceDim > 0);
+  assert(prefix);
+  assert(fingerprint);
+  assert(label);
+
+  const size_t numPoints = points.size() / spaceDim;
+  assert(!order || order->size() == numPoints);
+
+  // Use values from cache file if they match the query.
+  const bool useCache = strlen(prefix) > 0 && strlen(fingerprint) > 0;
+  std::string cacheFilename;
+  std::string cacheKey;
+  if (useCache) {
+    cacheFilename = filename(prefix, label, queryName);
+    cacheKey = key(*db, fingerprint, queryName, names, numValues, points, spaceDim);
+    if (read(values, cacheFilename.c_str(), cacheKey) && values->size() == numPoints*numValues) {
+      PYLITH_METHOD_END;
+    } // if
+  } // if
+
+  values->resize(numPoints*numValues);
+
+  // The spatial databases keep state between queries, so we query
+  // the points serially.
+  for (size_t i=0; i < numPoints; ++i) {
+    const PylithInt iPoint = (order) ? (*order)[i] : i;
+    const int err = db->query(&(*values)[iPoint*numValues], numValues, &points[iPoint*spaceDim], spaceDim, cs);
+    if (err) {
+      std::ostringstream msg;
+      msg << "Could not find " << description << " at " << "(";
+      for (int iDim=0; iDim < spaceDim; ++iDim)
+	msg << "  " << points[iPoint*spaceDim+iDim];
+      msg << ") in " << objectType << " '" << label << "' using spatial database '" << db->label() << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // for
+
+  if (useCache) {
+    write(cacheFilename.c_str(), cacheKey, *values);
+  } // if
+
+  PYLITH_METHOD_END;
+} // query
+
+// ----------------------------------------------------------------------
+// Read values from cache file.
+bool
+pylith::utils::DBQueryCache::read(scalar_array* values,
+				  const char* filename,
+				  const std::string& key)
+{ // read
+  PYLITH_METHOD_BEGIN;
+
+  assert(values);
+  assert(filename);
+
+  std::ifstream fin(filename, std::ios::in | std::ios::binary);
+  if (!fin.is_open() || !fin.good()) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  char magic[_magicSize];
+  fin.read(magic, _magicSize);
+  if (!fin.good() || strncmp(magic, _magic, _magicSize)) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  int keySize = 0;
+  fin.read((char*) &keySize, sizeof(keySize));
+  if (!fin.good() || keySize != int(key.size())) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+  std::string keyFile(keySize, ' ');
+  if (keySize > 0) {
+    fin.read(&keyFile[0], keySize);
+  } // if
+  if (!fin.good() || keyFile != key) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  long numValues = 0;
+  fin.read((char*) &numValues, sizeof(numValues));
+  if (!fin.good() || numValues < 0) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+  scalar_array valuesFile(numValues);
+  if (numValues > 0) {
+    fin.read((char*) &valuesFile[0], numValues*sizeof(PylithScalar));
+    if (!fin.good()) {
+      PYLITH_METHOD_RETURN(false);
+    } // if
+  } // if
+  fin.close();
+
+  values->resize(numValues);
+  *values = valuesFile;
+
+  PYLITH_METHOD_RETURN(true);
+} // read
+
+// ----------------------------------------------------------------------
+// Write values to cache file.
+void
+pylith::utils::DBQueryCache::write(const char* filename,
+				   const std::string& key,
+				   const scalar_array& values)
+{ // write
+  PYLITH_METHOD_BEGIN;
+
+  assert(filename);
+
+  std::ofstream fout(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!fout.is_open() || !fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open spatial database query cache file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  fout.write(_magic, _magicSize);
+  const int keySize = key.size();
+  fout.write((const char*) &keySize, sizeof(keySize));
+  fout.write(key.c_str(), keySize);
+  const long numValues = values.size();
+  fout.write((const char*) &numValues, sizeof(numValues));
+  if (numValues > 0) {
+    fout.write((const char*) &values[0], numValues*sizeof(PylithScalar));
+  } // if
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not write spatial database query cache file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // write
+
+
+// End of file 
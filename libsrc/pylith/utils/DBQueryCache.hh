@@ -0,0 +1,172 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/DBQueryCache.hh
+ *
+ * @brief C++ object for caching values queried from spatial
+ * databases.
+ *
+ * Values are stored in a binary file for each process together with
+ * a key identifying the query (database and fingerprint of its
+ * contents, name of query, names of values, number of processes, and
+ * coordinates of the points). A later query with the same key reads
+ * the values from the file instead of querying the database.
+ *
+ * The fingerprint of the database contents is supplied by the caller
+ * (for example, name, size, and modification time of the database
+ * file plus the query type). Queries of databases without a
+ * fingerprint are not cached.
+ */
+
+#if !defined(pylith_utils_dbquerycache_hh)
+#define pylith_utils_dbquerycache_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/arrayfwd.hh" // USES scalar_array
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // USES CoordSys
+
+#include <string> // USES std::string
+
+// DBQueryCache ---------------------------------------------------------
+/// C++ object for caching values queried from spatial databases.
+class pylith::utils::DBQueryCache
+{ // DBQueryCache
+  friend class TestDBQueryCache; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Get name of cache file for current process.
+   *
+   * @param prefix Prefix for name of cache files.
+   * @param label Label of object querying the database.
+   * @param name Name of query.
+   * @returns Name of cache file.
+   */
+  static
+  std::string filename(const char* prefix,
+		       const char* label,
+		       const char* name);
+
+  /** Create key identifying query.
+   *
+   * @param db Spatial database.
+   * @param fingerprint Fingerprint of contents of database.
+   * @param queryName Name of query.
+   * @param names Names of values in query.
+   * @param numValues Number of values in query.
+   * @param points Coordinates of points [numPoints][spaceDim].
+   * @param spaceDim Spatial dimension of coordinates.
+   * @returns Key for query.
+   */
+  static
+  std::string key(const spatialdata::spatialdb::SpatialDB& db,
+		  const char* fingerprint,
+		  const char* queryName,
+		  const char* const* names,
+		  const int numValues,
+		  const scalar_array& points,
+		  const int spaceDim);
+
+  /** Query spatial database at points, reading the values from the
+   * cache file if it matches the query and writing them to the cache
+   * file otherwise.
+   *
+   * The cache is used only if both the prefix and the fingerprint are
+   * not empty.
+   *
+   * @pre Must call db->open() and db->queryVals() before calling query().
+   *
+   * @param values Values at points [numPoints][numValues].
+   * @param db Spatial database.
+   * @param names Names of values in query.
+   * @param numValues Number of values in query.
+   * @param points Coordinates of points [numPoints][spaceDim].
+   * @param order Indices of points in query order (NULL for natural order).
+   * @param spaceDim Spatial dimension of coordinates.
+   * @param cs Coordinate system of points.
+   * @param prefix Prefix for name of cache files.
+   * @param fingerprint Fingerprint of contents of database.
+   * @param label Label of object querying the database.
+   * @param queryName Name of query.
+   * @param description Description of values for error messages.
+   * @param objectType Type of object querying the database for error messages.
+   */
+  static
+  void query(scalar_array* values,
+	     spatialdata::spatialdb::SpatialDB* db,
+	     const char* const* names,
+	     const int numValues,
+	     const scalar_array& points,
+	     const int_array* order,
+	     const int spaceDim,
+	     const spatialdata::geocoords::CoordSys* cs,
+	     const char* prefix,
+	     const char* fingerprint,
+	     const char* label,
+	     const char* queryName,
+	     const char* description,
+	     const char* objectType);
+
+  /** Read values from cache file.
+   *
+   * @param values Array of values.
+   * @param filename Name of cache file.
+   * @param key Key identifying query.
+   * @returns True if file exists and matches key, false otherwise.
+   */
+  static
+  bool read(scalar_array* values,
+	    const char* filename,
+	    const std::string& key);
+
+  /** Write values to cache file.
+   *
+   * @param filename Name of cache file.
+   * @param key Key identifying query.
+   * @param values Array of values.
+   */
+  static
+  void write(const char* filename,
+	     const std::string& key,
+	     const scalar_array& values);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  static const char* _magic; ///< Identifier at start of cache files.
+  static const int _magicSize; ///< Size of identifier.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  DBQueryCache(void); ///< Not implemented
+  DBQueryCache(const DBQueryCache&); ///< Not implemented
+  const DBQueryCache& operator=(const DBQueryCache&); ///< Not implemented
+
+}; // DBQueryCache
+
+#endif // pylith_utils_dbquerycache_hh
+
+
+// End of file 
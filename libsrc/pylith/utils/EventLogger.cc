@@ -26,6 +26,10 @@
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
 
+#if defined(_OPENMP)
+PetscLogDouble pylith::utils::_EventLogger::threadFlops = 0.0;
+#endif
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::utils::EventLogger::EventLogger(void) :
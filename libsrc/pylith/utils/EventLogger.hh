@@ -36,6 +36,21 @@
 #include "petsc.h"
 #include "petsclog.h" // USES PetscLogEventBegin/End() in inline methods
 
+#if defined(_OPENMP)
+#include <omp.h> // USES omp_in_parallel()
+
+namespace pylith {
+  namespace utils {
+    namespace _EventLogger {
+      /// Floating point operations logged by the current thread inside
+      /// a parallel region.
+      extern PetscLogDouble threadFlops;
+#pragma omp threadprivate(threadFlops)
+    } // _EventLogger
+  } // utils
+} // pylith
+#endif
+
 // EventLogger ----------------------------------------------------------
 /** @brief C++ object for managing event logging using PETSc.
  *
@@ -122,6 +137,24 @@ public :
   /// Log stage end.
   void stagePop(void);
 
+  /** Log floating point operations.
+   *
+   * PetscLogFlops() updates a global counter, so inside an OpenMP
+   * parallel region the operations are accumulated per thread
+   * instead. The thread that owns the parallel region must collect
+   * them with threadFlops() and log the sum after the region.
+   *
+   * @param n Number of floating point operations.
+   */
+  static void logFlops(const PetscLogDouble n);
+
+  /** Get and reset number of floating point operations accumulated by
+   * the current thread inside a parallel region.
+   *
+   * @returns Number of floating point operations.
+   */
+  static PetscLogDouble threadFlops(void);
+
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
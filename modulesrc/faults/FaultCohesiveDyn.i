@@ -75,6 +75,21 @@ namespace pylith {
        */
       void openFreeSurf(const bool value);
 
+      /** Set method used to compute the change in slip associated with a
+       * change in the Lagrange multipliers when constraining the solution
+       * space.
+       *
+       * @param value Name of method ("global" or "local").
+       */
+      void sensitivityMode(const char* value);
+
+      /** Get method used to compute the change in slip associated with a
+       * change in the Lagrange multipliers.
+       *
+       * @returns Name of method.
+       */
+      const char* sensitivityMode(void) const;
+
       /** Initialize fault. Determine orientation and setup boundary
        * condition parameters.
        *
@@ -53,6 +53,45 @@ namespace pylith {
        * @returns Time step
        */
       PylithScalar stableTimeStep(const pylith::topology::Mesh& mesh);
+
+      /** Set number of threads used in loops over cells when integrating
+       * the residual and Jacobian.
+       *
+       * @param value Number of threads (1 means no threading).
+       */
+      void numThreads(const int value);
+
+      /** Get number of threads used in loops over cells.
+       *
+       * @returns Number of threads.
+       */
+      int numThreads(void) const;
+
+      /** Set flag for bitwise-reproducible threaded assembly of the residual.
+       *
+       * @param flag True for deterministic assembly, false otherwise.
+       */
+      void deterministicAssembly(const bool flag);
+
+      /** Get flag for bitwise-reproducible threaded assembly of the residual.
+       *
+       * @returns True for deterministic assembly, false otherwise.
+       */
+      bool deterministicAssembly(void) const;
+
+      /** Set flag for reusing cell matrices between reformations of
+       * the Jacobian.
+       *
+       * @param flag True to reuse cell matrices, false otherwise.
+       */
+      void reuseCellMatrices(const bool flag);
+
+      /** Get flag for reusing cell matrices between reformations of
+       * the Jacobian.
+       *
+       * @returns True if cell matrices are reused, false otherwise.
+       */
+      bool reuseCellMatrices(void) const;
       
       /** Integrate residual part of RHS for 3-D finite elements.
        * Includes gravity and element internal force contribution.
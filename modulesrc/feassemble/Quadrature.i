@@ -57,6 +57,36 @@ namespace pylith {
        */
       bool checkConditioning(void) const;
 
+      /** Set flag for caching geometry of cells at quadrature points.
+       *
+       * @param flag True to cache geometry, false otherwise.
+       */
+      void cacheGeometry(const bool flag);
+
+      /** Get flag for caching geometry of cells at quadrature points.
+       *
+       * @returns True if caching geometry, false otherwise.
+       */
+      bool cacheGeometry(void) const;
+
+      /** Set maximum memory used by geometry cache.
+       *
+       * @param value Maximum memory (MB).
+       */
+      void geometryCacheBudget(const PylithScalar value);
+
+      /** Get maximum memory used by geometry cache.
+       *
+       * @returns Maximum memory (MB).
+       */
+      PylithScalar geometryCacheBudget(void) const;
+
+      /** Check whether geometry of cells is cached.
+       *
+       * @returns True if geometry is cached, false otherwise.
+       */
+      bool hasGeometryCache(void) const;
+
       /// Setup quadrature engine.
       void initializeGeometry(void);
       
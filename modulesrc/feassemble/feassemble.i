@@ -38,6 +38,7 @@
 #include "pylith/feassemble/ElasticityExplicit.hh"
 #include "pylith/feassemble/ElasticityExplicitTri3.hh"
 #include "pylith/feassemble/ElasticityExplicitTet4.hh"
+#include "pylith/feassemble/ElasticityExplicitHex8.hh"
 #include "pylith/feassemble/ElasticityImplicitLgDeform.hh"
 #include "pylith/feassemble/ElasticityExplicitLgDeform.hh"
 
@@ -81,6 +82,7 @@ import_array();
 %include "ElasticityImplicit.i"
 %include "ElasticityExplicit.i"
 %include "ElasticityExplicitTet4.i"
+%include "ElasticityExplicitHex8.i"
 %include "ElasticityExplicitTri3.i"
 %include "IntegratorElasticityLgDeform.i"
 %include "ElasticityImplicitLgDeform.i"
@@ -81,6 +81,31 @@ namespace pylith {
        */
       void dbInitialState(spatialdata::spatialdb::SpatialDB* value);
 
+      /** Set prefix for files caching values queried from the databases
+       * for physical properties and initial state variables.
+       *
+       * An empty prefix disables the cache.
+       *
+       * @param value Prefix for names of cache files.
+       */
+      void dbQueryCache(const char* value);
+
+      /** Set fingerprint of contents of database for physical properties.
+       *
+       * Queries are cached only for databases with a fingerprint.
+       *
+       * @param value Fingerprint of database (empty if unknown).
+       */
+      void dbPropertiesFingerprint(const char* value);
+
+      /** Set fingerprint of contents of database for initial state variables.
+       *
+       * Queries are cached only for databases with a fingerprint.
+       *
+       * @param value Fingerprint of database (empty if unknown).
+       */
+      void dbInitialStateFingerprint(const char* value);
+
       /** Set scales used to nondimensionalize physical properties.
        *
        * @param dim Nondimensionalizer
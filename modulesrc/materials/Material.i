@@ -109,6 +109,43 @@ namespace pylith {
        */
       void normalizer(const spatialdata::units::Nondimensional& dim);
       
+      /** Set flag for storing uniform physical properties compactly.
+       *
+       * @param flag True to store uniform properties compactly.
+       */
+      void compactProperties(const bool flag);
+      
+      /** Set flag for storing state variables in single precision.
+       *
+       * @param flag True to store state variables in single precision.
+       */
+      void stateVarsSinglePrecision(const bool flag);
+      
+      /** Set prefix for files caching values queried from the databases
+       * for physical properties and initial state variables.
+       *
+       * An empty prefix disables the cache.
+       *
+       * @param value Prefix for names of cache files.
+       */
+      void dbQueryCache(const char* value);
+
+      /** Set fingerprint of contents of database for physical properties.
+       *
+       * Queries are cached only for databases with a fingerprint.
+       *
+       * @param value Fingerprint of database (empty if unknown).
+       */
+      void dbPropertiesFingerprint(const char* value);
+
+      /** Set fingerprint of contents of database for initial state variables.
+       *
+       * Queries are cached only for databases with a fingerprint.
+       *
+       * @param value Fingerprint of database (empty if unknown).
+       */
+      void dbInitialStateFingerprint(const char* value);
+      
       /** Get size of stress/strain tensor associated with material.
        *
        * @returns Size of array holding stress/strain tensor.
@@ -66,6 +66,38 @@ namespace pylith {
        */
       bool useCustomConstraintPC(void) const;
 
+      /** Set flag for applying the Jacobian without assembling it.
+       *
+       * @param flag True if using matrix-free Jacobian, false otherwise.
+       */
+      void matrixFree(const bool flag);
+
+      /** Get flag for applying the Jacobian without assembling it.
+       *
+       * @returns True if using matrix-free Jacobian, false otherwise.
+       */
+      bool matrixFree(void) const;
+
+      /** Set preconditioner for matrix-free Jacobian.
+       *
+       * @param value Name of preconditioner ("diagonal" or "assembled").
+       */
+      void matrixFreePC(const char* value);
+
+      /** Get preconditioner for matrix-free Jacobian.
+       *
+       * @returns Name of preconditioner.
+       */
+      const char* matrixFreePC(void) const;
+
+      /** Setup operations of matrix-free Jacobian.
+       *
+       * @param jacobian Jacobian of system with PETSc shell matrix.
+       * @param fields Solution fields.
+       */
+      void initializeMatrixFree(pylith::topology::Jacobian* jacobian,
+				pylith::topology::SolutionFields* fields);
+
       /** Get solution fields.
        *
        * @returns solution fields.
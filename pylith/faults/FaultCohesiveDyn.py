@@ -47,6 +47,9 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
   @li \b open_free_surface If True, enforce traction free surface when
     the fault opens, otherwise use initial tractions even when the
     fault opens.
+  @li \b sensitivity_mode Method for computing change in slip from
+    change in tractions ('global' for linear solves, 'local' for
+    compliance of each vertex).
   
   \b Facilities
   @li \b tract_perturbation Prescribed perturbation in fault tractions.
@@ -71,6 +74,13 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     "the fault opens, otherwise use initial tractions even when the " \
     "fault opens."
 
+  sensitivityMode = pyre.inventory.str("sensitivity_mode", default="global",
+                                       validator=pyre.inventory.choice(["global",
+                                                                        "local"]))
+  sensitivityMode.meta['tip'] = "Method for computing change in slip from " \
+    "change in tractions ('global' for linear solves over fault, 'local' " \
+    "for compliance of each vertex from diagonal blocks of Jacobian)."
+
   tract = pyre.inventory.facility("traction_perturbation", family="traction_perturbation", factory=NullComponent)
   tract.meta['tip'] = "Prescribed perturbation in fault tractions."
 
@@ -216,6 +226,7 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     ModuleFaultCohesiveDyn.zeroTolerance(self, self.inventory.zeroTolerance)
     ModuleFaultCohesiveDyn.zeroToleranceNormal(self, self.inventory.zeroToleranceNormal)
     ModuleFaultCohesiveDyn.openFreeSurf(self, self.inventory.openFreeSurf)
+    ModuleFaultCohesiveDyn.sensitivityMode(self, self.inventory.sensitivityMode)
     self.output = self.inventory.output
     return
 
@@ -173,6 +173,9 @@ class IntegratorElasticity(Integrator):
     """
     Initialize output.
     """
+    if self.materialObj.quadrature.checkConditioning() and \
+          not "condition_number" in self.output.cellInfoFields:
+      self.output.cellInfoFields.append("condition_number")
     self.output.initialize(normalizer, self.materialObj.quadrature)
     self.output.writeInfo()
     self.output.open(totalTime, numTimeSteps)
@@ -41,8 +41,10 @@ class QuadratureBase(PetscComponent):
     ##
     ## \b Properties
     ## @li \b min_jacobian Minimum allowable determinant of Jacobian.
-    ## @li \b check_conditoning Check element matrices for 
-    ##   ill-conditioning.
+    ## @li \b check_conditoning Write condition number of cells with
+    ##   material info fields to check for ill-conditioning.
+    ## @li \b cache_geometry Cache geometry of cells at quadrature points.
+    ## @li \b geometry_cache_budget Maximum memory for geometry cache (MB).
     ##
     ## \b Facilities
     ## @li \b cell Reference cell with basis functions and quadrature rules
@@ -55,7 +57,17 @@ class QuadratureBase(PetscComponent):
     checkConditioning = pyre.inventory.bool("check_conditioning",
                                             default=False)
     checkConditioning.meta['tip'] = \
-        "Check element matrices for ill-conditioning."
+        "Write condition number of cells with material info fields " \
+        "to check for ill-conditioning."
+
+    cacheGeometry = pyre.inventory.bool("cache_geometry", default=False)
+    cacheGeometry.meta['tip'] = \
+        "Cache geometry of cells at quadrature points."
+
+    geometryCacheBudget = pyre.inventory.float("geometry_cache_budget",
+                                               default=512.0,
+                                               validator=pyre.inventory.greaterEqual(0.0))
+    geometryCacheBudget.meta['tip'] = "Maximum memory for geometry cache (MB)."
 
     from pylith.feassemble.FIATSimplex import FIATSimplex
     cell = pyre.inventory.facility("cell", family="reference_cell",
@@ -107,6 +119,8 @@ class QuadratureBase(PetscComponent):
     PetscComponent._configure(self)
     self.minJacobian(self.inventory.minJacobian)
     self.checkConditioning(self.inventory.checkConditioning)
+    self.cacheGeometry(self.inventory.cacheGeometry)
+    self.geometryCacheBudget(self.inventory.geometryCacheBudget)
     self.cell = self.inventory.cell
     return
 
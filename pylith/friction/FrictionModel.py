@@ -66,6 +66,7 @@ class FrictionModel(PetscComponent):
     ##
     ## \b Properties
     ## @li \b name Name of friction model.
+    ## @li \b db_query_cache Prefix for files caching database queries.
     ##
     ## \b Facilities
     ## @li \b db_properties Database of material property parameters
@@ -76,6 +77,11 @@ class FrictionModel(PetscComponent):
     label = pyre.inventory.str("label", default="", validator=validateLabel)
     label.meta['tip'] = "Descriptive label for friction model."
 
+    dbQueryCache = pyre.inventory.str("db_query_cache", default="")
+    dbQueryCache.meta['tip'] = "Prefix for files caching values queried from " \
+        "the spatial databases, so restarts skip the queries (empty to disable). " \
+        "Only SimpleDB, SimpleGridDB, and UniformDB databases are cached."
+
     from spatialdata.spatialdb.SimpleDB import SimpleDB
     dbProperties = pyre.inventory.facility("db_properties",
                                            family="spatial_database",
@@ -122,10 +128,14 @@ class FrictionModel(PetscComponent):
     try:
       PetscComponent._configure(self)
       self.label(self.inventory.label)
+      self.dbQueryCache(self.inventory.dbQueryCache)
+      from pylith.utils.dbfingerprint import dbFingerprint
       self.dbProperties(self.inventory.dbProperties)
+      self.dbPropertiesFingerprint(dbFingerprint(self.inventory.dbProperties))
       from pylith.utils.NullComponent import NullComponent
       if not isinstance(self.inventory.dbInitialState, NullComponent):
         self.dbInitialState(self.inventory.dbInitialState)
+        self.dbInitialStateFingerprint(dbFingerprint(self.inventory.dbInitialState))
 
       self.perfLogger = self.inventory.perfLogger
     except ValueError, err:
@@ -87,7 +87,7 @@ class DruckerPrager3D(ElasticMaterial, ModuleDruckerPrager3D):
             'data': []},
          'cell': \
            {'info': ["mu", "lambda", "density", "stable_dt_implicit", "stable_dt_explicit",
-                     "alpha_yield", "beta", "alpha_flow"],
+                     "condition_number", "alpha_yield", "beta", "alpha_flow"],
             'data': ["total_strain", "stress", "cauchy_stress", "plastic_strain"]}}
     self._loggingPrefix = "MaDP3D "
     return
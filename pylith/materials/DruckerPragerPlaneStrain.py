@@ -87,7 +87,7 @@ class DruckerPragerPlaneStrain(ElasticMaterial, ModuleDruckerPragerPlaneStrain):
             'data': []},
          'cell': \
            {'info': ["mu", "lambda", "density", "stable_dt_implicit", "stable_dt_explicit",
-                     "alpha_yield", "beta", "alpha_flow"],
+                     "condition_number", "alpha_yield", "beta", "alpha_flow"],
             'data': ["total_strain", "stress", "cauchy_stress", "stress_zz_initial",
                      "plastic_strain"]}}
     self._loggingPrefix = "MaDP2D "
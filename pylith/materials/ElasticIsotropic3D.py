@@ -45,7 +45,8 @@ class ElasticIsotropic3D(ElasticMaterial, ModuleElasticIsotropic3D):
            {'info': [],
             'data': []},
          'cell': \
-           {'info': ["mu", "lambda", "density", "stable_dt_implicit", "stable_dt_explicit",],
+           {'info': ["mu", "lambda", "density", "stable_dt_implicit", "stable_dt_explicit",
+                     "condition_number",],
             'data': ["total_strain", "stress", "cauchy_stress"]}}
     self._loggingPrefix = "MaEl3D "
     return
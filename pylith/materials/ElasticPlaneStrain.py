@@ -47,7 +47,8 @@ class ElasticPlaneStrain(ElasticMaterial, ModuleElasticPlaneStrain):
            {'info': [],
             'data': []},
          'cell': \
-           {'info': ["mu", "lambda", "density", "stable_dt_implicit", "stable_dt_explicit",],
+           {'info': ["mu", "lambda", "density", "stable_dt_implicit", "stable_dt_explicit",
+                     "condition_number",],
             'data': ["total_strain", "stress", "cauchy_stress"]}}
     self._loggingPrefix = "MaPlSn "
     return
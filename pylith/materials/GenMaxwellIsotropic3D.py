@@ -48,7 +48,7 @@ class GenMaxwellIsotropic3D(ElasticMaterial, ModuleGenMaxwellIsotropic3D):
             'data': []},
          'cell': \
            {'info': ["mu", "lambda", "density", "stable_dt_implicit", "stable_dt_explicit",
-                     "shear_ratio", "maxwell_time"],
+                     "condition_number", "shear_ratio", "maxwell_time"],
             'data': ["total_strain", "stress", "cauchy_stress",
                      "viscous_strain_1", 
                      "viscous_strain_2", 
@@ -48,7 +48,7 @@ class GenMaxwellQpQsIsotropic3D(ElasticMaterial, ModuleGenMaxwellQpQsIsotropic3D
             'data': []},
          'cell': \
            {'info': ["mu", "k", "density", "stable_dt_implicit", "stable_dt_explicit",
-                     "shear_ratio", 
+                     "condition_number", "shear_ratio", 
                      "bulk_ratio",
                      "maxwell_time_shear",
                      "maxwell_time_bulk"],
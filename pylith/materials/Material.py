@@ -67,6 +67,9 @@ class Material(PetscComponent):
     ## \b Properties
     ## @li \b id Material identifier (from mesh generator)
     ## @li \b label Descriptive label for material.
+    ## @li \b compact_properties Store uniform physical properties compactly.
+    ## @li \b state_vars_single_precision Store state variables in single precision.
+    ## @li \b db_query_cache Prefix for files caching database queries.
     ##
     ## \b Facilities
     ## @li \b db_properties Database of material property parameters
@@ -81,6 +84,20 @@ class Material(PetscComponent):
     label = pyre.inventory.str("label", default="", validator=validateLabel)
     label.meta['tip'] = "Descriptive label for material."
 
+    compactProperties = pyre.inventory.bool("compact_properties", default=False)
+    compactProperties.meta['tip'] = "Store physical properties once for the " \
+        "material or once per cell when they are uniform."
+
+    stateVarsSinglePrecision = pyre.inventory.bool("state_vars_single_precision",
+                                                   default=False)
+    stateVarsSinglePrecision.meta['tip'] = "Store state variables in single " \
+        "precision to reduce memory use (values are computed in double precision)."
+
+    dbQueryCache = pyre.inventory.str("db_query_cache", default="")
+    dbQueryCache.meta['tip'] = "Prefix for files caching values queried from " \
+        "the spatial databases, so restarts skip the queries (empty to disable). " \
+        "Only SimpleDB, SimpleGridDB, and UniformDB databases are cached."
+
     from spatialdata.spatialdb.SimpleDB import SimpleDB
     dbProperties = pyre.inventory.facility("db_properties",
                                            family="spatial_database",
@@ -185,10 +202,16 @@ class Material(PetscComponent):
       PetscComponent._configure(self)
       self.id(self.inventory.id)
       self.label(self.inventory.label)
+      self.compactProperties(self.inventory.compactProperties)
+      self.stateVarsSinglePrecision(self.inventory.stateVarsSinglePrecision)
+      self.dbQueryCache(self.inventory.dbQueryCache)
+      from pylith.utils.dbfingerprint import dbFingerprint
       self.dbProperties(self.inventory.dbProperties)
+      self.dbPropertiesFingerprint(dbFingerprint(self.inventory.dbProperties))
       from pylith.utils.NullComponent import NullComponent
       if not isinstance(self.inventory.dbInitialState, NullComponent):
         self.dbInitialState(self.inventory.dbInitialState)
+        self.dbInitialStateFingerprint(dbFingerprint(self.inventory.dbInitialState))
 
       self.quadrature = self.inventory.quadrature
       self.perfLogger = self.inventory.perfLogger
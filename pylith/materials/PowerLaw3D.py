@@ -47,7 +47,7 @@ class PowerLaw3D(ElasticMaterial, ModulePowerLaw3D):
             'data': []},
          'cell': \
            {'info': ["mu", "lambda", "density", "stable_dt_implicit", "stable_dt_explicit",
-                     "reference_strain_rate", "reference_stress",
+                     "condition_number", "reference_strain_rate", "reference_stress",
                      "power_law_exponent"],
             'data': ["total_strain", "stress", "cauchy_stress", "viscous_strain"]}}
     self._loggingPrefix = "MaPL3D "
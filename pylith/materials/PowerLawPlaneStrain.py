@@ -47,7 +47,7 @@ class PowerLawPlaneStrain(ElasticMaterial, ModulePowerLawPlaneStrain):
             'data': []},
          'cell': \
            {'info': ["mu", "lambda", "density", "stable_dt_implicit", "stable_dt_explicit",
-                     "reference_strain_rate", "reference_stress",
+                     "condition_number", "reference_strain_rate", "reference_stress",
                      "power_law_exponent"],
             'data': ["total_strain", "stress", "cauchy_stress",
                      "stress_zz_initial", "stress4", "viscous_strain"]}}
@@ -80,13 +80,43 @@ class Implicit(Formulation, ModuleImplicit):
     ## Python object for managing Implicit facilities and properties.
     ##
     ## \b Properties
-    ## @li None
+    ## @li \b num_threads Number of threads in loops over cells for elasticity.
+    ## @li \b deterministic_assembly Assemble threaded residual in fixed order.
+    ## @li \b reuse_cell_matrices Reuse elasticity cell matrices when unchanged.
+    ## @li \b matrix_free Apply Jacobian cell by cell without assembling it.
+    ## @li \b matrix_free_pc Preconditioner for matrix-free Jacobian.
     ##
     ## \b Facilities
     ## @li None
 
     import pyre.inventory
 
+    numThreads = pyre.inventory.int("num_threads", default=1,
+                                    validator=pyre.inventory.greaterEqual(1))
+    numThreads.meta['tip'] = "Number of threads in loops over cells when " \
+        "integrating elasticity residual and Jacobian (requires OpenMP)."
+
+    deterministicAssembly = pyre.inventory.bool("deterministic_assembly",
+                                                default=True)
+    deterministicAssembly.meta['tip'] = "Assemble threaded residual in a " \
+        "fixed order so results are bitwise reproducible."
+
+    reuseCellMatrices = pyre.inventory.bool("reuse_cell_matrices",
+                                            default=False)
+    reuseCellMatrices.meta['tip'] = "Store elasticity cell matrices and " \
+        "reuse them when reforming the Jacobian if the elastic constants " \
+        "are unchanged (uses more memory)."
+
+    matrixFree = pyre.inventory.bool("matrix_free", default=False)
+    matrixFree.meta['tip'] = "Apply Jacobian cell by cell using the elastic " \
+        "constants instead of assembling a sparse matrix."
+
+    matrixFreePC = pyre.inventory.str("matrix_free_pc", default="diagonal",
+                                      validator=pyre.inventory.choice(["diagonal",
+                                                                       "assembled"]))
+    matrixFreePC.meta['tip'] = "Preconditioner for matrix-free Jacobian " \
+        "('diagonal' for Jacobi, 'assembled' for sparse preconditioning matrix)."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -106,6 +136,9 @@ class Implicit(Formulation, ModuleImplicit):
     """
     from pylith.feassemble.ElasticityImplicit import ElasticityImplicit
     integrator = ElasticityImplicit()
+    integrator.numThreads(self.numThreads)
+    integrator.deterministicAssembly(self.deterministicAssembly)
+    integrator.reuseCellMatrices(self.reuseCellMatrices)
     return integrator
 
 
@@ -152,10 +185,14 @@ class Implicit(Formulation, ModuleImplicit):
     if 0 == comm.rank:
       self._info.log("Creating Jacobian matrix.")
     self._setJacobianMatrixType()
+    if self.matrixFree:
+      self.matrixType = "shell"
     from pylith.topology.Jacobian import Jacobian
     self.jacobian = Jacobian(self.fields.solution(),
                              self.matrixType, self.blockMatrixOkay)
     self.jacobian.zero() # TEMPORARY, to get correct memory usage
+    if self.matrixFree:
+      ModuleImplicit.initializeMatrixFree(self, self.jacobian, self.fields)
     self._debug.log(resourceUsageString())
 
     #memoryLogger.stagePush("Problem")
@@ -286,6 +323,15 @@ class Implicit(Formulation, ModuleImplicit):
     Set members based using inventory.
     """
     Formulation._configure(self)
+    self.numThreads = self.inventory.numThreads
+    self.deterministicAssembly = self.inventory.deterministicAssembly
+    self.reuseCellMatrices = self.inventory.reuseCellMatrices
+    self.matrixFree = self.inventory.matrixFree
+    if self.matrixFree and self.viewJacobian:
+      print "WARNING: Cannot view matrix-free Jacobian. Turning off view_jacobian."
+      self.viewJacobian = False
+    ModuleImplicit.matrixFree(self, self.matrixFree)
+    ModuleImplicit.matrixFreePC(self, self.inventory.matrixFreePC)
 
     import journal
     self._debug = journal.debug(self.name)
@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/utils/dbfingerprint.py
+##
+## @brief Fingerprints of spatial databases for caching query results.
+
+# ----------------------------------------------------------------------
+def _fileFingerprint(filename):
+  """
+  Get fingerprint of file from its name, size, and modification time.
+  """
+  import os
+  try:
+    info = os.stat(filename)
+  except OSError:
+    return ""
+  return "file=%s;size=%d;mtime=%r" % \
+      (os.path.abspath(filename), info.st_size, info.st_mtime)
+
+
+# ----------------------------------------------------------------------
+def dbFingerprint(db):
+  """
+  Get fingerprint identifying the contents and query type of a spatial
+  database.
+
+  Returns an empty string if the contents of the database cannot be
+  identified, in which case queries of the database are not cached.
+  """
+  inventory = getattr(db, "inventory", None)
+  if inventory is None:
+    return ""
+
+  fingerprint = ""
+  if hasattr(inventory, "iohandler"):
+    # SimpleDB
+    filename = getattr(inventory.iohandler.inventory, "filename", "")
+    fingerprint = _fileFingerprint(filename) if filename else ""
+  elif hasattr(inventory, "filename"):
+    # SimpleGridDB
+    fingerprint = _fileFingerprint(inventory.filename) if inventory.filename else ""
+  elif hasattr(inventory, "values") and hasattr(inventory, "data"):
+    # UniformDB
+    import hashlib
+    contents = repr((list(inventory.values), list(inventory.data)))
+    fingerprint = "uniform=%s" % hashlib.sha1(contents).hexdigest()
+  if not fingerprint:
+    return ""
+
+  queryType = getattr(inventory, "queryType", None)
+  if not queryType is None:
+    fingerprint += ";query_type=%s" % queryType
+  return fingerprint
+
+
+# End of file
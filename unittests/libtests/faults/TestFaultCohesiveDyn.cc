@@ -150,6 +150,27 @@ pylith::faults::TestFaultCohesiveDyn::testOpenFreeSurf(void)
   CPPUNIT_ASSERT_EQUAL(value, fault._openFreeSurf);
  } // testOpenFreeSurf
 
+// ----------------------------------------------------------------------
+// Test sensitivityMode().
+void
+pylith::faults::TestFaultCohesiveDyn::testSensitivityMode(void)
+{ // testSensitivityMode
+  PYLITH_METHOD_BEGIN;
+
+  FaultCohesiveDyn fault;
+
+  CPPUNIT_ASSERT_EQUAL(std::string("global"), std::string(fault.sensitivityMode())); // default
+  CPPUNIT_ASSERT_EQUAL(false, fault._sensitivityLocal);
+
+  fault.sensitivityMode("local");
+  CPPUNIT_ASSERT_EQUAL(std::string("local"), std::string(fault.sensitivityMode()));
+  CPPUNIT_ASSERT_EQUAL(true, fault._sensitivityLocal);
+
+  CPPUNIT_ASSERT_THROW(fault.sensitivityMode("blockjacobi"), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testSensitivityMode
+
 // ----------------------------------------------------------------------
 // Test initialize().
 void
@@ -590,12 +611,245 @@ pylith::faults::TestFaultCohesiveDyn::testCalcTractions(void)
   PYLITH_METHOD_END;
 } // testCalcTractions
 
+// ----------------------------------------------------------------------
+// Test reuse of sensitivity Jacobian and solver.
+void
+pylith::faults::TestFaultCohesiveDyn::testSensitivityReuse(void)
+{ // testSensitivityReuse
+  PYLITH_METHOD_BEGIN;
+
+  assert(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveDyn fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+  topology::Jacobian jacobian(fields.solution());
+  _setFieldsJacobian(&mesh, &fault, &fields, &jacobian, _data->fieldIncrStick);
+
+  const PylithScalar t = 2.134 / _data->timeScale;
+  const PylithScalar dt = 0.01 / _data->timeScale;
+  fault.timeStep(dt);
+  fault.constrainSolnSpace(&fields, t, jacobian);
+
+  const int numSides = 2;
+  long sensitivityState[numSides];
+  PetscKSP ksp[numSides];
+  for (int iSide=0; iSide < numSides; ++iSide) {
+    CPPUNIT_ASSERT(fault._jacobian[iSide]);
+    CPPUNIT_ASSERT(fault._ksp[iSide]);
+    CPPUNIT_ASSERT_EQUAL(jacobian.valuesState(), fault._jacobianState[iSide]);
+    sensitivityState[iSide] = fault._jacobian[iSide]->valuesState();
+    ksp[iSide] = fault._ksp[iSide];
+  } // for
+
+  // Domain Jacobian is unchanged, so sensitivity Jacobian should not
+  // be reformed.
+  fault.constrainSolnSpace(&fields, t, jacobian);
+  for (int iSide=0; iSide < numSides; ++iSide) {
+    CPPUNIT_ASSERT_EQUAL(sensitivityState[iSide], fault._jacobian[iSide]->valuesState());
+    CPPUNIT_ASSERT_EQUAL(ksp[iSide], fault._ksp[iSide]);
+  } // for
+
+  // Domain Jacobian is updated, so sensitivity Jacobian should be
+  // reformed.
+  jacobian.assemble("final_assembly");
+  fault.constrainSolnSpace(&fields, t, jacobian);
+  for (int iSide=0; iSide < numSides; ++iSide) {
+    CPPUNIT_ASSERT(sensitivityState[iSide] != fault._jacobian[iSide]->valuesState());
+    CPPUNIT_ASSERT_EQUAL(jacobian.valuesState(), fault._jacobianState[iSide]);
+    CPPUNIT_ASSERT_EQUAL(ksp[iSide], fault._ksp[iSide]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testSensitivityReuse
+
+// ----------------------------------------------------------------------
+// Test compliance and update of relative displacement for local
+// sensitivity mode.
+void
+pylith::faults::TestFaultCohesiveDyn::testSensitivityLocal(void)
+{ // testSensitivityLocal
+  PYLITH_METHOD_BEGIN;
+
+  assert(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveDyn fault;
+  fault.sensitivityMode("local");
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+  topology::Jacobian jacobian(fields.solution());
+  _setFieldsJacobian(&mesh, &fault, &fields, &jacobian, _data->fieldIncrSlip);
+
+  const int spaceDim = _data->spaceDim;
+  const int blockSize = spaceDim*spaceDim;
+
+  const PylithScalar t = 2.134 / _data->timeScale;
+  const PylithScalar dt = 0.01 / _data->timeScale;
+  fault.timeStep(dt);
+  fault.constrainSolnSpace(&fields, t, jacobian);
+
+  // No linear solves for local sensitivity mode.
+  for (int iSide=0; iSide < 2; ++iSide) {
+    CPPUNIT_ASSERT(!fault._jacobian[iSide]);
+    CPPUNIT_ASSERT(!fault._ksp[iSide]);
+  } // for
+  CPPUNIT_ASSERT_EQUAL(jacobian.valuesState(), fault._complianceState);
+
+  const int numVertices = fault._cohesiveVertices.size();
+  CPPUNIT_ASSERT_EQUAL(size_t(numVertices*blockSize), fault._compliance.size());
+
+  { // Check compliance and relative displacement.
+    // Compliance C = area * (inv(Kn) + inv(Kp)), so Kn C Kp = area * (Kn + Kp).
+    PetscErrorCode err;
+    const PetscMat jacobianMat = jacobian.matrix();CPPUNIT_ASSERT(jacobianMat);
+    PetscSection globalSection = fields.solution().globalSection();CPPUNIT_ASSERT(globalSection);
+
+    topology::VecVisitorMesh areaVisitor(fault._fields->get("area"));
+    const PetscScalar* areaArray = areaVisitor.localArray();CPPUNIT_ASSERT(areaArray);
+
+    topology::VecVisitorMesh dLagrangeVisitor(fault._fields->get("sensitivity dLagrange"));
+    const PetscScalar* dLagrangeArray = dLagrangeVisitor.localArray();CPPUNIT_ASSERT(dLagrangeArray);
+
+    topology::VecVisitorMesh dispRelVisitor(fault._fields->get("sensitivity relative disp"));
+    const PetscScalar* dispRelArray = dispRelVisitor.localArray();CPPUNIT_ASSERT(dispRelArray);
+
+    const FaultCohesiveLagrange::CohesiveOffsets& offsets = fault._cohesiveOffsets(fields.get("dispIncr(t->t+dt)"));
+
+    int_array indicesN(spaceDim);
+    int_array indicesP(spaceDim);
+    scalar_array jacobianN(blockSize);
+    scalar_array jacobianP(blockSize);
+    const PylithScalar tolerance = 1.0e-06;
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+      if (offsets.lagrange[iVertex] < 0) {
+	continue;
+      } // if
+
+      PetscInt goffN, goffP;
+      err = PetscSectionGetOffset(globalSection, fault._cohesiveVertices[iVertex].negative, &goffN);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionGetOffset(globalSection, fault._cohesiveVertices[iVertex].positive, &goffP);PYLITH_CHECK_ERROR(err);
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+	indicesN[iDim] = goffN + iDim;
+	indicesP[iDim] = goffP + iDim;
+      } // for
+      err = MatGetValues(jacobianMat, spaceDim, &indicesN[0], spaceDim, &indicesN[0], &jacobianN[0]);PYLITH_CHECK_ERROR(err);
+      err = MatGetValues(jacobianMat, spaceDim, &indicesP[0], spaceDim, &indicesP[0], &jacobianP[0]);PYLITH_CHECK_ERROR(err);
+
+      const PylithScalar areaVertex = areaArray[offsets.faultScalar[iVertex]];
+      const PylithScalar* complianceVertex = &fault._compliance[iVertex*blockSize];
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+	for (int jDim=0; jDim < spaceDim; ++jDim) {
+	  PylithScalar value = 0.0;
+	  for (int kDim=0; kDim < spaceDim; ++kDim) {
+	    for (int lDim=0; lDim < spaceDim; ++lDim) {
+	      value += jacobianN[iDim*spaceDim+kDim] * complianceVertex[kDim*spaceDim+lDim] * jacobianP[lDim*spaceDim+jDim];
+	    } // for
+	  } // for
+	  const PylithScalar valueE = areaVertex * (jacobianN[iDim*spaceDim+jDim] + jacobianP[iDim*spaceDim+jDim]);
+	  if (fabs(valueE) > tolerance) {
+	    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+	  } else {
+	    CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value, tolerance);
+	  } // if/else
+	} // for
+      } // for
+
+      // Relative displacement is -C dLagrange.
+      const PetscInt soff = offsets.faultVector[iVertex];
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+	PylithScalar valueE = 0.0;
+	for (int jDim=0; jDim < spaceDim; ++jDim) {
+	  valueE -= complianceVertex[iDim*spaceDim+jDim] * dLagrangeArray[soff+jDim];
+	} // for
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, dispRelArray[soff+iDim], tolerance);
+      } // for
+    } // for
+  } // Check compliance and relative displacement.
+
+  // Domain Jacobian is updated, so compliance should be recomputed.
+  const long complianceState = fault._complianceState;
+  jacobian.assemble("final_assembly");
+  fault.constrainSolnSpace(&fields, t, jacobian);
+  CPPUNIT_ASSERT(complianceState != fault._complianceState);
+  CPPUNIT_ASSERT_EQUAL(jacobian.valuesState(), fault._complianceState);
+
+  PYLITH_METHOD_END;
+} // testSensitivityLocal
+
+// ----------------------------------------------------------------------
+// Test constrainSolnSpace() for local sensitivity mode with friction
+// properties that vary by vertex.
+void
+pylith::faults::TestFaultCohesiveDyn::testConstrainSolnSpaceLocal(void)
+{ // testConstrainSolnSpaceLocal
+  PYLITH_METHOD_BEGIN;
+
+  assert(_data);
+
+  const PylithScalar t = 2.134 / _data->timeScale;
+  const PylithScalar dt = 0.01 / _data->timeScale;
+
+  // The update for each vertex must use the friction properties of
+  // that vertex, so the result cannot depend on which vertex the
+  // friction model retrieved last. Leave the friction model at the
+  // first and last fault vertex before constraining the solution
+  // space and compare the adjustments to the solution.
+  const int numRuns = 2;
+  scalar_array dispIncrAdjRuns[numRuns];
+  for (int iRun=0; iRun < numRuns; ++iRun) {
+    topology::Mesh mesh;
+    FaultCohesiveDyn fault;
+    fault.sensitivityMode("local");
+    topology::SolutionFields fields(mesh);
+    const bool varyingFriction = true;
+    _initialize(&mesh, &fault, &fields, varyingFriction);
+    topology::Jacobian jacobian(fields.solution());
+    _setFieldsJacobian(&mesh, &fault, &fields, &jacobian, _data->fieldIncrSlip);
+
+    PetscDM faultDMMesh = fault._faultMesh->dmMesh();CPPUNIT_ASSERT(faultDMMesh);
+    topology::Stratum verticesStratum(faultDMMesh, topology::Stratum::DEPTH, 0);
+    CPPUNIT_ASSERT(verticesStratum.size() > 1);
+    CPPUNIT_ASSERT(_friction);
+    _friction->retrievePropsStateVars((0 == iRun) ? verticesStratum.begin() : verticesStratum.end()-1);
+
+    fault.timeStep(dt);
+    fault.constrainSolnSpace(&fields, t, jacobian);
+
+    const topology::Field& dispIncrAdj = fields.get("dispIncr adjust");
+    PetscInt size = 0;
+    PetscErrorCode err = VecGetLocalSize(dispIncrAdj.localVector(), &size);PYLITH_CHECK_ERROR(err);
+    topology::VecVisitorMesh dispIncrAdjVisitor(dispIncrAdj);
+    const PetscScalar* dispIncrAdjArray = dispIncrAdjVisitor.localArray();CPPUNIT_ASSERT(dispIncrAdjArray);
+    dispIncrAdjRuns[iRun].resize(size);
+    for (PetscInt i=0; i < size; ++i) {
+      dispIncrAdjRuns[iRun][i] = dispIncrAdjArray[i];
+    } // for
+  } // for
+
+  const size_t size = dispIncrAdjRuns[0].size();
+  CPPUNIT_ASSERT_EQUAL(size, dispIncrAdjRuns[1].size());
+  const PylithScalar tolerance = 1.0e-06;
+  for (size_t i=0; i < size; ++i) {
+    const PylithScalar valE = dispIncrAdjRuns[0][i];
+    if (fabs(valE) > tolerance) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dispIncrAdjRuns[1][i]/valE, tolerance);
+    } else {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valE, dispIncrAdjRuns[1][i], tolerance);
+    } // if/else
+  } // for
+
+  PYLITH_METHOD_END;
+} // testConstrainSolnSpaceLocal
+
 // ----------------------------------------------------------------------
 // Initialize FaultCohesiveDyn interface condition.
 void
 pylith::faults::TestFaultCohesiveDyn::_initialize(topology::Mesh* const mesh,
 						  FaultCohesiveDyn* const fault,
-						  topology::SolutionFields* const fields)
+						  topology::SolutionFields* const fields,
+						  const bool varyingFriction)
 { // _initialize
   PYLITH_METHOD_BEGIN;
 
@@ -646,16 +900,16 @@ pylith::faults::TestFaultCohesiveDyn::_initialize(topology::Mesh* const mesh,
   spatialdata::spatialdb::SimpleDB* dbFriction = new spatialdata::spatialdb::SimpleDB("static friction");CPPUNIT_ASSERT(dbFriction);
   spatialdata::spatialdb::SimpleIOAscii ioFriction;
   if (2 == _data->spaceDim)
-    ioFriction.filename("data/static_friction_2d.spatialdb");
+    ioFriction.filename(varyingFriction ? "data/static_friction_varying_2d.spatialdb" : "data/static_friction_2d.spatialdb");
   else if (3 == _data->spaceDim)
-    ioFriction.filename("data/static_friction_3d.spatialdb");
+    ioFriction.filename(varyingFriction ? "data/static_friction_varying_3d.spatialdb" : "data/static_friction_3d.spatialdb");
   dbFriction->ioHandler(&ioFriction);
   delete _dbFriction; _dbFriction = dbFriction;
   friction::StaticFriction* friction = new pylith::friction::StaticFriction();CPPUNIT_ASSERT(friction);
   friction->label("static friction");
   friction->dbProperties(dbFriction);
   friction->normalizer(normalizer);
-  _friction = friction;
+  delete _friction; _friction = friction;
   fault->frictionModel(friction);
 
   PetscInt labelSize;
@@ -55,6 +55,7 @@ class pylith::faults::TestFaultCohesiveDyn: public CppUnit::TestFixture
   CPPUNIT_TEST( testTractPerturbation );
   CPPUNIT_TEST( testZeroTolerance );
   CPPUNIT_TEST( testOpenFreeSurf );
+  CPPUNIT_TEST( testSensitivityMode );
 
   // Tests in derived classes:
   // testInitialize()
@@ -63,6 +64,9 @@ class pylith::faults::TestFaultCohesiveDyn: public CppUnit::TestFixture
   // testConstrainSolnSpaceOpen()
   // testUpdateStateVars()
   // testCalcTractions()
+  // testSensitivityReuse()
+  // testSensitivityLocal()
+  // testConstrainSolnSpaceLocal()
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -97,6 +101,9 @@ public:
   /// Test openFreeSurf().
   void testOpenFreeSurf(void);
 
+  /// Test sensitivityMode().
+  void testSensitivityMode(void);
+
   /// Test initialize().
   void testInitialize(void);
 
@@ -115,6 +122,18 @@ public:
   /// Test _calcTractions().
   void testCalcTractions(void);
 
+  /// Test reuse of sensitivity Jacobian and solver when domain Jacobian
+  /// is unchanged.
+  void testSensitivityReuse(void);
+
+  /// Test compliance and update of relative displacement for local
+  /// sensitivity mode.
+  void testSensitivityLocal(void);
+
+  /// Test constrainSolnSpace() for local sensitivity mode with
+  /// friction properties that vary by vertex.
+  void testConstrainSolnSpaceLocal(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private:
 
@@ -123,10 +142,12 @@ private:
    * @param mesh PETSc mesh to initialize
    * @param fault Cohesive fault interface condition to initialize.
    * @param fields Solution fields.
+   * @param varyingFriction Use friction properties that vary by vertex.
    */
   void _initialize(topology::Mesh* const mesh,
       FaultCohesiveDyn* const fault,
-      topology::SolutionFields* const fields);
+      topology::SolutionFields* const fields,
+      const bool varyingFriction =false);
 
   /** Set values for fields and Jacobian.
    *
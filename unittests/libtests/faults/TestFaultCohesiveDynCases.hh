@@ -54,6 +54,9 @@ class pylith::faults::TestFaultCohesiveDynTri3 : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testSensitivityReuse );
+  CPPUNIT_TEST( testSensitivityLocal );
+  CPPUNIT_TEST( testConstrainSolnSpaceLocal );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -80,6 +83,9 @@ class pylith::faults::TestFaultCohesiveDynTri3d : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testSensitivityReuse );
+  CPPUNIT_TEST( testSensitivityLocal );
+  CPPUNIT_TEST( testConstrainSolnSpaceLocal );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -106,6 +112,9 @@ class pylith::faults::TestFaultCohesiveDynQuad4 : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testSensitivityReuse );
+  CPPUNIT_TEST( testSensitivityLocal );
+  CPPUNIT_TEST( testConstrainSolnSpaceLocal );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -132,6 +141,9 @@ class pylith::faults::TestFaultCohesiveDynTet4 : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testSensitivityReuse );
+  CPPUNIT_TEST( testSensitivityLocal );
+  CPPUNIT_TEST( testConstrainSolnSpaceLocal );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -158,6 +170,9 @@ class pylith::faults::TestFaultCohesiveDynHex8 : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testSensitivityReuse );
+  CPPUNIT_TEST( testSensitivityLocal );
+  CPPUNIT_TEST( testConstrainSolnSpaceLocal );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -598,6 +598,70 @@ pylith::faults::TestFaultCohesiveKin::testCalcTractionsChange(void)
   PYLITH_METHOD_END;
 } // testCalcTractionsChange
 
+// ----------------------------------------------------------------------
+// Test _cohesiveOffsets().
+void
+pylith::faults::TestFaultCohesiveKin::testCohesiveOffsets(void)
+{ // testCohesiveOffsets
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  const int spaceDim = _data->spaceDim;
+
+  const topology::Field& solution = fields.get("dispIncr(t->t+dt)");
+  const FaultCohesiveKin::CohesiveOffsets& offsets = fault._cohesiveOffsets(solution);
+
+  const int numVertices = fault._cohesiveVertices.size();
+  CPPUNIT_ASSERT_EQUAL(size_t(numVertices), offsets.lagrange.size());
+
+  topology::VecVisitorMesh solutionVisitor(solution);
+  PetscSection solutionGlobalSection = solution.globalSection();CPPUNIT_ASSERT(solutionGlobalSection);
+  CPPUNIT_ASSERT(fault._fields);
+  topology::VecVisitorMesh dispRelVisitor(fault._fields->get("relative disp"));
+  topology::VecVisitorMesh areaVisitor(fault._fields->get("area"));
+  topology::VecVisitorMesh orientationVisitor(fault._fields->get("orientation"));
+
+  PetscErrorCode err;
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    const PetscInt e_lagrange = fault._cohesiveVertices[iVertex].lagrange;
+    const PetscInt v_fault = fault._cohesiveVertices[iVertex].fault;
+    const PetscInt v_negative = fault._cohesiveVertices[iVertex].negative;
+    const PetscInt v_positive = fault._cohesiveVertices[iVertex].positive;
+
+    if (e_lagrange < 0) { // clamped edges
+      CPPUNIT_ASSERT_EQUAL(-1, int(offsets.lagrange[iVertex]));
+      CPPUNIT_ASSERT_EQUAL(-1, int(offsets.lagrangeGlobal[iVertex]));
+      continue;
+    } // if
+
+    CPPUNIT_ASSERT_EQUAL(solutionVisitor.sectionOffset(v_negative), PetscInt(offsets.negative[iVertex]));
+    CPPUNIT_ASSERT_EQUAL(solutionVisitor.sectionOffset(v_positive), PetscInt(offsets.positive[iVertex]));
+    CPPUNIT_ASSERT_EQUAL(solutionVisitor.sectionOffset(e_lagrange), PetscInt(offsets.lagrange[iVertex]));
+    CPPUNIT_ASSERT_EQUAL(dispRelVisitor.sectionOffset(v_fault), PetscInt(offsets.faultVector[iVertex]));
+    CPPUNIT_ASSERT_EQUAL(areaVisitor.sectionOffset(v_fault), PetscInt(offsets.faultScalar[iVertex]));
+    CPPUNIT_ASSERT_EQUAL(orientationVisitor.sectionOffset(v_fault), PetscInt(offsets.faultOrientation[iVertex]));
+
+    PetscInt goff = 0;
+    err = PetscSectionGetOffset(solutionGlobalSection, e_lagrange, &goff);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL((goff >= 0) ? goff : PetscInt(-1), PetscInt(offsets.lagrangeGlobal[iVertex]));
+    CPPUNIT_ASSERT_EQUAL(spaceDim, solutionVisitor.sectionDof(e_lagrange));
+  } // for
+
+  // Fields sharing the layout of the solution reuse the table.
+  const PetscInt storageSize = offsets.storageSize;
+  const FaultCohesiveKin::CohesiveOffsets& offsetsResidual = fault._cohesiveOffsets(fields.get("residual"));
+  CPPUNIT_ASSERT(&offsets == &offsetsResidual);
+  CPPUNIT_ASSERT_EQUAL(storageSize, offsetsResidual.storageSize);
+
+  PYLITH_METHOD_END;
+} // testCohesiveOffsets
+
 
 // ----------------------------------------------------------------------
 void
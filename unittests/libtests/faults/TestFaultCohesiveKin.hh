@@ -105,6 +105,9 @@ public :
   /// Test _calcTractionsChange().
   void testCalcTractionsChange(void);
 
+  /// Test _cohesiveOffsets().
+  void testCohesiveOffsets(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -57,6 +57,7 @@ class pylith::faults::TestFaultCohesiveKinTri3 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -82,6 +83,7 @@ class pylith::faults::TestFaultCohesiveKinTri3d : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -107,6 +109,7 @@ class pylith::faults::TestFaultCohesiveKinTri3g : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -133,6 +136,7 @@ class pylith::faults::TestFaultCohesiveKinQuad4 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -158,6 +162,7 @@ class pylith::faults::TestFaultCohesiveKinQuad4e : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -182,6 +187,7 @@ class pylith::faults::TestFaultCohesiveKinQuad4i : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -208,6 +214,7 @@ class pylith::faults::TestFaultCohesiveKinTet4 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -233,6 +240,7 @@ class pylith::faults::TestFaultCohesiveKinTet4e : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -258,6 +266,7 @@ class pylith::faults::TestFaultCohesiveKinTet4f : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -284,6 +293,7 @@ class pylith::faults::TestFaultCohesiveKinHex8 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testCohesiveOffsets );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -0,0 +1,632 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestElasticityExplicitHex8.hh" // Implementation of class methods
+
+#include "pylith/feassemble/ElasticityExplicitHex8.hh" // USES ElasticityExplicitHex8
+#include "pylith/feassemble/ElasticityExplicit.hh" // USES ElasticityExplicit
+#include "pylith/feassemble/GeometryHex3D.hh" // USES GeometryHex3D
+
+#include "pylith/materials/ElasticIsotropic3D.hh" // USES ElasticIsotropic3D
+#include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/utils/array.hh" // USES int_array
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
+#include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
+#include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <math.h> // USES fabs()
+
+#include <stdexcept> // USES std::exception
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::feassemble::TestElasticityExplicitHex8 );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace feassemble {
+    namespace _TestElasticityExplicitHex8 {
+      const int spaceDim = 3;
+      const int cellDim = 3;
+      const int numBasis = 8;
+      const int numQuadPts = 8;
+
+      // Two hexahedral cells (see unittests/libtests/bc/data/hex8.mesh)
+      // with vertices perturbed so the cells are distorted.
+      const int numVertices = 12;
+      const int numCells = 2;
+      const PylithScalar vertices[numVertices*spaceDim] = {
+	-1.0, -1.0, -1.0,
+	-1.1,  1.0, -0.9,
+	 0.1, -1.0, -1.1,
+	 0.0,  1.2, -1.0,
+	 1.0, -0.9, -1.0,
+	 1.1,  1.0, -1.0,
+	-1.0, -1.0,  1.0,
+	-0.9,  1.1,  1.0,
+	 0.0, -1.0,  0.9,
+	-0.1,  1.0,  1.0,
+	 1.0, -1.1,  1.1,
+	 1.0,  1.0,  1.0,
+      };
+      const int cells[numCells*numBasis] = {
+	0,  2,  3,  1,  6,  8,  9,  7,
+	2,  4,  5,  3,  8, 10, 11,  9,
+      };
+
+      const int matId = 0;
+      const char* matLabel = "elastic isotropic 3-D";
+      const char* matDBFilename = "data/elasticisotropic3d.spatialdb";
+
+      const PylithScalar lengthScale = 1.0e+3;
+      const PylithScalar pressureScale = 2.25e+10;
+      const PylithScalar timeScale = 2.0;
+      const PylithScalar densityScale = 3.0e+3;
+
+      // Nondimensional time step.
+      const PylithScalar dt = 1.0e-02 / timeScale;
+
+      // Gravitational acceleration.
+      const PylithScalar gravityAcc = 1.0e+8 * timeScale*timeScale / lengthScale;
+
+      const PylithScalar tolerance = 1.0e-10;
+    } // _TestElasticityExplicitHex8
+  } // feassemble
+} // pylith
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::feassemble::TestElasticityExplicitHex8::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  _quadrature = new Quadrature();CPPUNIT_ASSERT(_quadrature);
+  _quadratureE = new Quadrature();CPPUNIT_ASSERT(_quadratureE);
+  GeometryHex3D geometry;
+  _quadrature->refGeometry(&geometry);
+  _quadratureE->refGeometry(&geometry);
+
+  _material = new materials::ElasticIsotropic3D;
+  CPPUNIT_ASSERT(_material);
+  _materialE = new materials::ElasticIsotropic3D;
+  CPPUNIT_ASSERT(_materialE);
+  _gravityField = 0;
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::feassemble::TestElasticityExplicitHex8::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  delete _quadrature; _quadrature = 0;
+  delete _quadratureE; _quadratureE = 0;
+  delete _material; _material = 0;
+  delete _materialE; _materialE = 0;
+  delete _gravityField; _gravityField = 0;
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::feassemble::TestElasticityExplicitHex8::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityExplicitHex8 integrator;
+  CPPUNIT_ASSERT(!integrator._allowGeometryCache);
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test timeStep().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testTimeStep(void)
+{ // testTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityExplicitHex8 integrator;
+
+  const PylithScalar dt1 = 2.0;
+  integrator.timeStep(dt1);
+  CPPUNIT_ASSERT_EQUAL(dt1, integrator._dt);
+  integrator.timeStep(dt1);
+  CPPUNIT_ASSERT_EQUAL(dt1, integrator._dtm1);
+  CPPUNIT_ASSERT_EQUAL(dt1, integrator._dt);
+
+  PYLITH_METHOD_END;
+} // testTimeStep
+
+// ----------------------------------------------------------------------
+// Test normViscosity().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testNormViscosity(void)
+{ // testNormViscosity
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityExplicitHex8 integrator;
+
+  const PylithScalar viscosity = 0.3;
+  integrator.normViscosity(viscosity);
+  CPPUNIT_ASSERT_EQUAL(viscosity, integrator._normViscosity);
+
+  CPPUNIT_ASSERT_THROW(integrator.normViscosity(-1.0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testNormViscosity
+
+// ----------------------------------------------------------------------
+// Test initialize().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testInitialize(void)
+{ // testInitialize
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _TestElasticityExplicitHex8;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initializeMesh(&mesh, &fields);
+
+  ElasticityExplicitHex8 integrator;
+  _initialize(mesh, &integrator, _material, _quadrature);
+
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numBasis*spaceDim*numQuadPts), integrator._basisDerivCells.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numQuadPts), integrator._wtsCells.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numBasis), integrator._massCells.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), integrator._bodyForceCells.size());
+
+  // Sum of weights over the quadrature points in a cell is the cell
+  // volume, and the sum of the lumped mass is density times volume.
+  for (int iCell=0; iCell < numCells; ++iCell) {
+    PylithScalar volume = 0.0;
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      CPPUNIT_ASSERT(integrator._wtsCells[iCell*numQuadPts+iQuad] > 0.0);
+      volume += integrator._wtsCells[iCell*numQuadPts+iQuad];
+    } // for
+    PylithScalar mass = 0.0;
+    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+      CPPUNIT_ASSERT(integrator._massCells[iCell*numBasis+iBasis] > 0.0);
+      mass += integrator._massCells[iCell*numBasis+iBasis];
+    } // for
+    const PylithScalar density = mass / volume;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, density/2500.0*densityScale, tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testInitialize
+
+// ----------------------------------------------------------------------
+// Test _setupGravityCache() and _gravityCell().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testGravityCache(void)
+{ // testGravityCache
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _TestElasticityExplicitHex8;
+
+  _gravityField = new spatialdata::spatialdb::GravityField();
+  CPPUNIT_ASSERT(_gravityField);
+  _gravityField->gravityAcc(gravityAcc);
+  _gravityField->gravityDir(0.0, 0.0, -1.0);
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initializeMesh(&mesh, &fields);
+
+  ElasticityExplicitHex8 integrator;
+  _initialize(mesh, &integrator, _material, _quadrature);
+
+  // Uniform gravity field, so values are stored for only one cell.
+  CPPUNIT_ASSERT(integrator._gravityUniform);
+  CPPUNIT_ASSERT_EQUAL(size_t(numQuadPts*spaceDim), integrator._gravityCells.size());
+
+  const PylithScalar gravityScale = pressureScale / (lengthScale * densityScale);
+  const PylithScalar gravityE[spaceDim] = { 0.0, 0.0, -gravityAcc / gravityScale };
+  for (int iCell=0; iCell < numCells; ++iCell) {
+    const PylithScalar* gravCell = integrator._gravityCell(iCell);CPPUNIT_ASSERT(gravCell);
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(gravityE[iDim], gravCell[iQuad*spaceDim+iDim], tolerance*fabs(gravityE[2]));
+      } // for
+    } // for
+  } // for
+
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numBasis*spaceDim), integrator._bodyForceCells.size());
+
+  PYLITH_METHOD_END;
+} // testGravityCache
+
+// ----------------------------------------------------------------------
+// Test integrateResidual().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testIntegrateResidual(void)
+{ // testIntegrateResidual
+  PYLITH_METHOD_BEGIN;
+
+  _testIntegrateResidual();
+
+  PYLITH_METHOD_END;
+} // testIntegrateResidual
+
+// ----------------------------------------------------------------------
+// Test integrateResidual() with gravity.
+void
+pylith::feassemble::TestElasticityExplicitHex8::testIntegrateResidualGrav(void)
+{ // testIntegrateResidualGrav
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _TestElasticityExplicitHex8;
+
+  _gravityField = new spatialdata::spatialdb::GravityField();
+  CPPUNIT_ASSERT(_gravityField);
+  _gravityField->gravityAcc(gravityAcc);
+  _gravityField->gravityDir(0.3, -0.2, -0.9);
+
+  _testIntegrateResidual();
+
+  PYLITH_METHOD_END;
+} // testIntegrateResidualGrav
+
+// ----------------------------------------------------------------------
+// Test integrateJacobian().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testIntegrateJacobian(void)
+{ // testIntegrateJacobian
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _TestElasticityExplicitHex8;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initializeMesh(&mesh, &fields);
+
+  ElasticityExplicitHex8 integrator;
+  _initialize(mesh, &integrator, _material, _quadrature);
+  integrator._needNewJacobian = true;
+
+  ElasticityExplicit integratorE;
+  _initialize(mesh, &integratorE, _materialE, _quadratureE);
+
+  topology::Field& residual = fields.get("residual");
+  topology::Field jacobian(mesh);
+  jacobian.label("Jacobian");
+  jacobian.cloneSection(residual);
+  jacobian.zeroAll();
+  topology::Field jacobianE(mesh);
+  jacobianE.label("Jacobian");
+  jacobianE.cloneSection(residual);
+  jacobianE.zeroAll();
+
+  const PylithScalar t = 1.0;
+  integrator.integrateJacobian(&jacobian, t, &fields);
+  CPPUNIT_ASSERT_EQUAL(false, integrator.needNewJacobian());
+  jacobian.complete();
+  integratorE.integrateJacobian(&jacobianE, t, &fields);
+  jacobianE.complete();
+
+  const PetscDM dmMesh = mesh.dmMesh();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::VecVisitorMesh jacobianVisitor(jacobian);
+  const PetscScalar* jacobianArray = jacobianVisitor.localArray();CPPUNIT_ASSERT(jacobianArray);
+  topology::VecVisitorMesh jacobianEVisitor(jacobianE);
+  const PetscScalar* jacobianEArray = jacobianEVisitor.localArray();CPPUNIT_ASSERT(jacobianEArray);
+
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt off = jacobianVisitor.sectionOffset(v);
+    const PetscInt offE = jacobianEVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(spaceDim, jacobianVisitor.sectionDof(v));
+    for (int d=0; d < spaceDim; ++d) {
+      const PylithScalar valueE = jacobianEArray[offE+d];
+      CPPUNIT_ASSERT(valueE > 0.0);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, jacobianArray[off+d]/valueE, tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testIntegrateJacobian
+
+// ----------------------------------------------------------------------
+// Test stableTimeStep().
+void
+pylith::feassemble::TestElasticityExplicitHex8::testStableTimeStep(void)
+{ // testStableTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _TestElasticityExplicitHex8;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initializeMesh(&mesh, &fields);
+
+  ElasticityExplicitHex8 integrator;
+  _initialize(mesh, &integrator, _material, _quadrature);
+
+  ElasticityExplicit integratorE;
+  _initialize(mesh, &integratorE, _materialE, _quadratureE);
+
+  const PylithScalar dtStable = integrator.stableTimeStep(mesh);
+  const PylithScalar dtStableE = integratorE.stableTimeStep(mesh);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dtStable/dtStableE, tolerance);
+
+  PYLITH_METHOD_END;
+} // testStableTimeStep
+
+// ----------------------------------------------------------------------
+// Create mesh and solution fields.
+void
+pylith::feassemble::TestElasticityExplicitHex8::_initializeMesh(topology::Mesh* mesh,
+								topology::SolutionFields* const fields)
+{ // _initializeMesh
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _TestElasticityExplicitHex8;
+
+  CPPUNIT_ASSERT(mesh);
+  CPPUNIT_ASSERT(fields);
+
+  // Cells and vertices
+  int_array cellsPlex(cells, numCells*numBasis);
+  PetscErrorCode err;
+  for (int iCell=0; iCell < numCells; ++iCell) {
+    err = DMPlexInvertCell(cellDim, numBasis, &cellsPlex[iCell*numBasis]);PYLITH_CHECK_ERROR(err);
+  } // for
+  PetscDM dmMesh;
+  const PetscBool interpolate = PETSC_TRUE;
+  err = DMPlexCreateFromCellList(PETSC_COMM_WORLD, cellDim, numCells, numVertices, numBasis, interpolate, &cellsPlex[0], spaceDim, vertices, &dmMesh);PYLITH_CHECK_ERROR(err);
+  mesh->dmMesh(dmMesh, "domain");
+
+  // Material ids
+  PetscInt cStart, cEnd;
+  err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+  for(PetscInt c = cStart; c < cEnd; ++c) {
+    err = DMSetLabelValue(dmMesh, "material-id", c, matId);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  // Setup coordinate system.
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+  mesh->coordsys(&cs);
+
+  // Setup scales.
+  spatialdata::units::Nondimensional normalizer;
+  normalizer.lengthScale(lengthScale);
+  normalizer.pressureScale(pressureScale);
+  normalizer.densityScale(densityScale);
+  normalizer.timeScale(timeScale);
+  topology::MeshOps::nondimensionalize(mesh, normalizer);
+
+  // Setup fields
+  fields->add("residual", "residual");
+  fields->add("dispIncr(t->t+dt)", "displacement_increment");
+  fields->add("disp(t)", "displacement");
+  fields->add("disp(t-dt)", "displacement");
+  fields->add("velocity(t)", "velocity");
+  fields->add("acceleration(t)", "acceleration");
+  fields->solutionName("dispIncr(t->t+dt)");
+
+  topology::Field& residual = fields->get("residual");
+  residual.subfieldAdd("displacement", spaceDim, topology::Field::VECTOR, lengthScale);
+  residual.subfieldAdd("lagrange_multiplier", spaceDim, topology::Field::VECTOR);
+
+  residual.subfieldsSetup();
+  residual.setupSolnChart();
+  residual.setupSolnDof(spaceDim);
+  residual.allocate();
+  residual.zeroAll();
+  fields->copyLayout("residual");
+
+  // Arbitrary, nonuniform values for the solution fields.
+  topology::VecVisitorMesh dispTVisitor(fields->get("disp(t)"));
+  PetscScalar* dispTArray = dispTVisitor.localArray();CPPUNIT_ASSERT(dispTArray);
+
+  topology::VecVisitorMesh velVisitor(fields->get("velocity(t)"));
+  PetscScalar* velArray = velVisitor.localArray();CPPUNIT_ASSERT(velArray);
+
+  topology::VecVisitorMesh accVisitor(fields->get("acceleration(t)"));
+  PetscScalar* accArray = accVisitor.localArray();CPPUNIT_ASSERT(accArray);
+
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  CPPUNIT_ASSERT_EQUAL(numVertices, verticesStratum.size());
+
+  for(PetscInt v = vStart, iVertex = 0; v < vEnd; ++v, ++iVertex) {
+    const PetscInt dtoff = dispTVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(spaceDim, dispTVisitor.sectionDof(v));
+
+    const PetscInt voff = velVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(spaceDim, velVisitor.sectionDof(v));
+
+    const PetscInt aoff = accVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(spaceDim, accVisitor.sectionDof(v));
+
+    for(int iDim=0; iDim < spaceDim; ++iDim) {
+      const int i = iVertex*spaceDim + iDim;
+      dispTArray[dtoff+iDim] = 1.0e-3 * (0.2 + 0.13*i - 0.007*i*i);
+      velArray[voff+iDim] = 1.0e-2 * (-0.4 + 0.05*i + 0.002*i*i);
+      accArray[aoff+iDim] = 1.0e-1 * (0.3 - 0.08*i + 0.004*i*i);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _initializeMesh
+
+// ----------------------------------------------------------------------
+// Initialize elasticity integrator.
+void
+pylith::feassemble::TestElasticityExplicitHex8::_initialize(const topology::Mesh& mesh,
+							    IntegratorElasticity* const integrator,
+							    materials::ElasticMaterial* const material,
+							    Quadrature* const quadrature)
+{ // _initialize
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _TestElasticityExplicitHex8;
+
+  CPPUNIT_ASSERT(integrator);
+  CPPUNIT_ASSERT(material);
+  CPPUNIT_ASSERT(quadrature);
+
+  // Trilinear basis functions on [-1,1]^3 with 2x2x2 Gauss quadrature.
+  const PylithScalar verticesRef[numBasis*cellDim] = {
+    -1.0, -1.0, -1.0,
+    +1.0, -1.0, -1.0,
+    +1.0, +1.0, -1.0,
+    -1.0, +1.0, -1.0,
+    -1.0, -1.0, +1.0,
+    +1.0, -1.0, +1.0,
+    +1.0, +1.0, +1.0,
+    -1.0, +1.0, +1.0,
+  };
+  const PylithScalar g = 1.0 / sqrt(3.0);
+  PylithScalar quadPtsRef[numQuadPts*cellDim];
+  PylithScalar quadWts[numQuadPts];
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    for (int iDim=0; iDim < cellDim; ++iDim)
+      quadPtsRef[iQuad*cellDim+iDim] = g*verticesRef[iQuad*cellDim+iDim];
+    quadWts[iQuad] = 1.0;
+  } // for
+
+  PylithScalar basis[numQuadPts*numBasis];
+  PylithScalar basisDerivRef[numQuadPts*numBasis*cellDim];
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    const PylithScalar p = quadPtsRef[iQuad*cellDim  ];
+    const PylithScalar q = quadPtsRef[iQuad*cellDim+1];
+    const PylithScalar r = quadPtsRef[iQuad*cellDim+2];
+    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+      const PylithScalar pi = verticesRef[iBasis*cellDim  ];
+      const PylithScalar qi = verticesRef[iBasis*cellDim+1];
+      const PylithScalar ri = verticesRef[iBasis*cellDim+2];
+      basis[iQuad*numBasis+iBasis] = 0.125*(1.0+pi*p)*(1.0+qi*q)*(1.0+ri*r);
+      basisDerivRef[(iQuad*numBasis+iBasis)*cellDim  ] = 0.125*pi*(1.0+qi*q)*(1.0+ri*r);
+      basisDerivRef[(iQuad*numBasis+iBasis)*cellDim+1] = 0.125*(1.0+pi*p)*qi*(1.0+ri*r);
+      basisDerivRef[(iQuad*numBasis+iBasis)*cellDim+2] = 0.125*(1.0+pi*p)*(1.0+qi*q)*ri;
+    } // for
+  } // for
+
+  quadrature->initialize(basis, numQuadPts, numBasis,
+			 basisDerivRef, numQuadPts, numBasis, cellDim,
+			 quadPtsRef, numQuadPts, cellDim,
+			 quadWts, numQuadPts,
+			 spaceDim);
+
+  // Setup material
+  spatialdata::units::Nondimensional normalizer;
+  normalizer.lengthScale(lengthScale);
+  normalizer.pressureScale(pressureScale);
+  normalizer.densityScale(densityScale);
+  normalizer.timeScale(timeScale);
+
+  spatialdata::spatialdb::SimpleIOAscii iohandler;
+  iohandler.filename(matDBFilename);
+  spatialdata::spatialdb::SimpleDB dbProperties;
+  dbProperties.ioHandler(&iohandler);
+
+  material->id(matId);
+  material->label(matLabel);
+  material->dbProperties(&dbProperties);
+  material->normalizer(normalizer);
+
+  integrator->quadrature(quadrature);
+  integrator->gravityField(_gravityField);
+  integrator->timeStep(dt);
+  integrator->material(material);
+  integrator->initialize(mesh);
+
+  PYLITH_METHOD_END;
+} // _initialize
+
+// ----------------------------------------------------------------------
+// Check integrateResidual() against ElasticityExplicit.
+void
+pylith::feassemble::TestElasticityExplicitHex8::_testIntegrateResidual(void)
+{ // _testIntegrateResidual
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _TestElasticityExplicitHex8;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initializeMesh(&mesh, &fields);
+
+  ElasticityExplicitHex8 integrator;
+  _initialize(mesh, &integrator, _material, _quadrature);
+
+  ElasticityExplicit integratorE;
+  _initialize(mesh, &integratorE, _materialE, _quadratureE);
+
+  topology::Field& residual = fields.get("residual");
+  topology::Field residualE(mesh);
+  residualE.label("residual");
+  residualE.cloneSection(residual);
+  residualE.zeroAll();
+
+  const PylithScalar t = 1.0;
+  integrator.integrateResidual(residual, t, &fields);
+  integratorE.integrateResidual(residualE, t, &fields);
+
+  const PetscDM dmMesh = mesh.dmMesh();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::VecVisitorMesh residualVisitor(residual);
+  const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
+  topology::VecVisitorMesh residualEVisitor(residualE);
+  const PetscScalar* residualEArray = residualEVisitor.localArray();CPPUNIT_ASSERT(residualEArray);
+
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt off = residualVisitor.sectionOffset(v);
+    const PetscInt offE = residualEVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(spaceDim, residualVisitor.sectionDof(v));
+    for (int d=0; d < spaceDim; ++d) {
+      const PylithScalar valueE = residualEArray[offE+d];
+      if (fabs(valueE) > 1.0)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, residualArray[off+d]/valueE, tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, residualArray[off+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _testIntegrateResidual
+
+
+// End of file
@@ -0,0 +1,143 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/feassemble/TestElasticityExplicitHex8.hh
+ *
+ * @brief C++ TestElasticityExplicitHex8 object
+ *
+ * C++ unit testing for ElasticityExplicitHex8. The residual and
+ * Jacobian are checked against those from the generic
+ * ElasticityExplicit integrator for a mesh with two distorted
+ * hexahedral cells.
+ */
+
+#if !defined(pylith_feassemble_testelasticityexplicithex8_hh)
+#define pylith_feassemble_testelasticityexplicithex8_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/feassemble/feassemblefwd.hh" // forward declarations
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields
+#include "pylith/materials/materialsfwd.hh" // USES ElasticMaterial
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // USES GravityField
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace feassemble {
+    class TestElasticityExplicitHex8;
+  } // feassemble
+} // pylith
+
+/// C++ unit testing for ElasticityExplicitHex8
+class pylith::feassemble::TestElasticityExplicitHex8 : public CppUnit::TestFixture
+{ // class TestElasticityExplicitHex8
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestElasticityExplicitHex8 );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testTimeStep );
+  CPPUNIT_TEST( testNormViscosity );
+  CPPUNIT_TEST( testInitialize );
+  CPPUNIT_TEST( testGravityCache );
+  CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualGrav );
+  CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testStableTimeStep );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test timeStep().
+  void testTimeStep(void);
+
+  /// Test normViscosity().
+  void testNormViscosity(void);
+
+  /// Test initialize().
+  void testInitialize(void);
+
+  /// Test _setupGravityCache() and _gravityCell().
+  void testGravityCache(void);
+
+  /// Test integrateResidual().
+  void testIntegrateResidual(void);
+
+  /// Test integrateResidual() with gravity.
+  void testIntegrateResidualGrav(void);
+
+  /// Test integrateJacobian().
+  void testIntegrateJacobian(void);
+
+  /// Test stableTimeStep().
+  void testStableTimeStep(void);
+
+  // PROTECTED MEMBERS //////////////////////////////////////////////////
+protected :
+
+  materials::ElasticMaterial* _material; ///< Elastic material for ElasticityExplicitHex8.
+  materials::ElasticMaterial* _materialE; ///< Elastic material for ElasticityExplicit.
+  Quadrature* _quadrature; ///< Quadrature for ElasticityExplicitHex8.
+  Quadrature* _quadratureE; ///< Quadrature for ElasticityExplicit.
+  spatialdata::spatialdb::GravityField* _gravityField; ///< Gravity field.
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Create mesh and solution fields.
+   *
+   * @param mesh Finite-element mesh to initialize.
+   * @param fields Solution fields.
+   */
+  void _initializeMesh(topology::Mesh* mesh,
+		       topology::SolutionFields* const fields);
+
+  /** Initialize elasticity integrator.
+   *
+   * @param mesh Finite-element mesh.
+   * @param integrator Elasticity integrator to initialize.
+   * @param material Elastic material for integrator.
+   * @param quadrature Quadrature for integrator.
+   */
+  void _initialize(const topology::Mesh& mesh,
+		   IntegratorElasticity* const integrator,
+		   materials::ElasticMaterial* const material,
+		   Quadrature* const quadrature);
+
+  /// Check integrateResidual() against ElasticityExplicit.
+  void _testIntegrateResidual(void);
+
+}; // class TestElasticityExplicitHex8
+
+#endif // pylith_feassemble_testelasticityexplicithex8_hh
+
+
+// End of file
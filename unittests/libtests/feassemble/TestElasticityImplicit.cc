@@ -40,6 +40,8 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <math.h> // USES fabs()
+#include <stdexcept> // USES std::runtime_error
+#include <algorithm> // USES std::max()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::feassemble::TestElasticityImplicit );
@@ -148,6 +150,62 @@ pylith::feassemble::TestElasticityImplicit::testNeedNewJacobian(void)
   PYLITH_METHOD_END;
 } // testNeedNewJacobian
 
+// ----------------------------------------------------------------------
+// Test numThreads().
+void
+pylith::feassemble::TestElasticityImplicit::testNumThreads(void)
+{ // testNumThreads
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityImplicit integrator;
+  CPPUNIT_ASSERT_EQUAL(1, integrator.numThreads());
+
+  const int numThreads = 4;
+  integrator.numThreads(numThreads);
+#if defined(_OPENMP)
+  CPPUNIT_ASSERT_EQUAL(numThreads, integrator.numThreads());
+#else
+  // Without OpenMP a single thread is used.
+  CPPUNIT_ASSERT_EQUAL(1, integrator.numThreads());
+#endif
+
+  CPPUNIT_ASSERT_THROW(integrator.numThreads(0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testNumThreads
+
+// ----------------------------------------------------------------------
+// Test deterministicAssembly().
+void
+pylith::feassemble::TestElasticityImplicit::testDeterministicAssembly(void)
+{ // testDeterministicAssembly
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityImplicit integrator;
+  CPPUNIT_ASSERT_EQUAL(true, integrator.deterministicAssembly());
+
+  integrator.deterministicAssembly(false);
+  CPPUNIT_ASSERT_EQUAL(false, integrator.deterministicAssembly());
+
+  PYLITH_METHOD_END;
+} // testDeterministicAssembly
+
+// ----------------------------------------------------------------------
+// Test reuseCellMatrices().
+void
+pylith::feassemble::TestElasticityImplicit::testReuseCellMatrices(void)
+{ // testReuseCellMatrices
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityImplicit integrator;
+  CPPUNIT_ASSERT_EQUAL(false, integrator.reuseCellMatrices());
+
+  integrator.reuseCellMatrices(true);
+  CPPUNIT_ASSERT_EQUAL(true, integrator.reuseCellMatrices());
+
+  PYLITH_METHOD_END;
+} // testReuseCellMatrices
+
 // ----------------------------------------------------------------------
 // Test initialize().
 void 
@@ -172,54 +230,38 @@ pylith::feassemble::TestElasticityImplicit::testIntegrateResidual(void)
 { // testIntegrateResidual
   PYLITH_METHOD_BEGIN;
 
-  CPPUNIT_ASSERT(_data);
-
-  topology::Mesh mesh;
-  ElasticityImplicit integrator;
-  topology::SolutionFields fields(mesh);
-  _initialize(&mesh, &integrator, &fields);
-
-  topology::Field& residual = fields.get("residual");
-  const PylithScalar t = 1.0;
-  integrator.integrateResidual(residual, t, &fields);
-
-  const PylithScalar* valsE = _data->valsResidual;
+  _testIntegrateResidual(1, true);
 
-#if 0 // DEBUGGING
-  residual.view("RESIDUAL");
-  std::cout << "EXPECTED RESIDUAL" << std::endl;
-  const int size = _data->numVertices * _data->spaceDim;
-  for (int i=0; i < size; ++i)
-    std::cout << "  " << valsE[i] << std::endl;
-#endif
+  PYLITH_METHOD_END;
+} // testIntegrateResidual
 
-  const PetscDM dmMesh = mesh.dmMesh();
-  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-  const PetscInt vStart = verticesStratum.begin();
-  const PetscInt vEnd = verticesStratum.end();
-  CPPUNIT_ASSERT_EQUAL(_data->numVertices, verticesStratum.size());
+// ----------------------------------------------------------------------
+// Test integrateResidual() with multiple threads.
+void
+pylith::feassemble::TestElasticityImplicit::testIntegrateResidualThreaded(void)
+{ // testIntegrateResidualThreaded
+  PYLITH_METHOD_BEGIN;
 
-  topology::VecVisitorMesh residualVisitor(residual);
-  const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
+  _testIntegrateResidual(2, true);
+  _testIntegrateResidual(2, false);
 
-  const PylithScalar accScale = _data->lengthScale / pow(_data->timeScale, 2);
-  const PylithScalar residualScale = _data->densityScale * accScale*pow(_data->lengthScale, _data->spaceDim);
+  PYLITH_METHOD_END;
+} // testIntegrateResidualThreaded
 
-  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
-  for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
-    const PetscInt off = residualVisitor.sectionOffset(v);
-    CPPUNIT_ASSERT_EQUAL(_data->spaceDim, residualVisitor.sectionDof(v));
+// ----------------------------------------------------------------------
+// Test integrateResidual() with geometry cache.
+void
+pylith::feassemble::TestElasticityImplicit::testIntegrateResidualCached(void)
+{ // testIntegrateResidualCached
+  PYLITH_METHOD_BEGIN;
 
-    for (int d=0; d < _data->spaceDim; ++d, ++index) {
-      if (fabs(valsE[index]) > 1.0)
-	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, residualArray[off+d]/valsE[index]*residualScale, tolerance);
-      else
-	CPPUNIT_ASSERT_DOUBLES_EQUAL(valsE[index], residualArray[off+d]*residualScale, tolerance);
-    } // for
-  } // for
+  const bool deterministic = true;
+  const bool cacheGeometry = true;
+  _testIntegrateResidual(1, deterministic, cacheGeometry);
+  _testIntegrateResidual(2, deterministic, cacheGeometry);
 
   PYLITH_METHOD_END;
-} // testIntegrateResidual
+} // testIntegrateResidualCached
 
 // ----------------------------------------------------------------------
 // Test integrateJacobian().
@@ -228,6 +270,44 @@ pylith::feassemble::TestElasticityImplicit::testIntegrateJacobian(void)
 { // testIntegrateJacobian
   PYLITH_METHOD_BEGIN;
 
+  _testIntegrateJacobian(1);
+
+  PYLITH_METHOD_END;
+} // testIntegrateJacobian
+
+// ----------------------------------------------------------------------
+// Test integrateJacobian() with multiple threads.
+void
+pylith::feassemble::TestElasticityImplicit::testIntegrateJacobianThreaded(void)
+{ // testIntegrateJacobianThreaded
+  PYLITH_METHOD_BEGIN;
+
+  _testIntegrateJacobian(2);
+
+  PYLITH_METHOD_END;
+} // testIntegrateJacobianThreaded
+
+// ----------------------------------------------------------------------
+// Test integrateJacobian() reusing stored cell matrices.
+void
+pylith::feassemble::TestElasticityImplicit::testIntegrateJacobianReuse(void)
+{ // testIntegrateJacobianReuse
+  PYLITH_METHOD_BEGIN;
+
+  _testIntegrateJacobian(1, 2, true);
+  _testIntegrateJacobian(2, 2, true);
+
+  PYLITH_METHOD_END;
+} // testIntegrateJacobianReuse
+
+// ----------------------------------------------------------------------
+// Test prepareJacobianAction(), integrateJacobianAction(), and
+// integrateJacobianDiagonal().
+void
+pylith::feassemble::TestElasticityImplicit::testIntegrateJacobianAction(void)
+{ // testIntegrateJacobianAction
+  PYLITH_METHOD_BEGIN;
+
   CPPUNIT_ASSERT(_data);
 
   topology::Mesh mesh;
@@ -236,52 +316,88 @@ pylith::feassemble::TestElasticityImplicit::testIntegrateJacobian(void)
   _initialize(&mesh, &integrator, &fields);
   integrator._needNewJacobian = true;
 
-  topology::Jacobian jacobian(fields.solution());
+  CPPUNIT_ASSERT_EQUAL(true, integrator.hasJacobianAction());
 
   const PylithScalar t = 1.0;
-  integrator.integrateJacobian(&jacobian, t, &fields);
+  integrator.prepareJacobianAction(t, &fields);
   CPPUNIT_ASSERT_EQUAL(false, integrator.needNewJacobian());
-  jacobian.assemble("final_assembly");
 
-  const PylithScalar* valsE = _data->valsJacobian;
-  const int nrowsE = _data->numVertices * _data->spaceDim;
-  const int ncolsE = _data->numVertices * _data->spaceDim;
+  const char* fieldNames[3] = { "input", "action", "diagonal" };
+  for (int i=0; i < 3; ++i) {
+    fields.add(fieldNames[i], fieldNames[i]);
+    topology::Field& field = fields.get(fieldNames[i]);
+    field.cloneSection(fields.solution());
+    field.zeroAll();
+  } // for
+  topology::Field& input = fields.get("input");
+  topology::Field& action = fields.get("action");
+  topology::Field& diagonal = fields.get("diagonal");
 
-  const PetscMat jacobianMat = jacobian.matrix();
+  const int spaceDim = _data->spaceDim;
+  const int size = _data->numVertices * spaceDim;
+  scalar_array inputVals(size);
+  for (int i=0; i < size; ++i) {
+    inputVals[i] = 0.1 * (1 + (3*i) % 7) * ((i % 2) ? -1.0 : 1.0);
+  } // for
 
-  int nrows = 0;
-  int ncols = 0;
-  MatGetSize(jacobianMat, &nrows, &ncols);
-  CPPUNIT_ASSERT_EQUAL(nrowsE, nrows);
-  CPPUNIT_ASSERT_EQUAL(ncolsE, ncols);
+  const PetscDM dmMesh = mesh.dmMesh();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  CPPUNIT_ASSERT_EQUAL(_data->numVertices, verticesStratum.size());
 
-  PetscMat jDense;
-  MatConvert(jacobianMat, MATSEQDENSE, MAT_INITIAL_MATRIX, &jDense);
+  { // setup input
+    topology::VecVisitorMesh inputVisitor(input);
+    PetscScalar* inputArray = inputVisitor.localArray();CPPUNIT_ASSERT(inputArray);
+    for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+      const PetscInt off = inputVisitor.sectionOffset(v);
+      for (int d=0; d < spaceDim; ++d, ++index) {
+	inputArray[off+d] = inputVals[index];
+      } // for
+    } // for
+  } // setup input
 
-  scalar_array vals(nrows*ncols);
-  int_array rows(nrows);
-  int_array cols(ncols);
-  for (int iRow=0; iRow < nrows; ++iRow)
-    rows[iRow] = iRow;
-  for (int iCol=0; iCol < ncols; ++iCol)
-    cols[iCol] = iCol;
-  MatGetValues(jDense, nrows, &rows[0], ncols, &cols[0], &vals[0]);
+  integrator.integrateJacobianAction(action, input, t, &fields);
+  integrator.integrateJacobianDiagonal(diagonal, t, &fields);
+
+  // Expected values from assembled Jacobian.
+  const PylithScalar* valsE = _data->valsJacobian;
+  scalar_array actionE(size);
+  PylithScalar valsEMax = 0.0;
+  for (int iRow=0; iRow < size; ++iRow) {
+    actionE[iRow] = 0.0;
+    for (int iCol=0; iCol < size; ++iCol) {
+      actionE[iRow] += valsE[iRow*size+iCol] * inputVals[iCol];
+      valsEMax = std::max(valsEMax, PylithScalar(fabs(valsE[iRow*size+iCol])));
+    } // for
+  } // for
+
+  topology::VecVisitorMesh actionVisitor(action);
+  const PetscScalar* actionArray = actionVisitor.localArray();CPPUNIT_ASSERT(actionArray);
+  topology::VecVisitorMesh diagonalVisitor(diagonal);
+  const PetscScalar* diagonalArray = diagonalVisitor.localArray();CPPUNIT_ASSERT(diagonalArray);
 
   const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-04;
   const PylithScalar jacobianScale = _data->densityScale / pow(_data->timeScale, 2) * pow(_data->lengthScale, _data->spaceDim);
 
-  for (int iRow=0; iRow < nrows; ++iRow)
-    for (int iCol=0; iCol < ncols; ++iCol) {
-      const int index = ncols*iRow+iCol;
-      if (fabs(valsE[index]) > 1.0)
-	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, vals[index]/valsE[index]*jacobianScale, tolerance);
+  for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt aoff = actionVisitor.sectionOffset(v);
+    const PetscInt doff = diagonalVisitor.sectionOffset(v);
+    for (int d=0; d < spaceDim; ++d, ++index) {
+      // Action may involve cancellation, so compare relative to largest entry of Jacobian.
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(actionE[index], actionArray[aoff+d]*jacobianScale, tolerance*valsEMax);
+
+      const PylithScalar diagonalE = valsE[index*size+index];
+      if (fabs(diagonalE) > 1.0)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, diagonalArray[doff+d]/diagonalE*jacobianScale, tolerance);
       else
-	CPPUNIT_ASSERT_DOUBLES_EQUAL(valsE[index], vals[index]*jacobianScale, tolerance);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(diagonalE, diagonalArray[doff+d]*jacobianScale, tolerance);
     } // for
-  MatDestroy(&jDense);
+  } // for
 
   PYLITH_METHOD_END;
-} // testIntegrateJacobian
+} // testIntegrateJacobianAction
+
 
 // ----------------------------------------------------------------------
 // Test updateStateVars().
@@ -441,5 +557,143 @@ pylith::feassemble::TestElasticityImplicit::_initialize(topology::Mesh* mesh,
   PYLITH_METHOD_END;
 } // _initialize
 
+// ----------------------------------------------------------------------
+// Integrate residual and check values.
+void
+pylith::feassemble::TestElasticityImplicit::_testIntegrateResidual(const int numThreads,
+								   const bool deterministic,
+								   const bool cacheGeometry)
+{ // _testIntegrateResidual
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+  CPPUNIT_ASSERT(_quadrature);
+
+  topology::Mesh mesh;
+  ElasticityImplicit integrator;
+  integrator.numThreads(numThreads);
+  integrator.deterministicAssembly(deterministic);
+  topology::SolutionFields fields(mesh);
+  _quadrature->cacheGeometry(cacheGeometry);
+  _initialize(&mesh, &integrator, &fields);
+
+  // Cache is built on the integrator's copy of the quadrature, not
+  // on the original.
+  CPPUNIT_ASSERT(integrator._quadrature);
+  CPPUNIT_ASSERT_EQUAL(cacheGeometry, integrator._quadrature->hasGeometryCache());
+  CPPUNIT_ASSERT_EQUAL(false, _quadrature->hasGeometryCache());
+
+  topology::Field& residual = fields.get("residual");
+  const PylithScalar t = 1.0;
+  integrator.integrateResidual(residual, t, &fields);
+
+  const PylithScalar* valsE = _data->valsResidual;
+
+#if 0 // DEBUGGING
+  residual.view("RESIDUAL");
+  std::cout << "EXPECTED RESIDUAL" << std::endl;
+  const int size = _data->numVertices * _data->spaceDim;
+  for (int i=0; i < size; ++i)
+    std::cout << "  " << valsE[i] << std::endl;
+#endif
+
+  const PetscDM dmMesh = mesh.dmMesh();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  CPPUNIT_ASSERT_EQUAL(_data->numVertices, verticesStratum.size());
+
+  topology::VecVisitorMesh residualVisitor(residual);
+  const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
+
+  const PylithScalar accScale = _data->lengthScale / pow(_data->timeScale, 2);
+  const PylithScalar residualScale = _data->densityScale * accScale*pow(_data->lengthScale, _data->spaceDim);
+
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = residualVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(_data->spaceDim, residualVisitor.sectionDof(v));
+
+    for (int d=0; d < _data->spaceDim; ++d, ++index) {
+      if (fabs(valsE[index]) > 1.0)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, residualArray[off+d]/valsE[index]*residualScale, tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valsE[index], residualArray[off+d]*residualScale, tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _testIntegrateResidual
+
+// ----------------------------------------------------------------------
+// Integrate Jacobian and check values.
+void
+pylith::feassemble::TestElasticityImplicit::_testIntegrateJacobian(const int numThreads,
+								   const int numPasses,
+								   const bool reuse)
+{ // _testIntegrateJacobian
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  ElasticityImplicit integrator;
+  integrator.numThreads(numThreads);
+  integrator.reuseCellMatrices(reuse);
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &fields);
+
+  topology::Jacobian jacobian(fields.solution());
+
+  const PylithScalar t = 1.0;
+  for (int iPass=0; iPass < numPasses; ++iPass) {
+    integrator._needNewJacobian = true;
+    jacobian.zero();
+    integrator.integrateJacobian(&jacobian, t, &fields);
+    CPPUNIT_ASSERT_EQUAL(false, integrator.needNewJacobian());
+    CPPUNIT_ASSERT_EQUAL(reuse, integrator._cellMatricesValid);
+    jacobian.assemble("final_assembly");
+  } // for
+
+  const PylithScalar* valsE = _data->valsJacobian;
+  const int nrowsE = _data->numVertices * _data->spaceDim;
+  const int ncolsE = _data->numVertices * _data->spaceDim;
+
+  const PetscMat jacobianMat = jacobian.matrix();
+
+  int nrows = 0;
+  int ncols = 0;
+  MatGetSize(jacobianMat, &nrows, &ncols);
+  CPPUNIT_ASSERT_EQUAL(nrowsE, nrows);
+  CPPUNIT_ASSERT_EQUAL(ncolsE, ncols);
+
+  PetscMat jDense;
+  MatConvert(jacobianMat, MATSEQDENSE, MAT_INITIAL_MATRIX, &jDense);
+
+  scalar_array vals(nrows*ncols);
+  int_array rows(nrows);
+  int_array cols(ncols);
+  for (int iRow=0; iRow < nrows; ++iRow)
+    rows[iRow] = iRow;
+  for (int iCol=0; iCol < ncols; ++iCol)
+    cols[iCol] = iCol;
+  MatGetValues(jDense, nrows, &rows[0], ncols, &cols[0], &vals[0]);
+
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-04;
+  const PylithScalar jacobianScale = _data->densityScale / pow(_data->timeScale, 2) * pow(_data->lengthScale, _data->spaceDim);
+
+  for (int iRow=0; iRow < nrows; ++iRow)
+    for (int iCol=0; iCol < ncols; ++iCol) {
+      const int index = ncols*iRow+iCol;
+      if (fabs(valsE[index]) > 1.0)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, vals[index]/valsE[index]*jacobianScale, tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valsE[index], vals[index]*jacobianScale, tolerance);
+    } // for
+  MatDestroy(&jDense);
+
+  PYLITH_METHOD_END;
+} // _testIntegrateJacobian
+
 
 // End of file 
@@ -54,6 +54,9 @@ class pylith::feassemble::TestElasticityImplicit : public CppUnit::TestFixture
   CPPUNIT_TEST( testTimeStep );
   CPPUNIT_TEST( testMaterial );
   CPPUNIT_TEST( testNeedNewJacobian );
+  CPPUNIT_TEST( testNumThreads );
+  CPPUNIT_TEST( testDeterministicAssembly );
+  CPPUNIT_TEST( testReuseCellMatrices );
 
   // Testing of initialize(), integrateResidual(),
   // integrateJacobian(), and updateStateVars() handled by derived
@@ -85,15 +88,40 @@ public :
   /// Test needNewJacobian().
   void testNeedNewJacobian(void);
 
+  /// Test numThreads().
+  void testNumThreads(void);
+
+  /// Test deterministicAssembly().
+  void testDeterministicAssembly(void);
+
+  /// Test reuseCellMatrices().
+  void testReuseCellMatrices(void);
+
   /// Test initialize().
   void testInitialize(void);
 
   /// Test integrateResidual().
   void testIntegrateResidual(void);
 
+  /// Test integrateResidual() with multiple threads.
+  void testIntegrateResidualThreaded(void);
+
+  /// Test integrateResidual() with geometry cache.
+  void testIntegrateResidualCached(void);
+
   /// Test integrateJacobian().
   void testIntegrateJacobian(void);
 
+  /// Test integrateJacobian() with multiple threads.
+  void testIntegrateJacobianThreaded(void);
+
+  /// Test integrateJacobian() reusing stored cell matrices.
+  void testIntegrateJacobianReuse(void);
+
+  /// Test prepareJacobianAction(), integrateJacobianAction(), and
+  /// integrateJacobianDiagonal().
+  void testIntegrateJacobianAction(void);
+
   /// Test updateStateVars().
   void testUpdateStateVars(void);
 
@@ -118,6 +146,26 @@ private :
 		   ElasticityImplicit* const integrator,
 		   topology::SolutionFields* const fields);
 
+  /** Integrate residual and check values.
+   *
+   * @param numThreads Number of threads in loops over cells.
+   * @param deterministic Use deterministic threaded assembly.
+   * @param cacheGeometry Cache geometry of cells in quadrature.
+   */
+  void _testIntegrateResidual(const int numThreads,
+			      const bool deterministic,
+			      const bool cacheGeometry =false);
+
+  /** Integrate Jacobian and check values.
+   *
+   * @param numThreads Number of threads in loops over cells.
+   * @param numPasses Number of times to reform Jacobian.
+   * @param reuse Reuse cell matrices between reformations.
+   */
+  void _testIntegrateJacobian(const int numThreads,
+			      const int numPasses =1,
+			      const bool reuse =false);
+
 }; // class TestElasticityImplicit
 
 #endif // pylith_feassemble_testelasticityimplicit_hh
@@ -55,7 +55,12 @@ class pylith::feassemble::TestElasticityImplicit2DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualThreaded );
+  CPPUNIT_TEST( testIntegrateResidualCached );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianThreaded );
+  CPPUNIT_TEST( testIntegrateJacobianReuse );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
 
@@ -81,7 +86,12 @@ class pylith::feassemble::TestElasticityImplicit2DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualThreaded );
+  CPPUNIT_TEST( testIntegrateResidualCached );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianThreaded );
+  CPPUNIT_TEST( testIntegrateJacobianReuse );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
 
@@ -107,7 +117,12 @@ class pylith::feassemble::TestElasticityImplicit3DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualThreaded );
+  CPPUNIT_TEST( testIntegrateResidualCached );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianThreaded );
+  CPPUNIT_TEST( testIntegrateJacobianReuse );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
 
@@ -133,7 +148,12 @@ class pylith::feassemble::TestElasticityImplicit3DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualThreaded );
+  CPPUNIT_TEST( testIntegrateResidualCached );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianThreaded );
+  CPPUNIT_TEST( testIntegrateJacobianReuse );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
 
@@ -159,7 +179,12 @@ class pylith::feassemble::TestElasticityImplicitGrav2DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualThreaded );
+  CPPUNIT_TEST( testIntegrateResidualCached );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianThreaded );
+  CPPUNIT_TEST( testIntegrateJacobianReuse );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
 
@@ -185,7 +210,12 @@ class pylith::feassemble::TestElasticityImplicitGrav2DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualThreaded );
+  CPPUNIT_TEST( testIntegrateResidualCached );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianThreaded );
+  CPPUNIT_TEST( testIntegrateJacobianReuse );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
 
@@ -211,7 +241,12 @@ class pylith::feassemble::TestElasticityImplicitGrav3DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualThreaded );
+  CPPUNIT_TEST( testIntegrateResidualCached );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianThreaded );
+  CPPUNIT_TEST( testIntegrateJacobianReuse );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
 
@@ -237,7 +272,12 @@ class pylith::feassemble::TestElasticityImplicitGrav3DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualThreaded );
+  CPPUNIT_TEST( testIntegrateResidualCached );
   CPPUNIT_TEST( testIntegrateJacobian );
+  CPPUNIT_TEST( testIntegrateJacobianThreaded );
+  CPPUNIT_TEST( testIntegrateJacobianReuse );
+  CPPUNIT_TEST( testIntegrateJacobianAction );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
 
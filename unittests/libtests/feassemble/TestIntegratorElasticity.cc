@@ -21,10 +21,15 @@
 #include "TestIntegratorElasticity.hh" // Implementation of class methods
 
 #include "pylith/feassemble/IntegratorElasticity.hh" // USES IntegratorElasticity
+#include "pylith/feassemble/ElasticityImplicit.hh" // USES ElasticityImplicit
+#include "pylith/feassemble/ElasticityKernels.hh" // USES ElasticityKernels
+#include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+#include "pylith/feassemble/GeometryQuad2D.hh" // USES GeometryQuad2D
+#include "pylith/feassemble/GeometryHex3D.hh" // USES GeometryHex3D
 
 #include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
-#include <math.h> // USES fabs()
+#include <math.h> // USES fabs(), sqrt()
 
 #include <stdexcept>
 // ----------------------------------------------------------------------
@@ -141,4 +146,270 @@ pylith::feassemble::TestIntegratorElasticity::testCalcTotalStrain3D(void)
 } // testCalcTotalStrain3D
 
 
+// ----------------------------------------------------------------------
+// Test specialized kernels for quad4 cells.
+void
+pylith::feassemble::TestIntegratorElasticity::testKernelsQuad4(void)
+{ // testKernelsQuad4
+  PYLITH_METHOD_BEGIN;
+
+  const int cellDim = 2;
+  const int numBasis = 4;
+  const int numQuadPts = 4;
+
+  // Bilinear basis functions on [-1,1]x[-1,1] with 2x2 Gauss quadrature.
+  const PylithScalar verticesRef[numBasis*cellDim] = {
+    -1.0, -1.0,
+    +1.0, -1.0,
+    +1.0, +1.0,
+    -1.0, +1.0,
+  };
+  const PylithScalar coordinates[numBasis*cellDim] = {
+    0.0, 0.0,
+    2.1, 0.2,
+    2.4, 1.9,
+    -0.2, 1.6,
+  };
+  const PylithScalar g = 1.0 / sqrt(3.0);
+  const PylithScalar quadPtsRef[numQuadPts*cellDim] = {
+    -g, -g,
+    +g, -g,
+    +g, +g,
+    -g, +g,
+  };
+  const PylithScalar quadWts[numQuadPts] = { 1.0, 1.0, 1.0, 1.0 };
+
+  PylithScalar basis[numQuadPts*numBasis];
+  PylithScalar basisDerivRef[numQuadPts*numBasis*cellDim];
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    const PylithScalar p = quadPtsRef[iQuad*cellDim  ];
+    const PylithScalar q = quadPtsRef[iQuad*cellDim+1];
+    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+      const PylithScalar pi = verticesRef[iBasis*cellDim  ];
+      const PylithScalar qi = verticesRef[iBasis*cellDim+1];
+      basis[iQuad*numBasis+iBasis] = 0.25*(1.0+pi*p)*(1.0+qi*q);
+      basisDerivRef[(iQuad*numBasis+iBasis)*cellDim  ] = 0.25*pi*(1.0+qi*q);
+      basisDerivRef[(iQuad*numBasis+iBasis)*cellDim+1] = 0.25*(1.0+pi*p)*qi;
+    } // for
+  } // for
+
+  GeometryQuad2D geometry;
+  Quadrature quadrature;
+  quadrature.refGeometry(&geometry);
+  quadrature.initialize(basis, numQuadPts, numBasis,
+			basisDerivRef, numQuadPts, numBasis, cellDim,
+			quadPtsRef, numQuadPts, cellDim,
+			quadWts, numQuadPts,
+			cellDim);
+  quadrature.initializeGeometry();
+  quadrature.computeGeometry(coordinates, numBasis*cellDim, 0);
+
+  _checkKernels(quadrature);
+
+  PYLITH_METHOD_END;
+} // testKernelsQuad4
+
+// ----------------------------------------------------------------------
+// Test specialized kernels for hex8 cells.
+void
+pylith::feassemble::TestIntegratorElasticity::testKernelsHex8(void)
+{ // testKernelsHex8
+  PYLITH_METHOD_BEGIN;
+
+  const int cellDim = 3;
+  const int numBasis = 8;
+  const int numQuadPts = 8;
+
+  // Trilinear basis functions on [-1,1]^3 with 2x2x2 Gauss quadrature.
+  const PylithScalar verticesRef[numBasis*cellDim] = {
+    -1.0, -1.0, -1.0,
+    +1.0, -1.0, -1.0,
+    +1.0, +1.0, -1.0,
+    -1.0, +1.0, -1.0,
+    -1.0, -1.0, +1.0,
+    +1.0, -1.0, +1.0,
+    +1.0, +1.0, +1.0,
+    -1.0, +1.0, +1.0,
+  };
+  const PylithScalar coordinates[numBasis*cellDim] = {
+    0.0, 0.0, 0.0,
+    2.0, 0.1, -0.1,
+    2.2, 2.1, 0.1,
+    -0.1, 1.9, 0.0,
+    0.1, -0.1, 2.0,
+    2.1, 0.0, 2.2,
+    2.0, 2.0, 1.9,
+    0.0, 2.1, 2.1,
+  };
+  const PylithScalar g = 1.0 / sqrt(3.0);
+  PylithScalar quadPtsRef[numQuadPts*cellDim];
+  PylithScalar quadWts[numQuadPts];
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    for (int iDim=0; iDim < cellDim; ++iDim)
+      quadPtsRef[iQuad*cellDim+iDim] = g*verticesRef[iQuad*cellDim+iDim];
+    quadWts[iQuad] = 1.0;
+  } // for
+
+  PylithScalar basis[numQuadPts*numBasis];
+  PylithScalar basisDerivRef[numQuadPts*numBasis*cellDim];
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    const PylithScalar p = quadPtsRef[iQuad*cellDim  ];
+    const PylithScalar q = quadPtsRef[iQuad*cellDim+1];
+    const PylithScalar r = quadPtsRef[iQuad*cellDim+2];
+    for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+      const PylithScalar pi = verticesRef[iBasis*cellDim  ];
+      const PylithScalar qi = verticesRef[iBasis*cellDim+1];
+      const PylithScalar ri = verticesRef[iBasis*cellDim+2];
+      basis[iQuad*numBasis+iBasis] = 0.125*(1.0+pi*p)*(1.0+qi*q)*(1.0+ri*r);
+      basisDerivRef[(iQuad*numBasis+iBasis)*cellDim  ] = 0.125*pi*(1.0+qi*q)*(1.0+ri*r);
+      basisDerivRef[(iQuad*numBasis+iBasis)*cellDim+1] = 0.125*(1.0+pi*p)*qi*(1.0+ri*r);
+      basisDerivRef[(iQuad*numBasis+iBasis)*cellDim+2] = 0.125*(1.0+pi*p)*(1.0+qi*q)*ri;
+    } // for
+  } // for
+
+  GeometryHex3D geometry;
+  Quadrature quadrature;
+  quadrature.refGeometry(&geometry);
+  quadrature.initialize(basis, numQuadPts, numBasis,
+			basisDerivRef, numQuadPts, numBasis, cellDim,
+			quadPtsRef, numQuadPts, cellDim,
+			quadWts, numQuadPts,
+			cellDim);
+  quadrature.initializeGeometry();
+  quadrature.computeGeometry(coordinates, numBasis*cellDim, 0);
+
+  _checkKernels(quadrature);
+
+  PYLITH_METHOD_END;
+} // testKernelsHex8
+
+// ----------------------------------------------------------------------
+// Test _jacobianConditionNumber().
+void
+pylith::feassemble::TestIntegratorElasticity::testJacobianConditionNumber(void)
+{ // testJacobianConditionNumber
+  PYLITH_METHOD_BEGIN;
+
+  const PylithScalar tolerance = 1.0e-12;
+
+  { // 2-D, stretched
+    const PylithScalar jacobian[4] = {
+      2.0, 0.0,
+      0.0, 1.0,
+    };
+    const PylithScalar value = IntegratorElasticity::_jacobianConditionNumber(jacobian, 2.0, 2);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.25, value, tolerance);
+  } // 2-D, stretched
+
+  { // 3-D, scaled and rotated
+    const PylithScalar c = 2.0*cos(M_PI/6.0);
+    const PylithScalar s = 2.0*sin(M_PI/6.0);
+    const PylithScalar jacobian[9] = {
+      c,   -s,  0.0,
+      s,    c,  0.0,
+      0.0, 0.0, 2.0,
+    };
+    const PylithScalar value = IntegratorElasticity::_jacobianConditionNumber(jacobian, 8.0, 3);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value, tolerance);
+  } // 3-D, scaled and rotated
+
+  { // 3-D, flattened
+    const PylithScalar jacobian[9] = {
+      1.0, 0.0, 0.0,
+      0.0, 1.0, 0.0,
+      0.0, 0.0, 0.1,
+    };
+    const PylithScalar valueE = sqrt(2.01*1.02) / 0.3;
+    const PylithScalar value = IntegratorElasticity::_jacobianConditionNumber(jacobian, 0.1, 3);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+  } // 3-D, flattened
+
+  { // Inverted cell
+    const PylithScalar jacobian[4] = {
+      -1.0, 0.0,
+      0.0, 1.0,
+    };
+    const PylithScalar value = IntegratorElasticity::_jacobianConditionNumber(jacobian, -1.0, 2);
+    CPPUNIT_ASSERT(value > 1.0e+30);
+  } // Inverted cell
+
+  PYLITH_METHOD_END;
+} // testJacobianConditionNumber
+
+// ----------------------------------------------------------------------
+// Check specialized kernels against generic kernels.
+void
+pylith::feassemble::TestIntegratorElasticity::_checkKernels(const Quadrature& quadrature)
+{ // _checkKernels
+  PYLITH_METHOD_BEGIN;
+
+  const int numBasis = quadrature.numBasis();
+  const int numQuadPts = quadrature.numQuadPts();
+  const int spaceDim = quadrature.spaceDim();
+  const int tensorSize = (3 == spaceDim) ? 6 : 3;
+  const int cellVectorSize = numBasis*spaceDim;
+
+  ElasticityImplicit integrator;
+  integrator.quadrature(&quadrature);
+  IntegratorElasticity& integratorE = integrator;
+  integratorE._selectKernels();
+  CPPUNIT_ASSERT(integratorE._residualKernel);
+  CPPUNIT_ASSERT(integratorE._jacobianKernel);
+  CPPUNIT_ASSERT(integratorE._totalStrainKernel);
+
+  IntegratorElasticity::elasticityResidual_kernel_type residualFn = 0;
+  IntegratorElasticity::elasticityJacobian_kernel_type jacobianFn = 0;
+  IntegratorElasticity::totalStrain_fn_type totalStrainFn = 0;
+  if (2 == spaceDim) {
+    residualFn = &IntegratorElasticity::_elasticityResidual2D;
+    jacobianFn = &IntegratorElasticity::_elasticityJacobian2D;
+    totalStrainFn = &IntegratorElasticity::_calcTotalStrain2D;
+  } else {
+    residualFn = &IntegratorElasticity::_elasticityResidual3D;
+    jacobianFn = &IntegratorElasticity::_elasticityJacobian3D;
+    totalStrainFn = &IntegratorElasticity::_calcTotalStrain3D;
+  } // if/else
+
+  // Arbitrary displacement, stress, and (nonsymmetric) elastic constants.
+  scalar_array disp(cellVectorSize);
+  for (int i=0; i < cellVectorSize; ++i)
+    disp[i] = 0.1 + 0.03*i - 0.002*i*i;
+  scalar_array stress(numQuadPts*tensorSize);
+  for (size_t i=0; i < stress.size(); ++i)
+    stress[i] = 1.5 - 0.2*i + 0.01*i*i;
+  scalar_array elasticConsts(numQuadPts*tensorSize*tensorSize);
+  for (size_t i=0; i < elasticConsts.size(); ++i)
+    elasticConsts[i] = 2.0 + 0.05*(i % 7) + 0.3*(i % tensorSize);
+
+  const PylithScalar tolerance = 1.0e-10;
+
+  scalar_array strainE(numQuadPts*tensorSize);
+  scalar_array strain(numQuadPts*tensorSize);
+  totalStrainFn(&strainE, quadrature.basisDeriv(), &disp[0], numBasis, spaceDim, numQuadPts);
+  integratorE._totalStrainKernel(&strain, quadrature.basisDeriv(), &disp[0], numBasis, spaceDim, numQuadPts);
+  for (size_t i=0; i < strain.size(); ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(strainE[i], strain[i], tolerance*(1.0+fabs(strainE[i])));
+
+  scalar_array cellVectorE(cellVectorSize);
+  scalar_array cellVector(cellVectorSize);
+  cellVectorE = 1.0;
+  cellVector = 1.0;
+  residualFn(&cellVectorE, stress, quadrature);
+  integratorE._residualKernel(&cellVector, stress, quadrature);
+  for (int i=0; i < cellVectorSize; ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(cellVectorE[i], cellVector[i], tolerance*(1.0+fabs(cellVectorE[i])));
+
+  scalar_array cellMatrixE(cellVectorSize*cellVectorSize);
+  scalar_array cellMatrix(cellVectorSize*cellVectorSize);
+  cellMatrixE = 1.0;
+  cellMatrix = 1.0;
+  jacobianFn(&cellMatrixE, elasticConsts, quadrature);
+  integratorE._jacobianKernel(&cellMatrix, elasticConsts, quadrature);
+  for (size_t i=0; i < cellMatrix.size(); ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(cellMatrixE[i], cellMatrix[i], tolerance*(1.0+fabs(cellMatrixE[i])));
+
+  PYLITH_METHOD_END;
+} // _checkKernels
+
+
 // End of file 
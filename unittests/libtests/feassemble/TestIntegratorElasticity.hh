@@ -29,6 +29,8 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 
+#include "pylith/feassemble/feassemblefwd.hh" // USES Quadrature
+
 /// Namespace for pylith package
 namespace pylith {
   namespace feassemble {
@@ -45,6 +47,9 @@ class pylith::feassemble::TestIntegratorElasticity : public CppUnit::TestFixture
 
   CPPUNIT_TEST( testCalcTotalStrain2D );
   CPPUNIT_TEST( testCalcTotalStrain3D );
+  CPPUNIT_TEST( testKernelsQuad4 );
+  CPPUNIT_TEST( testKernelsHex8 );
+  CPPUNIT_TEST( testJacobianConditionNumber );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -57,6 +62,26 @@ public :
   /// Test calcTotalStrain3D().
   void testCalcTotalStrain3D(void);
 
+  /// Test specialized kernels for quad4 cells.
+  void testKernelsQuad4(void);
+
+  /// Test specialized kernels for hex8 cells.
+  void testKernelsHex8(void);
+
+  /// Test _jacobianConditionNumber().
+  void testJacobianConditionNumber(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Check that specialized kernels are selected for the quadrature
+   * and that they match the generic kernels.
+   *
+   * @param quadrature Quadrature with geometry for a cell.
+   */
+  static
+  void _checkKernels(const Quadrature& quadrature);
+
 }; // class TestIntegratorElasticity
 
 #endif // pylith_feassemble_testintegratorelasticity_hh
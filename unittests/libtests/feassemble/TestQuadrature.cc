@@ -256,5 +256,122 @@ pylith::feassemble::TestQuadrature::testComputeGeometryCell(void)
   PYLITH_METHOD_END;
 } // testComputeGeometryCell
 
+// ----------------------------------------------------------------------
+// Test cacheGeometry() and geometryCacheBudget().
+void
+pylith::feassemble::TestQuadrature::testCacheGeometry(void)
+{ // testCacheGeometry
+  PYLITH_METHOD_BEGIN;
+
+  Quadrature q;
+
+  CPPUNIT_ASSERT_EQUAL(false, q.cacheGeometry());
+  q.cacheGeometry(true);
+  CPPUNIT_ASSERT_EQUAL(true, q.cacheGeometry());
+
+  const PylithScalar budget = 12.5;
+  q.geometryCacheBudget(budget);
+  CPPUNIT_ASSERT_EQUAL(budget, q.geometryCacheBudget());
+
+  Quadrature qCopy(q);
+  CPPUNIT_ASSERT_EQUAL(true, qCopy.cacheGeometry());
+  CPPUNIT_ASSERT_EQUAL(budget, qCopy.geometryCacheBudget());
+  CPPUNIT_ASSERT_EQUAL(false, qCopy.hasGeometryCache());
+
+  PYLITH_METHOD_END;
+} // testCacheGeometry
+
+// ----------------------------------------------------------------------
+// Test initializeGeometryCache() and computeGeometry() with cache.
+void
+pylith::feassemble::TestQuadrature::testComputeGeometryCached(void)
+{ // testComputeGeometryCached
+  PYLITH_METHOD_BEGIN;
+
+  QuadratureData2DLinear data;
+  const int cellDim = data.cellDim;
+  const int numBasis = data.numBasis;
+  const int numQuadPts = data.numQuadPts;
+  const int spaceDim = data.spaceDim;
+
+  const PylithScalar* quadPtsE = data.quadPts;
+  const PylithScalar* jacobianDetE = data.jacobianDet;
+  const PylithScalar* basisDerivE = data.basisDeriv;
+
+  // Setup mesh
+  topology::Mesh mesh;
+  PetscDM dmMesh = NULL;
+  const PetscBool interpolate = PETSC_TRUE;
+  PetscErrorCode err = DMPlexCreateFromCellList(PETSC_COMM_WORLD, cellDim, data.numCells, data.numVertices, numBasis, interpolate, data.cells, spaceDim, data.vertices, &dmMesh);PYLITH_CHECK_ERROR(err);
+  mesh.dmMesh(dmMesh);
+  PetscInt cStart = 0, cEnd = 0;
+  err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(data.numCells, int(cEnd-cStart));
+  const PetscInt cells[1] = { cStart };
+
+  GeometryTri2D geometry;
+  Quadrature quadrature;
+  quadrature.refGeometry(&geometry);
+  quadrature.minJacobian(1.0e-06);
+  quadrature.initialize(data.basis, numQuadPts, numBasis,
+			data.basisDerivRef, numQuadPts, numBasis, cellDim,
+			data.quadPtsRef, numQuadPts, cellDim,
+			data.quadWts, numQuadPts,
+			spaceDim);
+  quadrature.initializeGeometry();
+
+  // Cache is not created unless requested or if it exceeds budget.
+  quadrature.initializeGeometryCache(mesh, cells, 1);
+  CPPUNIT_ASSERT_EQUAL(false, quadrature.hasGeometryCache());
+  quadrature.cacheGeometry(true);
+  quadrature.geometryCacheBudget(0.0);
+  quadrature.initializeGeometryCache(mesh, cells, 1);
+  CPPUNIT_ASSERT_EQUAL(false, quadrature.hasGeometryCache());
+
+  quadrature.geometryCacheBudget(1.0);
+  quadrature.initializeGeometryCache(mesh, cells, 1);
+  CPPUNIT_ASSERT_EQUAL(true, quadrature.hasGeometryCache());
+
+  // Use bogus coordinates to verify cached values are used. Copies
+  // have their own cache unless they share the cache of another
+  // quadrature object.
+  scalar_array coordsBogus(numBasis*spaceDim);
+  coordsBogus = 0.0;
+  Quadrature qCopy(quadrature);
+  qCopy.initializeGeometry();
+  CPPUNIT_ASSERT_EQUAL(false, qCopy.hasGeometryCache());
+  qCopy.shareGeometryCache(quadrature);
+  CPPUNIT_ASSERT_EQUAL(true, qCopy.hasGeometryCache());
+  Quadrature* quadratures[2] = { &quadrature, &qCopy };
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iQ=0; iQ < 2; ++iQ) {
+    quadratures[iQ]->computeGeometry(&coordsBogus[0], coordsBogus.size(), cells[0]);
+
+    const scalar_array& quadPts = quadratures[iQ]->quadPts();
+    size_t size = numQuadPts * spaceDim;
+    CPPUNIT_ASSERT_EQUAL(size, quadPts.size());
+    for (size_t i=0; i < size; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(quadPtsE[i], quadPts[i], tolerance);
+
+    const scalar_array& jacobianDet = quadratures[iQ]->jacobianDet();
+    size = numQuadPts;
+    CPPUNIT_ASSERT_EQUAL(size, jacobianDet.size());
+    for (size_t i=0; i < size; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(jacobianDetE[i], jacobianDet[i], tolerance);
+
+    const scalar_array& basisDeriv = quadratures[iQ]->basisDeriv();
+    size = numQuadPts * numBasis * spaceDim;
+    CPPUNIT_ASSERT_EQUAL(size, basisDeriv.size());
+    for (size_t i=0; i < size; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(basisDerivE[i], basisDeriv[i], tolerance);
+  } // for
+  qCopy.clear();
+
+  quadrature.clear();
+  CPPUNIT_ASSERT_EQUAL(false, quadrature.hasGeometryCache());
+
+  PYLITH_METHOD_END;
+} // testComputeGeometryCached
+
 
 // End of file 
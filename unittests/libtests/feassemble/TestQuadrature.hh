@@ -47,6 +47,8 @@ class pylith::feassemble::TestQuadrature : public CppUnit::TestFixture
   CPPUNIT_TEST( testCheckConditioning );
   CPPUNIT_TEST( testEngineAccessors );
   CPPUNIT_TEST( testComputeGeometryCell );
+  CPPUNIT_TEST( testCacheGeometry );
+  CPPUNIT_TEST( testComputeGeometryCached );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -65,6 +67,12 @@ public :
   /// Test computeGeometry() with coordinates and cell.
   void testComputeGeometryCell(void);
 
+  /// Test cacheGeometry() and geometryCacheBudget().
+  void testCacheGeometry(void);
+
+  /// Test initializeGeometryCache() and computeGeometry() with cache.
+  void testComputeGeometryCached(void);
+
 }; // class TestQuadrature
 
 #endif // pylith_feassemble_testquadrature_hh
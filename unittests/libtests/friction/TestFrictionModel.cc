@@ -443,6 +443,181 @@ pylith::friction::TestFrictionModel::testUpdateStateVars(void)
   PYLITH_METHOD_END;
 } // testUpdateStateVars
 
+// ----------------------------------------------------------------------
+// Test retrievePropsStateVars() for a batch of points.
+void
+pylith::friction::TestFrictionModel::testRetrievePropsStateVarsBatch(void)
+{ // testRetrievePropsStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  faults::FaultCohesiveDyn fault;
+  StaticFriction friction;
+  StaticFrictionData data;
+  _initialize(&mesh, &fault, &friction, &data);
+
+  PetscDM faultDMMesh = fault.faultMesh().dmMesh();CPPUNIT_ASSERT(faultDMMesh);
+  topology::Stratum depthStratum(faultDMMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = depthStratum.begin();
+  CPPUNIT_ASSERT_EQUAL(PetscInt(2), depthStratum.size());
+
+  const int numProperties = 2;
+  const int numPoints = 2;
+  const int points[numPoints] = { int(vStart+1), int(vStart) };
+  const PylithScalar propertiesE[numPoints*numProperties] = {
+    0.4, 1000000/data.pressureScale,
+    0.6, 1000000/data.pressureScale,
+  };
+
+  scalar_array propsStateVars;
+  friction.retrievePropsStateVars(&propsStateVars, points, numPoints);
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints*numProperties), propsStateVars.size());
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int i=0; i < numPoints*numProperties; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propsStateVars[i]/propertiesE[i], tolerance);
+  } // for
+
+  // Values must match those retrieved one point at a time.
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    friction.retrievePropsStateVars(points[iPoint]);
+    for (int i=0; i < numProperties; ++i) {
+      CPPUNIT_ASSERT_EQUAL(friction._propsStateVarsVertex[i], propsStateVars[iPoint*numProperties+i]);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testRetrievePropsStateVarsBatch
+
+// ----------------------------------------------------------------------
+// Test calcFriction() and calcFrictionDeriv() for a batch of vertices.
+void
+pylith::friction::TestFrictionModel::testCalcFrictionBatch(void)
+{ // testCalcFrictionBatch
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  faults::FaultCohesiveDyn fault;
+  StaticFriction friction;
+  StaticFrictionData data;
+  _initialize(&mesh, &fault, &friction, &data);
+
+  PetscDM faultDMMesh = fault.faultMesh().dmMesh();CPPUNIT_ASSERT(faultDMMesh);
+  topology::Stratum depthStratum(faultDMMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = depthStratum.begin();
+  CPPUNIT_ASSERT_EQUAL(PetscInt(2), depthStratum.size());
+
+  const PylithScalar t = 1.5;
+  const int numVertices = 2;
+  const int vertices[numVertices] = { int(vStart+1), int(vStart) };
+  const PylithScalar slip[numVertices] = { 1.2, 0.4 };
+  const PylithScalar slipRate[numVertices] = { -2.3, 0.8 };
+  const PylithScalar normalTraction[numVertices] = { -2.4e-3, 1.0e-3 };
+  const PylithScalar cohesion = 1.0e+6/data.pressureScale;
+  const PylithScalar frictionE[numVertices] = {
+    -normalTraction[0]*0.4 + cohesion, // compression
+    cohesion, // tension
+  };
+
+  friction.timeStep(data.dt);
+  PylithScalar frictionV[numVertices];
+  friction.calcFriction(frictionV, t, slip, slipRate, normalTraction, vertices, numVertices);
+  PylithScalar frictionDerivV[numVertices];
+  friction.calcFrictionDeriv(frictionDerivV, t, slip, slipRate, normalTraction, vertices, numVertices);
+
+  const PylithScalar tolerance = 1.0e-6;
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, frictionV[iVertex]/frictionE[iVertex], tolerance);
+
+    // Values must match those computed one vertex at a time.
+    friction.retrievePropsStateVars(vertices[iVertex]);
+    CPPUNIT_ASSERT_EQUAL(friction.calcFriction(t, slip[iVertex], slipRate[iVertex], normalTraction[iVertex]), frictionV[iVertex]);
+    CPPUNIT_ASSERT_EQUAL(friction.calcFrictionDeriv(t, slip[iVertex], slipRate[iVertex], normalTraction[iVertex]), frictionDerivV[iVertex]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testCalcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Test updateStateVars() for a batch of vertices.
+void
+pylith::friction::TestFrictionModel::testUpdateStateVarsBatch(void)
+{ // testUpdateStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  // Initialize uses static friction, so we change to slip weakening.
+  topology::Mesh mesh;
+  faults::FaultCohesiveDyn fault;
+  StaticFriction frictionDummy;
+  StaticFrictionData data;
+  _initialize(&mesh, &fault, &frictionDummy, &data);
+
+  SlipWeakening friction;
+  spatialdata::spatialdb::SimpleDB db;
+  spatialdata::spatialdb::SimpleIOAscii dbIO;
+  dbIO.filename("data/friction_slipweakening.spatialdb");
+  db.ioHandler(&dbIO);
+  db.queryType(spatialdata::spatialdb::SimpleDB::NEAREST);
+
+  friction.dbProperties(&db);
+  fault.frictionModel(&friction);
+
+  const PylithScalar upDir[] = { 0.0, 0.0, 1.0 };
+  fault.initialize(mesh, upDir);
+
+  PetscDM faultDMMesh = fault.faultMesh().dmMesh();CPPUNIT_ASSERT(faultDMMesh);
+  topology::Stratum depthStratum(faultDMMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = depthStratum.begin();
+  CPPUNIT_ASSERT_EQUAL(PetscInt(2), depthStratum.size());
+
+  const int numVertices = 2;
+  const int vertices[numVertices] = { int(vStart), int(vStart+1) };
+  const PylithScalar t = 1.5;
+  const PylithScalar slip[numVertices] = { 0.25, 0.3 };
+  const PylithScalar slipRate[numVertices] = { 0.64, 0.0 };
+  const PylithScalar normalTraction[numVertices] = { -2.3, -2.1 };
+  const PylithScalar dt = 0.01;
+
+  const PylithScalar stateVars[2] = { 0.5, 0.1 };
+  const PylithScalar stateVarsUpdatedE[numVertices*2] = {
+    0.65, 0.25, // sliding
+    0.0, 0.3, // healing
+  };
+
+  const materials::Metadata& metadata = friction.getMetadata();
+  const int numStateVars = metadata.numStateVars();
+  CPPUNIT_ASSERT(2 == numStateVars);
+  CPPUNIT_ASSERT_EQUAL(numStateVars, friction._varsFiberDim);
+
+  // Set state variables to given values
+  const int propsStateVarsSize = friction._propsFiberDim + friction._varsFiberDim;
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    const int index = (vertices[iVertex]-friction._vStart)*propsStateVarsSize + friction._propsFiberDim;
+    for (int i=0; i < numStateVars; ++i)
+      friction._propsStateVars[index+i] = stateVars[i];
+  } // for
+
+  friction.timeStep(dt);
+  friction.updateStateVars(t, slip, slipRate, normalTraction, vertices, numVertices);
+
+  const PylithScalar tolerance = 1.0e-06;
+  CPPUNIT_ASSERT(friction._fieldsPropsStateVars);
+  for(PetscInt i = 0; i < numStateVars; ++i) {
+    const materials::Metadata::ParamDescription& stateVar = metadata.getStateVar(i);
+    topology::Field& stateVarField = friction._fieldsPropsStateVars->get(stateVar.name.c_str());
+    topology::VecVisitorMesh stateVarVisitor(stateVarField);
+    PetscScalar *fieldsArray = stateVarVisitor.localArray();CPPUNIT_ASSERT(fieldsArray);
+
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+      const PetscInt off = stateVarVisitor.sectionOffset(vertices[iVertex]);
+      CPPUNIT_ASSERT_EQUAL(1, stateVarVisitor.sectionDof(vertices[iVertex]));
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(stateVarsUpdatedE[iVertex*numStateVars+i], fieldsArray[off], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testUpdateStateVarsBatch
+
 // ----------------------------------------------------------------------
 // Setup testing data.
 void
@@ -856,6 +1031,136 @@ pylith::friction::TestFrictionModel::test_updateStateVars(void)
   PYLITH_METHOD_END;
 } // test_updateStateVars
 
+// ----------------------------------------------------------------------
+// Test _calcFrictionBatch()
+void
+pylith::friction::TestFrictionModel::test_calcFrictionBatch(void)
+{ // test_calcFrictionBatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_friction);
+  CPPUNIT_ASSERT(_data);
+
+  const int numLocs = _data->numLocs;
+  const int numPropsVertex = _data->numPropsVertex;
+  const int numVarsVertex = _data->numVarsVertex;
+  const int propsStateVarsSize = numPropsVertex + numVarsVertex;
+
+  scalar_array propsStateVars(numLocs*propsStateVarsSize);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numPropsVertex; ++i)
+      propsStateVars[iLoc*propsStateVarsSize+i] = _data->properties[iLoc*numPropsVertex+i];
+    for (int i=0; i < numVarsVertex; ++i)
+      propsStateVars[iLoc*propsStateVarsSize+numPropsVertex+i] = _data->stateVars[iLoc*numVarsVertex+i];
+  } // for
+  const PylithScalar t = 1.5;
+
+  _friction->timeStep(_data->dt);
+  scalar_array friction(numLocs);
+  _friction->_calcFrictionBatch(&friction[0], t, _data->slip, _data->slipRate, _data->normalTraction,
+				&propsStateVars[0], numPropsVertex, numVarsVertex, numLocs);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar frictionE = _data->friction[iLoc];
+    if (0.0 != frictionE)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, friction[iLoc]/frictionE, tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionE, friction[iLoc], tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // test_calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Test _calcFrictionDerivBatch()
+void
+pylith::friction::TestFrictionModel::test_calcFrictionDerivBatch(void)
+{ // test_calcFrictionDerivBatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_friction);
+  CPPUNIT_ASSERT(_data);
+
+  const int numLocs = _data->numLocs;
+  const int numPropsVertex = _data->numPropsVertex;
+  const int numVarsVertex = _data->numVarsVertex;
+  const int propsStateVarsSize = numPropsVertex + numVarsVertex;
+
+  scalar_array propsStateVars(numLocs*propsStateVarsSize);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numPropsVertex; ++i)
+      propsStateVars[iLoc*propsStateVarsSize+i] = _data->properties[iLoc*numPropsVertex+i];
+    for (int i=0; i < numVarsVertex; ++i)
+      propsStateVars[iLoc*propsStateVarsSize+numPropsVertex+i] = _data->stateVars[iLoc*numVarsVertex+i];
+  } // for
+  const PylithScalar t = 1.5;
+
+  _friction->timeStep(_data->dt);
+  scalar_array frictionDeriv(numLocs);
+  _friction->_calcFrictionDerivBatch(&frictionDeriv[0], t, _data->slip, _data->slipRate, _data->normalTraction,
+				     &propsStateVars[0], numPropsVertex, numVarsVertex, numLocs);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar frictionDerivE = _data->frictionDeriv[iLoc];
+    if (0.0 != frictionDerivE)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, frictionDeriv[iLoc]/frictionDerivE, tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionDerivE, frictionDeriv[iLoc], tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // test_calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Test _updateStateVarsBatch()
+void
+pylith::friction::TestFrictionModel::test_updateStateVarsBatch(void)
+{ // test_updateStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_friction);
+  CPPUNIT_ASSERT(_data);
+
+  const int numLocs = _data->numLocs;
+  const int numPropsVertex = _data->numPropsVertex;
+  const int numVarsVertex = _data->numVarsVertex;
+  const int propsStateVarsSize = numPropsVertex + numVarsVertex;
+
+  scalar_array propsStateVars(numLocs*propsStateVarsSize);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numPropsVertex; ++i)
+      propsStateVars[iLoc*propsStateVarsSize+i] = _data->properties[iLoc*numPropsVertex+i];
+    for (int i=0; i < numVarsVertex; ++i)
+      propsStateVars[iLoc*propsStateVarsSize+numPropsVertex+i] = _data->stateVars[iLoc*numVarsVertex+i];
+  } // for
+  const PylithScalar t = 1.5;
+
+  _friction->timeStep(_data->dt);
+  _friction->_updateStateVarsBatch(t, _data->slip, _data->slipRate, _data->normalTraction,
+				   &propsStateVars[0], numPropsVertex, numVarsVertex, numLocs);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    // Properties should not change.
+    for (int i=0; i < numPropsVertex; ++i) {
+      CPPUNIT_ASSERT_EQUAL(_data->properties[iLoc*numPropsVertex+i], propsStateVars[iLoc*propsStateVarsSize+i]);
+    } // for
+
+    const PylithScalar* stateVars = &propsStateVars[iLoc*propsStateVarsSize+numPropsVertex];
+    for (int i=0; i < numVarsVertex; ++i) {
+      const PylithScalar valueE = _data->stateVarsUpdated[iLoc*numVarsVertex+i];
+      if (0.0 != valueE)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stateVars[i]/valueE, tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, stateVars[i], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // test_updateStateVarsBatch
+
 // ----------------------------------------------------------------------
 // Setup nondimensionalization.
 void
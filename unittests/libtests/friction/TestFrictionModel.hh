@@ -60,6 +60,9 @@ class pylith::friction::TestFrictionModel : public CppUnit::TestFixture
   CPPUNIT_TEST( testCalcFriction );
   CPPUNIT_TEST( testCalcFrictionDeriv );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testRetrievePropsStateVarsBatch );
+  CPPUNIT_TEST( testCalcFrictionBatch );
+  CPPUNIT_TEST( testUpdateStateVarsBatch );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -99,6 +102,15 @@ public :
   /// Test updateStateVars().
   void testUpdateStateVars(void);
 
+  /// Test retrievePropsStateVars() for a batch of points.
+  void testRetrievePropsStateVarsBatch(void);
+
+  /// Test calcFriction() and calcFrictionDeriv() for a batch of vertices.
+  void testCalcFrictionBatch(void);
+
+  /// Test updateStateVars() for a batch of vertices.
+  void testUpdateStateVarsBatch(void);
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -139,6 +151,15 @@ public :
   /// Test _updateStateVars().
   void test_updateStateVars(void);
 
+  /// Test _calcFrictionBatch().
+  void test_calcFrictionBatch(void);
+
+  /// Test _calcFrictionDerivBatch().
+  void test_calcFrictionDerivBatch(void);
+
+  /// Test _updateStateVarsBatch().
+  void test_updateStateVarsBatch(void);
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
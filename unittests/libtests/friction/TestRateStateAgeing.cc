@@ -24,6 +24,8 @@
 
 #include "pylith/friction/RateStateAgeing.hh" // USES RateStateAgeing
 
+#include <cmath> // USES std::isfinite()
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::friction::TestRateStateAgeing );
 
@@ -103,5 +105,59 @@ pylith::friction::TestRateStateAgeing::testHasPropStateVar(void)
   CPPUNIT_ASSERT(material.hasPropStateVar("state_variable"));
 } // testHasPropStateVar
 
+// ----------------------------------------------------------------------
+// Test batch kernels with zero slip rate.
+void
+pylith::friction::TestRateStateAgeing::testBatchZeroSlipRate(void)
+{ // testBatchZeroSlipRate
+  RateStateAgeing model;
+  const PylithScalar dt = 0.01;
+  model.timeStep(dt);
+
+  const int numProperties = 6;
+  const int numStateVars = 1;
+  const int propsStateVarsSize = numProperties + numStateVars;
+  const int numLocs = 3;
+  const PylithScalar properties[numProperties] = { 0.6, 1.0e-6, 0.02, 0.008, 0.012, 0.1 };
+  const PylithScalar stateVars[numStateVars] = { 20.0 };
+
+  // Zero slip rate in compression and in tension, positive slip rate
+  // in tension.
+  const PylithScalar slip[numLocs] = { 0.0, 0.0, 0.0 };
+  const PylithScalar slipRate[numLocs] = { 0.0, 0.0, 1.0e-3 };
+  const PylithScalar normalTraction[numLocs] = { -1.0, 1.0, 1.0 };
+
+  scalar_array propsStateVars(numLocs*propsStateVarsSize);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numProperties; ++i)
+      propsStateVars[iLoc*propsStateVarsSize+i] = properties[i];
+    for (int i=0; i < numStateVars; ++i)
+      propsStateVars[iLoc*propsStateVarsSize+numProperties+i] = stateVars[i];
+  } // for
+  const PylithScalar t = 1.5;
+
+  scalar_array friction(numLocs);
+  model._calcFrictionBatch(&friction[0], t, slip, slipRate, normalTraction,
+			   &propsStateVars[0], numProperties, numStateVars, numLocs);
+  model._updateStateVarsBatch(t, slip, slipRate, normalTraction,
+			      &propsStateVars[0], numProperties, numStateVars, numLocs);
+
+  // Batch values must be finite and match values from scalar kernels.
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar frictionE = model._calcFriction(t, slip[iLoc], slipRate[iLoc], normalTraction[iLoc],
+							properties, numProperties, stateVars, numStateVars);
+    CPPUNIT_ASSERT(std::isfinite(friction[iLoc]));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, friction[iLoc]/frictionE, tolerance);
+
+    PylithScalar stateVarsE[numStateVars] = { stateVars[0] };
+    model._updateStateVars(t, slip[iLoc], slipRate[iLoc], normalTraction[iLoc],
+			   stateVarsE, numStateVars, properties, numProperties);
+    const PylithScalar value = propsStateVars[iLoc*propsStateVarsSize+numProperties];
+    CPPUNIT_ASSERT(std::isfinite(value));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/stateVarsE[0], tolerance);
+  } // for
+} // testBatchZeroSlipRate
+
 
 // End of file 
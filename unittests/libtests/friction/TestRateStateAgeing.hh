@@ -56,6 +56,10 @@ class pylith::friction::TestRateStateAgeing : public TestFrictionModel
   CPPUNIT_TEST( test_calcFriction );
   CPPUNIT_TEST( test_calcFrictionDeriv );
   CPPUNIT_TEST( test_updateStateVars );
+  CPPUNIT_TEST( test_calcFrictionBatch );
+  CPPUNIT_TEST( test_calcFrictionDerivBatch );
+  CPPUNIT_TEST( test_updateStateVarsBatch );
+  CPPUNIT_TEST( testBatchZeroSlipRate );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -77,6 +81,9 @@ public :
   /// Test hasPropStateVar().
   void testHasPropStateVar(void);
 
+  /// Test batch kernels with zero slip rate.
+  void testBatchZeroSlipRate(void);
+
 }; // class TestRateStateAgeing
 
 #endif // pylith_friction_testslipweakeningtime_hh
@@ -33,19 +33,21 @@ namespace pylith {
     namespace _EffectiveStress {
       class Linear {
       public :
-	Linear(void) {};
-	~Linear(void) {};
-	PylithScalar effStressFunc(const PylithScalar x) {
+	struct EffStressStruct {};
+	static PylithScalar effStressFunc(const PylithScalar x,
+					const EffStressStruct& params) {
 	  return x - 10.0;
 	};
-	PylithScalar effStressDerivFunc(const PylithScalar x) {
+	static PylithScalar effStressDerivFunc(const PylithScalar x,
+					const EffStressStruct& params) {
 	  return 1.0;
 	};
-	void effStressFuncDerivFunc(PylithScalar* f,
-				    PylithScalar* df,
-				    const PylithScalar x) {
-	  *f = effStressFunc(x);
-	  *df = effStressDerivFunc(x);
+	static void effStressFuncDerivFunc(PylithScalar* f,
+					   PylithScalar* df,
+					   const PylithScalar x,
+					   const EffStressStruct& params) {
+	  *f = effStressFunc(x, params);
+	  *df = effStressDerivFunc(x, params);
 	};
       }; // Linear
     } // _EffectiveStress
@@ -58,19 +60,21 @@ namespace pylith {
     namespace _EffectiveStress {
       class Quadratic {
       public :
-	Quadratic(void) {};
-	~Quadratic(void) {};
-	PylithScalar effStressFunc(const PylithScalar x) {
+	struct EffStressStruct {};
+	static PylithScalar effStressFunc(const PylithScalar x,
+					const EffStressStruct& params) {
 	  return 1.0e+5 - 1.0/9.0e+3 * pow(x + 2.0e+4, 2);
 	};
-	PylithScalar effStressDerivFunc(const PylithScalar x) {
+	static PylithScalar effStressDerivFunc(const PylithScalar x,
+					const EffStressStruct& params) {
 	  return -2*1.0/9.0e+3*(x+2.0e+4);
 	};
-	void effStressFuncDerivFunc(PylithScalar* f,
-				    PylithScalar* df,
-				    const PylithScalar x) {
-	  *f = effStressFunc(x);
-	  *df = effStressDerivFunc(x);
+	static void effStressFuncDerivFunc(PylithScalar* f,
+					   PylithScalar* df,
+					   const PylithScalar x,
+					   const EffStressStruct& params) {
+	  *f = effStressFunc(x, params);
+	  *df = effStressDerivFunc(x, params);
 	};
       }; // Quadratic
     } // _EffectiveStress
@@ -83,19 +87,21 @@ namespace pylith {
     namespace _EffectiveStress {
       class Cubic {
       public :
-	Cubic(void) {};
-	~Cubic(void) {};
-	PylithScalar effStressFunc(const PylithScalar x) {
+	struct EffStressStruct {};
+	static PylithScalar effStressFunc(const PylithScalar x,
+					const EffStressStruct& params) {
 	  return pow(x - 4.0, 3) - 8.0;
 	};
-	PylithScalar effStressDerivFunc(const PylithScalar x) {
+	static PylithScalar effStressDerivFunc(const PylithScalar x,
+					const EffStressStruct& params) {
 	  return 3.0*pow(x - 4.0, 2);
 	};
-	void effStressFuncDerivFunc(PylithScalar* f,
-				    PylithScalar* df,
-				    const PylithScalar x) {
-	  *f = effStressFunc(x);
-	  *df = effStressDerivFunc(x);
+	static void effStressFuncDerivFunc(PylithScalar* f,
+					   PylithScalar* df,
+					   const PylithScalar x,
+					   const EffStressStruct& params) {
+	  *f = effStressFunc(x, params);
+	  *df = effStressDerivFunc(x, params);
 	};
       }; // Cubic
     } // _EffectiveStress
@@ -109,7 +115,7 @@ pylith::materials::TestEffectiveStress::testCalculateLinear(void)
 { // testCalculateLinear
   const PylithScalar valueE = 10.0;
   
-  _EffectiveStress::Linear material;
+  const _EffectiveStress::Linear::EffStressStruct params = {};
 
   const int ntests = 4;
   const PylithScalar guesses[ntests] = { 0.0, 6.0, 14.0, 20.0 };
@@ -118,7 +124,7 @@ pylith::materials::TestEffectiveStress::testCalculateLinear(void)
   for (int i=0; i < ntests; ++i) {
     const PylithScalar value =
       EffectiveStress::calculate<_EffectiveStress::Linear>(guesses[i], scale,
-							   &material);
+							   params);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
   } // for
 } // testCalculateLinear
@@ -130,7 +136,7 @@ pylith::materials::TestEffectiveStress::testCalculateQuadratic(void)
 { // testCalculateQuadratic
   const PylithScalar valueE = 1.0e+04;
   
-  _EffectiveStress::Quadratic material;
+  const _EffectiveStress::Quadratic::EffStressStruct params = {};
 
   const int ntests = 4;
   const PylithScalar guesses[ntests] = { 1.0, 1.0e-1, 2.0e-2, 1.0e-2 };
@@ -139,7 +145,7 @@ pylith::materials::TestEffectiveStress::testCalculateQuadratic(void)
   for (int i=0; i < ntests; ++i) {
     const PylithScalar value =
       EffectiveStress::calculate<_EffectiveStress::Quadratic>(guesses[i], scale,
-							   &material);
+							   params);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
   } // for
 } // testCalculateQuadratic
@@ -151,7 +157,7 @@ pylith::materials::TestEffectiveStress::testCalculateCubic(void)
 { // testCalculateCubic
   const PylithScalar valueE = 6.0;
   
-  _EffectiveStress::Cubic material;
+  const _EffectiveStress::Cubic::EffStressStruct params = {};
 
   const int ntests = 4;
   const PylithScalar guesses[ntests] = { 2.0, 4.0, 6.0, 8.0 };
@@ -160,10 +166,54 @@ pylith::materials::TestEffectiveStress::testCalculateCubic(void)
   for (int i=0; i < ntests; ++i) {
     const PylithScalar value =
       EffectiveStress::calculate<_EffectiveStress::Cubic>(guesses[i], scale,
-							   &material);
+							   params);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
   } // for
 } // testCalculateCubic
 
+// ----------------------------------------------------------------------
+// Test calculate() iteration statistics.
+void
+pylith::materials::TestEffectiveStress::testCalculateStats(void)
+{ // testCalculateStats
+  const _EffectiveStress::Cubic::EffStressStruct params = {};
+  const PylithScalar scale = 1.0;
+  const PylithScalar tolerance = 1.0e-06;
+
+  EffectiveStress::Stats stats;
+  EffectiveStress::resetStats(&stats);
+  CPPUNIT_ASSERT_EQUAL(long(0), stats.numSolves);
+  CPPUNIT_ASSERT_EQUAL(long(0), stats.numIterations);
+  CPPUNIT_ASSERT_EQUAL(long(0), stats.numBracketed);
+
+  // Initial guess is the root, so no iterations are needed.
+  PylithScalar value =
+    EffectiveStress::calculate<_EffectiveStress::Cubic>(6.0, scale,
+							 params, &stats);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/6.0, tolerance);
+  CPPUNIT_ASSERT_EQUAL(long(1), stats.numSolves);
+  CPPUNIT_ASSERT_EQUAL(long(0), stats.numIterations);
+  CPPUNIT_ASSERT_EQUAL(long(0), stats.numBracketed);
+
+  // Warm start near the root converges with Newton's method alone.
+  value = 
+    EffectiveStress::calculate<_EffectiveStress::Cubic>(6.1, scale,
+							 params, &stats);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/6.0, tolerance);
+  CPPUNIT_ASSERT_EQUAL(long(2), stats.numSolves);
+  CPPUNIT_ASSERT(stats.numIterations > 0);
+  CPPUNIT_ASSERT_EQUAL(long(0), stats.numBracketed);
+
+  // Derivative is zero at initial guess, so the root must be bracketed.
+  const long numIterations = stats.numIterations;
+  value = 
+    EffectiveStress::calculate<_EffectiveStress::Cubic>(4.0, scale,
+							 params, &stats);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/6.0, tolerance);
+  CPPUNIT_ASSERT_EQUAL(long(3), stats.numSolves);
+  CPPUNIT_ASSERT(stats.numIterations > numIterations);
+  CPPUNIT_ASSERT_EQUAL(long(1), stats.numBracketed);
+} // testCalculateStats
+
 
 // End of file
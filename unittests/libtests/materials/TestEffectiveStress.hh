@@ -48,6 +48,7 @@ class pylith::materials::TestEffectiveStress : public CppUnit::TestFixture
   CPPUNIT_TEST( testCalculateLinear );
   CPPUNIT_TEST( testCalculateQuadratic );
   CPPUNIT_TEST( testCalculateCubic );
+  CPPUNIT_TEST( testCalculateStats );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -63,6 +64,9 @@ public :
   /// Test calculate() with cubic function.
   void testCalculateCubic(void);
 
+  /// Test calculate() iteration statistics.
+  void testCalculateStats(void);
+
 }; // class TestEffectiveStress
 
 #endif // pylith_materials_testeffectivestress_hh
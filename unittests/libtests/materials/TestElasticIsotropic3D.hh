@@ -55,6 +55,8 @@ class pylith::materials::TestElasticIsotropic3D : public TestElasticMaterial
   CPPUNIT_TEST( test_calcDensity );
   CPPUNIT_TEST( test_calcStress );
   CPPUNIT_TEST( test_calcElasticConsts );
+  CPPUNIT_TEST( test_calcStressBatch );
+  CPPUNIT_TEST( test_calcElasticConstsBatch );
   CPPUNIT_TEST( test_updateStateVars );
   CPPUNIT_TEST( test_stableTimeStepImplicit );
   CPPUNIT_TEST( test_stableTimeStepExplicit );
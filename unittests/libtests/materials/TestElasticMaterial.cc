@@ -24,24 +24,25 @@
 #include "data/ElasticPlaneStrainData.hh" // USES ElasticPlaneStrainData
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
-#include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/topology/Stratum.hh" // USES StratumIS
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
-#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 #include "pylith/materials/ElasticPlaneStrain.hh" // USES ElasticPlaneStrain
+#include "pylith/materials/MaxwellPlaneStrain.hh" // USES MaxwellPlaneStrain
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/feassemble/GeometryTri2D.hh" // USES GeometryTri2D
 
 #include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
-#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <cstring> // USES memcpy()
+#include <algorithm> // USES std::min()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::materials::TestElasticMaterial );
@@ -142,22 +143,22 @@ pylith::materials::TestElasticMaterial::testInitialize(void)
 
   // Test cell arrays
   size_t size = data.numLocs*data.numPropsQuadPt;
-  CPPUNIT_ASSERT_EQUAL(size, material._propertiesCell.size());
+  CPPUNIT_ASSERT_EQUAL(size, material._workspace.propertiesCell.size());
 
   size = data.numLocs*data.numVarsQuadPt;
-  CPPUNIT_ASSERT_EQUAL(size, material._stateVarsCell.size());
+  CPPUNIT_ASSERT_EQUAL(size, material._workspace.stateVarsCell.size());
 
   size = data.numLocs*tensorSize;
-  CPPUNIT_ASSERT_EQUAL(size, material._initialStressCell.size());
+  CPPUNIT_ASSERT_EQUAL(size, material._workspace.initialStressCell.size());
 
   size = data.numLocs*tensorSize;
-  CPPUNIT_ASSERT_EQUAL(size, material._initialStrainCell.size());
+  CPPUNIT_ASSERT_EQUAL(size, material._workspace.initialStrainCell.size());
 
   size = data.numLocs;
-  CPPUNIT_ASSERT_EQUAL(size, material._densityCell.size());
+  CPPUNIT_ASSERT_EQUAL(size, material._workspace.densityCell.size());
 
   size = data.numLocs*tensorSize;
-  CPPUNIT_ASSERT_EQUAL(size, material._stressCell.size());
+  CPPUNIT_ASSERT_EQUAL(size, material._workspace.stressCell.size());
 
   int numElasticConsts = 0;
   switch (data.dimension)
@@ -175,7 +176,7 @@ pylith::materials::TestElasticMaterial::testInitialize(void)
       assert(0);
     } // switch
   size = data.numLocs*numElasticConsts;
-  CPPUNIT_ASSERT_EQUAL(size, material._elasticConstsCell.size());
+  CPPUNIT_ASSERT_EQUAL(size, material._workspace.elasticConstsCell.size());
 
   PYLITH_METHOD_END;
 } // testInitialize
@@ -212,7 +213,7 @@ pylith::materials::TestElasticMaterial::testRetrievePropsAndVars(void)
   // Test cell arrays
   const PylithScalar* propertiesE = data.propertiesNondim;
   CPPUNIT_ASSERT(propertiesE);
-  const scalar_array& properties = material._propertiesCell;
+  const scalar_array& properties = material._workspace.propertiesCell;
   size_t size = data.numLocs*data.numPropsQuadPt;
   CPPUNIT_ASSERT_EQUAL(size, properties.size());
   for (size_t i=0; i < size; ++i)
@@ -222,7 +223,7 @@ pylith::materials::TestElasticMaterial::testRetrievePropsAndVars(void)
   const PylithScalar* stateVarsE = data.stateVarsNondim;
   CPPUNIT_ASSERT( (0 < numVarsQuadPt && 0 != stateVarsE) ||
 		  (0 == numVarsQuadPt && 0 == stateVarsE) );
-  const scalar_array& stateVars = material._stateVarsCell;
+  const scalar_array& stateVars = material._workspace.stateVarsCell;
   size = data.numLocs*numVarsQuadPt;
   CPPUNIT_ASSERT_EQUAL(size, stateVars.size());
   for (size_t i=0; i < size; ++i)
@@ -231,7 +232,7 @@ pylith::materials::TestElasticMaterial::testRetrievePropsAndVars(void)
 
   const PylithScalar* initialStressE = data.initialStress;
   CPPUNIT_ASSERT(initialStressE);
-  const scalar_array& initialStress = material._initialStressCell;
+  const scalar_array& initialStress = material._workspace.initialStressCell;
   size = data.numLocs*tensorSize;
   CPPUNIT_ASSERT_EQUAL(size, initialStress.size());
   for (size_t i=0; i < size; ++i)
@@ -240,7 +241,7 @@ pylith::materials::TestElasticMaterial::testRetrievePropsAndVars(void)
 
   const PylithScalar* initialStrainE = data.initialStrain;
   CPPUNIT_ASSERT(initialStrainE);
-  const scalar_array& initialStrain = material._initialStrainCell;
+  const scalar_array& initialStrain = material._workspace.initialStrainCell;
   size = data.numLocs*tensorSize;
   CPPUNIT_ASSERT_EQUAL(size, initialStrain.size());
   for (size_t i=0; i < size; ++i)
@@ -250,6 +251,67 @@ pylith::materials::TestElasticMaterial::testRetrievePropsAndVars(void)
   PYLITH_METHOD_END;
 } // testRetrievePropsAndVars
 
+// ----------------------------------------------------------------------
+// Test retrievePropsAndVarsBatch().
+void
+pylith::materials::TestElasticMaterial::testRetrievePropsAndVarsBatch(void)
+{ // testRetrievePropsAndVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  ElasticPlaneStrain material;
+  ElasticPlaneStrainData data;
+  _initialize(&mesh, &material, &data);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+  CPPUNIT_ASSERT(numCells > 0);
+
+  material.createPropsAndVarsVisitors();
+  material.retrievePropsAndVarsBatch(cells, 1);
+  material.destroyPropsAndVarsVisitors();
+
+  const PylithScalar tolerance = 1.0e-06;
+  const int tensorSize = material._tensorSize;
+  const int numPoints = data.numLocs;
+  const int numPropsQuadPt = data.numPropsQuadPt;
+  CPPUNIT_ASSERT_EQUAL(numPoints, material._numPointsBatch);
+
+  // Test block arrays (structure-of-arrays layout)
+  const PylithScalar* propertiesE = data.propertiesNondim;
+  CPPUNIT_ASSERT(propertiesE);
+  const scalar_array& properties = material._propertiesBatch;
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints*numPropsQuadPt), properties.size());
+  for (int iPoint=0; iPoint < numPoints; ++iPoint)
+    for (int i=0; i < numPropsQuadPt; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, properties[i*numPoints+iPoint]/propertiesE[iPoint*numPropsQuadPt+i],
+				   tolerance);
+
+  const PylithScalar* initialStressE = data.initialStress;
+  CPPUNIT_ASSERT(initialStressE);
+  const scalar_array& initialStress = material._initialStressBatch;
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints*tensorSize), initialStress.size());
+  for (int iPoint=0; iPoint < numPoints; ++iPoint)
+    for (int i=0; i < tensorSize; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, initialStress[i*numPoints+iPoint]/initialStressE[iPoint*tensorSize+i]*data.pressureScale,
+				   tolerance);
+
+  const PylithScalar* initialStrainE = data.initialStrain;
+  CPPUNIT_ASSERT(initialStrainE);
+  const scalar_array& initialStrain = material._initialStrainBatch;
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints*tensorSize), initialStrain.size());
+  for (int iPoint=0; iPoint < numPoints; ++iPoint)
+    for (int i=0; i < tensorSize; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, initialStrain[i*numPoints+iPoint]/initialStrainE[iPoint*tensorSize+i],
+				   tolerance);
+
+  PYLITH_METHOD_END;
+} // testRetrievePropsAndVarsBatch
+
 // ----------------------------------------------------------------------
 // Test calcDensity()
 void
@@ -289,6 +351,48 @@ pylith::materials::TestElasticMaterial::testCalcDensity(void)
   PYLITH_METHOD_END;
 } // testCalcDensity
     
+// ----------------------------------------------------------------------
+// Test calcDensityBatch()
+void
+pylith::materials::TestElasticMaterial::testCalcDensityBatch(void)
+{ // testCalcDensityBatch
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  ElasticPlaneStrain material;
+  ElasticPlaneStrainData data;
+  _initialize(&mesh, &material, &data);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+  CPPUNIT_ASSERT(numCells > 0);
+
+  const int numQuadPts = data.numLocs;
+  const int numPoints = numCells*numQuadPts;
+
+  material.createPropsAndVarsVisitors();
+  material.retrievePropsAndVarsBatch(cells, numCells);
+  const scalar_array densityBatch = material.calcDensityBatch();
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints), densityBatch.size());
+
+  // Density must match values computed cell by cell.
+  const PylithScalar tolerance = 1.0e-06;
+  for (PetscInt c=0; c < numCells; ++c) {
+    material.retrievePropsAndVars(cells[c]);
+    const scalar_array& densityE = material.calcDensity();
+    CPPUNIT_ASSERT_EQUAL(size_t(numQuadPts), densityE.size());
+    for (int iQuad=0, iPoint=c*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, densityBatch[iPoint]/densityE[iQuad], tolerance);
+  } // for
+  material.destroyPropsAndVarsVisitors();
+
+  PYLITH_METHOD_END;
+} // testCalcDensityBatch
+    
 // ----------------------------------------------------------------------
 // Test calcStress()
 void
@@ -393,6 +497,216 @@ pylith::materials::TestElasticMaterial::testCalcDerivElastic(void)
 
   PYLITH_METHOD_END;
 } // testCalcDerivElastic
+
+// ----------------------------------------------------------------------
+// Test calcDerivElasticBatch()
+void
+pylith::materials::TestElasticMaterial::testCalcDerivElasticBatch(void)
+{ // testCalcDerivElasticBatch
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  feassemble::Quadrature quadrature;
+  spatialdata::units::Nondimensional normalizer;
+  _setupScales(&normalizer);
+  const int numQuadPts = 2;
+  _initializeTri(&mesh, &quadrature, normalizer, "data/tri3.mesh", numQuadPts);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+  CPPUNIT_ASSERT(numCells > 0);
+
+  spatialdata::spatialdb::UniformDB db("TestElasticMaterial properties");
+  const int numValues = 4;
+  const char* dbNames[numValues] = { "density", "vs", "vp", "viscosity" };
+  const char* dbUnits[numValues] = { "kg/m**3", "m/s", "m/s", "Pa*s" };
+  const double dbValues[numValues] = { 2500.0, 3000.0, 5196.15242, 1.0e+18 };
+  db.setData(dbNames, dbUnits, dbValues, numValues);
+
+  // Use viscoelastic material, so elasticity constants depend on the
+  // time step and state variables.
+  MaxwellPlaneStrain material;
+  material.dbProperties(&db);
+  material.id(materialId);
+  material.label("my_material");
+  material.normalizer(normalizer);
+  material.initialize(mesh, &quadrature);
+  material.useElasticBehavior(false);
+  material.timeStep(0.1);
+
+  const int tensorSize = material.tensorSize();
+  const int numElasticConsts = material._numElasticConsts;
+  const int numPoints = numCells*numQuadPts;
+  scalar_array strainCell(numQuadPts*tensorSize);
+  scalar_array strainBatch(tensorSize*numPoints);
+  for (PetscInt c=0; c < numCells; ++c) {
+    for (int iQuad=0, iPoint=c*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+      for (int iComp=0; iComp < tensorSize; ++iComp) {
+	strainBatch[iComp*numPoints+iPoint] = 1.0e-4 * (iComp+1) / (iQuad+2.0);
+      } // for
+    } // for
+  } // for
+
+  material.createPropsAndVarsVisitors();
+  material.retrievePropsAndVarsBatch(cells, numCells);
+  const scalar_array elasticConstsBatch = material.calcDerivElasticBatch(strainBatch);
+  CPPUNIT_ASSERT_EQUAL(size_t(numElasticConsts*numPoints), elasticConstsBatch.size());
+
+  // Elasticity constants must match those computed cell by cell.
+  const PylithScalar tolerance = 1.0e-10;
+  for (PetscInt c=0; c < numCells; ++c) {
+    for (int iQuad=0, iPoint=c*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+      for (int iComp=0; iComp < tensorSize; ++iComp) {
+	strainCell[iQuad*tensorSize+iComp] = strainBatch[iComp*numPoints+iPoint];
+      } // for
+    } // for
+    material.retrievePropsAndVars(cells[c]);
+    const scalar_array& elasticConstsE = material.calcDerivElastic(strainCell);
+    CPPUNIT_ASSERT_EQUAL(size_t(numQuadPts*numElasticConsts), elasticConstsE.size());
+    for (int iQuad=0, iPoint=c*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+      for (int i=0; i < numElasticConsts; ++i) {
+	const PylithScalar valueE = elasticConstsE[iQuad*numElasticConsts+i];
+	const PylithScalar value = elasticConstsBatch[i*numPoints+iPoint];
+	if (fabs(valueE) > tolerance) {
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+	} else {
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value, tolerance);
+	} // if/else
+      } // for
+    } // for
+  } // for
+  material.destroyPropsAndVarsVisitors();
+
+  PYLITH_METHOD_END;
+} // testCalcDerivElasticBatch
+
+// ----------------------------------------------------------------------
+// Test evaluating material with caller-owned workspaces.
+void
+pylith::materials::TestElasticMaterial::testWorkspace(void)
+{ // testWorkspace
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  ElasticPlaneStrain material;
+  ElasticPlaneStrainData data;
+  _initialize(&mesh, &material, &data);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+  CPPUNIT_ASSERT(numCells > 0);
+  PetscInt cell = cells[0];
+
+  const int tensorSize = material._tensorSize;
+  const int numQuadPts = data.numLocs;
+
+  // Setup total strain
+  scalar_array strain(data.strain, numQuadPts*tensorSize);
+
+  // Evaluate with two independent workspaces and the material's own
+  // workspace; all three must give the same values.
+  ElasticMaterial::Workspace workspaceA;
+  ElasticMaterial::Workspace workspaceB;
+  material.initWorkspace(&workspaceA);
+  material.initWorkspace(&workspaceB);
+  CPPUNIT_ASSERT_EQUAL(material._workspace.propertiesCell.size(), workspaceA.propertiesCell.size());
+  CPPUNIT_ASSERT_EQUAL(material._workspace.stressCell.size(), workspaceA.stressCell.size());
+  CPPUNIT_ASSERT_EQUAL(material._workspace.elasticConstsCell.size(), workspaceA.elasticConstsCell.size());
+
+  material.createPropsAndVarsVisitors();
+  material.retrievePropsAndVars(&workspaceA, cell);
+  material.retrievePropsAndVars(&workspaceB, cell);
+  material.retrievePropsAndVars(cell);
+  material.destroyPropsAndVarsVisitors();
+
+  const scalar_array& stressA = material.calcStress(&workspaceA, strain);
+  const scalar_array& elasticConstsB = material.calcDerivElastic(&workspaceB, strain);
+  const scalar_array& densityB = material.calcDensity(&workspaceB);
+
+  // Workspace results must not go through the material's workspace.
+  CPPUNIT_ASSERT(&stressA == &workspaceA.stressCell);
+  CPPUNIT_ASSERT(&elasticConstsB == &workspaceB.elasticConstsCell);
+  CPPUNIT_ASSERT(&densityB == &workspaceB.densityCell);
+
+  const PylithScalar tolerance = 1.0e-06;
+
+  const PylithScalar* stressE = data.stress;
+  CPPUNIT_ASSERT(stressE);
+  size_t size = numQuadPts * tensorSize;
+  CPPUNIT_ASSERT_EQUAL(size, stressA.size());
+  for (size_t i=0; i < size; ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stressA[i]/stressE[i]*data.pressureScale, tolerance);
+
+  const scalar_array& elasticConsts = material.calcDerivElastic(strain);
+  size = elasticConsts.size();
+  CPPUNIT_ASSERT_EQUAL(size, elasticConstsB.size());
+  for (size_t i=0; i < size; ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(elasticConsts[i], elasticConstsB[i], tolerance);
+
+  const scalar_array& density = material.calcDensity();
+  size = density.size();
+  CPPUNIT_ASSERT_EQUAL(size, densityB.size());
+  for (size_t i=0; i < size; ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(density[i], densityB[i], tolerance);
+
+  PYLITH_METHOD_END;
+} // testWorkspace
+
+// ----------------------------------------------------------------------
+// Test updateElasticConstsCache() and cachedElasticConsts().
+void
+pylith::materials::TestElasticMaterial::testCachedElasticConsts(void)
+{ // testCachedElasticConsts
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  ElasticPlaneStrain material;
+  ElasticPlaneStrainData data;
+  _initialize(&mesh, &material, &data);
+
+  CPPUNIT_ASSERT(material.hasConstantElasticConsts());
+  CPPUNIT_ASSERT(!material._elasticConstsCacheValid);
+  material.updateElasticConstsCache();
+  CPPUNIT_ASSERT(material._elasticConstsCacheValid);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+
+  const int tensorSize = material._tensorSize;
+  const int numQuadPts = data.numLocs;
+  scalar_array strain(data.strain, numQuadPts*tensorSize);
+
+  const PylithScalar tolerance = 1.0e-06;
+  material.createPropsAndVarsVisitors();
+  for (PetscInt c=0; c < numCells; ++c) {
+    material.retrievePropsAndVars(cells[c]);
+    const scalar_array& elasticConstsE = material.calcDerivElastic(strain);
+    const PylithScalar* elasticConsts = material.cachedElasticConsts(cells[c]);
+    CPPUNIT_ASSERT(elasticConsts);
+    for (size_t i=0; i < elasticConstsE.size(); ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(elasticConstsE[i], elasticConsts[i], tolerance*fabs(elasticConstsE[i]));
+    } // for
+  } // for
+  material.destroyPropsAndVarsVisitors();
+
+  // Switching constitutive behavior invalidates cache.
+  material.useElasticBehavior(true);
+  CPPUNIT_ASSERT(!material._elasticConstsCacheValid);
+
+  PYLITH_METHOD_END;
+} // testCachedElasticConsts
     
 // ----------------------------------------------------------------------
 // Test updateStateVars()
@@ -407,6 +721,83 @@ pylith::materials::TestElasticMaterial::testUpdateStateVars(void)
   PYLITH_METHOD_END;
 } // testUpdateStateVars
 
+// ----------------------------------------------------------------------
+// Test updateStateVarsBatch()
+void
+pylith::materials::TestElasticMaterial::testUpdateStateVarsBatch(void)
+{ // testUpdateStateVarsBatch
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  feassemble::Quadrature quadrature;
+  spatialdata::units::Nondimensional normalizer;
+  _setupScales(&normalizer);
+  const int numQuadPts = 2;
+  _initializeTri(&mesh, &quadrature, normalizer, "data/tri3.mesh", numQuadPts);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+  CPPUNIT_ASSERT(numCells > 0);
+
+  spatialdata::spatialdb::UniformDB db("TestElasticMaterial properties");
+  const int numValues = 4;
+  const char* dbNames[numValues] = { "density", "vs", "vp", "viscosity" };
+  const char* dbUnits[numValues] = { "kg/m**3", "m/s", "m/s", "Pa*s" };
+  const double dbValues[numValues] = { 2500.0, 3000.0, 5196.15242, 1.0e+18 };
+  db.setData(dbNames, dbUnits, dbValues, numValues);
+
+  // Update state variables of one material cell by cell and the
+  // other one for a block of cells.
+  MaxwellPlaneStrain material;
+  MaxwellPlaneStrain materialBatch;
+  MaxwellPlaneStrain* materials[2] = { &material, &materialBatch };
+  const PylithScalar dt = 0.1;
+  for (int iMat=0; iMat < 2; ++iMat) {
+    materials[iMat]->dbProperties(&db);
+    materials[iMat]->id(materialId);
+    materials[iMat]->label("my_material");
+    materials[iMat]->normalizer(normalizer);
+    materials[iMat]->initialize(mesh, &quadrature);
+    materials[iMat]->useElasticBehavior(false);
+    materials[iMat]->timeStep(dt);
+    materials[iMat]->createPropsAndVarsVisitors();
+  } // for
+
+  const int numSteps = 3;
+  const int tensorSize = material.tensorSize();
+  const int numPoints = numCells*numQuadPts;
+  scalar_array strainCell(numQuadPts*tensorSize);
+  scalar_array strainBatch(tensorSize*numPoints);
+  for (int iStep=0; iStep < numSteps; ++iStep) {
+    for (PetscInt c=0; c < numCells; ++c) {
+      for (int iQuad=0, iPoint=c*numQuadPts; iQuad < numQuadPts; ++iQuad, ++iPoint) {
+	for (int iComp=0; iComp < tensorSize; ++iComp) {
+	  const PylithScalar value = 1.0e-4 * (iStep+1) * (iComp+1) / (iQuad+2.0);
+	  strainCell[iQuad*tensorSize+iComp] = value;
+	  strainBatch[iComp*numPoints+iPoint] = value;
+	} // for
+      } // for
+      material.retrievePropsAndVars(cells[c]);
+      material.updateStateVars(strainCell, cells[c]);
+    } // for
+    materialBatch.retrievePropsAndVarsBatch(cells, numCells);
+    materialBatch.updateStateVarsBatch(strainBatch, cells, numCells);
+  } // for
+  for (int iMat=0; iMat < 2; ++iMat) {
+    materials[iMat]->destroyPropsAndVarsVisitors();
+  } // for
+
+  const PylithScalar tolerance = 1.0e-10;
+  const char* names[2] = { "total_strain", "viscous_strain" };
+  _checkFieldsMatch(mesh, material, materialBatch, names, 2, tolerance);
+
+  PYLITH_METHOD_END;
+} // testUpdateStateVarsBatch
+
 // ----------------------------------------------------------------------
 // Test calcStableTimeStepImplicit()
 void
@@ -501,6 +892,23 @@ pylith::materials::TestElasticMaterial::testStableTimeStepExplicit(void)
   const PylithScalar dtE = 2.0*1.757359312880716 / 5196.15242;
   CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dt/dtE, tolerance);
 
+  // Stable time step at each quadrature point comes from the cache.
+  topology::Field field(mesh);
+  const PylithScalar dtField = material.stableTimeStepExplicit(mesh, &quadrature, &field);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dtField/dtE, tolerance);
+
+  topology::VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  PylithScalar dtMin = pylith::PYLITH_MAXSCALAR;
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt off = fieldVisitor.sectionOffset(cells[c]);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(numQuadPts), fieldVisitor.sectionDof(cells[c]));
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      dtMin = std::min(dtMin, fieldArray[off+iQuad]);
+    } // for
+  } // for
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dtMin/dtE, tolerance);
+
   PYLITH_METHOD_END;
 } // testStableTimeStepExplicit
 
@@ -707,6 +1115,123 @@ pylith::materials::TestElasticMaterial::test_calcElasticConsts(void)
   PYLITH_METHOD_END;
 } // _testCalcElasticConsts
 
+// ----------------------------------------------------------------------
+// Test _calcStressBatch()
+void
+pylith::materials::TestElasticMaterial::test_calcStressBatch(void)
+{ // test_calcStressBatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_matElastic);
+  CPPUNIT_ASSERT(_dataElastic);
+  const ElasticMaterialData* data = _dataElastic;
+
+  const bool computeStateVars = true;
+
+  const int numPoints = data->numLocs;
+  const int numPropsQuadPt = data->numPropsQuadPt;
+  const int numVarsQuadPt = data->numVarsQuadPt;
+  const int tensorSize = _matElastic->_tensorSize;
+
+  // Transpose test data to structure-of-arrays layout.
+  scalar_array stress(tensorSize*numPoints);
+  scalar_array properties(numPropsQuadPt*numPoints);
+  scalar_array stateVars(numVarsQuadPt*numPoints);
+  scalar_array strain(tensorSize*numPoints);
+  scalar_array initialStress(tensorSize*numPoints);
+  scalar_array initialStrain(tensorSize*numPoints);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numPropsQuadPt; ++i)
+      properties[i*numPoints+iPoint] = data->properties[iPoint*numPropsQuadPt+i];
+    for (int i=0; i < numVarsQuadPt; ++i)
+      stateVars[i*numPoints+iPoint] = data->stateVars[iPoint*numVarsQuadPt+i];
+    for (int i=0; i < tensorSize; ++i) {
+      strain[i*numPoints+iPoint] = data->strain[iPoint*tensorSize+i];
+      initialStress[i*numPoints+iPoint] = data->initialStress[iPoint*tensorSize+i];
+      initialStrain[i*numPoints+iPoint] = data->initialStrain[iPoint*tensorSize+i];
+    } // for
+  } // for
+
+  _matElastic->_calcStressBatch(&stress[0], &properties[0],
+				(numVarsQuadPt > 0) ? &stateVars[0] : 0,
+				&strain[0], &initialStress[0], &initialStrain[0],
+				numPoints, computeStateVars);
+
+  const PylithScalar tolerance = (8 == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-04;
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar* stressE = &data->stress[iPoint*tensorSize];
+    CPPUNIT_ASSERT(stressE);
+    for (int i=0; i < tensorSize; ++i)
+      if (fabs(stressE[i]) > tolerance)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stress[i*numPoints+iPoint]/stressE[i], 
+				     tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(stressE[i], stress[i*numPoints+iPoint],
+				     tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // test_calcStressBatch
+
+// ----------------------------------------------------------------------
+// Test _calcElasticConstsBatch()
+void
+pylith::materials::TestElasticMaterial::test_calcElasticConstsBatch(void)
+{ // test_calcElasticConstsBatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_matElastic);
+  CPPUNIT_ASSERT(_dataElastic);
+  const ElasticMaterialData* data = _dataElastic;
+
+  const int numConsts = _matElastic->_numElasticConsts;
+  const int tensorSize = _matElastic->_tensorSize;
+  const int numPoints = data->numLocs;
+  const int numPropsQuadPt = data->numPropsQuadPt;
+  const int numVarsQuadPt = data->numVarsQuadPt;
+
+  // Transpose test data to structure-of-arrays layout.
+  scalar_array elasticConsts(numConsts*numPoints);
+  scalar_array properties(numPropsQuadPt*numPoints);
+  scalar_array stateVars(numVarsQuadPt*numPoints);
+  scalar_array strain(tensorSize*numPoints);
+  scalar_array initialStress(tensorSize*numPoints);
+  scalar_array initialStrain(tensorSize*numPoints);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int i=0; i < numPropsQuadPt; ++i)
+      properties[i*numPoints+iPoint] = data->properties[iPoint*numPropsQuadPt+i];
+    for (int i=0; i < numVarsQuadPt; ++i)
+      stateVars[i*numPoints+iPoint] = data->stateVars[iPoint*numVarsQuadPt+i];
+    for (int i=0; i < tensorSize; ++i) {
+      strain[i*numPoints+iPoint] = data->strain[iPoint*tensorSize+i];
+      initialStress[i*numPoints+iPoint] = data->initialStress[iPoint*tensorSize+i];
+      initialStrain[i*numPoints+iPoint] = data->initialStrain[iPoint*tensorSize+i];
+    } // for
+  } // for
+
+  _matElastic->_calcElasticConstsBatch(&elasticConsts[0], &properties[0],
+				       (numVarsQuadPt > 0) ? &stateVars[0] : 0,
+				       &strain[0], &initialStress[0], &initialStrain[0],
+				       numPoints);
+
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PylithScalar* elasticConstsE = &data->elasticConsts[iPoint*numConsts];
+    CPPUNIT_ASSERT(elasticConstsE);
+    for (int i=0; i < numConsts; ++i)
+      if (fabs(elasticConstsE[i]) > tolerance) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, elasticConsts[i*numPoints+iPoint]/elasticConstsE[i], 
+				     tolerance);
+      } else {
+	const double stressScale = 1.0e+9;
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(elasticConstsE[i], elasticConsts[i*numPoints+iPoint],
+				     tolerance*stressScale);
+      } // if/else
+  } // for
+
+  PYLITH_METHOD_END;
+} // test_calcElasticConstsBatch
+
 // ----------------------------------------------------------------------
 // Test _updateStateVars()
 void
@@ -848,75 +1373,17 @@ pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
   CPPUNIT_ASSERT(material);
   CPPUNIT_ASSERT(data);
 
-  meshio::MeshIOAscii iohandler;
-  iohandler.filename("data/tri3.mesh");
-  iohandler.read(mesh);
-
-  // Setup coordinates.
-  spatialdata::geocoords::CSCart cs;
-  cs.setSpaceDim(mesh->dimension());
-  cs.initialize();
-  mesh->coordsys(&cs);
-
   // Setup scales.
   spatialdata::units::Nondimensional normalizer;
   normalizer.lengthScale(data->lengthScale);
   normalizer.pressureScale(data->pressureScale);
   normalizer.timeScale(data->timeScale);
   normalizer.densityScale(data->densityScale);
-  topology::MeshOps::nondimensionalize(mesh, normalizer);
 
-  // Setup quadrature
   feassemble::Quadrature quadrature;
-  feassemble::GeometryTri2D geometry;
-  quadrature.refGeometry(&geometry);
-  const int cellDim = 2;
-  const int numCorners = 3;
-  const int numQuadPts = 2;
-  const int spaceDim = 2;
-  const PylithScalar basis[numQuadPts*numCorners] = {
-    1.0/6.0, 1.0/3.0, 1.0/2.0,
-    1.0/6.0, 1.0/2.0, 1.0/3.0,
-  };
-  const PylithScalar basisDeriv[numQuadPts*numCorners*cellDim] = { 
-    -0.5, 0.5,
-    -0.5, 0.0,
-     0.0, 0.5,
-    -0.5, 0.5,
-    -0.5, 0.0,
-     0.0, 0.5,
-  };
-  const PylithScalar quadPtsRef[numQuadPts*spaceDim] = { 
-    -1.0/3.0,        0,
-           0, -1.0/3.0,
-  };
-  const PylithScalar quadWts[numQuadPts] = {
-    1.0, 1.0,
-  };
-  quadrature.initialize(basis, numQuadPts, numCorners,
-			basisDeriv, numQuadPts, numCorners, cellDim,
-			quadPtsRef, numQuadPts, cellDim,
-			quadWts, numQuadPts,
-			spaceDim);
+  _initializeTri(mesh, &quadrature, normalizer, "data/tri3.mesh", 2);
 
-  // Get cells associated with material
   const int materialId = 24;
-  PetscDM dmMesh = mesh->dmMesh();
-  PetscIS cellIS = NULL;
-  const PetscInt *cells = NULL;
-  PetscInt numCells;
-  PetscErrorCode err = 0;
-
-  assert(dmMesh);
-  err = DMGetStratumIS(dmMesh, "material-id", materialId, &cellIS);PYLITH_CHECK_ERROR(err);
-  err = ISGetSize(cellIS, &numCells);PYLITH_CHECK_ERROR(err);
-  err = ISGetIndices(cellIS, &cells);PYLITH_CHECK_ERROR(err);
-
-  // Compute geometry for cells
-  quadrature.initializeGeometry();
-  err = ISRestoreIndices(cellIS, &cells);PYLITH_CHECK_ERROR(err);
-  err = ISDestroy(&cellIS);PYLITH_CHECK_ERROR(err);
-
   spatialdata::spatialdb::SimpleDB db;
   spatialdata::spatialdb::SimpleIOAscii dbIO;
   dbIO.filename("data/matinitialize.spatialdb");
@@ -51,10 +51,16 @@ class pylith::materials::TestElasticMaterial : public TestMaterial
   CPPUNIT_TEST( testDBInitialStrain );
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testRetrievePropsAndVars );
+  CPPUNIT_TEST( testRetrievePropsAndVarsBatch );
   CPPUNIT_TEST( testCalcDensity );
+  CPPUNIT_TEST( testCalcDensityBatch );
   CPPUNIT_TEST( testCalcStress );
   CPPUNIT_TEST( testCalcDerivElastic );
+  CPPUNIT_TEST( testCalcDerivElasticBatch );
+  CPPUNIT_TEST( testWorkspace );
+  CPPUNIT_TEST( testCachedElasticConsts );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testUpdateStateVarsBatch );
   CPPUNIT_TEST( testStableTimeStepImplicit );
   CPPUNIT_TEST( testStableTimeStepExplicit );
 
@@ -75,18 +81,36 @@ public :
   /// Test retrievePropsAndVars().
   void testRetrievePropsAndVars(void);
 
+  /// Test retrievePropsAndVarsBatch().
+  void testRetrievePropsAndVarsBatch(void);
+
   /// Test calcDensity()
   void testCalcDensity(void);
 
+  /// Test calcDensityBatch()
+  void testCalcDensityBatch(void);
+
   /// Test calcStress()
   void testCalcStress(void);
 
   /// Test calcDerivElastic()
   void testCalcDerivElastic(void);
 
+  /// Test calcDerivElasticBatch()
+  void testCalcDerivElasticBatch(void);
+
+  /// Test evaluating material with caller-owned workspaces.
+  void testWorkspace(void);
+
+  /// Test updateElasticConstsCache() and cachedElasticConsts().
+  void testCachedElasticConsts(void);
+
   /// Test updateStateVars().
   void testUpdateStateVars(void);
 
+  /// Test updateStateVarsBatch().
+  void testUpdateStateVarsBatch(void);
+
   /// Test stableTimeStepImplicit().
   void testStableTimeStepImplicit(void);
 
@@ -115,6 +139,12 @@ public :
   /// Test _calcElasticConsts().
   void test_calcElasticConsts(void);
 
+  /// Test _calcStressBatch().
+  void test_calcStressBatch(void);
+
+  /// Test _calcElasticConstsBatch().
+  void test_calcElasticConstsBatch(void);
+
   /// Test _updateStateVars().
   void test_updateStateVars(void);
 
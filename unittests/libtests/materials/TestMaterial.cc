@@ -31,11 +31,13 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 #include "pylith/materials/ElasticPlaneStrain.hh" // USES ElasticPlaneStrain
+#include "pylith/materials/MaxwellPlaneStrain.hh" // USES MaxwellPlaneStrain
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/feassemble/GeometryTri2D.hh" // USES GeometryTri2D
 
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -316,6 +318,250 @@ pylith::materials::TestMaterial::testInitialize(void)
   PYLITH_METHOD_END;
 } // testInitialize
 
+// ----------------------------------------------------------------------
+// Test initialize() with compact storage of properties.
+void
+pylith::materials::TestMaterial::testInitializeCompact(void)
+{ // testInitializeCompact
+  PYLITH_METHOD_BEGIN;
+ 
+  topology::Mesh mesh;
+  feassemble::Quadrature quadrature;
+  spatialdata::units::Nondimensional normalizer;
+  _setupScales(&normalizer);
+  _initializeTri(&mesh, &quadrature, normalizer, "data/tri3.mesh", 1);
+
+  spatialdata::spatialdb::SimpleDB db;
+  spatialdata::spatialdb::SimpleIOAscii dbIO;
+  dbIO.filename("data/matinitialize.spatialdb");
+  db.ioHandler(&dbIO);
+  db.queryType(spatialdata::spatialdb::SimpleDB::NEAREST);
+  
+  const int materialId = 24;
+  ElasticPlaneStrain material;
+  material.dbProperties(&db);
+  material.id(materialId);
+  material.label("my_material");
+  material.normalizer(normalizer);
+  material.initialize(mesh, &quadrature);
+  CPPUNIT_ASSERT_EQUAL(Material::PROPS_QUADPTS, material.propertiesStorage());
+
+  ElasticPlaneStrain materialCompact;
+  materialCompact.dbProperties(&db);
+  materialCompact.id(materialId);
+  materialCompact.label("my_material");
+  materialCompact.normalizer(normalizer);
+  materialCompact.compactProperties(true);
+  materialCompact.initialize(mesh, &quadrature);
+
+  // Mesh has a single cell, so properties are uniform.
+  CPPUNIT_ASSERT_EQUAL(Material::PROPS_UNIFORM, materialCompact.propertiesStorage());
+  CPPUNIT_ASSERT_EQUAL(size_t(materialCompact._numPropsQuadPt), materialCompact._propertiesUniform.size());
+
+  // Output of properties must match regular storage.
+  const PylithScalar tolerance = 1.0e-06;
+  const char* names[3] = { "density", "mu", "lambda" };
+  _checkFieldsMatch(mesh, material, materialCompact, names, 3, tolerance);
+
+  PYLITH_METHOD_END;
+} // testInitializeCompact
+
+// ----------------------------------------------------------------------
+// Test initialize() with compact storage of properties that vary
+// between cells and within cells.
+void
+pylith::materials::TestMaterial::testInitializeCompactVarying(void)
+{ // testInitializeCompactVarying
+  PYLITH_METHOD_BEGIN;
+ 
+  topology::Mesh mesh;
+  feassemble::Quadrature quadrature;
+  spatialdata::units::Nondimensional normalizer;
+  _setupScales(&normalizer);
+  const int numQuadPts = 2;
+  _initializeTri(&mesh, &quadrature, normalizer, "data/tri3_compact.mesh", numQuadPts);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  topology::StratumIS materialIS(mesh.dmMesh(), "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+  CPPUNIT_ASSERT_EQUAL(PetscInt(4), numCells);
+
+  // Cells 0 and 1 have the same properties, so storage starts as
+  // uniform and switches to per cell at cell 2 (back-filling cells 0
+  // and 1). In the second database the properties vary within cell 3,
+  // so storage switches again to per quadrature point (back-filling
+  // cells 0-2).
+  const int numCases = 2;
+  const char* filenames[numCases] = {
+    "data/matcompact_cell.spatialdb",
+    "data/matcompact_quadpts.spatialdb",
+  };
+  const Material::PropsStorageEnum storageE[numCases] = {
+    Material::PROPS_CELL,
+    Material::PROPS_QUADPTS,
+  };
+
+  for (int iCase=0; iCase < numCases; ++iCase) {
+    spatialdata::spatialdb::SimpleDB db;
+    spatialdata::spatialdb::SimpleIOAscii dbIO;
+    dbIO.filename(filenames[iCase]);
+    db.ioHandler(&dbIO);
+    db.queryType(spatialdata::spatialdb::SimpleDB::NEAREST);
+  
+    ElasticPlaneStrain material;
+    material.dbProperties(&db);
+    material.id(materialId);
+    material.label("my_material");
+    material.normalizer(normalizer);
+    material.initialize(mesh, &quadrature);
+    CPPUNIT_ASSERT_EQUAL(Material::PROPS_QUADPTS, material.propertiesStorage());
+
+    ElasticPlaneStrain materialCompact;
+    materialCompact.dbProperties(&db);
+    materialCompact.id(materialId);
+    materialCompact.label("my_material");
+    materialCompact.normalizer(normalizer);
+    materialCompact.compactProperties(true);
+    materialCompact.initialize(mesh, &quadrature);
+    CPPUNIT_ASSERT_EQUAL(storageE[iCase], materialCompact.propertiesStorage());
+    CPPUNIT_ASSERT_EQUAL(size_t(0), materialCompact._propertiesUniform.size());
+
+    // Check layout of compact properties field.
+    const int numPropsQuadPt = materialCompact._numPropsQuadPt;
+    const PetscInt fiberDimE = (Material::PROPS_CELL == storageE[iCase]) ? numPropsQuadPt : numQuadPts*numPropsQuadPt;
+    CPPUNIT_ASSERT(materialCompact._properties);
+    topology::VecVisitorMesh propertiesVisitor(*materialCompact._properties);
+    for (PetscInt c=0; c < numCells; ++c) {
+      CPPUNIT_ASSERT_EQUAL(fiberDimE, propertiesVisitor.sectionDof(cells[c]));
+    } // for
+
+    // Output of properties must match regular storage, including
+    // values back-filled when the storage changes.
+    const PylithScalar tolerance = 1.0e-06;
+    const char* names[3] = { "density", "mu", "lambda" };
+    _checkFieldsMatch(mesh, material, materialCompact, names, 3, tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testInitializeCompactVarying
+
+// ----------------------------------------------------------------------
+// Test storing state variables in single precision.
+void
+pylith::materials::TestMaterial::testStateVarsSinglePrecision(void)
+{ // testStateVarsSinglePrecision
+  PYLITH_METHOD_BEGIN;
+ 
+  topology::Mesh mesh;
+  feassemble::Quadrature quadrature;
+  spatialdata::units::Nondimensional normalizer;
+  _setupScales(&normalizer);
+  const int numQuadPts = 1;
+  _initializeTri(&mesh, &quadrature, normalizer, "data/tri3.mesh", numQuadPts);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  topology::StratumIS materialIS(mesh.dmMesh(), "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+
+  spatialdata::spatialdb::UniformDB db("TestMaterial properties");
+  const int numValues = 4;
+  const char* dbNames[numValues] = { "density", "vs", "vp", "viscosity" };
+  const char* dbUnits[numValues] = { "kg/m**3", "m/s", "m/s", "Pa*s" };
+  const double dbValues[numValues] = { 2500.0, 3000.0, 5196.15242, 1.0e+18 };
+  db.setData(dbNames, dbUnits, dbValues, numValues);
+
+  MaxwellPlaneStrain material;
+  material.dbProperties(&db);
+  material.id(materialId);
+  material.label("my_material");
+  material.normalizer(normalizer);
+  material.initialize(mesh, &quadrature);
+  CPPUNIT_ASSERT(!material.stateVarsSinglePrecision());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), material._stateVarsSingle.size());
+
+  MaxwellPlaneStrain materialSingle;
+  materialSingle.dbProperties(&db);
+  materialSingle.id(materialId);
+  materialSingle.label("my_material");
+  materialSingle.normalizer(normalizer);
+  materialSingle.stateVarsSinglePrecision(true);
+  materialSingle.initialize(mesh, &quadrature);
+  CPPUNIT_ASSERT(materialSingle.stateVarsSinglePrecision());
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numQuadPts*materialSingle._numVarsQuadPt), materialSingle._stateVarsSingle.size());
+
+  // Advance viscoelastic state variables several time steps with the
+  // same strain history in both materials.
+  const PylithScalar dt = 0.1;
+  const int numSteps = 5;
+  const int tensorSize = material.tensorSize();
+  MaxwellPlaneStrain* materials[2] = { &material, &materialSingle };
+  for (int iMat=0; iMat < 2; ++iMat) {
+    materials[iMat]->useElasticBehavior(false);
+    materials[iMat]->timeStep(dt);
+    materials[iMat]->createPropsAndVarsVisitors();
+  } // for
+  scalar_array totalStrain(numQuadPts*tensorSize);
+  for (int iStep=0; iStep < numSteps; ++iStep) {
+    for (int i=0; i < tensorSize; ++i) {
+      totalStrain[i] = 1.0e-4 * (iStep+1) * (i+1) / 3.0;
+    } // for
+    for (int iMat=0; iMat < 2; ++iMat) {
+      for (PetscInt c=0; c < numCells; ++c) {
+	materials[iMat]->retrievePropsAndVars(cells[c]);
+	materials[iMat]->updateStateVars(totalStrain, cells[c]);
+      } // for
+    } // for
+  } // for
+  for (int iMat=0; iMat < 2; ++iMat) {
+    materials[iMat]->destroyPropsAndVarsVisitors();
+  } // for
+
+  // Single precision state variables must match double precision
+  // ones to within single precision roundoff.
+  const PylithScalar tolerance = 1.0e-05;
+  const char* names[2] = { "total_strain", "viscous_strain" };
+  _checkFieldsMatch(mesh, material, materialSingle, names, 2, tolerance);
+
+  PYLITH_METHOD_END;
+} // testStateVarsSinglePrecision
+
+// ----------------------------------------------------------------------
+// Test _spatialOrder().
+void
+pylith::materials::TestMaterial::testSpatialOrder(void)
+{ // testSpatialOrder
+  PYLITH_METHOD_BEGIN;
+
+  const int spaceDim = 2;
+  const int numPoints = 5;
+  const PylithScalar pointsValues[numPoints*spaceDim] = {
+    0.0, 0.0,
+    1.0, 1.0,
+    0.0, 0.1,
+    1.0, 0.9,
+    0.0, 0.0,
+  };
+  const PylithInt orderE[numPoints] = { 0, 4, 2, 3, 1 };
+
+  const scalar_array points(pointsValues, numPoints*spaceDim);
+  int_array order;
+  Material::_spatialOrder(&order, points, spaceDim);
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints), order.size());
+  for (int i=0; i < numPoints; ++i) {
+    CPPUNIT_ASSERT_EQUAL(orderE[i], order[i]);
+  } // for
+
+  // No points.
+  Material::_spatialOrder(&order, scalar_array(), spaceDim);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), order.size());
+
+  PYLITH_METHOD_END;
+} // testSpatialOrder
+
 // ----------------------------------------------------------------------
 // Setup testing data.
 void
@@ -627,5 +873,165 @@ pylith::materials::TestMaterial::testDimStateVars(void)
   PYLITH_METHOD_END;
 } // testDimStateVars
 
+// ----------------------------------------------------------------------
+// Set scales used by test data for viscoelastic materials.
+void
+pylith::materials::TestMaterial::_setupScales(spatialdata::units::Nondimensional* normalizer)
+{ // _setupScales
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(normalizer);
+
+  const PylithScalar lengthScale = 1.0e+3;
+  const PylithScalar pressureScale = 2.25e+10;
+  const PylithScalar timeScale = 3.15576e+7;
+  const PylithScalar velocityScale = lengthScale / timeScale;
+  const PylithScalar densityScale = pressureScale / (velocityScale*velocityScale);
+  normalizer->lengthScale(lengthScale);
+  normalizer->pressureScale(pressureScale);
+  normalizer->timeScale(timeScale);
+  normalizer->densityScale(densityScale);
+
+  PYLITH_METHOD_END;
+} // _setupScales
+
+// ----------------------------------------------------------------------
+// Setup mesh with triangular cells and quadrature.
+void
+pylith::materials::TestMaterial::_initializeTri(topology::Mesh* mesh,
+						feassemble::Quadrature* quadrature,
+						const spatialdata::units::Nondimensional& normalizer,
+						const char* filename,
+						const int numQuadPts)
+{ // _initializeTri
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+  CPPUNIT_ASSERT(quadrature);
+  CPPUNIT_ASSERT(filename);
+
+  // Setup mesh
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(filename);
+  iohandler.read(mesh);
+
+  // Setup coordinates.
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(mesh->dimension());
+  cs.initialize();
+  mesh->coordsys(&cs);
+
+  topology::MeshOps::nondimensionalize(mesh, normalizer);
+
+  // Setup quadrature
+  feassemble::GeometryTri2D geometry;
+  quadrature->refGeometry(&geometry);
+  const int cellDim = 2;
+  const int numCorners = 3;
+  const int spaceDim = 2;
+  switch (numQuadPts) {
+  case 1 : {
+    const PylithScalar basis[] = { 1.0/3.0, 1.0/3.0, 1.0/3.0 };
+    const PylithScalar basisDeriv[] = { 
+      -0.5, 0.5,
+      -0.5, 0.0,
+       0.0, 0.5,
+    };
+    const PylithScalar quadPtsRef[] = { -1.0/3.0, -1.0/3.0 };
+    const PylithScalar quadWts[] = { 2.0  };
+    quadrature->initialize(basis, numQuadPts, numCorners,
+			   basisDeriv, numQuadPts, numCorners, cellDim,
+			   quadPtsRef, numQuadPts, cellDim,
+			   quadWts, numQuadPts,
+			   spaceDim);
+    break;
+  } // case 1
+  case 2 : {
+    const PylithScalar basis[] = {
+      1.0/6.0, 1.0/3.0, 1.0/2.0,
+      1.0/6.0, 1.0/2.0, 1.0/3.0,
+    };
+    const PylithScalar basisDeriv[] = { 
+      -0.5, 0.5,
+      -0.5, 0.0,
+       0.0, 0.5,
+      -0.5, 0.5,
+      -0.5, 0.0,
+       0.0, 0.5,
+    };
+    const PylithScalar quadPtsRef[] = { 
+      -1.0/3.0,        0,
+             0, -1.0/3.0,
+    };
+    const PylithScalar quadWts[] = {
+      1.0, 1.0,
+    };
+    quadrature->initialize(basis, numQuadPts, numCorners,
+			   basisDeriv, numQuadPts, numCorners, cellDim,
+			   quadPtsRef, numQuadPts, cellDim,
+			   quadWts, numQuadPts,
+			   spaceDim);
+    break;
+  } // case 2
+  default :
+    CPPUNIT_ASSERT_MESSAGE("Unsupported number of quadrature points.", false);
+  } // switch
+
+  // Compute geometry for cells
+  quadrature->initializeGeometry();
+
+  PYLITH_METHOD_END;
+} // _initializeTri
+
+// ----------------------------------------------------------------------
+// Check fields of material match those of reference material.
+void
+pylith::materials::TestMaterial::_checkFieldsMatch(const topology::Mesh& mesh,
+						   const Material& materialE,
+						   const Material& material,
+						   const char* const* names,
+						   const int numNames,
+						   const PylithScalar tolerance)
+{ // _checkFieldsMatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(names);
+
+  // Get cells associated with material
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialE.id());
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+  CPPUNIT_ASSERT(numCells > 0);
+
+  for (int iName=0; iName < numNames; ++iName) {
+    topology::Field fieldE(mesh);
+    materialE.getField(&fieldE, names[iName]);
+    topology::Field field(mesh);
+    material.getField(&field, names[iName]);
+
+    topology::VecVisitorMesh fieldEVisitor(fieldE);
+    const PetscScalar* fieldEArray = fieldEVisitor.localArray();
+    topology::VecVisitorMesh fieldVisitor(field);
+    const PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt c=0; c < numCells; ++c) {
+      const PetscInt offE = fieldEVisitor.sectionOffset(cells[c]);
+      const PetscInt off = fieldVisitor.sectionOffset(cells[c]);
+      const PetscInt fiberDim = fieldEVisitor.sectionDof(cells[c]);
+      CPPUNIT_ASSERT_EQUAL(fiberDim, fieldVisitor.sectionDof(cells[c]));
+      for (PetscInt d=0; d < fiberDim; ++d) {
+	const PylithScalar valueE = fieldEArray[offE+d];
+	if (fabs(valueE) > tolerance) {
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fieldArray[off+d]/valueE, tolerance);
+	} else {
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, fieldArray[off+d], tolerance);
+	} // if/else
+      } // for
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _checkFieldsMatch
+
 
 // End of file 
@@ -30,6 +30,11 @@
 #include <cppunit/extensions/HelperMacros.h>
 
 #include "pylith/materials/materialsfwd.hh" // forward declarations
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+#include "pylith/feassemble/feassemblefwd.hh" // USES Quadrature
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
 
 /// Namespace for pylith package
 namespace pylith {
@@ -55,6 +60,10 @@ class pylith::materials::TestMaterial : public CppUnit::TestFixture
   CPPUNIT_TEST( testNeedNewJacobian );
   CPPUNIT_TEST( testIsJacobianSymmetric );
   CPPUNIT_TEST( testInitialize );
+  CPPUNIT_TEST( testInitializeCompact );
+  CPPUNIT_TEST( testInitializeCompactVarying );
+  CPPUNIT_TEST( testStateVarsSinglePrecision );
+  CPPUNIT_TEST( testSpatialOrder );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -88,6 +97,19 @@ public :
   /// Test initialize()
   void testInitialize(void);
 
+  /// Test initialize() with compact storage of properties.
+  void testInitializeCompact(void);
+
+  /// Test initialize() with compact storage of properties that vary
+  /// between cells and within cells.
+  void testInitializeCompactVarying(void);
+
+  /// Test storing state variables in single precision.
+  void testStateVarsSinglePrecision(void);
+
+  /// Test _spatialOrder().
+  void testSpatialOrder(void);
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -125,6 +147,54 @@ public :
   /// Test _dimStateVars().
   void testDimStateVars(void);
 
+  // PROTECTED METHODS //////////////////////////////////////////////////
+protected :
+
+  /** Set scales to those used by the test data for the viscoelastic
+   * materials.
+   *
+   * @param normalizer Nondimensionalizer for scales.
+   */
+  static
+  void _setupScales(spatialdata::units::Nondimensional* normalizer);
+
+  /** Setup mesh with triangular cells and quadrature.
+   *
+   * @param mesh Finite-element mesh.
+   * @param quadrature Quadrature for cells in mesh.
+   * @param normalizer Nondimensionalizer for scales.
+   * @param filename Name of mesh file.
+   * @param numQuadPts Number of quadrature points (1 or 2).
+   */
+  static
+  void _initializeTri(topology::Mesh* mesh,
+		      feassemble::Quadrature* quadrature,
+		      const spatialdata::units::Nondimensional& normalizer,
+		      const char* filename,
+		      const int numQuadPts);
+
+  /** Check fields of material match those of reference material over
+   * the reference material's cells.
+   *
+   * Values are compared relative to the reference values except for
+   * values near zero, which are compared using the tolerance as an
+   * absolute tolerance.
+   *
+   * @param mesh Finite-element mesh.
+   * @param materialE Reference material with expected values.
+   * @param material Material with values to check.
+   * @param names Names of fields to check.
+   * @param numNames Number of fields to check.
+   * @param tolerance Tolerance for comparison.
+   */
+  static
+  void _checkFieldsMatch(const topology::Mesh& mesh,
+			 const Material& materialE,
+			 const Material& material,
+			 const char* const* names,
+			 const int numNames,
+			 const PylithScalar tolerance);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
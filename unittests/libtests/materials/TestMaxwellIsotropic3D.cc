@@ -180,6 +180,58 @@ pylith::materials::TestMaxwellIsotropic3D::test_updateStateVarsTimeDep(void)
 
 } // test_updateStateVarsTimeDep
 
+// ----------------------------------------------------------------------
+// Test _calcStressBatch() with elastic behavior.
+void
+pylith::materials::TestMaxwellIsotropic3D::test_calcStressBatchElastic(void)
+{ // test_calcStressBatchElastic
+  CPPUNIT_ASSERT(0 != _matElastic);
+  _matElastic->useElasticBehavior(true);
+
+  test_calcStressBatch();
+} // test_calcStressBatchElastic
+
+// ----------------------------------------------------------------------
+// Test _calcStressBatch() with viscoelastic behavior.
+void
+pylith::materials::TestMaxwellIsotropic3D::test_calcStressBatchTimeDep(void)
+{ // test_calcStressBatchTimeDep
+  CPPUNIT_ASSERT(0 != _matElastic);
+  _matElastic->useElasticBehavior(false);
+
+  delete _dataElastic; _dataElastic = new MaxwellIsotropic3DTimeDepData();
+
+  PylithScalar dt = 2.0e+5;
+  _matElastic->timeStep(dt);
+  test_calcStressBatch();
+} // test_calcStressBatchTimeDep
+
+// ----------------------------------------------------------------------
+// Test _calcElasticConstsBatch() with elastic behavior.
+void
+pylith::materials::TestMaxwellIsotropic3D::test_calcElasticConstsBatchElastic(void)
+{ // test_calcElasticConstsBatchElastic
+  CPPUNIT_ASSERT(0 != _matElastic);
+  _matElastic->useElasticBehavior(true);
+
+  test_calcElasticConstsBatch();
+} // test_calcElasticConstsBatchElastic
+
+// ----------------------------------------------------------------------
+// Test _calcElasticConstsBatch() with viscoelastic behavior.
+void
+pylith::materials::TestMaxwellIsotropic3D::test_calcElasticConstsBatchTimeDep(void)
+{ // test_calcElasticConstsBatchTimeDep
+  CPPUNIT_ASSERT(0 != _matElastic);
+  _matElastic->useElasticBehavior(false);
+
+  delete _dataElastic; _dataElastic = new MaxwellIsotropic3DTimeDepData();
+
+  PylithScalar dt = 2.0e+5;
+  _matElastic->timeStep(dt);
+  test_calcElasticConstsBatch();
+} // test_calcElasticConstsBatchTimeDep
+
 // ----------------------------------------------------------------------
 // Test _stableTimeStepImplicit()
 void
@@ -68,6 +68,10 @@ class pylith::materials::TestMaxwellIsotropic3D : public TestElasticMaterial
   CPPUNIT_TEST( test_calcElasticConstsTimeDep );
   CPPUNIT_TEST( test_updateStateVarsElastic );
   CPPUNIT_TEST( test_updateStateVarsTimeDep );
+  CPPUNIT_TEST( test_calcStressBatchElastic );
+  CPPUNIT_TEST( test_calcStressBatchTimeDep );
+  CPPUNIT_TEST( test_calcElasticConstsBatchElastic );
+  CPPUNIT_TEST( test_calcElasticConstsBatchTimeDep );
 
   CPPUNIT_TEST( testHasProperty );
   CPPUNIT_TEST( testHasStateVar );
@@ -107,6 +111,18 @@ public :
   /// Test _updateStatevarsTimeDep()
   void test_updateStateVarsTimeDep(void);
 
+  /// Test _calcStressBatch() with elastic behavior.
+  void test_calcStressBatchElastic(void);
+
+  /// Test _calcStressBatch() with viscoelastic behavior.
+  void test_calcStressBatchTimeDep(void);
+
+  /// Test _calcElasticConstsBatch() with elastic behavior.
+  void test_calcElasticConstsBatchElastic(void);
+
+  /// Test _calcElasticConstsBatch() with viscoelastic behavior.
+  void test_calcElasticConstsBatchTimeDep(void);
+
   /// Test _stableTimeStepImplicit()
   void test_stableTimeStepImplicit(void);
 
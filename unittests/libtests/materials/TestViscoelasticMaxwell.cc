@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+
+#include <portinfo>
+
+#include "TestViscoelasticMaxwell.hh" // Implementation of class methods
+
+#include "pylith/materials/ViscoelasticMaxwell.hh" // USES ViscoelasticMaxwell
+
+#include <cmath> // USES exp()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::materials::TestViscoelasticMaxwell );
+
+// ----------------------------------------------------------------------
+// Test viscousStrainParam().
+void
+pylith::materials::TestViscoelasticMaxwell::testViscousStrainParam(void)
+{ // testViscousStrainParam
+  const PylithScalar tolerance = 1.0e-06;
+
+  // Default solution.
+  const PylithScalar dt = 0.5;
+  const PylithScalar maxwellTime = 2.0;
+  const PylithScalar dqE = maxwellTime*(1.0-exp(-dt/maxwellTime))/dt;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime)/dqE, tolerance);
+
+  // Series expansion for small time step.
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, ViscoelasticMaxwell::viscousStrainParam(1.0e-12, maxwellTime), tolerance);
+
+  // Very small Maxwell time.
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, ViscoelasticMaxwell::viscousStrainParam(dt, 1.0e-12)/(1.0e-12/dt), tolerance);
+
+  CPPUNIT_ASSERT_THROW(ViscoelasticMaxwell::viscousStrainParam(dt, 0.0), std::runtime_error);
+} // testViscousStrainParam
+
+// ----------------------------------------------------------------------
+// Test decayFactors().
+void
+pylith::materials::TestViscoelasticMaxwell::testDecayFactors(void)
+{ // testDecayFactors
+  const int numModels = 2;
+  const PylithScalar dt = 0.5;
+  const PylithScalar maxwellTime[numModels] = { 2.0, 0.25 };
+
+  PylithScalar decay[numModels];
+  PylithScalar dq[numModels];
+  ViscoelasticMaxwell::decayFactors<numModels>(decay, dq, dt, maxwellTime);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int i=0; i < numModels; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, decay[i]/exp(-dt/maxwellTime[i]), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dq[i]/ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime[i]), tolerance);
+  } // for
+
+  // Same time step and Maxwell times (reuses factors).
+  PylithScalar decayReuse[numModels];
+  PylithScalar dqReuse[numModels];
+  ViscoelasticMaxwell::decayFactors<numModels>(decayReuse, dqReuse, dt, maxwellTime);
+  for (int i=0; i < numModels; ++i) {
+    CPPUNIT_ASSERT_EQUAL(decay[i], decayReuse[i]);
+    CPPUNIT_ASSERT_EQUAL(dq[i], dqReuse[i]);
+  } // for
+
+  // Different time step and Maxwell times.
+  const PylithScalar dtNew = 0.25;
+  const PylithScalar maxwellTimeNew[numModels] = { 2.0, 0.5 };
+  ViscoelasticMaxwell::decayFactors<numModels>(decay, dq, dtNew, maxwellTimeNew);
+  for (int i=0; i < numModels; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, decay[i]/exp(-dtNew/maxwellTimeNew[i]), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dq[i]/ViscoelasticMaxwell::viscousStrainParam(dtNew, maxwellTimeNew[i]), tolerance);
+  } // for
+} // testDecayFactors
+
+// ----------------------------------------------------------------------
+// Test viscousStrains().
+void
+pylith::materials::TestViscoelasticMaxwell::testViscousStrains(void)
+{ // testViscousStrains
+  const int numModels = 2;
+  const int tensorSize = 3;
+  const PylithScalar decay[numModels] = { 0.5, 0.25 };
+  const PylithScalar coef[numModels] = { 2.0, 0.0 };
+  const PylithScalar deltaStrain[tensorSize] = { 1.0e-4, -2.0e-4, 3.0e-4 };
+  const PylithScalar viscousStrainT[numModels*tensorSize] = {
+    1.0e-3, 2.0e-3, 3.0e-3,
+    4.0e-3, 5.0e-3, 6.0e-3,
+  };
+  const PylithScalar viscousStrainE[numModels*tensorSize] = {
+    0.7e-3, 0.6e-3, 2.1e-3,
+    1.0e-3, 1.25e-3, 1.5e-3,
+  };
+
+  const PylithScalar tolerance = 1.0e-06;
+  const int size = numModels*tensorSize;
+
+  PylithScalar viscousStrain[size];
+  ViscoelasticMaxwell::viscousStrains<numModels, tensorSize>(viscousStrain, viscousStrainT, decay, coef, deltaStrain);
+  for (int i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, viscousStrain[i]/viscousStrainE[i], tolerance);
+  } // for
+
+  // Update in place.
+  for (int i=0; i < size; ++i) {
+    viscousStrain[i] = viscousStrainT[i];
+  } // for
+  ViscoelasticMaxwell::viscousStrains<numModels, tensorSize>(viscousStrain, viscousStrain, decay, coef, deltaStrain);
+  for (int i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, viscousStrain[i]/viscousStrainE[i], tolerance);
+  } // for
+} // testViscousStrains
+
+
+// End of file 
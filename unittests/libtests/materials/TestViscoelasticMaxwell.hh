@@ -0,0 +1,69 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+
+/**
+ * @file unittests/libtests/materials/TestViscoelasticMaxwell.hh
+ *
+ * @brief C++ TestViscoelasticMaxwell object
+ *
+ * C++ unit testing for ViscoelasticMaxwell.
+ */
+
+#if !defined(pylith_materials_testviscoelasticmaxwell_hh)
+#define pylith_materials_testviscoelasticmaxwell_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace materials {
+    class TestViscoelasticMaxwell;
+  } // materials
+} // pylith
+
+/// C++ unit testing for ViscoelasticMaxwell
+class pylith::materials::TestViscoelasticMaxwell : public CppUnit::TestFixture
+{ // class TestViscoelasticMaxwell
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestViscoelasticMaxwell );
+
+  CPPUNIT_TEST( testViscousStrainParam );
+  CPPUNIT_TEST( testDecayFactors );
+  CPPUNIT_TEST( testViscousStrains );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test viscousStrainParam().
+  void testViscousStrainParam(void);
+
+  /// Test decayFactors().
+  void testDecayFactors(void);
+
+  /// Test viscousStrains().
+  void testViscousStrains(void);
+
+}; // class TestViscoelasticMaxwell
+
+#endif // pylith_materials_testviscoelasticmaxwell_hh
+
+// End of file 
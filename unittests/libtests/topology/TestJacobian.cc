@@ -131,6 +131,39 @@ pylith::topology::TestJacobian::testZero(void)
   PYLITH_METHOD_END;
 } // testZero
 
+// ----------------------------------------------------------------------
+// Test valuesChanged() and valuesState().
+void
+pylith::topology::TestJacobian::testValuesState(void)
+{ // testValuesState
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  Field field(mesh);
+  _initializeField(&mesh, &field);
+  Jacobian jacobian(field);
+
+  CPPUNIT_ASSERT(jacobian.valuesChanged());
+  const long state = jacobian.valuesState();
+
+  // Resetting flag does not change state.
+  jacobian.resetValuesChanged();
+  CPPUNIT_ASSERT(!jacobian.valuesChanged());
+  CPPUNIT_ASSERT_EQUAL(state, jacobian.valuesState());
+
+  jacobian.zero();
+  CPPUNIT_ASSERT(jacobian.valuesChanged());
+  CPPUNIT_ASSERT_EQUAL(state+1, jacobian.valuesState());
+
+  jacobian.resetValuesChanged();
+  jacobian.assemble("final_assembly");
+  CPPUNIT_ASSERT(jacobian.valuesChanged());
+  CPPUNIT_ASSERT_EQUAL(state+2, jacobian.valuesState());
+
+  PYLITH_METHOD_END;
+} // testValuesState
+
 // ----------------------------------------------------------------------
 // Test view().
 void
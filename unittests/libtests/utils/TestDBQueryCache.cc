@@ -0,0 +1,235 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+
+#include <portinfo>
+
+#include "TestDBQueryCache.hh" // Implementation of class methods
+
+#include "pylith/utils/DBQueryCache.hh" // USES DBQueryCache
+
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
+
+#include <cstdio> // USES remove()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::utils::TestDBQueryCache );
+
+// ----------------------------------------------------------------------
+// Test filename().
+void
+pylith::utils::TestDBQueryCache::testFilename(void)
+{ // testFilename
+  PYLITH_METHOD_BEGIN;
+
+  const std::string& filename = DBQueryCache::filename("cache", "material", "properties");
+  CPPUNIT_ASSERT_EQUAL(std::string("cache_material_properties_p0.dat"), filename);
+
+  PYLITH_METHOD_END;
+} // testFilename
+
+// ----------------------------------------------------------------------
+// Test key().
+void
+pylith::utils::TestDBQueryCache::testKey(void)
+{ // testKey
+  PYLITH_METHOD_BEGIN;
+
+  spatialdata::spatialdb::UniformDB db;
+  db.label("test db");
+
+  const int numValues = 2;
+  const char* names[numValues] = { "density", "vs" };
+  const int spaceDim = 2;
+  const PylithScalar pointsE[] = {
+    1.0, 2.0,
+    3.0, 4.0,
+  };
+  const size_t size = sizeof(pointsE) / sizeof(PylithScalar);
+  scalar_array points(pointsE, size);
+
+  const char* fingerprint = "file=test.spatialdb;size=100;mtime=1.0";
+  const char* queryName = "properties";
+
+  const std::string& key = DBQueryCache::key(db, fingerprint, queryName, names, numValues, points, spaceDim);
+  CPPUNIT_ASSERT_EQUAL(key, DBQueryCache::key(db, fingerprint, queryName, names, numValues, points, spaceDim));
+
+  // Key depends on values in query.
+  CPPUNIT_ASSERT(key != DBQueryCache::key(db, fingerprint, queryName, names, numValues-1, points, spaceDim));
+
+  // Key depends on coordinates of points.
+  points[3] = 4.5;
+  CPPUNIT_ASSERT(key != DBQueryCache::key(db, fingerprint, queryName, names, numValues, points, spaceDim));
+  points[3] = 4.0;
+
+  // Key depends on contents of database.
+  CPPUNIT_ASSERT(key != DBQueryCache::key(db, "file=test.spatialdb;size=100;mtime=2.0", queryName, names, numValues, points, spaceDim));
+
+  // Key depends on name of query.
+  CPPUNIT_ASSERT(key != DBQueryCache::key(db, fingerprint, "state_vars", names, numValues, points, spaceDim));
+
+  // Key depends on database.
+  db.label("other db");
+  CPPUNIT_ASSERT(key != DBQueryCache::key(db, fingerprint, queryName, names, numValues, points, spaceDim));
+
+  PYLITH_METHOD_END;
+} // testKey
+
+// ----------------------------------------------------------------------
+// Test write() and read().
+void
+pylith::utils::TestDBQueryCache::testWriteRead(void)
+{ // testWriteRead
+  PYLITH_METHOD_BEGIN;
+
+  const char* filename = "dbquerycache_writeread.dat";
+  const std::string key = "db=test;values=a,b";
+  const PylithScalar valuesE[] = {
+    1.5, -2.25, 3.0e+10,
+    4.0, 0.0, 6.125e-10,
+  };
+  const size_t size = sizeof(valuesE) / sizeof(PylithScalar);
+  const scalar_array values(valuesE, size);
+
+  DBQueryCache::write(filename, key, values);
+
+  scalar_array valuesFile;
+  CPPUNIT_ASSERT(DBQueryCache::read(&valuesFile, filename, key));
+  CPPUNIT_ASSERT_EQUAL(size, valuesFile.size());
+  for (size_t i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_EQUAL(valuesE[i], valuesFile[i]);
+  } // for
+
+  remove(filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead
+
+// ----------------------------------------------------------------------
+// Test read() with missing file and mismatched key.
+void
+pylith::utils::TestDBQueryCache::testReadMismatch(void)
+{ // testReadMismatch
+  PYLITH_METHOD_BEGIN;
+
+  const char* filename = "dbquerycache_mismatch.dat";
+  const std::string key = "db=test;values=a,b";
+  const scalar_array values(1.0, 4);
+
+  remove(filename);
+  scalar_array valuesFile;
+  CPPUNIT_ASSERT(!DBQueryCache::read(&valuesFile, filename, key));
+
+  DBQueryCache::write(filename, key, values);
+  CPPUNIT_ASSERT(!DBQueryCache::read(&valuesFile, filename, "db=test;values=a,c"));
+  CPPUNIT_ASSERT(!DBQueryCache::read(&valuesFile, filename, "db=test"));
+  CPPUNIT_ASSERT_EQUAL(size_t(0), valuesFile.size());
+
+  remove(filename);
+
+  PYLITH_METHOD_END;
+} // testReadMismatch
+
+
+// ----------------------------------------------------------------------
+// Test query().
+void
+pylith::utils::TestDBQueryCache::testQuery(void)
+{ // testQuery
+  PYLITH_METHOD_BEGIN;
+
+  const char* prefix = "dbquerycache_query";
+  const char* label = "material";
+  const char* queryName = "properties";
+  const std::string& filename = DBQueryCache::filename(prefix, label, queryName);
+  remove(filename.c_str());
+
+  const int numValues = 2;
+  const char* names[numValues] = { "density", "vs" };
+  const char* units[numValues] = { "kg/m**3", "m/s" };
+  const double dbValues[numValues] = { 2500.0, 3000.0 };
+  spatialdata::spatialdb::UniformDB db("test db");
+  db.setData(names, units, dbValues, numValues);
+  db.open();
+  db.queryVals(names, numValues);
+
+  const int spaceDim = 2;
+  const PylithScalar pointsE[] = {
+    1.0, 2.0,
+    3.0, 4.0,
+    5.0, 6.0,
+  };
+  const size_t numPoints = sizeof(pointsE) / sizeof(PylithScalar) / spaceDim;
+  const scalar_array points(pointsE, numPoints*spaceDim);
+  int_array order(numPoints);
+  for (size_t i=0; i < numPoints; ++i) {
+    order[i] = numPoints-1-i;
+  } // for
+
+  // Database without fingerprint is not cached.
+  scalar_array values;
+  DBQueryCache::query(&values, &db, names, numValues, points, &order, spaceDim, 0,
+		      prefix, "", label, queryName, "test values", "test");
+  CPPUNIT_ASSERT_EQUAL(numPoints*numValues, values.size());
+  for (size_t iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int iValue=0; iValue < numValues; ++iValue) {
+      CPPUNIT_ASSERT_EQUAL(PylithScalar(dbValues[iValue]), values[iPoint*numValues+iValue]);
+    } // for
+  } // for
+  scalar_array valuesFile;
+  const std::string& key = DBQueryCache::key(db, "uniform", queryName, names, numValues, points, spaceDim);
+  CPPUNIT_ASSERT(!DBQueryCache::read(&valuesFile, filename.c_str(), key));
+
+  // Query with fingerprint writes cache file.
+  DBQueryCache::query(&values, &db, names, numValues, points, NULL, spaceDim, 0,
+		      prefix, "uniform", label, queryName, "test values", "test");
+  CPPUNIT_ASSERT(DBQueryCache::read(&valuesFile, filename.c_str(), key));
+  CPPUNIT_ASSERT_EQUAL(values.size(), valuesFile.size());
+  for (size_t i=0; i < values.size(); ++i) {
+    CPPUNIT_ASSERT_EQUAL(values[i], valuesFile[i]);
+  } // for
+
+  // Query with matching key uses values from cache file.
+  const scalar_array valuesCache(-1.0, numPoints*numValues);
+  DBQueryCache::write(filename.c_str(), key, valuesCache);
+  DBQueryCache::query(&values, &db, names, numValues, points, NULL, spaceDim, 0,
+		      prefix, "uniform", label, queryName, "test values", "test");
+  for (size_t i=0; i < values.size(); ++i) {
+    CPPUNIT_ASSERT_EQUAL(valuesCache[i], values[i]);
+  } // for
+
+  // Query with different fingerprint ignores cache file.
+  DBQueryCache::query(&values, &db, names, numValues, points, NULL, spaceDim, 0,
+		      prefix, "uniform changed", label, queryName, "test values", "test");
+  for (size_t iPoint=0; iPoint < numPoints; ++iPoint) {
+    for (int iValue=0; iValue < numValues; ++iValue) {
+      CPPUNIT_ASSERT_EQUAL(PylithScalar(dbValues[iValue]), values[iPoint*numValues+iValue]);
+    } // for
+  } // for
+
+  db.close();
+  remove(filename.c_str());
+
+  PYLITH_METHOD_END;
+} // testQuery
+
+
+// End of file 
@@ -0,0 +1,78 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+
+/**
+ * @file unittests/libtests/utils/TestDBQueryCache.hh
+ *
+ * @brief C++ TestDBQueryCache object
+ *
+ * C++ unit testing for DBQueryCache.
+ */
+
+#if !defined(pylith_utils_testdbquerycache_hh)
+#define pylith_utils_testdbquerycache_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace utils {
+    class TestDBQueryCache;
+  } // utils
+} // pylith
+
+/// C++ unit testing for DBQueryCache
+class pylith::utils::TestDBQueryCache : public CppUnit::TestFixture
+{ // class TestDBQueryCache
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestDBQueryCache );
+
+  CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testKey );
+  CPPUNIT_TEST( testWriteRead );
+  CPPUNIT_TEST( testReadMismatch );
+  CPPUNIT_TEST( testQuery );
+
+  CPPUNIT_TEST_SUITE_END();
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Test filename().
+  void testFilename(void);
+
+  /// Test key().
+  void testKey(void);
+
+  /// Test write() and read().
+  void testWriteRead(void);
+
+  /// Test read() with missing file and mismatched key.
+  void testReadMismatch(void);
+
+  /// Test query().
+  void testQuery(void);
+
+}; // class TestDBQueryCache
+
+#endif // pylith_utils_testdbquerycache_hh
+
+
+// End of file 
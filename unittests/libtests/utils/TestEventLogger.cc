@@ -261,4 +261,39 @@ pylith::utils::TestEventLogger::testStageLogging(void)
 } // testStageLogging
 
 
+// ----------------------------------------------------------------------
+// Test logFlops() and threadFlops().
+void
+pylith::utils::TestEventLogger::testLogFlops(void)
+{ // testLogFlops
+  PYLITH_METHOD_BEGIN;
+
+  const PetscLogDouble tolerance = 1.0e-6;
+
+  // Outside a parallel region, flops are logged directly with PETSc.
+  EventLogger::logFlops(10.0);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, EventLogger::threadFlops(), tolerance);
+
+#if defined(_OPENMP)
+  // Inside a parallel region, flops are accumulated per thread.
+  const int numThreads = 2;
+  PetscLogDouble flopsThreads = 0.0;
+  int numThreadsActive = 0;
+#pragma omp parallel num_threads(numThreads) reduction(+:flopsThreads,numThreadsActive)
+  { // parallel
+    EventLogger::logFlops(5.0);
+    EventLogger::logFlops(3.0);
+    flopsThreads += EventLogger::threadFlops();
+    numThreadsActive += 1;
+  } // parallel
+  if (numThreadsActive > 1) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(8.0*numThreadsActive, flopsThreads, tolerance);
+  } // if
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, EventLogger::threadFlops(), tolerance);
+#endif
+
+  PYLITH_METHOD_END;
+} // testLogFlops
+
+
 // End of file 
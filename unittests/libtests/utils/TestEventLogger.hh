@@ -52,6 +52,7 @@ class pylith::utils::TestEventLogger : public CppUnit::TestFixture
   CPPUNIT_TEST( testRegisterStage );
   CPPUNIT_TEST( testStageId );
   CPPUNIT_TEST( testStageLogging );
+  CPPUNIT_TEST( testLogFlops );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -85,6 +86,9 @@ public :
   /// Test stagePush() and stagePop().
   void testStageLogging(void);
 
+  /// Test logFlops() and threadFlops().
+  void testLogFlops(void);
+
 }; // class TestEventLogging
 
 #endif // pylith_utils_testeventlogger_hh
@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/utils/TestDBFingerprint.py
+
+## @brief Unit testing of dbFingerprint().
+
+import unittest
+
+
+# ----------------------------------------------------------------------
+class TestDBFingerprint(unittest.TestCase):
+  """
+  Unit testing of dbFingerprint().
+  """
+
+
+  def test_uniformdb(self):
+    """
+    Test dbFingerprint() with UniformDB.
+    """
+    from pylith.utils.dbfingerprint import dbFingerprint
+    from spatialdata.spatialdb.UniformDB import UniformDB
+    db = UniformDB()
+    db.inventory.label = "uniform"
+    db.inventory.values = ["density", "vs"]
+    db.inventory.data = ["2500.0*kg/m**3", "3.0*km/s"]
+    db._configure()
+    fingerprint = dbFingerprint(db)
+    self.assertNotEqual("", fingerprint)
+    self.assertEqual(fingerprint, dbFingerprint(db))
+
+    db.inventory.data = ["2500.0*kg/m**3", "3.5*km/s"]
+    self.assertNotEqual(fingerprint, dbFingerprint(db))
+    return
+
+
+  def test_simpledb(self):
+    """
+    Test dbFingerprint() with SimpleDB.
+    """
+    from pylith.utils.dbfingerprint import dbFingerprint
+    from spatialdata.spatialdb.SimpleIOAscii import SimpleIOAscii
+    from spatialdata.spatialdb.SimpleDB import SimpleDB
+
+    filename = "dbfingerprint.spatialdb"
+    self._writeDB(filename, 2500.0)
+
+    iohandler = SimpleIOAscii()
+    iohandler.inventory.filename = filename
+    iohandler._configure()
+    db = SimpleDB()
+    db.inventory.label = "simple"
+    db.inventory.iohandler = iohandler
+    db._configure()
+    fingerprint = dbFingerprint(db)
+    self.assertNotEqual("", fingerprint)
+    self.assertEqual(fingerprint, dbFingerprint(db))
+
+    # Fingerprint depends on query type.
+    db.inventory.queryType = "linear"
+    self.assertNotEqual(fingerprint, dbFingerprint(db))
+    db.inventory.queryType = "nearest"
+
+    # Fingerprint depends on file.
+    self._writeDB(filename, 2500.0, 3000.0)
+    self.assertNotEqual(fingerprint, dbFingerprint(db))
+
+    # Database without a file is not fingerprinted.
+    import os
+    os.remove(filename)
+    self.assertEqual("", dbFingerprint(db))
+    return
+
+
+  def test_unknown(self):
+    """
+    Test dbFingerprint() with object that is not a known spatial database.
+    """
+    from pylith.utils.dbfingerprint import dbFingerprint
+    from pylith.utils.NullComponent import NullComponent
+    self.assertEqual("", dbFingerprint(NullComponent()))
+    self.assertEqual("", dbFingerprint(None))
+    return
+
+
+  def _writeDB(self, filename, *densities):
+    """
+    Write SimpleDB file with density at points along the x axis.
+    """
+    fout = open(filename, "w")
+    fout.write("#SPATIAL.ascii 1\n"
+               "SimpleDB {\n"
+               "  num-values = 1\n"
+               "  value-names = density\n"
+               "  value-units = kg/m**3\n"
+               "  num-locs = %d\n"
+               "  data-dim = 1\n"
+               "  space-dim = 2\n"
+               "  cs-data = cartesian {\n"
+               "    to-meters = 1.0\n"
+               "    space-dim = 2\n"
+               "  }\n"
+               "}\n" % len(densities))
+    for i, density in enumerate(densities):
+      fout.write("%f 0.0 %f\n" % (float(i), density))
+    fout.close()
+    return
+
+
+# End of file
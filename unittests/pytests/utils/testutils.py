@@ -65,6 +65,9 @@ class TestApp(UnitTestApp):
         from TestConstants import TestConstants
         suite.addTest(unittest.makeSuite(TestConstants))
 
+        from TestDBFingerprint import TestDBFingerprint
+        suite.addTest(unittest.makeSuite(TestDBFingerprint))
+
         return suite
 
 